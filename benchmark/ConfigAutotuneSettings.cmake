@@ -93,6 +93,11 @@ KeyType;ValueType;BlockSize;ItemsPerThread;PartitionAllowed" PARENT_SCOPE)
     set(list_across "${TUNING_TYPES};int8_t;64;4 8 16;true false" PARENT_SCOPE)
     set(output_pattern_suffix "\
 @KeyType@_@ValueType@_@BlockSize@_@ItemsPerThread@_@PartitionAllowed@" PARENT_SCOPE)
+  elseif(file STREQUAL "benchmark_device_sort_thresholds")
+    set(list_across_names "KeyType;ValueType" PARENT_SCOPE)
+    set(list_across "\
+${TUNING_TYPES};rocprim::empty_type ${LIMITED_TUNING_TYPES}" PARENT_SCOPE)
+    set(output_pattern_suffix "@KeyType@_@ValueType@" PARENT_SCOPE)
   elseif(file STREQUAL "benchmark_device_transform")
     set(list_across_names "\
 DataType;BlockSize;" PARENT_SCOPE)
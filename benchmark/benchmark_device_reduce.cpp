@@ -45,6 +45,13 @@ const size_t DEFAULT_N = 1024 * 1024 * 128;
         REGISTER_BENCHMARK(benchmarks, size, seed, stream, instance); \
     }
 
+// Ranges that are not aligned for vector accesses
+#define CREATE_MISALIGNED_BENCHMARK(T, REDUCE_OP, OFFSET)                                      \
+    {                                                                                          \
+        const device_reduce_benchmark<T, REDUCE_OP, rocprim::default_config, OFFSET> instance; \
+        REGISTER_BENCHMARK(benchmarks, size, seed, stream, instance);                          \
+    }
+
 int main(int argc, char *argv[])
 {
     cli::Parser parser(argc, argv);
@@ -111,6 +118,10 @@ int main(int argc, char *argv[])
 
     CREATE_BENCHMARK(custom_float2, rocprim::plus<custom_float2>)
     CREATE_BENCHMARK(custom_double2, rocprim::plus<custom_double2>)
+
+    CREATE_MISALIGNED_BENCHMARK(int, rocprim::plus<int>, 1)
+    CREATE_MISALIGNED_BENCHMARK(float, rocprim::plus<float>, 1)
+    CREATE_MISALIGNED_BENCHMARK(uint8_t, rocprim::plus<uint8_t>, 3)
 #endif
 
     // Use manual timing
@@ -71,14 +71,17 @@ inline std::string config_name<rocprim::default_config>()
 
 template<typename T              = int,
          typename BinaryFunction = rocprim::plus<T>,
-         typename Config         = rocprim::default_config>
+         typename Config         = rocprim::default_config,
+         unsigned int Offset     = 0>
 struct device_reduce_benchmark : public config_autotune_interface
 {
     std::string name() const override
     {
         return bench_naming::format_name("{lvl:device,algo:reduce,key_type:"
                                          + std::string(Traits<T>::name())
-                                         + ",cfg:" + config_name<Config>() + "}");
+                                         + ",cfg:" + config_name<Config>()
+                                         + (Offset ? ",offset:" + std::to_string(Offset) : "")
+                                         + "}");
     }
 
     static constexpr unsigned int batch_size = 10;
@@ -94,13 +97,14 @@ struct device_reduce_benchmark : public config_autotune_interface
         std::vector<T> input
             = get_random_data<T>(size, random_range.first, random_range.second, seed.get_0());
 
+        // The input starts Offset items after an aligned allocation
         T * d_input;
         T * d_output;
-        HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&d_input), size * sizeof(T)));
+        HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&d_input), (size + Offset) * sizeof(T)));
         HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&d_output), sizeof(T)));
         HIP_CHECK(
             hipMemcpy(
-                d_input, input.data(),
+                d_input + Offset, input.data(),
                 size * sizeof(T),
                 hipMemcpyHostToDevice
                 )
@@ -114,7 +118,7 @@ struct device_reduce_benchmark : public config_autotune_interface
         HIP_CHECK(
             rocprim::reduce<Config>(
                 d_temp_storage, temp_storage_size_bytes,
-                d_input, d_output, T(), size,
+                d_input + Offset, d_output, T(), size,
                 reduce_op, stream
                 )
         );
@@ -127,7 +131,7 @@ struct device_reduce_benchmark : public config_autotune_interface
             HIP_CHECK(
                 rocprim::reduce<Config>(
                     d_temp_storage, temp_storage_size_bytes,
-                    d_input, d_output, T(), size,
+                    d_input + Offset, d_output, T(), size,
                     reduce_op, stream
                     )
             );
@@ -149,7 +153,7 @@ struct device_reduce_benchmark : public config_autotune_interface
                 HIP_CHECK(
                     rocprim::reduce<Config>(
                         d_temp_storage, temp_storage_size_bytes,
-                        d_input, d_output, T(), size,
+                        d_input + Offset, d_output, T(), size,
                         reduce_op, stream
                         )
                 );
@@ -49,6 +49,18 @@ const size_t DEFAULT_N = 1024 * 1024 * 32;
     CREATE_EXCL_INCL_BENCHMARK(false, T, SCAN_OP) \
     CREATE_EXCL_INCL_BENCHMARK(true, T, SCAN_OP)
 
+// Ranges that are not aligned for vector accesses
+#define CREATE_MISALIGNED_EXCL_INCL_BENCHMARK(EXCL, T, SCAN_OP, OFFSET)                            \
+    {                                                                                              \
+        const device_scan_benchmark<EXCL, T, SCAN_OP, false, rocprim::default_config, OFFSET>      \
+            instance;                                                                              \
+        REGISTER_BENCHMARK(benchmarks, size, seed, stream, instance);                              \
+    }
+
+#define CREATE_MISALIGNED_BENCHMARK(T, SCAN_OP, OFFSET)              \
+    CREATE_MISALIGNED_EXCL_INCL_BENCHMARK(false, T, SCAN_OP, OFFSET) \
+    CREATE_MISALIGNED_EXCL_INCL_BENCHMARK(true, T, SCAN_OP, OFFSET)
+
 int main(int argc, char* argv[])
 {
     cli::Parser parser(argc, argv);
@@ -114,6 +126,10 @@ int main(int argc, char* argv[])
     CREATE_BENCHMARK(int8_t, rocprim::plus<int8_t>)
     CREATE_BENCHMARK(uint8_t, rocprim::plus<uint8_t>)
     CREATE_BENCHMARK(rocprim::half, rocprim::plus<rocprim::half>)
+
+    CREATE_MISALIGNED_BENCHMARK(int, rocprim::plus<int>, 1)
+    CREATE_MISALIGNED_BENCHMARK(float, rocprim::plus<float>, 1)
+    CREATE_MISALIGNED_BENCHMARK(uint8_t, rocprim::plus<uint8_t>, 3)
 #endif
 
     // Use manual timing
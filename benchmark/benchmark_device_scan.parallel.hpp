@@ -59,7 +59,8 @@ template<bool Exclusive     = false,
          class T            = int,
          class ScanOp       = rocprim::plus<T>,
          bool Deterministic = false,
-         class Config       = rocprim::default_config>
+         class Config       = rocprim::default_config,
+         unsigned int Offset = 0>
 struct device_scan_benchmark : public config_autotune_interface
 {
     std::string name() const override
@@ -67,7 +68,8 @@ struct device_scan_benchmark : public config_autotune_interface
         using namespace std::string_literals;
         return bench_naming::format_name(
             "{lvl:device,algo:scan,exclusive:" + (Exclusive ? "true"s : "false"s) + ",value_type:"
-            + std::string(Traits<T>::name()) + ",cfg:" + config_name<Config>() + "}");
+            + std::string(Traits<T>::name()) + ",cfg:" + config_name<Config>()
+            + (Offset ? ",offset:" + std::to_string(Offset) : "") + "}");
     }
 
     template<bool excl = Exclusive>
@@ -155,10 +157,13 @@ struct device_scan_benchmark : public config_autotune_interface
         std::vector<T> input
             = get_random_data<T>(size, random_range.first, random_range.second, seed.get_0());
         T              initial_value = T(123);
-        T*             d_input;
-        T*             d_output;
-        HIP_CHECK(hipMalloc(&d_input, size * sizeof(T)));
-        HIP_CHECK(hipMalloc(&d_output, size * sizeof(T)));
+        // The ranges start Offset items after aligned allocations
+        T* d_input_allocation;
+        T* d_output_allocation;
+        HIP_CHECK(hipMalloc(&d_input_allocation, (size + Offset) * sizeof(T)));
+        HIP_CHECK(hipMalloc(&d_output_allocation, (size + Offset) * sizeof(T)));
+        T* d_input  = d_input_allocation + Offset;
+        T* d_output = d_output_allocation + Offset;
         HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
         HIP_CHECK(hipDeviceSynchronize());
 
@@ -230,8 +235,8 @@ struct device_scan_benchmark : public config_autotune_interface
         state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
         state.SetItemsProcessed(state.iterations() * batch_size * size);
 
-        HIP_CHECK(hipFree(d_input));
-        HIP_CHECK(hipFree(d_output));
+        HIP_CHECK(hipFree(d_input_allocation));
+        HIP_CHECK(hipFree(d_output_allocation));
         HIP_CHECK(hipFree(d_temp_storage));
     }
 };
@@ -0,0 +1,144 @@
+// MIT License
+//
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// CmdParser
+#include "cmdparser.hpp"
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// HIP API
+#include <hip/hip_runtime.h>
+
+#include "benchmark_device_sort_thresholds.parallel.hpp"
+#include "benchmark_utils.hpp"
+
+#include <string>
+
+#include <cstddef>
+
+#ifndef DEFAULT_N
+const size_t DEFAULT_N = 1024 * 1024 * 32;
+#endif
+
+#define CREATE_BENCHMARK(...)                                         \
+    {                                                                 \
+        const __VA_ARGS__ instance{};                                 \
+        REGISTER_BENCHMARK(benchmarks, size, seed, stream, instance); \
+    }
+
+#define CREATE_RADIX_SORT_BENCHMARK(Key, Value)                                                  \
+    CREATE_BENCHMARK(                                                                            \
+        device_radix_sort_thresholds_benchmark<Key, Value, radix_sort_single_sort_path<256, 4>>) \
+    CREATE_BENCHMARK(                                                                            \
+        device_radix_sort_thresholds_benchmark<Key, Value, radix_sort_merge_sort_path>)          \
+    CREATE_BENCHMARK(device_radix_sort_thresholds_benchmark<Key, Value, radix_sort_onesweep_path>)
+
+#define CREATE_PARTIAL_SORT_BENCHMARK(Key)                                 \
+    CREATE_BENCHMARK(device_partial_sort_thresholds_benchmark<Key, false>) \
+    CREATE_BENCHMARK(device_partial_sort_thresholds_benchmark<Key, true>)
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.set_optional<std::string>("name_format",
+                                     "name_format",
+                                     "human",
+                                     "either: json,human,txt");
+    parser.set_optional<std::string>("seed", "seed", "random", get_seed_message());
+#ifdef BENCHMARK_CONFIG_TUNING
+    // optionally run an evenly split subset of benchmarks, when making multiple program invocations
+    parser.set_optional<int>("parallel_instance",
+                             "parallel_instance",
+                             0,
+                             "parallel instance index");
+    parser.set_optional<int>("parallel_instances",
+                             "parallel_instances",
+                             1,
+                             "total parallel instances");
+#endif
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t size   = parser.get<size_t>("size");
+    const int    trials = parser.get<int>("trials");
+    bench_naming::set_format(parser.get<std::string>("name_format"));
+    const std::string  seed_type = parser.get<std::string>("seed");
+    const managed_seed seed(seed_type);
+
+    // HIP
+    hipStream_t stream = 0; // default
+
+    // Benchmark info
+    add_common_benchmark_info();
+    benchmark::AddCustomContext("size", std::to_string(size));
+    benchmark::AddCustomContext("seed", seed_type);
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks = {};
+#ifdef BENCHMARK_CONFIG_TUNING
+    const int parallel_instance  = parser.get<int>("parallel_instance");
+    const int parallel_instances = parser.get<int>("parallel_instances");
+    config_autotune_register::register_benchmark_subset(benchmarks,
+                                                        parallel_instance,
+                                                        parallel_instances,
+                                                        size,
+                                                        seed,
+                                                        stream);
+#else // BENCHMARK_CONFIG_TUNING
+    using rocprim::empty_type;
+    CREATE_RADIX_SORT_BENCHMARK(int, empty_type)
+    CREATE_RADIX_SORT_BENCHMARK(long long, empty_type)
+    CREATE_RADIX_SORT_BENCHMARK(short, empty_type)
+    CREATE_RADIX_SORT_BENCHMARK(int8_t, empty_type)
+    CREATE_RADIX_SORT_BENCHMARK(int, float)
+    CREATE_RADIX_SORT_BENCHMARK(long long, double)
+
+    CREATE_PARTIAL_SORT_BENCHMARK(int)
+    CREATE_PARTIAL_SORT_BENCHMARK(long long)
+    CREATE_PARTIAL_SORT_BENCHMARK(short)
+    CREATE_PARTIAL_SORT_BENCHMARK(int8_t)
+#endif // BENCHMARK_CONFIG_TUNING
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
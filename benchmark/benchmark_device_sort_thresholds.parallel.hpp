@@ -0,0 +1,487 @@
+// MIT License
+//
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef ROCPRIM_BENCHMARK_DEVICE_SORT_THRESHOLDS_PARALLEL_HPP_
+#define ROCPRIM_BENCHMARK_DEVICE_SORT_THRESHOLDS_PARALLEL_HPP_
+
+#include "benchmark_utils.hpp"
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// HIP API
+#include <hip/hip_runtime.h>
+
+// rocPRIM
+#include <rocprim/device/device_partial_sort.hpp>
+#include <rocprim/device/device_radix_sort.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+// The benchmarks in this file measure each algorithm that device-level radix sort and partial sort
+// select between. When run with multiple sizes, the autotuning script finds the sizes where the
+// fastest algorithm changes and generates the thresholds from them.
+
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+struct radix_sort_single_sort_path
+{
+    static std::string name()
+    {
+        return "{path:single_sort,bs:" + std::to_string(BlockSize)
+               + ",ipt:" + std::to_string(ItemsPerThread) + "}";
+    }
+
+    static bool supports(size_t size)
+    {
+        return size <= BlockSize * ItemsPerThread;
+    }
+
+    template<typename Key, typename Value>
+    static hipError_t sort(void*       temporary_storage,
+                           size_t&     storage_size,
+                           Key*        keys_input,
+                           Key*        keys_output,
+                           Value*      values_input,
+                           Value*      values_output,
+                           size_t      size,
+                           hipStream_t stream)
+    {
+        if(temporary_storage == nullptr)
+        {
+            storage_size = 1;
+            return hipSuccess;
+        }
+        unsigned int items_per_block;
+        return rocprim::detail::radix_sort_block_sort<
+            rocprim::kernel_config<BlockSize, ItemsPerThread>,
+            false>(keys_input,
+                   keys_output,
+                   values_input,
+                   values_output,
+                   static_cast<unsigned int>(size),
+                   items_per_block,
+                   rocprim::identity_decomposer{},
+                   0,
+                   sizeof(Key) * 8,
+                   stream,
+                   false);
+    }
+};
+
+struct radix_sort_merge_sort_path
+{
+    static std::string name()
+    {
+        return "{path:merge_sort}";
+    }
+
+    static bool supports(size_t size)
+    {
+        return size <= std::numeric_limits<unsigned int>::max();
+    }
+
+    template<typename Key, typename Value>
+    static hipError_t sort(void*       temporary_storage,
+                           size_t&     storage_size,
+                           Key*        keys_input,
+                           Key*        keys_output,
+                           Value*      values_input,
+                           Value*      values_output,
+                           size_t      size,
+                           hipStream_t stream)
+    {
+        return rocprim::detail::radix_sort_merge_impl<rocprim::default_config, false>(
+            temporary_storage,
+            storage_size,
+            keys_input,
+            static_cast<Key*>(nullptr),
+            keys_output,
+            values_input,
+            static_cast<Value*>(nullptr),
+            values_output,
+            static_cast<unsigned int>(size),
+            rocprim::identity_decomposer{},
+            0,
+            sizeof(Key) * 8,
+            stream,
+            false);
+    }
+};
+
+struct radix_sort_onesweep_path
+{
+    static std::string name()
+    {
+        return "{path:onesweep}";
+    }
+
+    static bool supports(size_t /*size*/)
+    {
+        return true;
+    }
+
+    template<typename Key, typename Value>
+    static hipError_t sort(void*       temporary_storage,
+                           size_t&     storage_size,
+                           Key*        keys_input,
+                           Key*        keys_output,
+                           Value*      values_input,
+                           Value*      values_output,
+                           size_t      size,
+                           hipStream_t stream)
+    {
+        bool is_result_in_output;
+        return rocprim::detail::radix_sort_onesweep_impl<rocprim::default_config, false>(
+            temporary_storage,
+            storage_size,
+            keys_input,
+            static_cast<Key*>(nullptr),
+            keys_output,
+            values_input,
+            static_cast<Value*>(nullptr),
+            values_output,
+            size,
+            is_result_in_output,
+            rocprim::identity_decomposer{},
+            0,
+            sizeof(Key) * 8,
+            stream,
+            false);
+    }
+};
+
+template<typename Key, typename Value, typename Path>
+struct device_radix_sort_thresholds_benchmark : public config_autotune_interface
+{
+    std::string name() const override
+    {
+        return bench_naming::format_name("{lvl:device,algo:radix_sort_thresholds,key_type:"
+                                         + std::string(Traits<Key>::name())
+                                         + ",value_type:" + std::string(Traits<Value>::name())
+                                         + ",cfg:" + Path::name() + "}");
+    }
+
+    static constexpr unsigned int batch_size  = 10;
+    static constexpr unsigned int warmup_size = 5;
+
+    void run(benchmark::State&   state,
+             size_t              size,
+             const managed_seed& seed,
+             hipStream_t         stream) const override
+    {
+        using key_type   = Key;
+        using value_type = Value;
+
+        if(!Path::supports(size))
+        {
+            state.SkipWithError("SKIPPING: the algorithm does not support this size");
+            return;
+        }
+
+        // Generate data, the values are only moved so their contents are irrelevant
+        std::vector<key_type> keys_input
+            = get_random_data<key_type>(size,
+                                        generate_limits<key_type>::min(),
+                                        generate_limits<key_type>::max(),
+                                        seed.get_0());
+
+        key_type*   d_keys_input;
+        key_type*   d_keys_output;
+        value_type* d_values_input;
+        value_type* d_values_output;
+        HIP_CHECK(hipMalloc(&d_keys_input, size * sizeof(*d_keys_input)));
+        HIP_CHECK(hipMalloc(&d_keys_output, size * sizeof(*d_keys_output)));
+        HIP_CHECK(hipMalloc(&d_values_input, size * sizeof(*d_values_input)));
+        HIP_CHECK(hipMalloc(&d_values_output, size * sizeof(*d_values_output)));
+        HIP_CHECK(hipMemcpy(d_keys_input,
+                            keys_input.data(),
+                            size * sizeof(*d_keys_input),
+                            hipMemcpyHostToDevice));
+
+        void*  d_temporary_storage     = nullptr;
+        size_t temporary_storage_bytes = 0;
+        HIP_CHECK(Path::sort(d_temporary_storage,
+                             temporary_storage_bytes,
+                             d_keys_input,
+                             d_keys_output,
+                             d_values_input,
+                             d_values_output,
+                             size,
+                             stream));
+
+        HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+        // Warm-up
+        for(size_t i = 0; i < warmup_size; i++)
+        {
+            HIP_CHECK(Path::sort(d_temporary_storage,
+                                 temporary_storage_bytes,
+                                 d_keys_input,
+                                 d_keys_output,
+                                 d_values_input,
+                                 d_values_output,
+                                 size,
+                                 stream));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        // HIP events creation
+        hipEvent_t start, stop;
+        HIP_CHECK(hipEventCreate(&start));
+        HIP_CHECK(hipEventCreate(&stop));
+
+        for(auto _ : state)
+        {
+            // Record start event
+            HIP_CHECK(hipEventRecord(start, stream));
+
+            for(size_t i = 0; i < batch_size; i++)
+            {
+                HIP_CHECK(Path::sort(d_temporary_storage,
+                                     temporary_storage_bytes,
+                                     d_keys_input,
+                                     d_keys_output,
+                                     d_values_input,
+                                     d_values_output,
+                                     size,
+                                     stream));
+            }
+
+            // Record stop event and wait until it completes
+            HIP_CHECK(hipEventRecord(stop, stream));
+            HIP_CHECK(hipEventSynchronize(stop));
+
+            float elapsed_mseconds;
+            HIP_CHECK(hipEventElapsedTime(&elapsed_mseconds, start, stop));
+            state.SetIterationTime(elapsed_mseconds / 1000);
+        }
+
+        // Destroy HIP events
+        HIP_CHECK(hipEventDestroy(start));
+        HIP_CHECK(hipEventDestroy(stop));
+
+        state.SetBytesProcessed(state.iterations() * batch_size * size
+                                * (sizeof(key_type) + sizeof(value_type)));
+        state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+        HIP_CHECK(hipFree(d_temporary_storage));
+        HIP_CHECK(hipFree(d_keys_input));
+        HIP_CHECK(hipFree(d_keys_output));
+        HIP_CHECK(hipFree(d_values_input));
+        HIP_CHECK(hipFree(d_values_output));
+    }
+};
+
+// Compares sorting the whole input with selecting the sorted range with nth element first. The
+// number of sorted items is small, which is the case where nth element is the most beneficial.
+template<typename Key, bool SortAll>
+struct device_partial_sort_thresholds_benchmark : public config_autotune_interface
+{
+    using config = rocprim::partial_sort_config<rocprim::default_config,
+                                                rocprim::default_config,
+                                                SortAll ? std::numeric_limits<size_t>::max() : 0>;
+
+    std::string name() const override
+    {
+        using namespace std::string_literals;
+        return bench_naming::format_name(
+            "{lvl:device,algo:partial_sort_thresholds,key_type:" + std::string(Traits<Key>::name())
+            + ",cfg:{path:" + (SortAll ? "sort"s : "nth_element"s) + "}}");
+    }
+
+    static constexpr unsigned int batch_size  = 10;
+    static constexpr unsigned int warmup_size = 5;
+
+    void run(benchmark::State&   state,
+             size_t              size,
+             const managed_seed& seed,
+             hipStream_t         stream) const override
+    {
+        using key_type = Key;
+
+        const size_t middle = std::min(size_t{10}, size / 2);
+
+        // Generate data
+        std::vector<key_type> keys_input
+            = get_random_data<key_type>(size,
+                                        generate_limits<key_type>::min(),
+                                        generate_limits<key_type>::max(),
+                                        seed.get_0());
+
+        key_type* d_keys_input;
+        key_type* d_keys_new_data;
+        HIP_CHECK(hipMalloc(&d_keys_input, size * sizeof(*d_keys_input)));
+        HIP_CHECK(hipMalloc(&d_keys_new_data, size * sizeof(*d_keys_new_data)));
+
+        HIP_CHECK(hipMemcpy(d_keys_new_data,
+                            keys_input.data(),
+                            size * sizeof(*d_keys_input),
+                            hipMemcpyHostToDevice));
+
+        rocprim::less<key_type> lesser_op;
+        void*                   d_temporary_storage     = nullptr;
+        size_t                  temporary_storage_bytes = 0;
+        HIP_CHECK(rocprim::partial_sort<config>(d_temporary_storage,
+                                                temporary_storage_bytes,
+                                                d_keys_input,
+                                                middle,
+                                                size,
+                                                lesser_op,
+                                                stream,
+                                                false));
+
+        HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+        // Warm-up
+        for(size_t i = 0; i < warmup_size; i++)
+        {
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                d_keys_new_data,
+                                size * sizeof(*d_keys_input),
+                                hipMemcpyDeviceToDevice));
+            HIP_CHECK(rocprim::partial_sort<config>(d_temporary_storage,
+                                                    temporary_storage_bytes,
+                                                    d_keys_input,
+                                                    middle,
+                                                    size,
+                                                    lesser_op,
+                                                    stream,
+                                                    false));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        // HIP events creation
+        hipEvent_t start, stop;
+        HIP_CHECK(hipEventCreate(&start));
+        HIP_CHECK(hipEventCreate(&stop));
+
+        for(auto _ : state)
+        {
+            float elapsed_mseconds = 0;
+            for(size_t i = 0; i < batch_size; i++)
+            {
+                HIP_CHECK(hipMemcpy(d_keys_input,
+                                    d_keys_new_data,
+                                    size * sizeof(*d_keys_input),
+                                    hipMemcpyDeviceToDevice));
+                // Record start event
+                HIP_CHECK(hipEventRecord(start, stream));
+                HIP_CHECK(rocprim::partial_sort<config>(d_temporary_storage,
+                                                        temporary_storage_bytes,
+                                                        d_keys_input,
+                                                        middle,
+                                                        size,
+                                                        lesser_op,
+                                                        stream,
+                                                        false));
+                // Record stop event and wait until it completes
+                HIP_CHECK(hipEventRecord(stop, stream));
+                HIP_CHECK(hipEventSynchronize(stop));
+                float elapsed_mseconds_current;
+                HIP_CHECK(hipEventElapsedTime(&elapsed_mseconds_current, start, stop));
+                elapsed_mseconds += elapsed_mseconds_current;
+            }
+
+            state.SetIterationTime(elapsed_mseconds / 1000);
+        }
+
+        // Destroy HIP events
+        HIP_CHECK(hipEventDestroy(start));
+        HIP_CHECK(hipEventDestroy(stop));
+
+        state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(*d_keys_input));
+        state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+        HIP_CHECK(hipFree(d_temporary_storage));
+        HIP_CHECK(hipFree(d_keys_input));
+        HIP_CHECK(hipFree(d_keys_new_data));
+    }
+};
+
+template<typename Key, typename Value = rocprim::empty_type>
+struct device_sort_thresholds_benchmark_generator
+{
+    template<typename Path>
+    static void create_radix_sort(std::vector<std::unique_ptr<config_autotune_interface>>& storage)
+    {
+        storage.emplace_back(
+            std::make_unique<device_radix_sort_thresholds_benchmark<Key, Value, Path>>());
+    }
+
+    template<unsigned int BlockSize>
+    struct create_single_sort
+    {
+        template<unsigned int ItemsPerThreadLog2>
+        struct create_ipt
+        {
+            void operator()(std::vector<std::unique_ptr<config_autotune_interface>>& storage)
+            {
+                create_radix_sort<
+                    radix_sort_single_sort_path<BlockSize, 1u << ItemsPerThreadLog2>>(storage);
+            }
+        };
+
+        void operator()(std::vector<std::unique_ptr<config_autotune_interface>>& storage)
+        {
+            // Very large block sizes don't work with large items_per_blocks since
+            // shared memory is limited
+            static constexpr unsigned int max_shared_memory = TUNING_SHARED_MEMORY_MAX - 2000;
+            static constexpr unsigned int max_size_per_element
+                = std::max(sizeof(Key), sizeof(Value));
+            static constexpr unsigned int max_items_per_thread = std::max(
+                1u,
+                std::min(32u, max_shared_memory / (BlockSize * max_size_per_element)));
+
+            // The single sort only launches a single block, so only the power-of-two items per
+            // thread are measured to limit the number of benchmarks.
+            static constexpr unsigned int max_items_per_thread_log2
+                = rocprim::Log2<max_items_per_thread + 1>::VALUE - 1;
+            static_for_each<make_index_range<unsigned int, 0, max_items_per_thread_log2>,
+                            create_ipt>(storage);
+        }
+    };
+
+    static void create(std::vector<std::unique_ptr<config_autotune_interface>>& storage)
+    {
+        static_for_each<std::integer_sequence<unsigned int, 64, 128, 256, 512, 1024>,
+                        create_single_sort>(storage);
+        create_radix_sort<radix_sort_merge_sort_path>(storage);
+        create_radix_sort<radix_sort_onesweep_path>(storage);
+
+        // Partial sort only sorts keys
+        if(std::is_same<Value, rocprim::empty_type>::value)
+        {
+            storage.emplace_back(
+                std::make_unique<device_partial_sort_thresholds_benchmark<Key, false>>());
+            storage.emplace_back(
+                std::make_unique<device_partial_sort_thresholds_benchmark<Key, true>>());
+        }
+    }
+};
+
+#endif // ROCPRIM_BENCHMARK_DEVICE_SORT_THRESHOLDS_PARALLEL_HPP_
@@ -53,6 +53,13 @@ const size_t DEFAULT_N = 1024 * 1024 * 128;
         REGISTER_BENCHMARK(benchmarks, size, seed, stream, instance); \
     }
 
+// Ranges that are not aligned for vector accesses
+#define CREATE_MISALIGNED_BENCHMARK(T, OFFSET)                                           \
+    {                                                                                    \
+        const device_transform_benchmark<T, rocprim::default_config, OFFSET> instance{}; \
+        REGISTER_BENCHMARK(benchmarks, size, seed, stream, instance);                    \
+    }
+
 int main(int argc, char *argv[])
 {
     cli::Parser parser(argc, argv);
@@ -118,6 +125,11 @@ int main(int argc, char *argv[])
 
     CREATE_BENCHMARK(custom_float2)
     CREATE_BENCHMARK(custom_double2)
+
+    CREATE_MISALIGNED_BENCHMARK(int, 1)
+    CREATE_MISALIGNED_BENCHMARK(uint8_t, 1)
+    CREATE_MISALIGNED_BENCHMARK(uint8_t, 3)
+    CREATE_MISALIGNED_BENCHMARK(rocprim::half, 1)
 #endif // BENCHMARK_CONFIG_TUNING
 
     // Use manual timing
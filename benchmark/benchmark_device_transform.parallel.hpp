@@ -53,7 +53,7 @@ inline std::string transform_config_name<rocprim::default_config>()
     return "default_config";
 }
 
-template<typename T = int, typename Config = rocprim::default_config>
+template<typename T = int, typename Config = rocprim::default_config, unsigned int Offset = 0>
 struct device_transform_benchmark : public config_autotune_interface
 {
 
@@ -63,7 +63,9 @@ struct device_transform_benchmark : public config_autotune_interface
         using namespace std::string_literals;
         return bench_naming::format_name("{lvl:device,algo:transform,value_type:"
                                          + std::string(Traits<T>::name())
-                                         + ",cfg:" + transform_config_name<Config>() + "}");
+                                         + ",cfg:" + transform_config_name<Config>()
+                                         + (Offset ? ",offset:" + std::to_string(Offset) : "")
+                                         + "}");
     }
 
     static constexpr unsigned int batch_size  = 10;
@@ -83,21 +85,22 @@ struct device_transform_benchmark : public config_autotune_interface
         const std::vector<T> input
             = get_random_data<T>(size, random_range.first, random_range.second, seed.get_0());
 
+        // The ranges start Offset items after aligned allocations
         T*           d_input;
         output_type* d_output = nullptr;
-        HIP_CHECK(hipMalloc(&d_input, input.size() * sizeof(input[0])));
-        HIP_CHECK(hipMemcpy(d_input,
+        HIP_CHECK(hipMalloc(&d_input, (input.size() + Offset) * sizeof(input[0])));
+        HIP_CHECK(hipMemcpy(d_input + Offset,
                             input.data(),
                             input.size() * sizeof(input[0]),
                             hipMemcpyHostToDevice));
 
-        HIP_CHECK(hipMalloc(&d_output, size * sizeof(output_type)));
+        HIP_CHECK(hipMalloc(&d_output, (size + Offset) * sizeof(output_type)));
 
         const auto launch = [&]
         {
             auto transform_op = [](T v) { return v + T(5); };
-            return rocprim::transform<Config>(d_input,
-                                              d_output,
+            return rocprim::transform<Config>(d_input + Offset,
+                                              d_output + Offset,
                                               size,
                                               transform_op,
                                               stream,
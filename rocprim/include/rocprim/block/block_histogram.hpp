@@ -31,6 +31,7 @@
 
 #include "detail/block_histogram_atomic.hpp"
 #include "detail/block_histogram_sort.hpp"
+#include "detail/block_histogram_warp_aggregated.hpp"
 
 /// \addtogroup blockmodule
 /// @{
@@ -55,6 +56,17 @@ enum class block_histogram_algorithm
     /// * Performance is consistent regardless of sample bin distribution.
     using_sort,
 
+    /// Atomic additions are aggregated within a warp before updating bin counts:
+    /// lanes with equal bins are grouped using ballots and only one lane per distinct
+    /// bin performs the atomic addition. Warps are spread over several privatised
+    /// sub-histograms in shared memory, which are merged into the output at the end.
+    /// \par Performance Notes:
+    /// * Performance improves with skewed input distributions where many items of a warp
+    /// fall into the same few bins.
+    /// * Performance may decrease for uniform input distributions over many bins, as each
+    /// distinct bin of a warp requires a separate round of ballots.
+    using_warp_aggregated_atomic,
+
     /// \brief Default block_histogram algorithm.
     default_algorithm = using_atomic,
 };
@@ -81,6 +93,13 @@ struct select_block_histogram_impl<block_histogram_algorithm::using_sort>
     using type = block_histogram_sort<T, BlockSizeX, BlockSizeY, BlockSizeZ, ItemsPerThread, Bins>;
 };
 
+template<>
+struct select_block_histogram_impl<block_histogram_algorithm::using_warp_aggregated_atomic>
+{
+    template<class T, unsigned int BlockSizeX, unsigned int BlockSizeY, unsigned int BlockSizeZ, unsigned int ItemsPerThread, unsigned int Bins>
+    using type = block_histogram_warp_aggregated<T, BlockSizeX, BlockSizeY, BlockSizeZ, ItemsPerThread, Bins>;
+};
+
 } // end namespace detail
 
 /// \brief The block_histogram class is a block level parallel primitive which provides methods
@@ -93,8 +112,8 @@ struct select_block_histogram_impl<block_histogram_algorithm::using_sort>
 /// \tparam Algorithm - selected histogram algorithm, block_histogram_algorithm::default_algorithm by default.
 ///
 /// \par Overview
-/// * block_histogram has two alternative implementations: \p block_histogram_algorithm::using_atomic
-///   and \p block_histogram_algorithm::using_sort.
+/// * block_histogram has three alternative implementations: \p block_histogram_algorithm::using_atomic,
+///   \p block_histogram_algorithm::using_sort and \p block_histogram_algorithm::using_warp_aggregated_atomic.
 ///
 /// \par Examples
 /// \parblock
@@ -62,6 +62,10 @@ enum class block_load_method
     ///   * \p ItemsPerThread is odd.
     ///   * The datatype \p T is not a primitive or a HIP vector type (e.g. int2,
     /// int4, etc.
+    /// * The input can also be a \p cache_modified_input_iterator. The vectors are then
+    /// loaded with its cache modifier.
+    /// * The input can also be a \p zip_iterator of pointers and \p T a tuple. Every column
+    /// is then loaded with vector loads of its own type, and must be quad-item aligned.
     block_load_vectorize,
 
     /// A striped arrangement of data from continuous memory is locally transposed
@@ -530,6 +534,24 @@ public:
         block_load_direct_blocked_vectorized(flat_id, block_input, _items);
     }
 
+    template<cache_load_modifier Modifier>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(cache_modified_input_iterator<Modifier, T> block_input,
+              T (&items)[ItemsPerThread])
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        block_load_direct_blocked_vectorized(flat_id, block_input, items);
+    }
+
+    template<class... Types>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(zip_iterator<::rocprim::tuple<Types*...>> block_input,
+              T (&items)[ItemsPerThread])
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        block_load_direct_blocked_vectorized(flat_id, block_input, items);
+    }
+
     template<class InputIterator, class U>
     ROCPRIM_DEVICE ROCPRIM_INLINE
     void load(InputIterator block_input,
@@ -585,6 +607,26 @@ public:
         load(block_input, items);
     }
 
+    template<cache_load_modifier Modifier>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(cache_modified_input_iterator<Modifier, T> block_input,
+              T (&items)[ItemsPerThread],
+              storage_type& storage)
+    {
+        (void) storage;
+        load(block_input, items);
+    }
+
+    template<class... Types>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(zip_iterator<::rocprim::tuple<Types*...>> block_input,
+              T (&items)[ItemsPerThread],
+              storage_type& storage)
+    {
+        (void) storage;
+        load(block_input, items);
+    }
+
     template<class InputIterator, class U>
     ROCPRIM_DEVICE ROCPRIM_INLINE
     void load(InputIterator block_input,
@@ -0,0 +1,406 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_BLOCK_BLOCK_LOAD_2D_HPP_
+#define ROCPRIM_BLOCK_BLOCK_LOAD_2D_HPP_
+
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+
+#include "../intrinsics.hpp"
+#include "../functional.hpp"
+#include "../types.hpp"
+
+#include "block_exchange.hpp"
+#include "block_load.hpp"
+#include "block_load_func.hpp"
+#include "detail/block_load_store_2d.hpp"
+
+/// \addtogroup blockmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The \p block_load_2d class is a block level parallel primitive which provides methods
+/// for loading a tile of a row-major 2D range with a row pitch into an arrangement of items
+/// across the thread block.
+///
+/// \tparam T - the input/output type.
+/// \tparam BlockSizeX - the number of threads in a block's x dimension.
+/// \tparam RowsPerTile - the number of rows in a tile.
+/// \tparam ColsPerTile - the number of columns in a tile.
+/// \tparam Method - the method to load data.
+/// \tparam BlockSizeY - the number of threads in a block's y dimension, defaults to 1.
+/// \tparam BlockSizeZ - the number of threads in a block's z dimension, defaults to 1.
+///
+/// \par Overview
+/// * The tile is treated as a continuous range of <tt>RowsPerTile * ColsPerTile</tt> items
+///   in row-major order, which is loaded the same way \p block_load loads a continuous range.
+///   Each thread loads \p items_per_thread items.
+/// * Consecutive threads access consecutive items of a row, so loads are coalesced along rows.
+/// * The \p block_load_2d class supports the following methods:
+///   * \p block_load_method::block_load_direct
+///   * \p block_load_method::block_load_striped
+///   * \p block_load_method::block_load_vectorize - vector loads are used when the input is
+///     a pointer, \p ColsPerTile is a multiple of \p items_per_thread, and both the tile
+///     and the pitch are suitably aligned, which is checked at run time. Otherwise, it
+///     behaves as \p block_load_method::block_load_direct.
+///   * \p block_load_method::block_load_transpose - items are loaded in a striped arrangement
+///     and transposed into a blocked arrangement using \p block_exchange.
+/// * Partial tiles at the edges of the 2D range are supported by limiting the number of
+///   valid rows and columns of the tile.
+///
+/// \par Example:
+/// \parblock
+/// In the example a tile of 32 rows and 64 columns of a matrix of \p float with a row pitch
+/// of \p pitch items is loaded by a block of 256 threads, each thread receiving 8 items.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(const float* matrix, unsigned int pitch, ...)
+/// {
+///     using block_load_2d = rocprim::block_load_2d<float, 256, 32, 64,
+///                                                  rocprim::block_load_method::block_load_transpose>;
+///     __shared__ block_load_2d::storage_type storage;
+///
+///     const float* tile = matrix + blockIdx.y * 32 * pitch + blockIdx.x * 64;
+///     float items[block_load_2d::items_per_thread];
+///     block_load_2d().load(tile, pitch, items, storage);
+///     ...
+/// }
+/// \endcode
+/// \endparblock
+template<class T,
+         unsigned int      BlockSizeX,
+         unsigned int      RowsPerTile,
+         unsigned int      ColsPerTile,
+         block_load_method Method     = block_load_method::block_load_direct,
+         unsigned int      BlockSizeY = 1,
+         unsigned int      BlockSizeZ = 1>
+class block_load_2d
+{
+    static constexpr unsigned int BlockSize = BlockSizeX * BlockSizeY * BlockSizeZ;
+
+public:
+    /// \brief The number of items loaded by each thread.
+    static constexpr unsigned int items_per_thread = RowsPerTile * ColsPerTile / BlockSize;
+
+private:
+    static_assert((RowsPerTile * ColsPerTile) % BlockSize == 0,
+                  "The number of items in a tile must be a multiple of the block size");
+    static_assert(Method != block_load_method::block_load_warp_transpose,
+                  "block_load_2d does not support block_load_warp_transpose");
+
+    static constexpr bool transposed = Method == block_load_method::block_load_transpose;
+    static constexpr bool striped
+        = transposed || Method == block_load_method::block_load_striped;
+    // Distance between the tile indices of consecutive items of a thread
+    static constexpr unsigned int stride = striped ? BlockSize : 1;
+
+    using block_exchange_type = block_exchange<T, BlockSizeX, items_per_thread, BlockSizeY, BlockSizeZ>;
+
+    using storage_type_ =
+        typename std::conditional<transposed,
+                                  typename block_exchange_type::storage_type,
+                                  ::rocprim::detail::empty_storage_type>::type;
+
+    template<class InputIterator>
+    using use_vector_loads = std::integral_constant<
+        bool,
+        Method == block_load_method::block_load_vectorize && std::is_pointer<InputIterator>::value
+            && std::is_same<typename std::remove_cv<
+                                typename std::remove_pointer<InputIterator>::type>::type,
+                            T>::value
+            && ColsPerTile % items_per_thread == 0>;
+
+public:
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by related parallel primitive.
+    ///
+    /// Depending on the implemention the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords \p __shared__. It can be aliased to
+    /// an externally allocated memory, or be a part of a union with other storage types
+    /// to increase shared memory reusability.
+    using storage_type = storage_type_;
+
+    /// \brief Loads a tile of a 2D range into an arrangement of items across the thread block.
+    ///
+    /// \tparam InputIterator - [inferred] an iterator type for input (can be a simple
+    /// pointer.
+    ///
+    /// \param [in] tile - the input iterator pointing to the first item of the tile.
+    /// \param [in] pitch - the distance in items between the starts of consecutive rows.
+    /// \param [out] items - array that data is loaded to.
+    /// \param [in] storage - temporary storage for inputs.
+    ///
+    /// \par Overview
+    /// * The type \p T must be such that an object of type \p InputIterator
+    /// can be dereferenced and then implicitly converted to \p T.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(InputIterator tile,
+              unsigned int  pitch,
+              T (&items)[items_per_thread],
+              storage_type& storage)
+    {
+        using value_type = typename std::iterator_traits<InputIterator>::value_type;
+        static_assert(std::is_convertible<value_type, T>::value,
+                      "The type T must be such that an object of type InputIterator "
+                      "can be dereferenced and then implicitly converted to T.");
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        load_full(flat_id, tile, pitch, items, use_vector_loads<InputIterator>{});
+        exchange(items, storage, std::integral_constant<bool, transposed>{});
+    }
+
+    /// \brief Loads a tile of a 2D range into an arrangement of items across the thread block,
+    /// which is guarded by the number of valid rows and columns of the tile.
+    ///
+    /// \tparam InputIterator - [inferred] an iterator type for input (can be a simple
+    /// pointer.
+    ///
+    /// \param [in] tile - the input iterator pointing to the first item of the tile.
+    /// \param [in] pitch - the distance in items between the starts of consecutive rows.
+    /// \param [out] items - array that data is loaded to.
+    /// \param [in] valid_rows - the number of rows of the tile that can be loaded.
+    /// \param [in] valid_cols - the number of columns of the tile that can be loaded.
+    /// \param [in] storage - temporary storage for inputs.
+    ///
+    /// \par Overview
+    /// * The type \p T must be such that an object of type \p InputIterator
+    /// can be dereferenced and then implicitly converted to \p T.
+    /// * Items outside of the valid rows and columns are left unchanged.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(InputIterator tile,
+              unsigned int  pitch,
+              T (&items)[items_per_thread],
+              unsigned int  valid_rows,
+              unsigned int  valid_cols,
+              storage_type& storage)
+    {
+        using value_type = typename std::iterator_traits<InputIterator>::value_type;
+        static_assert(std::is_convertible<value_type, T>::value,
+                      "The type T must be such that an object of type InputIterator "
+                      "can be dereferenced and then implicitly converted to T.");
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        ::rocprim::detail::block_load_2d_direct<ColsPerTile, stride>(first_index(flat_id),
+                                                                     tile,
+                                                                     pitch,
+                                                                     items,
+                                                                     valid_rows,
+                                                                     valid_cols);
+        exchange(items, storage, std::integral_constant<bool, transposed>{});
+    }
+
+    /// \brief Loads a tile of a 2D range into an arrangement of items across the thread block,
+    /// which is guarded by the number of valid rows and columns of the tile, with a fall-back
+    /// value for out-of-bound items.
+    ///
+    /// \tparam InputIterator - [inferred] an iterator type for input (can be a simple
+    /// pointer.
+    /// \tparam Default - [inferred] The data type of the default value.
+    ///
+    /// \param [in] tile - the input iterator pointing to the first item of the tile.
+    /// \param [in] pitch - the distance in items between the starts of consecutive rows.
+    /// \param [out] items - array that data is loaded to.
+    /// \param [in] valid_rows - the number of rows of the tile that can be loaded.
+    /// \param [in] valid_cols - the number of columns of the tile that can be loaded.
+    /// \param [in] out_of_bounds - default value assigned to out-of-bound items.
+    /// \param [in] storage - temporary storage for inputs.
+    ///
+    /// \par Overview
+    /// * The type \p T must be such that an object of type \p InputIterator
+    /// can be dereferenced and then implicitly converted to \p T.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class InputIterator, class Default>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(InputIterator tile,
+              unsigned int  pitch,
+              T (&items)[items_per_thread],
+              unsigned int  valid_rows,
+              unsigned int  valid_cols,
+              Default       out_of_bounds,
+              storage_type& storage)
+    {
+        using value_type = typename std::iterator_traits<InputIterator>::value_type;
+        static_assert(std::is_convertible<value_type, T>::value,
+                      "The type T must be such that an object of type InputIterator "
+                      "can be dereferenced and then implicitly converted to T.");
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        ::rocprim::detail::block_load_2d_direct<ColsPerTile, stride>(first_index(flat_id),
+                                                                     tile,
+                                                                     pitch,
+                                                                     items,
+                                                                     valid_rows,
+                                                                     valid_cols,
+                                                                     out_of_bounds);
+        exchange(items, storage, std::integral_constant<bool, transposed>{});
+    }
+
+    /// \brief Loads a tile of a 2D range into an arrangement of items across the thread block.
+    ///
+    /// This overload allocates the temporary storage internally.
+    ///
+    /// \tparam InputIterator - [inferred] an iterator type for input (can be a simple
+    /// pointer.
+    ///
+    /// \param [in] tile - the input iterator pointing to the first item of the tile.
+    /// \param [in] pitch - the distance in items between the starts of consecutive rows.
+    /// \param [out] items - array that data is loaded to.
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(InputIterator tile,
+              unsigned int  pitch,
+              T (&items)[items_per_thread])
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        load(tile, pitch, items, storage);
+    }
+
+    /// \brief Loads a tile of a 2D range into an arrangement of items across the thread block,
+    /// which is guarded by the number of valid rows and columns of the tile.
+    ///
+    /// This overload allocates the temporary storage internally.
+    ///
+    /// \tparam InputIterator - [inferred] an iterator type for input (can be a simple
+    /// pointer.
+    ///
+    /// \param [in] tile - the input iterator pointing to the first item of the tile.
+    /// \param [in] pitch - the distance in items between the starts of consecutive rows.
+    /// \param [out] items - array that data is loaded to.
+    /// \param [in] valid_rows - the number of rows of the tile that can be loaded.
+    /// \param [in] valid_cols - the number of columns of the tile that can be loaded.
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(InputIterator tile,
+              unsigned int  pitch,
+              T (&items)[items_per_thread],
+              unsigned int  valid_rows,
+              unsigned int  valid_cols)
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        load(tile, pitch, items, valid_rows, valid_cols, storage);
+    }
+
+    /// \brief Loads a tile of a 2D range into an arrangement of items across the thread block,
+    /// which is guarded by the number of valid rows and columns of the tile, with a fall-back
+    /// value for out-of-bound items.
+    ///
+    /// This overload allocates the temporary storage internally.
+    ///
+    /// \tparam InputIterator - [inferred] an iterator type for input (can be a simple
+    /// pointer.
+    /// \tparam Default - [inferred] The data type of the default value.
+    ///
+    /// \param [in] tile - the input iterator pointing to the first item of the tile.
+    /// \param [in] pitch - the distance in items between the starts of consecutive rows.
+    /// \param [out] items - array that data is loaded to.
+    /// \param [in] valid_rows - the number of rows of the tile that can be loaded.
+    /// \param [in] valid_cols - the number of columns of the tile that can be loaded.
+    /// \param [in] out_of_bounds - default value assigned to out-of-bound items.
+    template<class InputIterator, class Default>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(InputIterator tile,
+              unsigned int  pitch,
+              T (&items)[items_per_thread],
+              unsigned int  valid_rows,
+              unsigned int  valid_cols,
+              Default       out_of_bounds)
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        load(tile, pitch, items, valid_rows, valid_cols, out_of_bounds, storage);
+    }
+
+private:
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static unsigned int first_index(const unsigned int flat_id)
+    {
+        return striped ? flat_id : flat_id * items_per_thread;
+    }
+
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load_full(const unsigned int flat_id,
+                   InputIterator      tile,
+                   const unsigned int pitch,
+                   T (&items)[items_per_thread],
+                   std::false_type /* use_vector_loads */)
+    {
+        ::rocprim::detail::block_load_2d_direct<ColsPerTile, stride>(first_index(flat_id),
+                                                                     tile,
+                                                                     pitch,
+                                                                     items);
+    }
+
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load_full(const unsigned int flat_id,
+                   InputIterator      tile,
+                   const unsigned int pitch,
+                   T (&items)[items_per_thread],
+                   std::true_type /* use_vector_loads */)
+    {
+        if(::rocprim::detail::is_tile_2d_vector_aligned<T, items_per_thread>(tile, pitch))
+        {
+            // All items of the thread are in the same row
+            const size_t offset
+                = ::rocprim::detail::tile_2d_offset<ColsPerTile>(first_index(flat_id), pitch);
+            block_load_direct_blocked_vectorized(0, tile + offset, items);
+        }
+        else
+        {
+            load_full(flat_id, tile, pitch, items, std::false_type{});
+        }
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void exchange(T (&items)[items_per_thread], storage_type& storage, std::true_type /* transposed */)
+    {
+        block_exchange_type().striped_to_blocked(items, items, storage);
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void exchange(T (&items)[items_per_thread], storage_type& storage, std::false_type /* transposed */)
+    {
+        (void)items;
+        (void)storage;
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group blockmodule
+
+#endif // ROCPRIM_BLOCK_BLOCK_LOAD_2D_HPP_
@@ -28,6 +28,13 @@
 #include "../functional.hpp"
 #include "../types.hpp"
 
+#include "../iterator/cache_modified_input_iterator.hpp"
+#include "../iterator/permutation_iterator.hpp"
+#include "../iterator/pitched_2d_iterator.hpp"
+#include "../iterator/strided_iterator.hpp"
+#include "../iterator/zip_iterator.hpp"
+#include "detail/block_load_store_vectorized.hpp"
+
 /// \addtogroup blockmodule
 /// @{
 
@@ -506,6 +513,800 @@ void block_load_direct_warp_striped(unsigned int flat_id,
     block_load_direct_warp_striped<WarpSize>(flat_id, block_input, items, valid);
 }
 
+namespace detail
+{
+
+// Gathers the values of a thread. The indices are loaded before, so the gathers of a thread
+// do not depend on each other and are issued together.
+template<class ValueIterator, class Index, class T, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void permutation_gather(ValueIterator values,
+                        const Index (&indices)[ItemsPerThread],
+                        T (&items)[ItemsPerThread])
+{
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        items[item] = values[indices[item]];
+    }
+}
+
+template<class ValueIterator, class T, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void permutation_load_consecutive(ValueIterator values,
+                                  T (&items)[ItemsPerThread],
+                                  std::false_type /* vectorized */)
+{
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        items[item] = values[item];
+    }
+}
+
+template<class V, class T, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void permutation_load_consecutive(V* values,
+                                  T (&items)[ItemsPerThread],
+                                  std::true_type /* vectorized */)
+{
+    using value_type  = typename std::remove_cv<V>::type;
+    using access      = vector_access<value_type, ItemsPerThread>;
+    using vector_type = typename access::vector_type;
+
+    if(!is_vector_aligned<value_type, ItemsPerThread>(values))
+    {
+        permutation_load_consecutive(values, items, std::false_type{});
+        return;
+    }
+
+    vector_type vectors[access::vectors_per_thread];
+    const vector_type* vector_ptr = reinterpret_cast<const vector_type*>(values);
+    ROCPRIM_UNROLL
+    for (unsigned int i = 0; i < access::vectors_per_thread; i++)
+    {
+        vectors[i] = vector_ptr[i];
+    }
+
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        items[item] = reinterpret_cast<const value_type*>(vectors)[item];
+    }
+}
+
+// Loads the values of a blocked arrangement
+template<class ValueIterator, class Index, class T, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void permutation_load_blocked(ValueIterator values,
+                              const Index (&indices)[ItemsPerThread],
+                              T (&items)[ItemsPerThread],
+                              std::false_type /* sorted indices */)
+{
+    permutation_gather(values, indices, items);
+}
+
+// Strictly increasing indices of a thread are consecutive iff the first and the last ones are
+// ItemsPerThread - 1 apart, then the values are loaded as a contiguous range.
+template<class ValueIterator, class Index, class T, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void permutation_load_blocked(ValueIterator values,
+                              const Index (&indices)[ItemsPerThread],
+                              T (&items)[ItemsPerThread],
+                              std::true_type /* sorted indices */)
+{
+    if(indices[ItemsPerThread - 1] - indices[0] == static_cast<Index>(ItemsPerThread - 1))
+    {
+        permutation_load_consecutive(values + indices[0],
+                                     items,
+                                     is_vector_accessible<ValueIterator, ItemsPerThread>{});
+    }
+    else
+    {
+        permutation_gather(values, indices, items);
+    }
+}
+
+} // end namespace detail
+
+/// \brief Gathers data through a permutation_iterator into a blocked arrangement of items
+/// across the thread block.
+///
+/// The indices of the thread are loaded with block_load_direct_blocked before all values are
+/// gathered. If the indices are sorted and the indices of the thread are consecutive, the
+/// values are loaded as a contiguous range (with vector loads when the value iterator is
+/// a suitably aligned pointer).
+///
+/// \tparam ValueIterator - [inferred] the value iterator of the permutation_iterator
+/// \tparam IndexIterator - [inferred] the index iterator of the permutation_iterator
+/// \tparam SortedIndices - [inferred] whether the indices are strictly increasing
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from
+/// \param items - array that data is loaded to
+template<
+    class ValueIterator,
+    class IndexIterator,
+    bool SortedIndices,
+    class T,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_blocked(unsigned int flat_id,
+                               permutation_iterator<ValueIterator, IndexIterator, SortedIndices> block_input,
+                               T (&items)[ItemsPerThread])
+{
+    using index_type = typename std::iterator_traits<IndexIterator>::value_type;
+
+    index_type indices[ItemsPerThread];
+    block_load_direct_blocked(flat_id, block_input.index_iterator(), indices);
+
+    detail::permutation_load_blocked(block_input.value_iterator(),
+                                     indices,
+                                     items,
+                                     std::integral_constant<bool, SortedIndices>{});
+}
+
+/// \brief Gathers data through a permutation_iterator into a blocked arrangement of items
+/// across the thread block, which is guarded by range \p valid.
+///
+/// See the unguarded overload for permutation_iterator. The fast path for sorted indices
+/// is only used by threads whose items are all valid.
+///
+/// \tparam ValueIterator - [inferred] the value iterator of the permutation_iterator
+/// \tparam IndexIterator - [inferred] the index iterator of the permutation_iterator
+/// \tparam SortedIndices - [inferred] whether the indices are strictly increasing
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from
+/// \param items - array that data is loaded to
+/// \param valid - maximum range of valid numbers to load
+template<
+    class ValueIterator,
+    class IndexIterator,
+    bool SortedIndices,
+    class T,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_blocked(unsigned int flat_id,
+                               permutation_iterator<ValueIterator, IndexIterator, SortedIndices> block_input,
+                               T (&items)[ItemsPerThread],
+                               unsigned int valid)
+{
+    using index_type = typename std::iterator_traits<IndexIterator>::value_type;
+
+    const unsigned int offset = flat_id * ItemsPerThread;
+
+    index_type indices[ItemsPerThread];
+    block_load_direct_blocked(flat_id, block_input.index_iterator(), indices, valid);
+
+    if(offset + ItemsPerThread <= valid)
+    {
+        detail::permutation_load_blocked(block_input.value_iterator(),
+                                         indices,
+                                         items,
+                                         std::integral_constant<bool, SortedIndices>{});
+    }
+    else
+    {
+        ValueIterator values = block_input.value_iterator();
+        ROCPRIM_UNROLL
+        for (unsigned int item = 0; item < ItemsPerThread; item++)
+        {
+            if (item + offset < valid)
+            {
+                items[item] = values[indices[item]];
+            }
+        }
+    }
+}
+
+/// \brief Gathers data through a permutation_iterator into a striped arrangement of items
+/// across the thread block.
+///
+/// The indices are loaded with block_load_direct_striped, so that the loads of indices are
+/// coalesced, before all values of the thread are gathered.
+///
+/// \tparam BlockSize - the number of threads in a block
+/// \tparam ValueIterator - [inferred] the value iterator of the permutation_iterator
+/// \tparam IndexIterator - [inferred] the index iterator of the permutation_iterator
+/// \tparam SortedIndices - [inferred] whether the indices are strictly increasing
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from
+/// \param items - array that data is loaded to
+template<
+    unsigned int BlockSize,
+    class ValueIterator,
+    class IndexIterator,
+    bool SortedIndices,
+    class T,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_striped(unsigned int flat_id,
+                               permutation_iterator<ValueIterator, IndexIterator, SortedIndices> block_input,
+                               T (&items)[ItemsPerThread])
+{
+    using index_type = typename std::iterator_traits<IndexIterator>::value_type;
+
+    index_type indices[ItemsPerThread];
+    block_load_direct_striped<BlockSize>(flat_id, block_input.index_iterator(), indices);
+
+    detail::permutation_gather(block_input.value_iterator(), indices, items);
+}
+
+/// \brief Gathers data through a permutation_iterator into a striped arrangement of items
+/// across the thread block, which is guarded by range \p valid.
+///
+/// See the unguarded overload for permutation_iterator.
+///
+/// \tparam BlockSize - the number of threads in a block
+/// \tparam ValueIterator - [inferred] the value iterator of the permutation_iterator
+/// \tparam IndexIterator - [inferred] the index iterator of the permutation_iterator
+/// \tparam SortedIndices - [inferred] whether the indices are strictly increasing
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from
+/// \param items - array that data is loaded to
+/// \param valid - maximum range of valid numbers to load
+template<
+    unsigned int BlockSize,
+    class ValueIterator,
+    class IndexIterator,
+    bool SortedIndices,
+    class T,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_striped(unsigned int flat_id,
+                               permutation_iterator<ValueIterator, IndexIterator, SortedIndices> block_input,
+                               T (&items)[ItemsPerThread],
+                               unsigned int valid)
+{
+    using index_type = typename std::iterator_traits<IndexIterator>::value_type;
+
+    index_type indices[ItemsPerThread];
+    block_load_direct_striped<BlockSize>(flat_id, block_input.index_iterator(), indices, valid);
+
+    ValueIterator values = block_input.value_iterator();
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        if (flat_id + item * BlockSize < valid)
+        {
+            items[item] = values[indices[item]];
+        }
+    }
+}
+
+namespace detail
+{
+
+template<cache_load_modifier Modifier, class T, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void cache_modified_load_blocked_vectorized(unsigned int flat_id,
+                                            const T* block_input,
+                                            U (&items)[ItemsPerThread],
+                                            std::true_type /* vectorizable */)
+{
+    typedef typename detail::match_vector_type<T, ItemsPerThread>::type vector_type;
+    // The items of a thread are loaded with the widest words the vectors allow (up to 128 bits),
+    // so that a vector is not split into narrower accesses that each wait for their result.
+    using word = typename cache_modified_word<vector_type>::type;
+    constexpr unsigned int words_per_thread = (sizeof(T) * ItemsPerThread) / sizeof(word);
+    alignas(vector_type) word words[words_per_thread];
+
+    const word* word_ptr
+        = reinterpret_cast<const word*>(block_input) + (flat_id * words_per_thread);
+    cache_modified_load_words<Modifier>(word_ptr, words);
+
+    const T* raw_items = reinterpret_cast<const T*>(words);
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        items[item] = raw_items[item];
+    }
+}
+
+template<cache_load_modifier Modifier, class T, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void cache_modified_load_blocked_vectorized(unsigned int flat_id,
+                                            const T* block_input,
+                                            U (&items)[ItemsPerThread],
+                                            std::false_type /* vectorizable */)
+{
+    block_load_direct_blocked(flat_id,
+                              cache_modified_input_iterator<Modifier, T>(block_input),
+                              items);
+}
+
+} // end namespace detail
+
+/// \brief Loads data from continuous memory into a blocked arrangement of items
+/// across the thread block with the cache modifier of a cache_modified_input_iterator.
+///
+/// The vectors are loaded with the cache modifier, so the same conditions for vectorization
+/// as for block_load_direct_blocked_vectorized with a pointer apply.
+///
+/// \tparam Modifier - [inferred] the cache load modifier
+/// \tparam T - [inferred] the input data type
+/// \tparam U - [inferred] the output data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// The type \p T must be such that it can be implicitly converted to \p U.
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from
+/// \param items - array that data is loaded to
+template<
+    cache_load_modifier Modifier,
+    class T,
+    class U,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_blocked_vectorized(unsigned int flat_id,
+                                          cache_modified_input_iterator<Modifier, T> block_input,
+                                          U (&items)[ItemsPerThread])
+{
+    detail::cache_modified_load_blocked_vectorized<Modifier>(
+        flat_id,
+        block_input.base(),
+        items,
+        std::integral_constant<bool, detail::is_vectorizable<T, ItemsPerThread>::value>{});
+}
+
+namespace detail
+{
+
+// Loads one column of a zip_iterator of pointers into the member Index of the items
+template<size_t Index, class V, class T, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void zip_load_column_blocked_vectorized(unsigned int flat_id,
+                                        V* column,
+                                        T (&items)[ItemsPerThread])
+{
+    typename std::remove_cv<V>::type column_items[ItemsPerThread];
+    block_load_direct_blocked_vectorized(flat_id, column, column_items);
+
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        ::rocprim::get<Index>(items[item]) = column_items[item];
+    }
+}
+
+template<class... Types, class T, unsigned int ItemsPerThread, size_t... Indices>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void zip_load_blocked_vectorized(unsigned int flat_id,
+                                 const ::rocprim::tuple<Types*...>& columns,
+                                 T (&items)[ItemsPerThread],
+                                 ::rocprim::index_sequence<Indices...>)
+{
+    int swallow[] = {(zip_load_column_blocked_vectorized<Indices>(flat_id,
+                                                                  ::rocprim::get<Indices>(columns),
+                                                                  items),
+                      0)...};
+    (void)swallow;
+}
+
+} // end namespace detail
+
+/// \brief Loads data from continuous memory into a blocked arrangement of items
+/// across the thread block, loading every column of a zip_iterator of pointers with
+/// block_load_direct_blocked_vectorized.
+///
+/// Each column is loaded with vector loads of its own type into registers, so that
+/// a structure of arrays is loaded with the same bandwidth as its columns separately.
+/// The same conditions for vectorization as for a pointer apply to every column.
+///
+/// \tparam Types - [inferred] the types of the columns
+/// \tparam T - [inferred] the tuple type of the items
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from
+/// \param items - array that data is loaded to
+template<
+    class... Types,
+    class T,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_blocked_vectorized(unsigned int flat_id,
+                                          zip_iterator<::rocprim::tuple<Types*...>> block_input,
+                                          T (&items)[ItemsPerThread])
+{
+    detail::zip_load_blocked_vectorized(flat_id,
+                                        block_input.get_iterator_tuple(),
+                                        items,
+                                        ::rocprim::index_sequence_for<Types...>());
+}
+
+namespace detail
+{
+
+// The items of a thread in a blocked arrangement of a strided_iterator over a pointer span
+// (ItemsPerThread - 1) * Stride + 1 items. They are loaded with the vectors that fit in the span,
+// which pays off if a vector holds more than one item, and selected in registers.
+template<class T, unsigned int Stride, unsigned int ItemsPerThread>
+struct strided_vector_access
+{
+    static constexpr unsigned int span = (ItemsPerThread - 1) * Stride + 1;
+
+    using vector_type = typename match_vector_type<T, ItemsPerThread * Stride>::type;
+
+    static constexpr unsigned int items_per_vector = sizeof(vector_type) / sizeof(T);
+    static constexpr unsigned int vectors          = span / items_per_vector;
+
+    static constexpr bool value = Stride > 1 && items_per_vector > Stride && vectors > 0
+                                  && sizeof(vector_type) % sizeof(T) == 0
+                                  && std::is_trivially_copyable<T>::value;
+};
+
+template<class Iterator, unsigned int Stride, class T, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void strided_load_blocked(strided_iterator<Iterator, Stride> thread_input,
+                          T (&items)[ItemsPerThread],
+                          std::false_type /* vectorized */)
+{
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        items[item] = thread_input[item];
+    }
+}
+
+template<class V, unsigned int Stride, class T, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void strided_load_blocked(strided_iterator<V*, Stride> thread_input,
+                          T (&items)[ItemsPerThread],
+                          std::true_type /* vectorized */)
+{
+    using value_type  = typename std::remove_cv<V>::type;
+    using access      = strided_vector_access<value_type, Stride, ItemsPerThread>;
+    using vector_type = typename access::vector_type;
+
+    const value_type* ptr = thread_input.base();
+    if(reinterpret_cast<uintptr_t>(ptr) % alignof(vector_type) != 0)
+    {
+        strided_load_blocked(thread_input, items, std::false_type{});
+        return;
+    }
+
+    vector_type vectors[access::vectors];
+    const vector_type* vector_ptr = reinterpret_cast<const vector_type*>(ptr);
+    ROCPRIM_UNROLL
+    for (unsigned int i = 0; i < access::vectors; i++)
+    {
+        vectors[i] = vector_ptr[i];
+    }
+
+    const value_type* loaded = reinterpret_cast<const value_type*>(vectors);
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        const unsigned int index = item * Stride;
+        // The last items may not be covered by the vectors
+        items[item] = index < access::vectors * access::items_per_vector ? loaded[index]
+                                                                          : ptr[index];
+    }
+}
+
+// Position within the region of a pitched_2d_iterator, which is advanced without divisions
+template<class Difference>
+struct pitched_2d_position
+{
+    Difference   row_offset;
+    unsigned int column;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    pitched_2d_position(Difference index, unsigned int width, unsigned int pitch)
+        : row_offset((index / width) * pitch), column(static_cast<unsigned int>(index % width))
+    {
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    Difference offset() const
+    {
+        return row_offset + column;
+    }
+
+    // Advances by rows * width + columns items, columns must be less than width
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void advance(unsigned int rows, unsigned int columns, unsigned int width, unsigned int pitch)
+    {
+        row_offset += static_cast<Difference>(rows) * pitch;
+        column += columns;
+        if(column >= width)
+        {
+            column -= width;
+            row_offset += pitch;
+        }
+    }
+};
+
+} // end namespace detail
+
+/// \brief Loads data from a strided_iterator into a blocked arrangement of items
+/// across the thread block.
+///
+/// If the underlying iterator is a pointer and the stride is known at compile time and
+/// smaller than the number of items of a vector, the items of a thread are loaded with
+/// vector loads that cover them and selected in registers. This requires the items of
+/// the thread to be aligned for the vector loads, otherwise they are loaded one by one.
+///
+/// \tparam Iterator - [inferred] the underlying iterator of the strided_iterator
+/// \tparam Stride - [inferred] the compile-time stride of the strided_iterator, or zero
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from
+/// \param items - array that data is loaded to
+template<
+    class Iterator,
+    unsigned int Stride,
+    class T,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_blocked(unsigned int flat_id,
+                               strided_iterator<Iterator, Stride> block_input,
+                               T (&items)[ItemsPerThread])
+{
+    using value_type = typename std::iterator_traits<Iterator>::value_type;
+    using vectorized = std::integral_constant<
+        bool,
+        std::is_pointer<Iterator>::value
+            && detail::strided_vector_access<value_type, Stride, ItemsPerThread>::value>;
+
+    detail::strided_load_blocked(block_input + flat_id * ItemsPerThread, items, vectorized{});
+}
+
+/// \brief Loads data from a strided_iterator into a blocked arrangement of items
+/// across the thread block, which is guarded by range \p valid.
+///
+/// See the unguarded overload for strided_iterator. Wider loads are only used by threads
+/// whose items are all valid.
+///
+/// \tparam Iterator - [inferred] the underlying iterator of the strided_iterator
+/// \tparam Stride - [inferred] the compile-time stride of the strided_iterator, or zero
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from
+/// \param items - array that data is loaded to
+/// \param valid - maximum range of valid numbers to load
+template<
+    class Iterator,
+    unsigned int Stride,
+    class T,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_blocked(unsigned int flat_id,
+                               strided_iterator<Iterator, Stride> block_input,
+                               T (&items)[ItemsPerThread],
+                               unsigned int valid)
+{
+    const unsigned int offset = flat_id * ItemsPerThread;
+    if(offset + ItemsPerThread <= valid)
+    {
+        block_load_direct_blocked(flat_id, block_input, items);
+        return;
+    }
+
+    const strided_iterator<Iterator, Stride> thread_input = block_input + offset;
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        if (item + offset < valid)
+        {
+            items[item] = thread_input[item];
+        }
+    }
+}
+
+/// \brief Loads data from a pitched_2d_iterator into a blocked arrangement of items
+/// across the thread block.
+///
+/// The row and the column of the first item of the thread are computed once, the following
+/// items are found by walking along the rows.
+///
+/// \tparam Iterator - [inferred] the underlying iterator of the pitched_2d_iterator
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from
+/// \param items - array that data is loaded to
+template<
+    class Iterator,
+    class T,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_blocked(unsigned int flat_id,
+                               pitched_2d_iterator<Iterator> block_input,
+                               T (&items)[ItemsPerThread])
+{
+    using difference_type = typename pitched_2d_iterator<Iterator>::difference_type;
+
+    const unsigned int width = block_input.width();
+    const unsigned int pitch = block_input.pitch();
+    Iterator           input = block_input.base();
+
+    detail::pitched_2d_position<difference_type> position(
+        block_input.index() + flat_id * ItemsPerThread, width, pitch);
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        items[item] = input[position.offset()];
+        position.advance(0, 1, width, pitch);
+    }
+}
+
+/// \brief Loads data from a pitched_2d_iterator into a blocked arrangement of items
+/// across the thread block, which is guarded by range \p valid.
+///
+/// See the unguarded overload for pitched_2d_iterator.
+///
+/// \tparam Iterator - [inferred] the underlying iterator of the pitched_2d_iterator
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from
+/// \param items - array that data is loaded to
+/// \param valid - maximum range of valid numbers to load
+template<
+    class Iterator,
+    class T,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_blocked(unsigned int flat_id,
+                               pitched_2d_iterator<Iterator> block_input,
+                               T (&items)[ItemsPerThread],
+                               unsigned int valid)
+{
+    using difference_type = typename pitched_2d_iterator<Iterator>::difference_type;
+
+    const unsigned int width  = block_input.width();
+    const unsigned int pitch  = block_input.pitch();
+    const unsigned int offset = flat_id * ItemsPerThread;
+    Iterator           input  = block_input.base();
+
+    detail::pitched_2d_position<difference_type> position(block_input.index() + offset,
+                                                          width,
+                                                          pitch);
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        if (item + offset < valid)
+        {
+            items[item] = input[position.offset()];
+        }
+        position.advance(0, 1, width, pitch);
+    }
+}
+
+/// \brief Loads data from a pitched_2d_iterator into a striped arrangement of items
+/// across the thread block.
+///
+/// The row and the column of the first item of the thread are computed once, the following
+/// items are found by advancing them by \p BlockSize items.
+///
+/// \tparam BlockSize - the number of threads in a block
+/// \tparam Iterator - [inferred] the underlying iterator of the pitched_2d_iterator
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from
+/// \param items - array that data is loaded to
+template<
+    unsigned int BlockSize,
+    class Iterator,
+    class T,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_striped(unsigned int flat_id,
+                               pitched_2d_iterator<Iterator> block_input,
+                               T (&items)[ItemsPerThread])
+{
+    using difference_type = typename pitched_2d_iterator<Iterator>::difference_type;
+
+    const unsigned int width        = block_input.width();
+    const unsigned int pitch        = block_input.pitch();
+    const unsigned int step_rows    = BlockSize / width;
+    const unsigned int step_columns = BlockSize % width;
+    Iterator           input        = block_input.base();
+
+    detail::pitched_2d_position<difference_type> position(block_input.index() + flat_id,
+                                                          width,
+                                                          pitch);
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        items[item] = input[position.offset()];
+        position.advance(step_rows, step_columns, width, pitch);
+    }
+}
+
+/// \brief Loads data from a pitched_2d_iterator into a striped arrangement of items
+/// across the thread block, which is guarded by range \p valid.
+///
+/// See the unguarded overload for pitched_2d_iterator.
+///
+/// \tparam BlockSize - the number of threads in a block
+/// \tparam Iterator - [inferred] the underlying iterator of the pitched_2d_iterator
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from
+/// \param items - array that data is loaded to
+/// \param valid - maximum range of valid numbers to load
+template<
+    unsigned int BlockSize,
+    class Iterator,
+    class T,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_striped(unsigned int flat_id,
+                               pitched_2d_iterator<Iterator> block_input,
+                               T (&items)[ItemsPerThread],
+                               unsigned int valid)
+{
+    using difference_type = typename pitched_2d_iterator<Iterator>::difference_type;
+
+    const unsigned int width        = block_input.width();
+    const unsigned int pitch        = block_input.pitch();
+    const unsigned int step_rows    = BlockSize / width;
+    const unsigned int step_columns = BlockSize % width;
+    Iterator           input        = block_input.base();
+
+    detail::pitched_2d_position<difference_type> position(block_input.index() + flat_id,
+                                                          width,
+                                                          pitch);
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        if (flat_id + item * BlockSize < valid)
+        {
+            items[item] = input[position.offset()];
+        }
+        position.advance(step_rows, step_columns, width, pitch);
+    }
+}
+
 END_ROCPRIM_NAMESPACE
 
 /// @}
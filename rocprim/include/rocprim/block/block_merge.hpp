@@ -0,0 +1,527 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_BLOCK_BLOCK_MERGE_HPP_
+#define ROCPRIM_BLOCK_BLOCK_MERGE_HPP_
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+#include "../intrinsics.hpp"
+#include "../thread/thread_search.hpp"
+#include "../types.hpp"
+#include "../types/uninitialized_array.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+/// \addtogroup blockmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The \p block_merge class is a block level parallel primitive which provides methods
+/// for merging two sorted sequences of items partitioned across threads in a block.
+///
+/// \tparam Key - the key type.
+/// \tparam BlockSizeX - the number of threads in a block's x dimension.
+/// \tparam ItemsPerThread - the number of items contributed by each thread.
+/// \tparam Value - the value type. Default type empty_type indicates
+/// a keys-only merge.
+/// \tparam BlockSizeY - the number of threads in a block's y dimension, defaults to 1.
+/// \tparam BlockSizeZ - the number of threads in a block's z dimension, defaults to 1.
+///
+/// \par Overview
+/// * The merge is stable: keys that compare equal keep their relative order, and keys of the
+///   first sequence are placed before equal keys of the second sequence.
+/// * Every thread finds the start of its part of the output with a merge path search
+///   (\p merge_path_search) over the sequences in shared memory, and then merges
+///   \p ItemsPerThread items serially.
+/// * The output is in a blocked arrangement.
+/// * \p storage_type can be reused or be part of a union with the storage of other primitives,
+///   so a merge can be fused with other work in the same kernel.
+///
+/// \par Examples
+/// \parblock
+/// In the examples merge operation is performed on a block of 128 threads, using type
+/// \p int and 4 items per thread.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(...)
+/// {
+///     // specialize block_merge for int, block of 128 threads and 4 items per thread
+///     using block_merge_int = rocprim::block_merge<int, 128, 4>;
+///     // allocate storage in shared memory
+///     __shared__ block_merge_int::storage_type storage;
+///
+///     // The first num_keys1 items of the tile (in a blocked arrangement) are the first sorted
+///     // sequence, the remaining items are the second sorted sequence.
+///     int items[4];
+///     unsigned int num_keys1 = ...;
+///     ...
+///     block_merge_int().merge(items, num_keys1, storage, rocprim::less<int>());
+///     ...
+/// }
+/// \endcode
+/// \endparblock
+template<class Key,
+         unsigned int BlockSizeX,
+         unsigned int ItemsPerThread,
+         class Value             = empty_type,
+         unsigned int BlockSizeY = 1,
+         unsigned int BlockSizeZ = 1>
+class block_merge
+{
+    static constexpr unsigned int BlockSize     = BlockSizeX * BlockSizeY * BlockSizeZ;
+    static constexpr unsigned int ItemsPerBlock = BlockSize * ItemsPerThread;
+    static constexpr bool         with_values   = !std::is_same<Value, empty_type>::value;
+
+    // Keys and values are never in shared memory at the same time
+    union storage_type_
+    {
+        uninitialized_array<Key, ItemsPerBlock>   keys;
+        uninitialized_array<Value, ItemsPerBlock> values;
+    };
+
+public:
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by related parallel primitive.
+    ///
+    /// Depending on the implemention the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords <tt>__shared__</tt>. It can be aliased to
+    /// an externally allocated memory, or be a part of a union type with other storage types
+    /// to increase shared memory reusability.
+    using storage_type = storage_type_;
+
+    /// \brief Merges two sorted sequences of keys, which together form the tile of the block.
+    ///
+    /// The first \p num_keys1 keys of the tile (in a blocked arrangement) form the first
+    /// sequence, and the remaining keys form the second sequence.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for comparison.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in] num_keys1 - number of keys in the first sequence.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] compare_function - comparison function object which returns true if the
+    /// first argument is ordered before the second. The signature of the function should be
+    /// equivalent to the following: <tt>bool f(const Key &a, const Key &b);</tt>.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void merge(Key (&keys)[ItemsPerThread],
+                                             const unsigned int num_keys1,
+                                             storage_type&      storage,
+                                             BinaryFunction     compare_function)
+    {
+        this->merge(keys, num_keys1, ItemsPerBlock, storage, compare_function);
+    }
+
+    /// \overload
+    /// \brief Merges two sorted sequences of keys, which together form the tile of the block.
+    ///
+    /// * This overload does not accept storage argument. Required shared memory is
+    /// allocated by the method itself.
+    template<class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void merge(Key (&keys)[ItemsPerThread],
+                                                   const unsigned int num_keys1,
+                                                   BinaryFunction     compare_function)
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        this->merge(keys, num_keys1, storage, compare_function);
+    }
+
+    /// \brief Merges two sorted sequences of keys, which together form the first \p num_keys
+    /// items of the tile of the block.
+    ///
+    /// The first \p num_keys1 keys of the tile (in a blocked arrangement) form the first
+    /// sequence, and the keys in <tt>[num_keys1, num_keys)</tt> form the second sequence.
+    /// The keys of the tile past \p num_keys are not read, and are undefined after the merge.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for comparison.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in] num_keys1 - number of keys in the first sequence.
+    /// \param [in] num_keys - total number of keys in both sequences, at most
+    /// <tt>BlockSize * ItemsPerThread</tt>.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] compare_function - comparison function object which returns true if the
+    /// first argument is ordered before the second. The signature of the function should be
+    /// equivalent to the following: <tt>bool f(const Key &a, const Key &b);</tt>.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void merge(Key (&keys)[ItemsPerThread],
+                                             const unsigned int num_keys1,
+                                             const unsigned int num_keys,
+                                             storage_type&      storage,
+                                             BinaryFunction     compare_function)
+    {
+        const unsigned int flat_id
+            = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        unsigned int indices[ItemsPerThread];
+        keys_to_shared(keys, flat_id, num_keys, storage);
+        merge_from_shared(keys, indices, flat_id, num_keys1, num_keys, storage, compare_function);
+    }
+
+    /// \brief Merges two sorted sequences of key-value pairs, which together form the tile
+    /// of the block.
+    ///
+    /// The first \p num_keys1 pairs of the tile (in a blocked arrangement) form the first
+    /// sequence, and the remaining pairs form the second sequence.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for comparison.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in, out] values - reference to an array of values provided by a thread.
+    /// \param [in] num_keys1 - number of pairs in the first sequence.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] compare_function - comparison function object which returns true if the
+    /// first argument is ordered before the second. The signature of the function should be
+    /// equivalent to the following: <tt>bool f(const Key &a, const Key &b);</tt>.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class BinaryFunction, bool WithValues = with_values>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void
+        merge(Key (&keys)[ItemsPerThread],
+              typename std::enable_if<WithValues, Value>::type (&values)[ItemsPerThread],
+              const unsigned int num_keys1,
+              storage_type&      storage,
+              BinaryFunction     compare_function)
+    {
+        this->merge(keys, values, num_keys1, ItemsPerBlock, storage, compare_function);
+    }
+
+    /// \overload
+    /// \brief Merges two sorted sequences of key-value pairs, which together form the tile
+    /// of the block.
+    ///
+    /// * This overload does not accept storage argument. Required shared memory is
+    /// allocated by the method itself.
+    template<class BinaryFunction, bool WithValues = with_values>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+        merge(Key (&keys)[ItemsPerThread],
+              typename std::enable_if<WithValues, Value>::type (&values)[ItemsPerThread],
+              const unsigned int num_keys1,
+              BinaryFunction     compare_function)
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        this->merge(keys, values, num_keys1, storage, compare_function);
+    }
+
+    /// \brief Merges two sorted sequences of key-value pairs, which together form the first
+    /// \p num_keys items of the tile of the block.
+    ///
+    /// The first \p num_keys1 pairs of the tile (in a blocked arrangement) form the first
+    /// sequence, and the pairs in <tt>[num_keys1, num_keys)</tt> form the second sequence.
+    /// The pairs of the tile past \p num_keys are not read, and are undefined after the merge.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for comparison.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in, out] values - reference to an array of values provided by a thread.
+    /// \param [in] num_keys1 - number of pairs in the first sequence.
+    /// \param [in] num_keys - total number of pairs in both sequences, at most
+    /// <tt>BlockSize * ItemsPerThread</tt>.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] compare_function - comparison function object which returns true if the
+    /// first argument is ordered before the second. The signature of the function should be
+    /// equivalent to the following: <tt>bool f(const Key &a, const Key &b);</tt>.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class BinaryFunction, bool WithValues = with_values>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void
+        merge(Key (&keys)[ItemsPerThread],
+              typename std::enable_if<WithValues, Value>::type (&values)[ItemsPerThread],
+              const unsigned int num_keys1,
+              const unsigned int num_keys,
+              storage_type&      storage,
+              BinaryFunction     compare_function)
+    {
+        const unsigned int flat_id
+            = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        unsigned int indices[ItemsPerThread];
+        keys_to_shared(keys, flat_id, num_keys, storage);
+        merge_from_shared(keys, indices, flat_id, num_keys1, num_keys, storage, compare_function);
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            const unsigned int index = flat_id * ItemsPerThread + i;
+            if(index < num_keys)
+            {
+                storage.values.emplace(index, values[i]);
+            }
+        }
+        ::rocprim::syncthreads();
+        gather_values(values, indices, flat_id, num_keys, storage.values.get_unsafe_array());
+    }
+
+    /// \brief Merges two sorted sequences of keys read from iterators, for example from global
+    /// memory or from the storage of another primitive.
+    ///
+    /// \tparam KeysInputIterator1 - [inferred] random-access iterator type of the first sequence.
+    /// \tparam KeysInputIterator2 - [inferred] random-access iterator type of the second sequence.
+    /// \tparam BinaryFunction - type of binary function used for comparison.
+    ///
+    /// \param [in] keys_input1 - iterator to the first sorted sequence.
+    /// \param [in] num_keys1 - number of keys in the first sequence.
+    /// \param [in] keys_input2 - iterator to the second sorted sequence.
+    /// \param [in] num_keys2 - number of keys in the second sequence. The total number of keys
+    /// must be at most <tt>BlockSize * ItemsPerThread</tt>.
+    /// \param [out] keys - reference to an array of merged keys, in a blocked arrangement.
+    /// The items past <tt>num_keys1 + num_keys2</tt> are undefined.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] compare_function - comparison function object which returns true if the
+    /// first argument is ordered before the second. The signature of the function should be
+    /// equivalent to the following: <tt>bool f(const Key &a, const Key &b);</tt>.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class KeysInputIterator1, class KeysInputIterator2, class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void merge(KeysInputIterator1 keys_input1,
+                                             const unsigned int num_keys1,
+                                             KeysInputIterator2 keys_input2,
+                                             const unsigned int num_keys2,
+                                             Key (&keys)[ItemsPerThread],
+                                             storage_type&      storage,
+                                             BinaryFunction     compare_function)
+    {
+        const unsigned int flat_id
+            = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        const unsigned int num_keys = num_keys1 + num_keys2;
+        unsigned int       indices[ItemsPerThread];
+        keys_to_shared(keys_input1, num_keys1, keys_input2, flat_id, num_keys, storage);
+        merge_from_shared(keys, indices, flat_id, num_keys1, num_keys, storage, compare_function);
+    }
+
+    /// \brief Merges two sorted sequences of key-value pairs read from iterators, for example
+    /// from global memory or from the storage of another primitive.
+    ///
+    /// The values are read directly from the value iterators at the position of their key
+    /// in the merged sequence, they are not staged in shared memory.
+    ///
+    /// \tparam KeysInputIterator1 - [inferred] random-access iterator type of the keys of
+    /// the first sequence.
+    /// \tparam ValuesInputIterator1 - [inferred] random-access iterator type of the values of
+    /// the first sequence.
+    /// \tparam KeysInputIterator2 - [inferred] random-access iterator type of the keys of
+    /// the second sequence.
+    /// \tparam ValuesInputIterator2 - [inferred] random-access iterator type of the values of
+    /// the second sequence.
+    /// \tparam BinaryFunction - type of binary function used for comparison.
+    ///
+    /// \param [in] keys_input1 - iterator to the keys of the first sorted sequence.
+    /// \param [in] values_input1 - iterator to the values of the first sequence.
+    /// \param [in] num_keys1 - number of pairs in the first sequence.
+    /// \param [in] keys_input2 - iterator to the keys of the second sorted sequence.
+    /// \param [in] values_input2 - iterator to the values of the second sequence.
+    /// \param [in] num_keys2 - number of pairs in the second sequence. The total number of pairs
+    /// must be at most <tt>BlockSize * ItemsPerThread</tt>.
+    /// \param [out] keys - reference to an array of merged keys, in a blocked arrangement.
+    /// \param [out] values - reference to an array of merged values, in a blocked arrangement.
+    /// The items past <tt>num_keys1 + num_keys2</tt> are undefined.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] compare_function - comparison function object which returns true if the
+    /// first argument is ordered before the second. The signature of the function should be
+    /// equivalent to the following: <tt>bool f(const Key &a, const Key &b);</tt>.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class KeysInputIterator1,
+             class ValuesInputIterator1,
+             class KeysInputIterator2,
+             class ValuesInputIterator2,
+             class BinaryFunction,
+             bool WithValues = with_values>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void
+        merge(KeysInputIterator1   keys_input1,
+              ValuesInputIterator1 values_input1,
+              const unsigned int   num_keys1,
+              KeysInputIterator2   keys_input2,
+              ValuesInputIterator2 values_input2,
+              const unsigned int   num_keys2,
+              Key (&keys)[ItemsPerThread],
+              typename std::enable_if<WithValues, Value>::type (&values)[ItemsPerThread],
+              storage_type&  storage,
+              BinaryFunction compare_function)
+    {
+        const unsigned int flat_id
+            = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        const unsigned int num_keys = num_keys1 + num_keys2;
+        unsigned int       indices[ItemsPerThread];
+        keys_to_shared(keys_input1, num_keys1, keys_input2, flat_id, num_keys, storage);
+        merge_from_shared(keys, indices, flat_id, num_keys1, num_keys, storage, compare_function);
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            if(flat_id * ItemsPerThread + i < num_keys)
+            {
+                const unsigned int index = indices[i];
+                values[i] = index < num_keys1 ? values_input1[index]
+                                              : values_input2[index - num_keys1];
+            }
+        }
+    }
+
+private:
+    struct merge_path_coordinate
+    {
+        unsigned int x;
+        unsigned int y;
+    };
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE void keys_to_shared(const Key (&keys)[ItemsPerThread],
+                                                      const unsigned int flat_id,
+                                                      const unsigned int num_keys,
+                                                      storage_type&      storage)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            const unsigned int index = flat_id * ItemsPerThread + i;
+            if(index < num_keys)
+            {
+                storage.keys.emplace(index, keys[i]);
+            }
+        }
+        ::rocprim::syncthreads();
+    }
+
+    template<class KeysInputIterator1, class KeysInputIterator2>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void keys_to_shared(KeysInputIterator1 keys_input1,
+                                                      const unsigned int num_keys1,
+                                                      KeysInputIterator2 keys_input2,
+                                                      const unsigned int flat_id,
+                                                      const unsigned int num_keys,
+                                                      storage_type&      storage)
+    {
+        // Striped, so that consecutive threads read consecutive keys
+        for(unsigned int index = flat_id; index < num_keys; index += BlockSize)
+        {
+            if(index < num_keys1)
+            {
+                storage.keys.emplace(index, keys_input1[index]);
+            }
+            else
+            {
+                storage.keys.emplace(index, keys_input2[index - num_keys1]);
+            }
+        }
+        ::rocprim::syncthreads();
+    }
+
+    /// Merges the items of this thread from the two sequences in shared memory. \p indices
+    /// receives the position of every output key in the concatenation of the sequences.
+    template<class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void merge_from_shared(Key (&keys)[ItemsPerThread],
+                                                         unsigned int (&indices)[ItemsPerThread],
+                                                         const unsigned int flat_id,
+                                                         const unsigned int num_keys1,
+                                                         const unsigned int num_keys,
+                                                         storage_type&      storage,
+                                                         BinaryFunction     compare_function)
+    {
+        const Key(&keys_shared)[ItemsPerBlock] = storage.keys.get_unsafe_array();
+
+        const unsigned int num_keys2 = num_keys - num_keys1;
+        const unsigned int diagonal  = ::rocprim::min(flat_id * ItemsPerThread, num_keys);
+
+        merge_path_coordinate path_coordinate;
+        merge_path_search(diagonal,
+                          &keys_shared[0],
+                          &keys_shared[num_keys1],
+                          num_keys1,
+                          num_keys2,
+                          path_coordinate,
+                          compare_function);
+
+        unsigned int begin1 = path_coordinate.x;
+        unsigned int begin2 = num_keys1 + path_coordinate.y;
+
+        // The next key of each sequence is cached in registers, keys past the end of a
+        // sequence are never read.
+        Key key1 = keys_shared[begin1 < num_keys1 ? begin1 : 0];
+        Key key2 = keys_shared[begin2 < num_keys ? begin2 : 0];
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            // Equal keys are taken from the first sequence first, which makes the merge stable
+            const bool take1 = begin2 >= num_keys
+                               || (begin1 < num_keys1 && !compare_function(key2, key1));
+            keys[i]    = take1 ? key1 : key2;
+            indices[i] = take1 ? begin1 : begin2;
+            if(take1)
+            {
+                ++begin1;
+                if(begin1 < num_keys1)
+                {
+                    key1 = keys_shared[begin1];
+                }
+            }
+            else
+            {
+                ++begin2;
+                if(begin2 < num_keys)
+                {
+                    key2 = keys_shared[begin2];
+                }
+            }
+        }
+        ::rocprim::syncthreads();
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE void
+        gather_values(Value (&values)[ItemsPerThread],
+                      const unsigned int (&indices)[ItemsPerThread],
+                      const unsigned int flat_id,
+                      const unsigned int num_keys,
+                      const Value (&values_shared)[ItemsPerBlock])
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            if(flat_id * ItemsPerThread + i < num_keys)
+            {
+                values[i] = values_shared[indices[i]];
+            }
+        }
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group blockmodule
+
+#endif // ROCPRIM_BLOCK_BLOCK_MERGE_HPP_
@@ -0,0 +1,265 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_BLOCK_BLOCK_PARTITION_HPP_
+#define ROCPRIM_BLOCK_BLOCK_PARTITION_HPP_
+
+#include "detail/block_select_ballot.hpp"
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+#include "../intrinsics.hpp"
+#include "../types/uninitialized_array.hpp"
+
+/// \addtogroup blockmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The \p block_partition class is a block level parallel primitive which provides
+/// methods for two-way partitioning of items partitioned across threads in a block.
+///
+/// \tparam T - the input type.
+/// \tparam BlockSizeX - the number of threads in a block's x dimension.
+/// \tparam ItemsPerThread - the number of items contributed by each thread.
+/// \tparam BlockSizeY - the number of threads in a block's y dimension, defaults to 1.
+/// \tparam BlockSizeZ - the number of threads in a block's z dimension, defaults to 1.
+///
+/// \par Overview
+/// * The input is a tile in a blocked arrangement. The selected items are written to the
+///   front of the selected output and the rejected items to the front of the rejected output.
+///   Both keep their relative order.
+/// * Items are selected either by flags or by a predicate.
+/// * The outputs are written in a striped arrangement, through shared memory, so consecutive
+///   threads write consecutive items.
+/// * The ranks within a warp are computed with warp ballots and bit counts, only the item
+///   counts of the warps are exchanged through shared memory.
+///
+/// \par Examples
+/// \parblock
+/// In the examples partition operation is performed on a block of 128 threads, using type
+/// \p int and 4 items per thread.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(int* selected, int* rejected, ...)
+/// {
+///     // specialize block_partition for int, block of 128 threads and 4 items per thread
+///     using block_partition_int = rocprim::block_partition<int, 128, 4>;
+///     // allocate storage in shared memory
+///     __shared__ block_partition_int::storage_type storage;
+///
+///     int items[4];
+///     bool flags[4];
+///     ...
+///     const unsigned int selected_count
+///         = block_partition_int().partition_flagged(items, flags, selected, rejected, storage);
+///     ...
+/// }
+/// \endcode
+/// \endparblock
+template<class T,
+         unsigned int BlockSizeX,
+         unsigned int ItemsPerThread,
+         unsigned int BlockSizeY = 1,
+         unsigned int BlockSizeZ = 1>
+class block_partition
+{
+    static constexpr unsigned int BlockSize     = BlockSizeX * BlockSizeY * BlockSizeZ;
+    static constexpr unsigned int ItemsPerBlock = BlockSize * ItemsPerThread;
+
+    using ballot_type
+        = detail::block_select_ballot<BlockSizeX, ItemsPerThread, BlockSizeY, BlockSizeZ>;
+
+    struct storage_type_
+    {
+        typename ballot_type::storage_type    ballot;
+        uninitialized_array<T, ItemsPerBlock> items;
+    };
+
+public:
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by related parallel primitive.
+    ///
+    /// Depending on the implemention the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords <tt>__shared__</tt>. It can be aliased to
+    /// an externally allocated memory, or be a part of a union type with other storage types
+    /// to increase shared memory reusability.
+    using storage_type = storage_type_;
+
+    /// \brief Partitions the items into the items which have a set flag and the other items.
+    ///
+    /// \tparam Flag - [inferred] the flag type, it must be convertible to \p bool.
+    /// \tparam SelectedOutputIterator - [inferred] random-access iterator type of the
+    /// selected output.
+    /// \tparam RejectedOutputIterator - [inferred] random-access iterator type of the
+    /// rejected output.
+    ///
+    /// \param [in] items - reference to an array of items provided by a thread.
+    /// \param [in] flags - reference to an array of flags provided by a thread.
+    /// \param [out] selected_output - iterator to the output of the selected items.
+    /// \param [out] rejected_output - iterator to the output of the rejected items.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \returns The number of selected items of the block. The number of rejected items is the
+    /// number of valid items minus the number of selected items.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class Flag, class SelectedOutputIterator, class RejectedOutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int
+        partition_flagged(const T (&items)[ItemsPerThread],
+                          const Flag (&flags)[ItemsPerThread],
+                          SelectedOutputIterator selected_output,
+                          RejectedOutputIterator rejected_output,
+                          storage_type&          storage)
+    {
+        return partition_flagged(items,
+                                 flags,
+                                 ItemsPerBlock,
+                                 selected_output,
+                                 rejected_output,
+                                 storage);
+    }
+
+    /// \overload
+    /// \brief Partitions the items into the items which have a set flag and the other items.
+    /// Only the first \p valid_items items of the tile are considered.
+    template<class Flag, class SelectedOutputIterator, class RejectedOutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int
+        partition_flagged(const T (&items)[ItemsPerThread],
+                          const Flag (&flags)[ItemsPerThread],
+                          const unsigned int     valid_items,
+                          SelectedOutputIterator selected_output,
+                          RejectedOutputIterator rejected_output,
+                          storage_type&          storage)
+    {
+        const unsigned int flat_id
+            = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+
+        bool               selected[ItemsPerThread];
+        unsigned int       ranks[ItemsPerThread];
+        const unsigned int selected_count
+            = ballot_type().rank(flags, selected, ranks, flat_id, valid_items, storage.ballot);
+
+        // The rejected items are placed after the selected items, the number of rejected items
+        // before an item is its index minus the number of selected items before it
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            const unsigned int index = flat_id * ItemsPerThread + i;
+            if(index < valid_items)
+            {
+                storage.items.emplace(selected[i] ? ranks[i] : selected_count + index - ranks[i],
+                                      items[i]);
+            }
+        }
+        ::rocprim::syncthreads();
+
+        const T(&items_shared)[ItemsPerBlock] = storage.items.get_unsafe_array();
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            const unsigned int index = i * BlockSize + flat_id;
+            if(index < selected_count)
+            {
+                selected_output[index] = items_shared[index];
+            }
+            else if(index < valid_items)
+            {
+                rejected_output[index - selected_count] = items_shared[index];
+            }
+        }
+        return selected_count;
+    }
+
+    /// \brief Partitions the items into the items for which \p predicate returns \p true
+    /// and the other items.
+    ///
+    /// \tparam SelectedOutputIterator - [inferred] random-access iterator type of the
+    /// selected output.
+    /// \tparam RejectedOutputIterator - [inferred] random-access iterator type of the
+    /// rejected output.
+    /// \tparam Predicate - [inferred] type of the unary predicate, the signature of the
+    /// function should be equivalent to the following: <tt>bool f(const T &a);</tt>.
+    ///
+    /// \param [in] items - reference to an array of items provided by a thread.
+    /// \param [out] selected_output - iterator to the output of the selected items.
+    /// \param [out] rejected_output - iterator to the output of the rejected items.
+    /// \param [in] predicate - unary function object which returns \p true for the items
+    /// which are selected.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \returns The number of selected items of the block. The number of rejected items is the
+    /// number of valid items minus the number of selected items.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class SelectedOutputIterator, class RejectedOutputIterator, class Predicate>
+    ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int
+        partition_if(const T (&items)[ItemsPerThread],
+                     SelectedOutputIterator selected_output,
+                     RejectedOutputIterator rejected_output,
+                     Predicate              predicate,
+                     storage_type&          storage)
+    {
+        return partition_if(items,
+                            ItemsPerBlock,
+                            selected_output,
+                            rejected_output,
+                            predicate,
+                            storage);
+    }
+
+    /// \overload
+    /// \brief Partitions the items into the items for which \p predicate returns \p true
+    /// and the other items. Only the first \p valid_items items of the tile are considered.
+    template<class SelectedOutputIterator, class RejectedOutputIterator, class Predicate>
+    ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int
+        partition_if(const T (&items)[ItemsPerThread],
+                     const unsigned int     valid_items,
+                     SelectedOutputIterator selected_output,
+                     RejectedOutputIterator rejected_output,
+                     Predicate              predicate,
+                     storage_type&          storage)
+    {
+        bool flags[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            flags[i] = predicate(items[i]);
+        }
+        return partition_flagged(items,
+                                 flags,
+                                 valid_items,
+                                 selected_output,
+                                 rejected_output,
+                                 storage);
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group blockmodule
+
+#endif // ROCPRIM_BLOCK_BLOCK_PARTITION_HPP_
@@ -0,0 +1,429 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_BLOCK_BLOCK_REDUCE_BY_KEY_HPP_
+#define ROCPRIM_BLOCK_BLOCK_REDUCE_BY_KEY_HPP_
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+#include "../intrinsics.hpp"
+#include "../types.hpp"
+#include "../types/tuple.hpp"
+#include "../types/uninitialized_array.hpp"
+
+#include "block_discontinuity.hpp"
+#include "block_scan.hpp"
+
+/// \addtogroup blockmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+/// Segmented reduction operator on (number of segment heads, value) pairs. The value restarts
+/// at every segment head.
+template<class Value, class BinaryFunction>
+struct block_reduce_by_key_op
+{
+    BinaryFunction reduce_op;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE ::rocprim::tuple<unsigned int, Value>
+        operator()(const ::rocprim::tuple<unsigned int, Value>& lhs,
+                   const ::rocprim::tuple<unsigned int, Value>& rhs) const
+    {
+        return ::rocprim::tuple<unsigned int, Value>{
+            ::rocprim::get<0>(lhs) + ::rocprim::get<0>(rhs),
+            ::rocprim::get<0>(rhs) == 0
+                ? reduce_op(::rocprim::get<1>(lhs), ::rocprim::get<1>(rhs))
+                : ::rocprim::get<1>(rhs)};
+    }
+};
+
+/// Flags the items whose key is not equal to the key of the previous item.
+template<class KeyEqual>
+struct block_reduce_by_key_flag_op
+{
+    KeyEqual key_equal;
+
+    template<class Key>
+    ROCPRIM_DEVICE ROCPRIM_INLINE bool operator()(const Key& a, const Key& b) const
+    {
+        return !key_equal(a, b);
+    }
+};
+
+} // namespace detail
+
+/// \brief The \p block_reduce_by_key class is a block level parallel primitive which provides
+/// methods for reducing runs of equal keys (segments) of items partitioned across threads
+/// in a block.
+///
+/// \tparam Key - the key type.
+/// \tparam Value - the value type.
+/// \tparam BlockSizeX - the number of threads in a block's x dimension.
+/// \tparam ItemsPerThread - the number of items contributed by each thread.
+/// \tparam BlockSizeY - the number of threads in a block's y dimension, defaults to 1.
+/// \tparam BlockSizeZ - the number of threads in a block's z dimension, defaults to 1.
+///
+/// \par Overview
+/// * The input is a tile of keys and values in a blocked arrangement. Every run of consecutive
+///   equal keys is a segment.
+/// * The first key and the reduction of the values of every segment, except the last one, are
+///   compacted to the front of the tile, in a blocked arrangement. The number of these
+///   segments is returned.
+/// * The last segment may continue in the next tile, so its key and its reduction are returned
+///   to all threads as carry-out instead. A carry-out can be passed as carry-in to the next
+///   tile, which reduces a sequence of tiles without a separate device pass. Then the carry-in
+///   is either merged into the first segment of the tile, or is written as the first closed
+///   segment.
+/// * Run-length encoding is a reduction by key of ones with \p rocprim::plus.
+///
+/// \par Examples
+/// \parblock
+/// In the examples reduce by key operation is performed on a block of 128 threads, using
+/// type \p int for the keys, \p float for the values and 4 items per thread.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(...)
+/// {
+///     using block_rbk = rocprim::block_reduce_by_key<int, float, 128, 4>;
+///     // allocate storage in shared memory
+///     __shared__ block_rbk::storage_type storage;
+///
+///     int   keys[4];
+///     float values[4];
+///     int   carry_key;
+///     float carry_value;
+///     ...
+///     const unsigned int closed_segments = block_rbk().reduce_by_key(
+///         keys, values, carry_key, carry_value, storage, rocprim::plus<float>());
+///     // The first closed_segments items of the tile hold the unique keys and the reductions,
+///     // the last segment is in carry_key and carry_value.
+///     ...
+/// }
+/// \endcode
+/// \endparblock
+template<class Key,
+         class Value,
+         unsigned int BlockSizeX,
+         unsigned int ItemsPerThread,
+         unsigned int BlockSizeY = 1,
+         unsigned int BlockSizeZ = 1>
+class block_reduce_by_key
+{
+    static constexpr unsigned int BlockSize     = BlockSizeX * BlockSizeY * BlockSizeZ;
+    static constexpr unsigned int ItemsPerBlock = BlockSize * ItemsPerThread;
+
+    using wrapped_type = ::rocprim::tuple<unsigned int, Value>;
+
+    using block_discontinuity_type
+        = ::rocprim::block_discontinuity<Key, BlockSizeX, BlockSizeY, BlockSizeZ>;
+    using block_scan_type = ::rocprim::block_scan<wrapped_type,
+                                                  BlockSizeX,
+                                                  block_scan_algorithm::default_algorithm,
+                                                  BlockSizeY,
+                                                  BlockSizeZ>;
+
+    // The closed segments are staged at the front, the carry-out is staged in the last item
+    union storage_type_
+    {
+        typename block_discontinuity_type::storage_type flags;
+        typename block_scan_type::storage_type          scan;
+        uninitialized_array<Key, ItemsPerBlock + 1>     keys;
+        uninitialized_array<Value, ItemsPerBlock + 1>   values;
+    };
+
+public:
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by related parallel primitive.
+    ///
+    /// Depending on the implemention the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords <tt>__shared__</tt>. It can be aliased to
+    /// an externally allocated memory, or be a part of a union type with other storage types
+    /// to increase shared memory reusability.
+    using storage_type = storage_type_;
+
+    /// \brief Reduces the segments of the tile, and returns the last segment as carry-out.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for the reduction.
+    /// \tparam KeyEqual - type of binary function used to compare keys for equality.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread. On output
+    /// the first <tt>closed_segments</tt> keys of the tile are the first keys of the segments.
+    /// \param [in, out] values - reference to an array of values provided by a thread. On output
+    /// the first <tt>closed_segments</tt> values of the tile are the reductions of the segments.
+    /// \param [out] carry_key - the first key of the last segment of the tile.
+    /// \param [out] carry_value - the reduction of the last segment of the tile.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] reduce_op - binary operation function object that will be used for the
+    /// reduction. The signature of the function should be equivalent to the following:
+    /// <tt>Value f(const Value &a, const Value &b);</tt>.
+    /// \param [in] key_equal - binary function object which returns \p true if the keys are
+    /// equal. The signature of the function should be equivalent to the following:
+    /// <tt>bool f(const Key &a, const Key &b);</tt>.
+    ///
+    /// \returns The number of closed segments, that is the number of segments minus one.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class BinaryFunction = ::rocprim::plus<Value>,
+             class KeyEqual       = ::rocprim::equal_to<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int reduce_by_key(Key (&keys)[ItemsPerThread],
+                                                             Value (&values)[ItemsPerThread],
+                                                             Key&           carry_key,
+                                                             Value&         carry_value,
+                                                             storage_type&  storage,
+                                                             BinaryFunction reduce_op
+                                                             = BinaryFunction(),
+                                                             KeyEqual key_equal = KeyEqual())
+    {
+        return reduce_by_key_impl<false>(keys,
+                                         values,
+                                         ItemsPerBlock,
+                                         carry_key,
+                                         carry_value,
+                                         storage,
+                                         reduce_op,
+                                         key_equal);
+    }
+
+    /// \overload
+    /// \brief Reduces the segments of the first \p valid_items items of the tile, and returns
+    /// the last segment as carry-out. \p valid_items must be greater than zero.
+    template<class BinaryFunction = ::rocprim::plus<Value>,
+             class KeyEqual       = ::rocprim::equal_to<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int reduce_by_key(Key (&keys)[ItemsPerThread],
+                                                             Value (&values)[ItemsPerThread],
+                                                             const unsigned int valid_items,
+                                                             Key&               carry_key,
+                                                             Value&             carry_value,
+                                                             storage_type&      storage,
+                                                             BinaryFunction     reduce_op
+                                                             = BinaryFunction(),
+                                                             KeyEqual key_equal = KeyEqual())
+    {
+        return reduce_by_key_impl<false>(keys,
+                                         values,
+                                         valid_items,
+                                         carry_key,
+                                         carry_value,
+                                         storage,
+                                         reduce_op,
+                                         key_equal);
+    }
+
+    /// \brief Reduces the segments of the tile continuing the carry of the previous tile,
+    /// and returns the last segment as carry-out.
+    ///
+    /// If the first key of the tile is equal to \p carry_key, the carry-in is reduced into the
+    /// first segment of the tile. Otherwise the carry-in is closed and is written as the first
+    /// closed segment.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for the reduction.
+    /// \tparam KeyEqual - type of binary function used to compare keys for equality.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread. On output
+    /// the first <tt>closed_segments</tt> keys of the tile are the first keys of the segments.
+    /// \param [in, out] values - reference to an array of values provided by a thread. On output
+    /// the first <tt>closed_segments</tt> values of the tile are the reductions of the segments.
+    /// \param [in] valid_items - number of valid items of the tile, it must be greater than zero.
+    /// \param [in, out] carry_key - on input the key of the carry of the previous tile, it must
+    /// be the same for all threads. On output the first key of the last segment of the tile.
+    /// \param [in, out] carry_value - on input the reduction of the carry of the previous tile,
+    /// it must be the same for all threads. On output the reduction of the last segment.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] reduce_op - binary operation function object that will be used for the
+    /// reduction. The signature of the function should be equivalent to the following:
+    /// <tt>Value f(const Value &a, const Value &b);</tt>.
+    /// \param [in] key_equal - binary function object which returns \p true if the keys are
+    /// equal. The signature of the function should be equivalent to the following:
+    /// <tt>bool f(const Key &a, const Key &b);</tt>.
+    ///
+    /// \returns The number of closed segments, including the carry-in if it was closed.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class BinaryFunction = ::rocprim::plus<Value>,
+             class KeyEqual       = ::rocprim::equal_to<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int
+        reduce_by_key_with_carry(Key (&keys)[ItemsPerThread],
+                                 Value (&values)[ItemsPerThread],
+                                 const unsigned int valid_items,
+                                 Key&               carry_key,
+                                 Value&             carry_value,
+                                 storage_type&      storage,
+                                 BinaryFunction     reduce_op = BinaryFunction(),
+                                 KeyEqual           key_equal = KeyEqual())
+    {
+        return reduce_by_key_impl<true>(keys,
+                                        values,
+                                        valid_items,
+                                        carry_key,
+                                        carry_value,
+                                        storage,
+                                        reduce_op,
+                                        key_equal);
+    }
+
+private:
+    template<bool WithCarryIn, class BinaryFunction, class KeyEqual>
+    ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int reduce_by_key_impl(Key (&keys)[ItemsPerThread],
+                                                                  Value (&values)[ItemsPerThread],
+                                                                  const unsigned int valid_items,
+                                                                  Key&               carry_key,
+                                                                  Value&             carry_value,
+                                                                  storage_type&      storage,
+                                                                  BinaryFunction     reduce_op,
+                                                                  KeyEqual           key_equal)
+    {
+        const unsigned int flat_id
+            = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+
+        const auto flag_op = detail::block_reduce_by_key_flag_op<KeyEqual>{key_equal};
+
+        // With a carry-in, the carry is segment 0 and the first item of the tile is only a head
+        // if its key differs from the carry key
+        bool head_flags[ItemsPerThread];
+        bool tail_flags[ItemsPerThread];
+        if(WithCarryIn)
+        {
+            block_discontinuity_type().flag_heads_and_tails(head_flags,
+                                                            carry_key,
+                                                            tail_flags,
+                                                            keys,
+                                                            flag_op,
+                                                            storage.flags);
+            if(flat_id == 0 && !head_flags[0])
+            {
+                values[0] = reduce_op(carry_value, values[0]);
+            }
+        }
+        else
+        {
+            block_discontinuity_type().flag_heads_and_tails(head_flags,
+                                                            tail_flags,
+                                                            keys,
+                                                            flag_op,
+                                                            storage.flags);
+        }
+        ::rocprim::syncthreads();
+
+        wrapped_type wrapped[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            const unsigned int index = flat_id * ItemsPerThread + i;
+            // Items past the end are appended to the last segment, they never reach a tail
+            head_flags[i] = head_flags[i] && index < valid_items;
+            tail_flags[i] = (tail_flags[i] && index < valid_items) || index + 1 == valid_items;
+            wrapped[i]    = wrapped_type{head_flags[i] ? 1u : 0u, values[i]};
+        }
+
+        wrapped_type reduction;
+        block_scan_type().inclusive_scan(
+            wrapped,
+            wrapped,
+            reduction,
+            storage.scan,
+            detail::block_reduce_by_key_op<Value, BinaryFunction>{reduce_op});
+        ::rocprim::syncthreads();
+
+        // Segment of an item is the number of heads up to and including it, minus one if there
+        // is no carry-in. The last segment is not closed, it is staged in the last item.
+        const unsigned int segment_offset  = WithCarryIn ? 0 : 1;
+        const unsigned int closed_segments = ::rocprim::get<0>(reduction) - segment_offset;
+
+        auto staged_position = [&](const unsigned int segment)
+        { return segment == closed_segments ? ItemsPerBlock : segment; };
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            if(head_flags[i])
+            {
+                const unsigned int segment = ::rocprim::get<0>(wrapped[i]) - segment_offset;
+                storage.keys.emplace(staged_position(segment), keys[i]);
+            }
+        }
+        if(WithCarryIn && flat_id == 0)
+        {
+            storage.keys.emplace(staged_position(0), carry_key);
+        }
+        ::rocprim::syncthreads();
+        {
+            const Key(&keys_shared)[ItemsPerBlock + 1] = storage.keys.get_unsafe_array();
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < ItemsPerThread; ++i)
+            {
+                const unsigned int index = flat_id * ItemsPerThread + i;
+                if(index < closed_segments)
+                {
+                    keys[i] = keys_shared[index];
+                }
+            }
+            carry_key = keys_shared[ItemsPerBlock];
+        }
+        ::rocprim::syncthreads();
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            if(tail_flags[i])
+            {
+                const unsigned int segment = ::rocprim::get<0>(wrapped[i]) - segment_offset;
+                storage.values.emplace(staged_position(segment), ::rocprim::get<1>(wrapped[i]));
+            }
+        }
+        // A carry-in which is closed by the first item has no items in the tile
+        if(WithCarryIn && flat_id == 0 && head_flags[0])
+        {
+            storage.values.emplace(0, carry_value);
+        }
+        ::rocprim::syncthreads();
+        {
+            const Value(&values_shared)[ItemsPerBlock + 1] = storage.values.get_unsafe_array();
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < ItemsPerThread; ++i)
+            {
+                const unsigned int index = flat_id * ItemsPerThread + i;
+                if(index < closed_segments)
+                {
+                    values[i] = values_shared[index];
+                }
+            }
+            carry_value = values_shared[ItemsPerBlock];
+        }
+
+        return closed_segments;
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group blockmodule
+
+#endif // ROCPRIM_BLOCK_BLOCK_REDUCE_BY_KEY_HPP_
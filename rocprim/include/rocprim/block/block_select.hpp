@@ -0,0 +1,316 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_BLOCK_BLOCK_SELECT_HPP_
+#define ROCPRIM_BLOCK_BLOCK_SELECT_HPP_
+
+#include "detail/block_select_ballot.hpp"
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+#include "../intrinsics.hpp"
+#include "../types/uninitialized_array.hpp"
+
+/// \addtogroup blockmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The \p block_select class is a block level parallel primitive which provides methods
+/// for stream compaction of items partitioned across threads in a block.
+///
+/// \tparam T - the input type.
+/// \tparam BlockSizeX - the number of threads in a block's x dimension.
+/// \tparam ItemsPerThread - the number of items contributed by each thread.
+/// \tparam BlockSizeY - the number of threads in a block's y dimension, defaults to 1.
+/// \tparam BlockSizeZ - the number of threads in a block's z dimension, defaults to 1.
+///
+/// \par Overview
+/// * The input is a tile in a blocked arrangement. The selected items are compacted to the
+///   front of the output, keeping their relative order, and the number of selected items
+///   is returned to every thread.
+/// * Items are selected either by flags or by a predicate.
+/// * \p select_flagged and \p select_if write the selected items to an output iterator in a
+///   striped arrangement, through shared memory, so consecutive threads write consecutive items.
+/// * \p scatter_flagged and \p scatter_if write every selected item directly to its position
+///   in the output, which is suitable for writing to shared memory.
+/// * The ranks within a warp are computed with warp ballots and bit counts, only the item
+///   counts of the warps are exchanged through shared memory.
+///
+/// \par Examples
+/// \parblock
+/// In the examples select operation is performed on a block of 128 threads, using type
+/// \p int and 4 items per thread.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(int* output, ...)
+/// {
+///     // specialize block_select for int, block of 128 threads and 4 items per thread
+///     using block_select_int = rocprim::block_select<int, 128, 4>;
+///     // allocate storage in shared memory
+///     __shared__ block_select_int::storage_type storage;
+///
+///     int items[4];
+///     bool flags[4];
+///     ...
+///     const unsigned int selected_count
+///         = block_select_int().select_flagged(items, flags, output, storage);
+///     ...
+/// }
+/// \endcode
+/// \endparblock
+template<class T,
+         unsigned int BlockSizeX,
+         unsigned int ItemsPerThread,
+         unsigned int BlockSizeY = 1,
+         unsigned int BlockSizeZ = 1>
+class block_select
+{
+    static constexpr unsigned int BlockSize     = BlockSizeX * BlockSizeY * BlockSizeZ;
+    static constexpr unsigned int ItemsPerBlock = BlockSize * ItemsPerThread;
+
+    using ballot_type
+        = detail::block_select_ballot<BlockSizeX, ItemsPerThread, BlockSizeY, BlockSizeZ>;
+
+    struct storage_type_
+    {
+        typename ballot_type::storage_type    ballot;
+        uninitialized_array<T, ItemsPerBlock> items;
+    };
+
+public:
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by related parallel primitive.
+    ///
+    /// Depending on the implemention the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords <tt>__shared__</tt>. It can be aliased to
+    /// an externally allocated memory, or be a part of a union type with other storage types
+    /// to increase shared memory reusability.
+    using storage_type = storage_type_;
+
+    /// \brief Compacts the items which have a set flag to the front of \p output, in a striped
+    /// arrangement.
+    ///
+    /// \tparam Flag - [inferred] the flag type, it must be convertible to \p bool.
+    /// \tparam OutputIterator - [inferred] random-access iterator type of the output.
+    ///
+    /// \param [in] items - reference to an array of items provided by a thread.
+    /// \param [in] flags - reference to an array of flags provided by a thread.
+    /// \param [out] output - iterator to the output. The selected items are written to the
+    /// first positions of the output, in the order of the tile.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \returns The number of selected items of the block.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class Flag, class OutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int select_flagged(const T (&items)[ItemsPerThread],
+                                                              const Flag (&flags)[ItemsPerThread],
+                                                              OutputIterator output,
+                                                              storage_type&  storage)
+    {
+        return select_flagged(items, flags, ItemsPerBlock, output, storage);
+    }
+
+    /// \overload
+    /// \brief Compacts the items which have a set flag to the front of \p output, in a striped
+    /// arrangement. Only the first \p valid_items items of the tile are considered.
+    template<class Flag, class OutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int select_flagged(const T (&items)[ItemsPerThread],
+                                                              const Flag (&flags)[ItemsPerThread],
+                                                              const unsigned int valid_items,
+                                                              OutputIterator     output,
+                                                              storage_type&      storage)
+    {
+        const unsigned int flat_id
+            = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+
+        bool               selected[ItemsPerThread];
+        unsigned int       ranks[ItemsPerThread];
+        const unsigned int selected_count
+            = ballot_type().rank(flags, selected, ranks, flat_id, valid_items, storage.ballot);
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            if(selected[i])
+            {
+                storage.items.emplace(ranks[i], items[i]);
+            }
+        }
+        ::rocprim::syncthreads();
+
+        const T(&items_shared)[ItemsPerBlock] = storage.items.get_unsafe_array();
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            const unsigned int index = i * BlockSize + flat_id;
+            if(index < selected_count)
+            {
+                output[index] = items_shared[index];
+            }
+        }
+        return selected_count;
+    }
+
+    /// \brief Compacts the items for which \p predicate returns \p true to the front of
+    /// \p output, in a striped arrangement.
+    ///
+    /// \tparam OutputIterator - [inferred] random-access iterator type of the output.
+    /// \tparam Predicate - [inferred] type of the unary predicate, the signature of the
+    /// function should be equivalent to the following: <tt>bool f(const T &a);</tt>.
+    ///
+    /// \param [in] items - reference to an array of items provided by a thread.
+    /// \param [out] output - iterator to the output. The selected items are written to the
+    /// first positions of the output, in the order of the tile.
+    /// \param [in] predicate - unary function object which returns \p true for the items
+    /// which are selected.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \returns The number of selected items of the block.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class OutputIterator, class Predicate>
+    ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int select_if(const T (&items)[ItemsPerThread],
+                                                         OutputIterator output,
+                                                         Predicate      predicate,
+                                                         storage_type&  storage)
+    {
+        return select_if(items, ItemsPerBlock, output, predicate, storage);
+    }
+
+    /// \overload
+    /// \brief Compacts the items for which \p predicate returns \p true to the front of
+    /// \p output, in a striped arrangement. Only the first \p valid_items items of the tile
+    /// are considered.
+    template<class OutputIterator, class Predicate>
+    ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int select_if(const T (&items)[ItemsPerThread],
+                                                         const unsigned int valid_items,
+                                                         OutputIterator     output,
+                                                         Predicate          predicate,
+                                                         storage_type&      storage)
+    {
+        bool flags[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            flags[i] = predicate(items[i]);
+        }
+        return select_flagged(items, flags, valid_items, output, storage);
+    }
+
+    /// \brief Writes the items which have a set flag directly to their compacted position
+    /// in \p output.
+    ///
+    /// The items are not staged in \p storage, so \p output is typically shared memory
+    /// (for example storage of another primitive), that is read by the block afterwards.
+    ///
+    /// \tparam Flag - [inferred] the flag type, it must be convertible to \p bool.
+    /// \tparam OutputIterator - [inferred] random-access iterator type of the output.
+    ///
+    /// \param [in] items - reference to an array of items provided by a thread.
+    /// \param [in] flags - reference to an array of flags provided by a thread.
+    /// \param [in] valid_items - number of valid items of the tile.
+    /// \param [out] output - iterator to the output.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \returns The number of selected items of the block.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed, and before \p output is read by other threads:
+    /// \p __syncthreads() or \p rocprim::syncthreads().
+    template<class Flag, class OutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int scatter_flagged(const T (&items)[ItemsPerThread],
+                                                               const Flag (&flags)[ItemsPerThread],
+                                                               const unsigned int valid_items,
+                                                               OutputIterator     output,
+                                                               storage_type&      storage)
+    {
+        const unsigned int flat_id
+            = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+
+        bool               selected[ItemsPerThread];
+        unsigned int       ranks[ItemsPerThread];
+        const unsigned int selected_count
+            = ballot_type().rank(flags, selected, ranks, flat_id, valid_items, storage.ballot);
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            if(selected[i])
+            {
+                output[ranks[i]] = items[i];
+            }
+        }
+        return selected_count;
+    }
+
+    /// \brief Writes the items for which \p predicate returns \p true directly to their
+    /// compacted position in \p output.
+    ///
+    /// The items are not staged in \p storage, so \p output is typically shared memory
+    /// (for example storage of another primitive), that is read by the block afterwards.
+    ///
+    /// \tparam OutputIterator - [inferred] random-access iterator type of the output.
+    /// \tparam Predicate - [inferred] type of the unary predicate, the signature of the
+    /// function should be equivalent to the following: <tt>bool f(const T &a);</tt>.
+    ///
+    /// \param [in] items - reference to an array of items provided by a thread.
+    /// \param [in] valid_items - number of valid items of the tile.
+    /// \param [out] output - iterator to the output.
+    /// \param [in] predicate - unary function object which returns \p true for the items
+    /// which are selected.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \returns The number of selected items of the block.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed, and before \p output is read by other threads:
+    /// \p __syncthreads() or \p rocprim::syncthreads().
+    template<class OutputIterator, class Predicate>
+    ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int scatter_if(const T (&items)[ItemsPerThread],
+                                                          const unsigned int valid_items,
+                                                          OutputIterator     output,
+                                                          Predicate          predicate,
+                                                          storage_type&      storage)
+    {
+        bool flags[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            flags[i] = predicate(items[i]);
+        }
+        return scatter_flagged(items, flags, valid_items, output, storage);
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group blockmodule
+
+#endif // ROCPRIM_BLOCK_BLOCK_SELECT_HPP_
@@ -64,6 +64,12 @@ enum class block_store_method
     ///   * \p ItemsPerThread is odd.
     ///   * The datatype \p T is not a primitive or a HIP vector type (e.g. int2,
     /// int4, etc.
+    /// * The output can also be a \p transform_output_iterator over a pointer. The items are
+    /// then transformed in registers and stored to the pointer using vectorization.
+    /// * The output can also be a \p cache_modified_output_iterator. The vectors are then
+    /// stored with its cache modifier.
+    /// * The output can also be a \p zip_iterator of pointers and \p T a tuple. Every column
+    /// is then stored with vector stores of its own type, and must be quad-item aligned.
     block_store_vectorize,
 
     /// A blocked arrangement of items is locally transposed and stored as a striped
@@ -371,6 +377,33 @@ public:
         block_store_direct_blocked_vectorized(flat_id, block_output, _items);
     }
 
+    template<class V, class UnaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(transform_output_iterator<V*, UnaryFunction> block_output,
+               T (&items)[ItemsPerThread])
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        block_store_direct_blocked_vectorized(flat_id, block_output, items);
+    }
+
+    template<cache_store_modifier Modifier>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(cache_modified_output_iterator<Modifier, T> block_output,
+               T (&items)[ItemsPerThread])
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        block_store_direct_blocked_vectorized(flat_id, block_output, items);
+    }
+
+    template<class... Types>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(zip_iterator<::rocprim::tuple<Types*...>> block_output,
+               T (&items)[ItemsPerThread])
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        block_store_direct_blocked_vectorized(flat_id, block_output, items);
+    }
+
     template<class OutputIterator, class U>
     ROCPRIM_DEVICE ROCPRIM_INLINE
     void store(OutputIterator block_output,
@@ -399,6 +432,36 @@ public:
         store(block_output, items);
     }
 
+    template<class V, class UnaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(transform_output_iterator<V*, UnaryFunction> block_output,
+               T (&items)[ItemsPerThread],
+               storage_type& storage)
+    {
+        (void) storage;
+        store(block_output, items);
+    }
+
+    template<cache_store_modifier Modifier>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(cache_modified_output_iterator<Modifier, T> block_output,
+               T (&items)[ItemsPerThread],
+               storage_type& storage)
+    {
+        (void) storage;
+        store(block_output, items);
+    }
+
+    template<class... Types>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(zip_iterator<::rocprim::tuple<Types*...>> block_output,
+               T (&items)[ItemsPerThread],
+               storage_type& storage)
+    {
+        (void) storage;
+        store(block_output, items);
+    }
+
     template<class OutputIterator, class U>
     ROCPRIM_DEVICE ROCPRIM_INLINE
     void store(OutputIterator block_output,
@@ -0,0 +1,317 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_BLOCK_BLOCK_STORE_2D_HPP_
+#define ROCPRIM_BLOCK_BLOCK_STORE_2D_HPP_
+
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+
+#include "../intrinsics.hpp"
+#include "../functional.hpp"
+#include "../types.hpp"
+
+#include "block_exchange.hpp"
+#include "block_store.hpp"
+#include "block_store_func.hpp"
+#include "detail/block_load_store_2d.hpp"
+
+/// \addtogroup blockmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The \p block_store_2d class is a block level parallel primitive which provides methods
+/// for storing an arrangement of items across the thread block into a tile of a row-major 2D
+/// range with a row pitch.
+///
+/// \tparam T - the input/output type.
+/// \tparam BlockSizeX - the number of threads in a block's x dimension.
+/// \tparam RowsPerTile - the number of rows in a tile.
+/// \tparam ColsPerTile - the number of columns in a tile.
+/// \tparam Method - the method to store data.
+/// \tparam BlockSizeY - the number of threads in a block's y dimension, defaults to 1.
+/// \tparam BlockSizeZ - the number of threads in a block's z dimension, defaults to 1.
+///
+/// \par Overview
+/// * The tile is treated as a continuous range of <tt>RowsPerTile * ColsPerTile</tt> items
+///   in row-major order, which is stored the same way \p block_store stores a continuous range.
+///   Each thread stores \p items_per_thread items.
+/// * Consecutive threads access consecutive items of a row, so stores are coalesced along rows.
+/// * The \p block_store_2d class supports the following methods:
+///   * \p block_store_method::block_store_direct
+///   * \p block_store_method::block_store_striped
+///   * \p block_store_method::block_store_vectorize - vector stores are used when the output
+///     is a pointer, \p ColsPerTile is a multiple of \p items_per_thread, and both the tile
+///     and the pitch are suitably aligned, which is checked at run time. Otherwise, it
+///     behaves as \p block_store_method::block_store_direct.
+///   * \p block_store_method::block_store_transpose - items are transposed from a blocked
+///     into a striped arrangement using \p block_exchange and stored.
+/// * Partial tiles at the edges of the 2D range are supported by limiting the number of
+///   valid rows and columns of the tile.
+///
+/// \par Example:
+/// \parblock
+/// In the example a tile of 32 rows and 64 columns of a matrix of \p float with a row pitch
+/// of \p pitch items is stored by a block of 256 threads, each thread providing 8 items.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(float* matrix, unsigned int pitch, ...)
+/// {
+///     using block_store_2d = rocprim::block_store_2d<float, 256, 32, 64,
+///                                                    rocprim::block_store_method::block_store_transpose>;
+///     __shared__ block_store_2d::storage_type storage;
+///
+///     float items[block_store_2d::items_per_thread];
+///     ...
+///     float* tile = matrix + blockIdx.y * 32 * pitch + blockIdx.x * 64;
+///     block_store_2d().store(tile, pitch, items, storage);
+/// }
+/// \endcode
+/// \endparblock
+template<class T,
+         unsigned int       BlockSizeX,
+         unsigned int       RowsPerTile,
+         unsigned int       ColsPerTile,
+         block_store_method Method     = block_store_method::block_store_direct,
+         unsigned int       BlockSizeY = 1,
+         unsigned int       BlockSizeZ = 1>
+class block_store_2d
+{
+    static constexpr unsigned int BlockSize = BlockSizeX * BlockSizeY * BlockSizeZ;
+
+public:
+    /// \brief The number of items stored by each thread.
+    static constexpr unsigned int items_per_thread = RowsPerTile * ColsPerTile / BlockSize;
+
+private:
+    static_assert((RowsPerTile * ColsPerTile) % BlockSize == 0,
+                  "The number of items in a tile must be a multiple of the block size");
+    static_assert(Method != block_store_method::block_store_warp_transpose,
+                  "block_store_2d does not support block_store_warp_transpose");
+
+    static constexpr bool transposed = Method == block_store_method::block_store_transpose;
+    static constexpr bool striped
+        = transposed || Method == block_store_method::block_store_striped;
+    // Distance between the tile indices of consecutive items of a thread
+    static constexpr unsigned int stride = striped ? BlockSize : 1;
+
+    using block_exchange_type = block_exchange<T, BlockSizeX, items_per_thread, BlockSizeY, BlockSizeZ>;
+
+    using storage_type_ =
+        typename std::conditional<transposed,
+                                  typename block_exchange_type::storage_type,
+                                  ::rocprim::detail::empty_storage_type>::type;
+
+    template<class OutputIterator>
+    using use_vector_stores
+        = std::integral_constant<bool,
+                                 Method == block_store_method::block_store_vectorize
+                                     && std::is_same<OutputIterator, T*>::value
+                                     && ColsPerTile % items_per_thread == 0>;
+
+public:
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by related parallel primitive.
+    ///
+    /// Depending on the implemention the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords \p __shared__. It can be aliased to
+    /// an externally allocated memory, or be a part of a union with other storage types
+    /// to increase shared memory reusability.
+    using storage_type = storage_type_;
+
+    /// \brief Stores an arrangement of items across the thread block into a tile of a 2D range.
+    ///
+    /// \tparam OutputIterator - [inferred] an iterator type for output (can be a simple
+    /// pointer.
+    ///
+    /// \param [out] tile - the output iterator pointing to the first item of the tile.
+    /// \param [in] pitch - the distance in items between the starts of consecutive rows.
+    /// \param [in] items - array that data is stored from.
+    /// \param [in] storage - temporary storage for outputs.
+    ///
+    /// \par Overview
+    /// * The type \p T must be such that an object of type \p OutputIterator
+    /// can be dereferenced and then assigned to \p T.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class OutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(OutputIterator tile,
+               unsigned int   pitch,
+               T (&items)[items_per_thread],
+               storage_type&  storage)
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        exchange(items, storage, std::integral_constant<bool, transposed>{});
+        store_full(flat_id, tile, pitch, items, use_vector_stores<OutputIterator>{});
+    }
+
+    /// \brief Stores an arrangement of items across the thread block into a tile of a 2D range,
+    /// which is guarded by the number of valid rows and columns of the tile.
+    ///
+    /// \tparam OutputIterator - [inferred] an iterator type for output (can be a simple
+    /// pointer.
+    ///
+    /// \param [out] tile - the output iterator pointing to the first item of the tile.
+    /// \param [in] pitch - the distance in items between the starts of consecutive rows.
+    /// \param [in] items - array that data is stored from.
+    /// \param [in] valid_rows - the number of rows of the tile that can be stored.
+    /// \param [in] valid_cols - the number of columns of the tile that can be stored.
+    /// \param [in] storage - temporary storage for outputs.
+    ///
+    /// \par Overview
+    /// * The type \p T must be such that an object of type \p OutputIterator
+    /// can be dereferenced and then assigned to \p T.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class OutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(OutputIterator tile,
+               unsigned int   pitch,
+               T (&items)[items_per_thread],
+               unsigned int   valid_rows,
+               unsigned int   valid_cols,
+               storage_type&  storage)
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        exchange(items, storage, std::integral_constant<bool, transposed>{});
+        ::rocprim::detail::block_store_2d_direct<ColsPerTile, stride>(first_index(flat_id),
+                                                                      tile,
+                                                                      pitch,
+                                                                      items,
+                                                                      valid_rows,
+                                                                      valid_cols);
+    }
+
+    /// \brief Stores an arrangement of items across the thread block into a tile of a 2D range.
+    ///
+    /// This overload allocates the temporary storage internally.
+    ///
+    /// \tparam OutputIterator - [inferred] an iterator type for output (can be a simple
+    /// pointer.
+    ///
+    /// \param [out] tile - the output iterator pointing to the first item of the tile.
+    /// \param [in] pitch - the distance in items between the starts of consecutive rows.
+    /// \param [in] items - array that data is stored from.
+    template<class OutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(OutputIterator tile,
+               unsigned int   pitch,
+               T (&items)[items_per_thread])
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        store(tile, pitch, items, storage);
+    }
+
+    /// \brief Stores an arrangement of items across the thread block into a tile of a 2D range,
+    /// which is guarded by the number of valid rows and columns of the tile.
+    ///
+    /// This overload allocates the temporary storage internally.
+    ///
+    /// \tparam OutputIterator - [inferred] an iterator type for output (can be a simple
+    /// pointer.
+    ///
+    /// \param [out] tile - the output iterator pointing to the first item of the tile.
+    /// \param [in] pitch - the distance in items between the starts of consecutive rows.
+    /// \param [in] items - array that data is stored from.
+    /// \param [in] valid_rows - the number of rows of the tile that can be stored.
+    /// \param [in] valid_cols - the number of columns of the tile that can be stored.
+    template<class OutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(OutputIterator tile,
+               unsigned int   pitch,
+               T (&items)[items_per_thread],
+               unsigned int   valid_rows,
+               unsigned int   valid_cols)
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        store(tile, pitch, items, valid_rows, valid_cols, storage);
+    }
+
+private:
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static unsigned int first_index(const unsigned int flat_id)
+    {
+        return striped ? flat_id : flat_id * items_per_thread;
+    }
+
+    template<class OutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store_full(const unsigned int flat_id,
+                    OutputIterator     tile,
+                    const unsigned int pitch,
+                    T (&items)[items_per_thread],
+                    std::false_type /* use_vector_stores */)
+    {
+        ::rocprim::detail::block_store_2d_direct<ColsPerTile, stride>(first_index(flat_id),
+                                                                      tile,
+                                                                      pitch,
+                                                                      items);
+    }
+
+    template<class OutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store_full(const unsigned int flat_id,
+                    OutputIterator     tile,
+                    const unsigned int pitch,
+                    T (&items)[items_per_thread],
+                    std::true_type /* use_vector_stores */)
+    {
+        if(::rocprim::detail::is_tile_2d_vector_aligned<T, items_per_thread>(tile, pitch))
+        {
+            // All items of the thread are in the same row
+            const size_t offset
+                = ::rocprim::detail::tile_2d_offset<ColsPerTile>(first_index(flat_id), pitch);
+            block_store_direct_blocked_vectorized(0, tile + offset, items);
+        }
+        else
+        {
+            store_full(flat_id, tile, pitch, items, std::false_type{});
+        }
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void exchange(T (&items)[items_per_thread], storage_type& storage, std::true_type /* transposed */)
+    {
+        block_exchange_type().blocked_to_striped(items, items, storage);
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void exchange(T (&items)[items_per_thread], storage_type& storage, std::false_type /* transposed */)
+    {
+        (void)items;
+        (void)storage;
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group blockmodule
+
+#endif // ROCPRIM_BLOCK_BLOCK_STORE_2D_HPP_
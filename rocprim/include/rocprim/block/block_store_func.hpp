@@ -28,6 +28,10 @@
 #include "../functional.hpp"
 #include "../types.hpp"
 
+#include "../iterator/cache_modified_output_iterator.hpp"
+#include "../iterator/transform_output_iterator.hpp"
+#include "../iterator/zip_iterator.hpp"
+
 /// \addtogroup blockmodule
 /// @{
 
@@ -185,6 +189,193 @@ block_store_direct_blocked_vectorized(unsigned int flat_id,
     block_store_direct_blocked(flat_id, block_output, items);
 }
 
+/// \brief Stores a blocked arrangement of items from across the thread block
+/// into a blocked arrangement on continuous memory, transforming the items with the
+/// functor of a transform_output_iterator.
+///
+/// The items are transformed in registers and stored to the underlying pointer with
+/// block_store_direct_blocked_vectorized, so the same conditions for vectorization apply.
+///
+/// \tparam T - [inferred] the output data type of the underlying pointer
+/// \tparam UnaryFunction - [inferred] the transform functor
+/// \tparam U - [inferred] the input data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_output - the output iterator from the thread block to store to
+/// \param items - array that data is stored to thread block
+template<
+    class T,
+    class UnaryFunction,
+    class U,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_store_direct_blocked_vectorized(unsigned int flat_id,
+                                           transform_output_iterator<T*, UnaryFunction> block_output,
+                                           U (&items)[ItemsPerThread])
+{
+    UnaryFunction transform_op = block_output.functor();
+
+    T transformed_items[ItemsPerThread];
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        transformed_items[item] = transform_op(items[item]);
+    }
+
+    block_store_direct_blocked_vectorized(flat_id, block_output.base(), transformed_items);
+}
+
+namespace detail
+{
+
+template<cache_store_modifier Modifier, class T, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void cache_modified_store_blocked_vectorized(unsigned int flat_id,
+                                             T* block_output,
+                                             U (&items)[ItemsPerThread],
+                                             std::true_type /* vectorizable */)
+{
+    typedef typename detail::match_vector_type<T, ItemsPerThread>::type vector_type;
+    // See cache_modified_load_blocked_vectorized
+    using word = typename cache_modified_word<vector_type>::type;
+    constexpr unsigned int words_per_thread = (sizeof(T) * ItemsPerThread) / sizeof(word);
+    alignas(vector_type) word words[words_per_thread];
+
+    T* raw_items = reinterpret_cast<T*>(words);
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        raw_items[item] = items[item];
+    }
+
+    word* word_ptr = reinterpret_cast<word*>(block_output) + (flat_id * words_per_thread);
+    cache_modified_store_words<Modifier>(word_ptr, words);
+}
+
+template<cache_store_modifier Modifier, class T, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void cache_modified_store_blocked_vectorized(unsigned int flat_id,
+                                             T* block_output,
+                                             U (&items)[ItemsPerThread],
+                                             std::false_type /* vectorizable */)
+{
+    block_store_direct_blocked(flat_id,
+                               cache_modified_output_iterator<Modifier, T>(block_output),
+                               items);
+}
+
+} // end namespace detail
+
+/// \brief Stores a blocked arrangement of items from across the thread block
+/// into a blocked arrangement on continuous memory with the cache modifier of
+/// a cache_modified_output_iterator.
+///
+/// The vectors are stored with the cache modifier, so the same conditions for vectorization
+/// as for block_store_direct_blocked_vectorized with a pointer apply.
+///
+/// \tparam Modifier - [inferred] the cache store modifier
+/// \tparam T - [inferred] the output data type
+/// \tparam U - [inferred] the input data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// The type \p U must be such that it can be implicitly converted to \p T.
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_output - the output iterator from the thread block to store to
+/// \param items - array that data is stored to thread block
+template<
+    cache_store_modifier Modifier,
+    class T,
+    class U,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_store_direct_blocked_vectorized(unsigned int flat_id,
+                                           cache_modified_output_iterator<Modifier, T> block_output,
+                                           U (&items)[ItemsPerThread])
+{
+    static_assert(std::is_convertible<U, T>::value,
+                  "The type U must be such that it can be implicitly converted to T.");
+
+    detail::cache_modified_store_blocked_vectorized<Modifier>(
+        flat_id,
+        block_output.base(),
+        items,
+        std::integral_constant<bool, detail::is_vectorizable<T, ItemsPerThread>::value>{});
+}
+
+namespace detail
+{
+
+// Stores the member Index of the items to one column of a zip_iterator of pointers
+template<size_t Index, class V, class T, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void zip_store_column_blocked_vectorized(unsigned int flat_id,
+                                         V* column,
+                                         T (&items)[ItemsPerThread])
+{
+    V column_items[ItemsPerThread];
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        column_items[item] = ::rocprim::get<Index>(items[item]);
+    }
+
+    block_store_direct_blocked_vectorized(flat_id, column, column_items);
+}
+
+template<class... Types, class T, unsigned int ItemsPerThread, size_t... Indices>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void zip_store_blocked_vectorized(unsigned int flat_id,
+                                  const ::rocprim::tuple<Types*...>& columns,
+                                  T (&items)[ItemsPerThread],
+                                  ::rocprim::index_sequence<Indices...>)
+{
+    int swallow[] = {(zip_store_column_blocked_vectorized<Indices>(flat_id,
+                                                                   ::rocprim::get<Indices>(columns),
+                                                                   items),
+                      0)...};
+    (void)swallow;
+}
+
+} // end namespace detail
+
+/// \brief Stores a blocked arrangement of items from across the thread block
+/// into a blocked arrangement on continuous memory, storing every column of a zip_iterator
+/// of pointers with block_store_direct_blocked_vectorized.
+///
+/// Each column is stored with vector stores of its own type, so that a structure of arrays
+/// is stored with the same bandwidth as its columns separately. The same conditions for
+/// vectorization as for a pointer apply to every column.
+///
+/// \tparam Types - [inferred] the types of the columns
+/// \tparam T - [inferred] the tuple type of the items
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_output - the output iterator from the thread block to store to
+/// \param items - array that data is stored to thread block
+template<
+    class... Types,
+    class T,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_store_direct_blocked_vectorized(unsigned int flat_id,
+                                           zip_iterator<::rocprim::tuple<Types*...>> block_output,
+                                           T (&items)[ItemsPerThread])
+{
+    detail::zip_store_blocked_vectorized(flat_id,
+                                         block_output.get_iterator_tuple(),
+                                         items,
+                                         ::rocprim::index_sequence_for<Types...>());
+}
+
 /// \brief Stores a striped arrangement of items from across the thread block
 /// into a blocked arrangement on continuous memory.
 ///
@@ -0,0 +1,549 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_BLOCK_BLOCK_TOPK_HPP_
+#define ROCPRIM_BLOCK_BLOCK_TOPK_HPP_
+
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/optional_values.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+#include "../intrinsics.hpp"
+#include "../thread/radix_key_codec.hpp"
+#include "../types.hpp"
+#include "../types/uninitialized_array.hpp"
+
+#include "block_scan.hpp"
+
+/// \addtogroup blockmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The \p block_topk class is a block level parallel primitive which provides methods
+/// for selecting the \p k largest or smallest keys (or key-value pairs) of the items
+/// partitioned across threads in a block, without sorting the whole tile.
+///
+/// \tparam Key - the key type.
+/// \tparam BlockSizeX - the number of threads in a block's x dimension.
+/// \tparam ItemsPerThread - the number of items contributed by each thread.
+/// \tparam Value - the value type. Default type empty_type indicates
+/// a keys-only selection.
+/// \tparam BlockSizeY - the number of threads in a block's y dimension, defaults to 1.
+/// \tparam BlockSizeZ - the number of threads in a block's z dimension, defaults to 1.
+/// \tparam RadixBitsPerPass - amount of bits to process per pass. The Default is 8.
+///
+/// \par Overview
+/// * The input is a tile in a blocked arrangement. Keys are ordered by their radix
+///   representation (see rocprim::radix_key_codec), so \p Key must be an arithmetic type.
+/// * The selection is a radix select: starting from the most significant bits, every pass
+///   builds a histogram of one digit of the remaining candidates in shared memory and keeps
+///   only the digit bucket that contains the <tt>k</tt>-th key. It stops as soon as the whole
+///   bucket is selected, so often fewer than <tt>sizeof(Key) * 8 / RadixBitsPerPass</tt>
+///   passes are needed.
+/// * The selected items are returned in the first \p k positions of the tile, in a blocked
+///   (\p select_max, \p select_min) or striped (\p select_max_to_striped,
+///   \p select_min_to_striped) arrangement. Items past the first \p k positions are undefined.
+/// * Unsorted output keeps the order of the tile. Sorted output orders the selected items
+///   from the best to the worst, equal keys keep the order of the tile. Sorting ranks every
+///   selected item against the others, which costs <tt>O(k * k / BlockSize)</tt> per thread,
+///   so it is intended for small \p k.
+/// * Among equal keys at the selection boundary, the ones first in the tile are selected.
+///
+/// \par Examples
+/// \parblock
+/// In the examples the 8 largest keys are selected in a block of 128 threads, each thread
+/// provides 4 \p float keys.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(...)
+/// {
+///     // specialize block_topk for float, block of 128 threads and 4 items per thread
+///     using block_topk_float = rocprim::block_topk<float, 128, 4>;
+///     // allocate storage in shared memory
+///     __shared__ block_topk_float::storage_type storage;
+///
+///     float keys[4];
+///     ...
+///     block_topk_float().select_max(keys, 8, storage, true);
+///     // thread 0 holds the 4 largest keys in descending order, thread 1 the next 4
+///     ...
+/// }
+/// \endcode
+/// \endparblock
+template<class Key,
+         unsigned int BlockSizeX,
+         unsigned int ItemsPerThread,
+         class Value                   = empty_type,
+         unsigned int BlockSizeY       = 1,
+         unsigned int BlockSizeZ       = 1,
+         unsigned int RadixBitsPerPass = 8>
+class block_topk
+{
+    static_assert(RadixBitsPerPass > 0 && RadixBitsPerPass < 32,
+                  "The RadixBitsPerPass should be larger than 0 and smaller than the size "
+                  "of an unsigned int");
+
+    static constexpr unsigned int BlockSize     = BlockSizeX * BlockSizeY * BlockSizeZ;
+    static constexpr unsigned int ItemsPerBlock = BlockSize * ItemsPerThread;
+    static constexpr bool         with_values   = !std::is_same<Value, empty_type>::value;
+
+    static constexpr unsigned int radix_digits = 1u << RadixBitsPerPass;
+    static constexpr unsigned int digits_per_thread
+        = ::rocprim::detail::ceiling_div(radix_digits, BlockSize);
+
+    using bit_key_type    = typename ::rocprim::radix_key_codec<Key>::bit_key_type;
+    using counter_type    = unsigned int;
+    using block_scan_type = ::rocprim::block_scan<counter_type,
+                                                  BlockSizeX,
+                                                  ::rocprim::block_scan_algorithm::using_warp_scan,
+                                                  BlockSizeY,
+                                                  BlockSizeZ>;
+
+    struct storage_type_
+    {
+        typename block_scan_type::storage_type scan;
+        union
+        {
+            counter_type bins[digits_per_thread * BlockSize];
+            struct
+            {
+                uninitialized_array<bit_key_type, ItemsPerBlock>          keys;
+                uninitialized_array<Value, with_values ? ItemsPerBlock : 1> values;
+            } exchange;
+        };
+        // The digit bucket that contains the k-th key, and how many keys of it are selected
+        unsigned int digit;
+        unsigned int digit_count;
+        unsigned int remaining;
+    };
+
+public:
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by related parallel primitive.
+    ///
+    /// Depending on the implemention the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords <tt>__shared__</tt>. It can be aliased to
+    /// an externally allocated memory, or be a part of a union type with other storage types
+    /// to increase shared memory reusability.
+    using storage_type = storage_type_;
+
+    /// \brief Selects the \p k largest keys of the block, in a blocked arrangement.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread. On return
+    /// the first \p k keys of the tile are the selected keys.
+    /// \param [in] k - the number of keys to select, the same for all threads. If it is
+    /// greater than the number of items of the block, all items are selected.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] sorted - [optional] if \p true, the selected keys are sorted in descending
+    /// order. Default value: \p false.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE void select_max(Key (&keys)[ItemsPerThread],
+                                                  const unsigned int k,
+                                                  storage_type&      storage,
+                                                  const bool         sorted = false)
+    {
+        empty_type values[ItemsPerThread];
+        select_impl<false, false>(keys, values, k, sorted, storage);
+    }
+
+    /// \brief Selects the key-value pairs with the \p k largest keys of the block, in a
+    /// blocked arrangement.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread. On return
+    /// the first \p k keys of the tile are the selected keys.
+    /// \param [in, out] values - reference to an array of values provided by a thread. The
+    /// values are moved together with their keys.
+    /// \param [in] k - the number of keys to select, the same for all threads. If it is
+    /// greater than the number of items of the block, all items are selected.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] sorted - [optional] if \p true, the selected pairs are sorted by key in
+    /// descending order. Default value: \p false.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE void select_max(Key (&keys)[ItemsPerThread],
+                                                  Value (&values)[ItemsPerThread],
+                                                  const unsigned int k,
+                                                  storage_type&      storage,
+                                                  const bool         sorted = false)
+    {
+        select_impl<false, false>(keys, values, k, sorted, storage);
+    }
+
+    /// \brief Selects the \p k smallest keys of the block, in a blocked arrangement.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread. On return
+    /// the first \p k keys of the tile are the selected keys.
+    /// \param [in] k - the number of keys to select, the same for all threads. If it is
+    /// greater than the number of items of the block, all items are selected.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] sorted - [optional] if \p true, the selected keys are sorted in ascending
+    /// order. Default value: \p false.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE void select_min(Key (&keys)[ItemsPerThread],
+                                                  const unsigned int k,
+                                                  storage_type&      storage,
+                                                  const bool         sorted = false)
+    {
+        empty_type values[ItemsPerThread];
+        select_impl<true, false>(keys, values, k, sorted, storage);
+    }
+
+    /// \brief Selects the key-value pairs with the \p k smallest keys of the block, in a
+    /// blocked arrangement.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread. On return
+    /// the first \p k keys of the tile are the selected keys.
+    /// \param [in, out] values - reference to an array of values provided by a thread. The
+    /// values are moved together with their keys.
+    /// \param [in] k - the number of keys to select, the same for all threads. If it is
+    /// greater than the number of items of the block, all items are selected.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] sorted - [optional] if \p true, the selected pairs are sorted by key in
+    /// ascending order. Default value: \p false.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE void select_min(Key (&keys)[ItemsPerThread],
+                                                  Value (&values)[ItemsPerThread],
+                                                  const unsigned int k,
+                                                  storage_type&      storage,
+                                                  const bool         sorted = false)
+    {
+        select_impl<true, false>(keys, values, k, sorted, storage);
+    }
+
+    /// \brief Selects the \p k largest keys of the block, in a striped arrangement.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread. On return
+    /// the first \p k keys of the tile, in a striped arrangement, are the selected keys.
+    /// \param [in] k - the number of keys to select, the same for all threads. If it is
+    /// greater than the number of items of the block, all items are selected.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] sorted - [optional] if \p true, the selected keys are sorted in descending
+    /// order. Default value: \p false.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE void select_max_to_striped(Key (&keys)[ItemsPerThread],
+                                                             const unsigned int k,
+                                                             storage_type&      storage,
+                                                             const bool         sorted = false)
+    {
+        empty_type values[ItemsPerThread];
+        select_impl<false, true>(keys, values, k, sorted, storage);
+    }
+
+    /// \brief Selects the key-value pairs with the \p k largest keys of the block, in a
+    /// striped arrangement.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread. On return
+    /// the first \p k keys of the tile, in a striped arrangement, are the selected keys.
+    /// \param [in, out] values - reference to an array of values provided by a thread. The
+    /// values are moved together with their keys.
+    /// \param [in] k - the number of keys to select, the same for all threads. If it is
+    /// greater than the number of items of the block, all items are selected.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] sorted - [optional] if \p true, the selected pairs are sorted by key in
+    /// descending order. Default value: \p false.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE void select_max_to_striped(Key (&keys)[ItemsPerThread],
+                                                             Value (&values)[ItemsPerThread],
+                                                             const unsigned int k,
+                                                             storage_type&      storage,
+                                                             const bool         sorted = false)
+    {
+        select_impl<false, true>(keys, values, k, sorted, storage);
+    }
+
+    /// \brief Selects the \p k smallest keys of the block, in a striped arrangement.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread. On return
+    /// the first \p k keys of the tile, in a striped arrangement, are the selected keys.
+    /// \param [in] k - the number of keys to select, the same for all threads. If it is
+    /// greater than the number of items of the block, all items are selected.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] sorted - [optional] if \p true, the selected keys are sorted in ascending
+    /// order. Default value: \p false.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE void select_min_to_striped(Key (&keys)[ItemsPerThread],
+                                                             const unsigned int k,
+                                                             storage_type&      storage,
+                                                             const bool         sorted = false)
+    {
+        empty_type values[ItemsPerThread];
+        select_impl<true, true>(keys, values, k, sorted, storage);
+    }
+
+    /// \brief Selects the key-value pairs with the \p k smallest keys of the block, in a
+    /// striped arrangement.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread. On return
+    /// the first \p k keys of the tile, in a striped arrangement, are the selected keys.
+    /// \param [in, out] values - reference to an array of values provided by a thread. The
+    /// values are moved together with their keys.
+    /// \param [in] k - the number of keys to select, the same for all threads. If it is
+    /// greater than the number of items of the block, all items are selected.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] sorted - [optional] if \p true, the selected pairs are sorted by key in
+    /// ascending order. Default value: \p false.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE void select_min_to_striped(Key (&keys)[ItemsPerThread],
+                                                             Value (&values)[ItemsPerThread],
+                                                             const unsigned int k,
+                                                             storage_type&      storage,
+                                                             const bool         sorted = false)
+    {
+        select_impl<true, true>(keys, values, k, sorted, storage);
+    }
+
+private:
+    template<class V>
+    using values_tag = detail::moves_values<Value, V>;
+
+    // Finds the bits of the k-th largest key by radix select. On return the keys with
+    // (key & mask) > prefix are selected, and the first remaining keys of the tile with
+    // (key & mask) == prefix.
+    ROCPRIM_DEVICE ROCPRIM_INLINE void
+        find_threshold(const bit_key_type (&bit_keys)[ItemsPerThread],
+                       const unsigned int flat_id,
+                       bit_key_type&      prefix,
+                       bit_key_type&      mask,
+                       unsigned int&      remaining,
+                       storage_type&      storage)
+    {
+        constexpr unsigned int key_bits = 8 * sizeof(bit_key_type);
+
+        for(unsigned int end_bit = key_bits; end_bit > 0;)
+        {
+            const unsigned int pass_bits = ::rocprim::min(RadixBitsPerPass, end_bit);
+            const unsigned int begin_bit = end_bit - pass_bits;
+            const bit_key_type digit_mask
+                = static_cast<bit_key_type>((bit_key_type(1) << pass_bits) - 1u);
+
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < digits_per_thread; ++i)
+            {
+                storage.bins[flat_id * digits_per_thread + i] = 0;
+            }
+            ::rocprim::syncthreads();
+
+            // Histogram of the digit of the keys that still can be the k-th key
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < ItemsPerThread; ++i)
+            {
+                if((bit_keys[i] & mask) == prefix)
+                {
+                    const unsigned int digit
+                        = static_cast<unsigned int>((bit_keys[i] >> begin_bit) & digit_mask);
+                    ::rocprim::detail::atomic_add(&storage.bins[digit], 1u);
+                }
+            }
+            ::rocprim::syncthreads();
+
+            // Count the keys with a digit greater or equal than every digit, by scanning the
+            // bins from the largest digit
+            counter_type counts[digits_per_thread];
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < digits_per_thread; ++i)
+            {
+                const unsigned int index = flat_id * digits_per_thread + i;
+                counts[i] = index < radix_digits ? storage.bins[radix_digits - 1 - index] : 0;
+            }
+            counter_type inclusive_counts[digits_per_thread];
+            block_scan_type().inclusive_scan(counts, inclusive_counts, storage.scan);
+
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < digits_per_thread; ++i)
+            {
+                const counter_type exclusive_count = inclusive_counts[i] - counts[i];
+                if(exclusive_count < remaining && remaining <= inclusive_counts[i])
+                {
+                    storage.digit       = radix_digits - 1 - (flat_id * digits_per_thread + i);
+                    storage.digit_count = counts[i];
+                    storage.remaining   = remaining - exclusive_count;
+                }
+            }
+            ::rocprim::syncthreads();
+
+            const bit_key_type digit = storage.digit;
+            prefix |= digit << begin_bit;
+            mask |= digit_mask << begin_bit;
+            const bool done = storage.digit_count == storage.remaining;
+            remaining       = storage.remaining;
+            end_bit         = begin_bit;
+            // All the keys of the bucket are selected, the remaining bits don't matter
+            if(done)
+            {
+                break;
+            }
+        }
+    }
+
+    // Sorts the first k items of the exchange storage from the largest to the smallest key.
+    template<class V>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void sort_selected(const unsigned int k,
+                                                     const unsigned int flat_id,
+                                                     V (&values)[ItemsPerThread],
+                                                     storage_type& storage)
+    {
+        bit_key_type thread_keys[ItemsPerThread];
+        unsigned int ranks[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            const unsigned int position = i * BlockSize + flat_id;
+            if(position < k)
+            {
+                thread_keys[i] = storage.exchange.keys.get_unsafe_array()[position];
+                detail::load_value(storage.exchange.values, position, values[i], values_tag<V>{});
+                // The rank is the number of keys that go before this one
+                ranks[i] = 0;
+                for(unsigned int j = 0; j < k; ++j)
+                {
+                    const bit_key_type other = storage.exchange.keys.get_unsafe_array()[j];
+                    ranks[i] += other > thread_keys[i] || (other == thread_keys[i] && j < position);
+                }
+            }
+        }
+        ::rocprim::syncthreads();
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            if(i * BlockSize + flat_id < k)
+            {
+                storage.exchange.keys.emplace(ranks[i], thread_keys[i]);
+                detail::store_value(storage.exchange.values, ranks[i], values[i], values_tag<V>{});
+            }
+        }
+        ::rocprim::syncthreads();
+    }
+
+    template<bool Min, bool ToStriped, class V>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void select_impl(Key (&keys)[ItemsPerThread],
+                                                   V (&values)[ItemsPerThread],
+                                                   unsigned int  k,
+                                                   const bool    sorted,
+                                                   storage_type& storage)
+    {
+        // The smallest keys are the largest ones of the descending radix representation
+        using key_codec = ::rocprim::radix_key_codec<Key, Min>;
+
+        const unsigned int flat_id
+            = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        k = ::rocprim::min(k, ItemsPerBlock);
+
+        bit_key_type bit_keys[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            bit_keys[i] = key_codec::encode(keys[i]);
+        }
+
+        bit_key_type prefix    = 0;
+        bit_key_type mask      = 0;
+        unsigned int remaining = k;
+        if(k > 0 && k < ItemsPerBlock)
+        {
+            find_threshold(bit_keys, flat_id, prefix, mask, remaining, storage);
+        }
+
+        // Rank the keys equal to the threshold, only the first remaining ones are selected
+        counter_type ties[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            ties[i] = (bit_keys[i] & mask) == prefix;
+        }
+        counter_type tie_ranks[ItemsPerThread];
+        block_scan_type().exclusive_scan(ties, tie_ranks, 0, storage.scan);
+        ::rocprim::syncthreads();
+
+        counter_type selected[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            selected[i] = (bit_keys[i] & mask) > prefix || (ties[i] && tie_ranks[i] < remaining);
+        }
+        counter_type positions[ItemsPerThread];
+        block_scan_type().exclusive_scan(selected, positions, 0, storage.scan);
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            if(selected[i])
+            {
+                storage.exchange.keys.emplace(positions[i], bit_keys[i]);
+                detail::store_value(storage.exchange.values,
+                                    positions[i],
+                                    values[i],
+                                    values_tag<V>{});
+            }
+        }
+        ::rocprim::syncthreads();
+
+        if(sorted)
+        {
+            sort_selected(k, flat_id, values, storage);
+        }
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            const unsigned int position
+                = ToStriped ? i * BlockSize + flat_id : flat_id * ItemsPerThread + i;
+            if(position < k)
+            {
+                keys[i] = key_codec::decode(storage.exchange.keys.get_unsafe_array()[position]);
+                detail::load_value(storage.exchange.values, position, values[i], values_tag<V>{});
+            }
+        }
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group blockmodule
+
+#endif // ROCPRIM_BLOCK_BLOCK_TOPK_HPP_
@@ -0,0 +1,203 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_BLOCK_DETAIL_BLOCK_HISTOGRAM_WARP_AGGREGATED_HPP_
+#define ROCPRIM_BLOCK_DETAIL_BLOCK_HISTOGRAM_WARP_AGGREGATED_HPP_
+
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+
+#include "../../intrinsics.hpp"
+#include "../../functional.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Adds the number of lanes with `valid` set to `hist[bin]`, issuing a single atomic per distinct
+// bin of the warp. Groups of equal bins are peeled off one at a time: the lowest remaining lane
+// becomes the leader and every lane with the leader's bin joins its group. The number of
+// iterations equals the number of distinct bins in the warp, which makes this cheap for skewed
+// inputs where most lanes hit the same few bins.
+// All lanes of the warp must call this function.
+template<class Counter>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void warp_aggregated_atomic_add(Counter* hist, const unsigned int bin, const bool valid)
+{
+    ::rocprim::lane_mask_type remaining = ::rocprim::ballot(valid);
+    while(remaining != 0)
+    {
+        const unsigned int leader     = ::rocprim::ctz(remaining);
+        const unsigned int leader_bin = ::rocprim::warp_shuffle(bin, leader);
+        const ::rocprim::lane_mask_type peers
+            = ::rocprim::ballot(valid && bin == leader_bin) & remaining;
+        if(::rocprim::lane_id() == leader)
+        {
+            detail::atomic_add(&hist[leader_bin], Counter(::rocprim::bit_count(peers)));
+        }
+        remaining &= ~peers;
+    }
+}
+
+template<
+    class T,
+    unsigned int BlockSizeX,
+    unsigned int BlockSizeY,
+    unsigned int BlockSizeZ,
+    unsigned int ItemsPerThread,
+    unsigned int Bins
+>
+class block_histogram_warp_aggregated
+{
+    static constexpr unsigned int BlockSize = BlockSizeX * BlockSizeY * BlockSizeZ;
+    static constexpr unsigned int warps_no_
+        = ::rocprim::detail::ceiling_div(BlockSize, ::rocprim::device_warp_size());
+    // Upper bound on the number of privatised counters kept in shared memory
+    static constexpr unsigned int max_private_counters_ = 4096;
+    // Number of sub-histograms the warps are spread over. The first one is the output
+    // histogram itself, the others live in the storage and are merged at the end.
+    static constexpr unsigned int sub_histograms_ = ::rocprim::max(
+        1u, ::rocprim::min(warps_no_, (max_private_counters_ + Bins) / Bins));
+    static constexpr unsigned int private_counters_ = (sub_histograms_ - 1) * Bins;
+
+    static_assert(
+        std::is_convertible<T, unsigned int>::value,
+        "T must be convertible to unsigned int"
+    );
+
+    struct private_storage_type
+    {
+        unsigned int counters[private_counters_ > 0 ? private_counters_ : 1];
+    };
+
+public:
+    using storage_type = typename std::conditional<(private_counters_ > 0),
+                                                   private_storage_type,
+                                                   detail::empty_storage_type>::type;
+
+    template<class Counter>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void composite(T (&input)[ItemsPerThread],
+                   Counter hist[Bins])
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        this->composite(input, hist, storage);
+    }
+
+    template<class Counter>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void composite(T (&input)[ItemsPerThread],
+                   Counter hist[Bins],
+                   storage_type& storage)
+    {
+        static_assert(
+            std::is_same<Counter, unsigned int>::value || std::is_same<Counter, int>::value ||
+            std::is_same<Counter, float>::value || std::is_same<Counter, unsigned long long>::value,
+            "Counter must be type that is supported by atomics (float, int, unsigned int, unsigned long long)"
+        );
+        composite_impl(input,
+                       hist,
+                       storage,
+                       std::integral_constant<bool, (private_counters_ > 0)>{});
+    }
+
+private:
+    template<class Counter>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void composite_impl(T (&input)[ItemsPerThread],
+                        Counter hist[Bins],
+                        storage_type& storage,
+                        std::false_type /* privatised */)
+    {
+        (void) storage;
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            warp_aggregated_atomic_add(hist, static_cast<unsigned int>(input[i]), true);
+        }
+        ::rocprim::syncthreads();
+    }
+
+    template<class Counter>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void composite_impl(T (&input)[ItemsPerThread],
+                        Counter hist[Bins],
+                        storage_type& storage,
+                        std::true_type /* privatised */)
+    {
+        const unsigned int flat_tid
+            = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        const unsigned int sub_histogram
+            = ::rocprim::warp_id(flat_tid) % sub_histograms_;
+
+        for(unsigned int offset = flat_tid; offset < private_counters_; offset += BlockSize)
+        {
+            storage.counters[offset] = 0;
+        }
+        ::rocprim::syncthreads();
+
+        if(sub_histogram == 0)
+        {
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < ItemsPerThread; ++i)
+            {
+                warp_aggregated_atomic_add(hist, static_cast<unsigned int>(input[i]), true);
+            }
+        }
+        else
+        {
+            unsigned int* private_hist = &storage.counters[(sub_histogram - 1) * Bins];
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < ItemsPerThread; ++i)
+            {
+                warp_aggregated_atomic_add(private_hist,
+                                           static_cast<unsigned int>(input[i]),
+                                           true);
+            }
+        }
+        ::rocprim::syncthreads();
+
+        // Merge the privatised sub-histograms into the output. Atomics are still required as
+        // the output may be shared with other blocks.
+        for(unsigned int bin = flat_tid; bin < Bins; bin += BlockSize)
+        {
+            unsigned int count = 0;
+            ROCPRIM_UNROLL
+            for(unsigned int h = 0; h < sub_histograms_ - 1; ++h)
+            {
+                count += storage.counters[h * Bins + bin];
+            }
+            if(count != 0)
+            {
+                detail::atomic_add(&hist[bin], Counter(count));
+            }
+        }
+        ::rocprim::syncthreads();
+    }
+};
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_BLOCK_DETAIL_BLOCK_HISTOGRAM_WARP_AGGREGATED_HPP_
@@ -0,0 +1,179 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_BLOCK_DETAIL_BLOCK_LOAD_STORE_2D_HPP_
+#define ROCPRIM_BLOCK_DETAIL_BLOCK_LOAD_STORE_2D_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Tiles of 2D ranges are addressed by the flat row-major index of an item in the tile,
+// `index = row * ColsPerTile + col`. The item is located at `row * pitch + col` relative
+// to the first item of the tile.
+template<unsigned int ColsPerTile>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+size_t tile_2d_offset(const unsigned int index, const unsigned int pitch)
+{
+    return static_cast<size_t>(index / ColsPerTile) * pitch + index % ColsPerTile;
+}
+
+template<unsigned int ColsPerTile>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+bool tile_2d_in_range(const unsigned int index,
+                      const unsigned int valid_rows,
+                      const unsigned int valid_cols)
+{
+    return index / ColsPerTile < valid_rows && index % ColsPerTile < valid_cols;
+}
+
+// Returns true if every row of the tile is suitably aligned for vector accesses of
+// ItemsPerThread items starting at multiples of ItemsPerThread columns.
+template<class T, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+bool is_tile_2d_vector_aligned(const T* tile, const unsigned int pitch)
+{
+    using vector_type = typename match_vector_type<T, ItemsPerThread>::type;
+    return reinterpret_cast<uintptr_t>(tile) % alignof(vector_type) == 0
+           && (static_cast<size_t>(pitch) * sizeof(T)) % alignof(vector_type) == 0;
+}
+
+// Loads items[i] from the tile index `first + i * Stride`.
+template<unsigned int ColsPerTile,
+         unsigned int Stride,
+         class InputIterator,
+         class T,
+         unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_2d_direct(const unsigned int first,
+                          InputIterator      tile,
+                          const unsigned int pitch,
+                          T (&items)[ItemsPerThread])
+{
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        items[item] = tile[tile_2d_offset<ColsPerTile>(first + item * Stride, pitch)];
+    }
+}
+
+template<unsigned int ColsPerTile,
+         unsigned int Stride,
+         class InputIterator,
+         class T,
+         unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_2d_direct(const unsigned int first,
+                          InputIterator      tile,
+                          const unsigned int pitch,
+                          T (&items)[ItemsPerThread],
+                          const unsigned int valid_rows,
+                          const unsigned int valid_cols)
+{
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        const unsigned int index = first + item * Stride;
+        if(tile_2d_in_range<ColsPerTile>(index, valid_rows, valid_cols))
+        {
+            items[item] = tile[tile_2d_offset<ColsPerTile>(index, pitch)];
+        }
+    }
+}
+
+template<unsigned int ColsPerTile,
+         unsigned int Stride,
+         class InputIterator,
+         class T,
+         unsigned int ItemsPerThread,
+         class Default>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_2d_direct(const unsigned int first,
+                          InputIterator      tile,
+                          const unsigned int pitch,
+                          T (&items)[ItemsPerThread],
+                          const unsigned int valid_rows,
+                          const unsigned int valid_cols,
+                          Default            out_of_bounds)
+{
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        items[item] = static_cast<T>(out_of_bounds);
+    }
+    block_load_2d_direct<ColsPerTile, Stride>(first, tile, pitch, items, valid_rows, valid_cols);
+}
+
+// Stores items[i] to the tile index `first + i * Stride`.
+template<unsigned int ColsPerTile,
+         unsigned int Stride,
+         class OutputIterator,
+         class T,
+         unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_store_2d_direct(const unsigned int first,
+                           OutputIterator     tile,
+                           const unsigned int pitch,
+                           T (&items)[ItemsPerThread])
+{
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        tile[tile_2d_offset<ColsPerTile>(first + item * Stride, pitch)] = items[item];
+    }
+}
+
+template<unsigned int ColsPerTile,
+         unsigned int Stride,
+         class OutputIterator,
+         class T,
+         unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_store_2d_direct(const unsigned int first,
+                           OutputIterator     tile,
+                           const unsigned int pitch,
+                           T (&items)[ItemsPerThread],
+                           const unsigned int valid_rows,
+                           const unsigned int valid_cols)
+{
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        const unsigned int index = first + item * Stride;
+        if(tile_2d_in_range<ColsPerTile>(index, valid_rows, valid_cols))
+        {
+            tile[tile_2d_offset<ColsPerTile>(index, pitch)] = items[item];
+        }
+    }
+}
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_BLOCK_DETAIL_BLOCK_LOAD_STORE_2D_HPP_
@@ -0,0 +1,219 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_BLOCK_DETAIL_BLOCK_LOAD_STORE_VECTORIZED_HPP_
+#define ROCPRIM_BLOCK_DETAIL_BLOCK_LOAD_STORE_VECTORIZED_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Vectorized accesses used by device-level algorithms for full tiles.
+//
+// Tiles are accessed in a vector-striped arrangement: thread `flat_id` holds the vectors
+// `j * BlockSize + flat_id` of the tile, each of `items_per_vector` consecutive items. Like the
+// striped arrangement it keeps accesses of consecutive threads adjacent, but with the full
+// vector width. Algorithms that need a blocked arrangement transpose it through
+// block_exchange.
+template<class T, unsigned int ItemsPerThread>
+struct vector_access
+{
+    using vector_type = typename match_vector_type<T, ItemsPerThread>::type;
+
+    static constexpr unsigned int items_per_vector   = sizeof(vector_type) / sizeof(T);
+    static constexpr unsigned int vectors_per_thread = ItemsPerThread / items_per_vector;
+
+    // Vectors must hold a whole number of items and more than one of them
+    static constexpr bool value = is_vectorizable<T, ItemsPerThread>::value
+                                  && sizeof(vector_type) % sizeof(T) == 0
+                                  && std::is_trivially_copyable<T>::value;
+
+    // Index of the item `item` of thread `flat_id` within the tile
+    template<unsigned int BlockSize>
+    ROCPRIM_HOST_DEVICE
+    static constexpr unsigned int tile_index(const unsigned int flat_id, const unsigned int item)
+    {
+        return ((item / items_per_vector) * BlockSize + flat_id) * items_per_vector
+               + item % items_per_vector;
+    }
+
+    // Index in a blocked arrangement of the item that has index `index` within the tile
+    template<unsigned int BlockSize>
+    ROCPRIM_HOST_DEVICE
+    static constexpr unsigned int blocked_index(const unsigned int index)
+    {
+        return ((index / items_per_vector) % BlockSize) * ItemsPerThread
+               + (index / items_per_vector / BlockSize) * items_per_vector
+               + index % items_per_vector;
+    }
+};
+
+// Vector accesses are possible when the iterator is a pointer to an item type that can be
+// vectorized with ItemsPerThread items per thread.
+template<class Iterator, unsigned int ItemsPerThread>
+struct is_vector_accessible : std::false_type
+{};
+
+template<class T, unsigned int ItemsPerThread>
+struct is_vector_accessible<T*, ItemsPerThread>
+    : std::integral_constant<
+          bool,
+          vector_access<typename std::remove_cv<T>::type, ItemsPerThread>::value>
+{};
+
+template<class T, unsigned int ItemsPerThread>
+ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+bool is_vector_aligned(const T* ptr)
+{
+    using vector_type = typename vector_access<T, ItemsPerThread>::vector_type;
+    return reinterpret_cast<uintptr_t>(ptr) % alignof(vector_type) == 0;
+}
+
+// The number of items before the first address after `ptr` that is aligned for vector accesses.
+// When the misalignment is not a whole number of items, the result is not aligned either,
+// which must be checked with is_vector_aligned.
+template<class T, unsigned int ItemsPerThread>
+ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+unsigned int vector_alignment_head(const T* ptr)
+{
+    using vector_type = typename vector_access<T, ItemsPerThread>::vector_type;
+    constexpr uintptr_t alignment = alignof(vector_type);
+
+    const uintptr_t misalignment = reinterpret_cast<uintptr_t>(ptr) % alignment;
+    return static_cast<unsigned int>(((alignment - misalignment) % alignment) / sizeof(T));
+}
+
+// Loads a full tile into a vector-striped arrangement. `tile` must be aligned for vector accesses.
+template<unsigned int BlockSize, class T, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_vector_striped(const unsigned int flat_id,
+                               const T*           tile,
+                               U (&items)[ItemsPerThread])
+{
+    using access      = vector_access<typename std::remove_cv<T>::type, ItemsPerThread>;
+    using vector_type = typename access::vector_type;
+
+    vector_type vectors[access::vectors_per_thread];
+
+    const vector_type* vector_ptr = reinterpret_cast<const vector_type*>(tile) + flat_id;
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < access::vectors_per_thread; i++)
+    {
+        vectors[i] = vector_ptr[i * BlockSize];
+    }
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        items[i] = reinterpret_cast<const T*>(vectors)[i];
+    }
+}
+
+// Stores a full tile from a vector-striped arrangement. `tile` must be aligned for vector accesses.
+template<unsigned int BlockSize, class T, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_store_vector_striped(const unsigned int flat_id,
+                                T*                 tile,
+                                const U (&items)[ItemsPerThread])
+{
+    using access      = vector_access<T, ItemsPerThread>;
+    using vector_type = typename access::vector_type;
+
+    vector_type vectors[access::vectors_per_thread];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        reinterpret_cast<T*>(vectors)[i] = static_cast<T>(items[i]);
+    }
+
+    vector_type* vector_ptr = reinterpret_cast<vector_type*>(tile) + flat_id;
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < access::vectors_per_thread; i++)
+    {
+        vector_ptr[i * BlockSize] = vectors[i];
+    }
+}
+
+// Loads a full tile into a blocked arrangement with vector loads, transposing the items through
+// the storage of BlockExchange. `tile` must be aligned for vector accesses.
+template<class BlockExchange,
+         unsigned int BlockSize,
+         class T,
+         class U,
+         unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_vector_transpose(const unsigned int                    flat_id,
+                                 const T*                              tile,
+                                 U (&items)[ItemsPerThread],
+                                 typename BlockExchange::storage_type& storage)
+{
+    using access = vector_access<typename std::remove_cv<T>::type, ItemsPerThread>;
+
+    block_load_vector_striped<BlockSize>(flat_id, tile, items);
+
+    unsigned int ranks[ItemsPerThread];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        ranks[i] = access::template tile_index<BlockSize>(flat_id, i);
+    }
+    BlockExchange().scatter_to_blocked(items, items, ranks, storage);
+}
+
+// Stores a full tile from a blocked arrangement with vector stores, transposing the items through
+// the storage of BlockExchange. `tile` must be aligned for vector accesses.
+template<class BlockExchange,
+         unsigned int BlockSize,
+         class T,
+         class U,
+         unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_store_vector_transpose(const unsigned int                    flat_id,
+                                  T*                                    tile,
+                                  U (&items)[ItemsPerThread],
+                                  typename BlockExchange::storage_type& storage)
+{
+    using access = vector_access<T, ItemsPerThread>;
+
+    unsigned int ranks[ItemsPerThread];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        ranks[i] = access::template blocked_index<BlockSize>(flat_id * ItemsPerThread + i);
+    }
+    BlockExchange().scatter_to_blocked(items, items, ranks, storage);
+
+    block_store_vector_striped<BlockSize>(flat_id, tile, items);
+}
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_BLOCK_DETAIL_BLOCK_LOAD_STORE_VECTORIZED_HPP_
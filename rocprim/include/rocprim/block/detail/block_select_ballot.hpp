@@ -0,0 +1,110 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_BLOCK_DETAIL_BLOCK_SELECT_BALLOT_HPP_
+#define ROCPRIM_BLOCK_DETAIL_BLOCK_SELECT_BALLOT_HPP_
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../intrinsics.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+/// Computes the rank of every flagged item of a blocked tile among the flagged items of the
+/// block. For every item index, the flags of a warp fit in a single lane mask, so the ranks
+/// within a warp are computed with ballots and bit counts, and only the per-warp counts are
+/// exchanged through shared memory.
+template<unsigned int BlockSizeX,
+         unsigned int ItemsPerThread,
+         unsigned int BlockSizeY = 1,
+         unsigned int BlockSizeZ = 1>
+class block_select_ballot
+{
+    static constexpr unsigned int block_size = BlockSizeX * BlockSizeY * BlockSizeZ;
+    static constexpr unsigned int warps
+        = ::rocprim::detail::ceiling_div(block_size, device_warp_size());
+
+public:
+    struct storage_type
+    {
+        unsigned int warp_counts[warps];
+    };
+
+    /// Returns the number of flagged items of the block, and the rank of each flagged item in
+    /// \p ranks. Only the first \p valid_items items of the tile are considered. The ranks of
+    /// items which are not flagged are the number of flagged items before them.
+    template<class Flag>
+    ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int rank(const Flag (&flags)[ItemsPerThread],
+                                                    bool (&selected)[ItemsPerThread],
+                                                    unsigned int (&ranks)[ItemsPerThread],
+                                                    const unsigned int flat_id,
+                                                    const unsigned int valid_items,
+                                                    storage_type&      storage)
+    {
+        const unsigned int warp_id = ::rocprim::warp_id(flat_id);
+
+        // Number of flagged items of the lower lanes of the warp
+        unsigned int lane_prefix = 0;
+        unsigned int warp_count  = 0;
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            selected[i] = flags[i] && flat_id * ItemsPerThread + i < valid_items;
+
+            const ::rocprim::lane_mask_type mask = ::rocprim::ballot(selected[i]);
+            lane_prefix = ::rocprim::masked_bit_count(mask, lane_prefix);
+            warp_count += ::rocprim::bit_count(mask);
+        }
+
+        if(::rocprim::lane_id() == 0)
+        {
+            storage.warp_counts[warp_id] = warp_count;
+        }
+        ::rocprim::syncthreads();
+
+        unsigned int warp_prefix = 0;
+        unsigned int block_count = 0;
+        ROCPRIM_UNROLL
+        for(unsigned int w = 0; w < warps; ++w)
+        {
+            const unsigned int count = storage.warp_counts[w];
+            warp_prefix += w < warp_id ? count : 0;
+            block_count += count;
+        }
+
+        unsigned int rank = warp_prefix + lane_prefix;
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            ranks[i] = rank;
+            rank += selected[i] ? 1 : 0;
+        }
+        return block_count;
+    }
+};
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_BLOCK_DETAIL_BLOCK_SELECT_BALLOT_HPP_
@@ -0,0 +1,67 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DETAIL_OPTIONAL_VALUES_HPP_
+#define ROCPRIM_DETAIL_OPTIONAL_VALUES_HPP_
+
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../types.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+namespace detail
+{
+
+// Helpers for primitives that exchange optional values through shared memory. Keys-only
+// operations pass empty_type values, which are not moved even if Value is not empty_type.
+template<class Value, class V>
+using moves_values = std::integral_constant<bool,
+                                            !std::is_same<Value, empty_type>::value
+                                                && std::is_same<V, Value>::value>;
+
+template<class ValuesArray, class Value>
+ROCPRIM_DEVICE ROCPRIM_INLINE void
+    store_value(ValuesArray& values, unsigned int index, const Value& value, std::true_type)
+{
+    values.emplace(index, value);
+}
+
+template<class ValuesArray, class V>
+ROCPRIM_DEVICE ROCPRIM_INLINE void
+    store_value(ValuesArray&, unsigned int, const V&, std::false_type)
+{}
+
+template<class ValuesArray, class Value>
+ROCPRIM_DEVICE ROCPRIM_INLINE void
+    load_value(ValuesArray& values, unsigned int index, Value& value, std::true_type)
+{
+    value = values.get_unsafe_array()[index];
+}
+
+template<class ValuesArray, class V>
+ROCPRIM_DEVICE ROCPRIM_INLINE void
+    load_value(ValuesArray&, unsigned int, V&, std::false_type)
+{}
+
+} // end namespace detail
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DETAIL_OPTIONAL_VALUES_HPP_
@@ -0,0 +1,764 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_CONFIG_DATABASE_HPP_
+#define ROCPRIM_DEVICE_CONFIG_DATABASE_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../config.hpp"
+#include "../types.hpp"
+#include "config_types.hpp"
+#include "device_autotune.hpp"
+#include "device_launch_trace.hpp"
+
+/// \addtogroup primitivesmodule_deviceconfigs
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief Config type that lets the config database choose, at run time, between the
+/// compiled-in default configuration and a set of candidate configurations.
+///
+/// The kernels of every candidate are instantiated when the device-level function is
+/// compiled, so a config database can switch between them without rebuilding. Candidate
+/// <tt>0</tt> is always \p default_config (the configuration tables compiled into rocPRIM),
+/// which is also used when the database has no matching entry. The candidates \p Candidates
+/// are numbered from <tt>1</tt>, in order.
+///
+/// \tparam Candidates - configs accepted by the device-level function, for example
+/// <tt>rocprim::reduce_config<256, 16, rocprim::block_reduce_algorithm::using_warp_reduce></tt>.
+///
+/// The database is a text file with one entry per line:
+/// \code
+/// # algorithm   architecture   types         max_size   candidate
+/// reduce        gfx90a         float         65536      1
+/// reduce        gfx90a         float         *          2
+/// transform     *              int32,float   *          1
+/// \endcode
+/// An entry applies to a call of \p algorithm on a device of \p architecture, with value
+/// types \p types and a problem size of at most \p max_size. <tt>*</tt> matches any value.
+/// The algorithm is the name of the device-level function, so that each scan variant (e.g.
+/// <tt>inclusive_scan</tt>, <tt>exclusive_scan</tt>, <tt>deterministic_inclusive_scan</tt>)
+/// is tuned separately.
+/// The first matching entry wins. Arithmetic types are named <tt>int8</tt>, <tt>uint8</tt>,
+/// ..., <tt>int64</tt>, <tt>uint64</tt>, <tt>half</tt>, <tt>bfloat16</tt>, <tt>float</tt> and
+/// <tt>double</tt>, other types are named after their size, e.g. <tt>size12</tt>.
+/// Multiple types (e.g. input and output of \p transform) are separated by commas.
+///
+/// The database is read from the file in the \p ROCPRIM_CONFIG_DATABASE environment variable
+/// when it is first needed, and can be replaced with load_config_database().
+///
+/// Calls without a matching entry can also select their candidate by timing them, see
+/// enable_autotune().
+template<class... Candidates>
+struct tuned_config
+{};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS // Do not document
+
+namespace detail
+{
+
+struct config_database_entry
+{
+    std::string  algorithm; // empty matches any
+    std::string  arch; // empty matches any
+    std::string  types; // empty matches any
+    size_t       max_size;
+    unsigned int candidate;
+};
+
+using config_database = std::vector<config_database_entry>;
+
+struct config_database_state
+{
+    std::mutex                             mutex;
+    std::shared_ptr<const config_database> database;
+    // Set when the database has entries, checked before any key is built.
+    std::atomic<bool> enabled{false};
+};
+
+inline hipError_t parse_config_database(std::istream& input, config_database& database)
+{
+    const auto field
+        = [](const std::string& value) { return value == "*" ? std::string() : value; };
+
+    std::string line;
+    while(std::getline(input, line))
+    {
+        line = line.substr(0, line.find('#'));
+        std::istringstream fields(line);
+
+        std::string algorithm, arch, types, max_size, candidate;
+        if(!(fields >> algorithm))
+        {
+            continue;
+        }
+        std::string extra;
+        if(!(fields >> arch >> types >> max_size >> candidate) || (fields >> extra))
+        {
+            return hipErrorInvalidValue;
+        }
+
+        config_database_entry entry;
+        entry.algorithm = field(algorithm);
+        entry.arch      = field(arch);
+        entry.types     = field(types);
+        char* end       = nullptr;
+        if(max_size == "*")
+        {
+            entry.max_size = std::numeric_limits<size_t>::max();
+        }
+        else
+        {
+            entry.max_size = static_cast<size_t>(std::strtoull(max_size.c_str(), &end, 10));
+            if(*end != '\0')
+            {
+                return hipErrorInvalidValue;
+            }
+        }
+        entry.candidate = static_cast<unsigned int>(std::strtoul(candidate.c_str(), &end, 10));
+        if(*end != '\0')
+        {
+            return hipErrorInvalidValue;
+        }
+        database.push_back(std::move(entry));
+    }
+    return hipSuccess;
+}
+
+inline void set_config_database(config_database_state& state, config_database&& database)
+{
+    const bool                  enabled = !database.empty();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.database = std::make_shared<const config_database>(std::move(database));
+    state.enabled.store(enabled, std::memory_order_release);
+}
+
+inline hipError_t load_config_database(config_database_state& state, const char* path)
+{
+    std::ifstream file(path);
+    if(!file)
+    {
+        return hipErrorFileNotFound;
+    }
+    config_database  database;
+    const hipError_t result = parse_config_database(file, database);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    set_config_database(state, std::move(database));
+    return hipSuccess;
+}
+
+inline config_database_state& get_config_database_state()
+{
+    static config_database_state state;
+    // The environment is read once, on first use, and a malformed database is ignored.
+    static const bool from_environment = [] {
+        const char* path = std::getenv("ROCPRIM_CONFIG_DATABASE");
+        return path != nullptr && load_config_database(state, path) == hipSuccess;
+    }();
+    (void)from_environment;
+    return state;
+}
+
+inline const char* target_arch_name(const target_arch arch)
+{
+    switch(arch)
+    {
+        case target_arch::gfx803: return "gfx803";
+        case target_arch::gfx900: return "gfx900";
+        case target_arch::gfx906: return "gfx906";
+        case target_arch::gfx908: return "gfx908";
+        case target_arch::gfx90a: return "gfx90a";
+        case target_arch::gfx1030: return "gfx1030";
+        case target_arch::gfx1100: return "gfx1100";
+        case target_arch::gfx1102: return "gfx1102";
+        case target_arch::invalid:
+        case target_arch::unknown: break;
+    }
+    return "unknown";
+}
+
+template<class T, class Enable = void>
+struct config_database_type_name
+{
+    static std::string name()
+    {
+        return "size" + std::to_string(sizeof(T));
+    }
+};
+
+template<class T>
+struct config_database_type_name<T, std::enable_if_t<std::is_integral<T>::value>>
+{
+    static std::string name()
+    {
+        return (std::is_signed<T>::value ? "int" : "uint") + std::to_string(8 * sizeof(T));
+    }
+};
+
+#define ROCPRIM_DETAIL_CONFIG_DATABASE_TYPE_NAME(type, type_name) \
+    template<>                                                    \
+    struct config_database_type_name<type>                        \
+    {                                                             \
+        static std::string name()                                 \
+        {                                                         \
+            return type_name;                                     \
+        }                                                         \
+    };
+
+ROCPRIM_DETAIL_CONFIG_DATABASE_TYPE_NAME(float, "float")
+ROCPRIM_DETAIL_CONFIG_DATABASE_TYPE_NAME(double, "double")
+ROCPRIM_DETAIL_CONFIG_DATABASE_TYPE_NAME(::rocprim::half, "half")
+ROCPRIM_DETAIL_CONFIG_DATABASE_TYPE_NAME(::rocprim::bfloat16, "bfloat16")
+
+#undef ROCPRIM_DETAIL_CONFIG_DATABASE_TYPE_NAME
+
+template<class... Types>
+struct config_database_types;
+
+template<class T>
+struct config_database_types<T>
+{
+    static std::string name()
+    {
+        return config_database_type_name<std::remove_cv_t<T>>::name();
+    }
+};
+
+template<class T, class... Types>
+struct config_database_types<T, Types...>
+{
+    static std::string name()
+    {
+        return config_database_types<T>::name() + "," + config_database_types<Types...>::name();
+    }
+};
+
+/// Sets \p candidate to the candidate selected by the database and returns \p true, or
+/// returns \p false when there is no matching entry.
+inline bool lookup_config_database(const char*        algorithm,
+                                   const target_arch  arch,
+                                   const std::string& types,
+                                   const size_t       size,
+                                   unsigned int&      candidate)
+{
+    config_database_state&                 state = get_config_database_state();
+    std::shared_ptr<const config_database> database;
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        database = state.database;
+    }
+    if(!database)
+    {
+        return false;
+    }
+    const char* arch_name = target_arch_name(arch);
+    for(const config_database_entry& entry : *database)
+    {
+        if((entry.algorithm.empty() || entry.algorithm == algorithm)
+           && (entry.arch.empty() || entry.arch == arch_name)
+           && (entry.types.empty() || entry.types == types) && size <= entry.max_size)
+        {
+            candidate = entry.candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+template<class Config>
+struct is_tuned_config : std::false_type
+{};
+
+template<class... Candidates>
+struct is_tuned_config<tuned_config<Candidates...>> : std::true_type
+{};
+
+/// Calls \p function with the config_tag of \p Config, the default config is further split
+/// into the size buckets of \p SizeBucketTable.
+template<class Config, class SizeBucketTable>
+struct config_invoker
+{
+    template<class Function>
+    static hipError_t invoke(const size_t, const hipStream_t, void*, size_t*, Function&& function)
+    {
+        return function(config_tag<Config>{});
+    }
+};
+
+template<class SizeBucketTable>
+struct config_invoker<default_config, SizeBucketTable>
+{
+    template<class Function>
+    static hipError_t invoke(const size_t      size,
+                             const hipStream_t stream,
+                             void*             temporary_storage,
+                             size_t*           storage_size,
+                             Function&&        function)
+    {
+        return dispatch_size_bucket<SizeBucketTable>(size,
+                                                     stream,
+                                                     temporary_storage,
+                                                     storage_size,
+                                                     std::forward<Function>(function));
+    }
+};
+
+template<class SizeBucketTable, class Function>
+hipError_t invoke_config_candidate_impl(unsigned int,
+                                        tuned_config<>,
+                                        const size_t,
+                                        const hipStream_t,
+                                        void*,
+                                        size_t*,
+                                        Function&&)
+{
+    // Unreachable, the index is checked by the caller.
+    return hipErrorInvalidValue;
+}
+
+template<class SizeBucketTable, class Candidate, class... Candidates, class Function>
+hipError_t invoke_config_candidate_impl(const unsigned int index,
+                                        tuned_config<Candidate, Candidates...>,
+                                        const size_t      size,
+                                        const hipStream_t stream,
+                                        void*             temporary_storage,
+                                        size_t*           storage_size,
+                                        Function&&        function)
+{
+    if(index == 0)
+    {
+        return config_invoker<Candidate, SizeBucketTable>::invoke(size,
+                                                                  stream,
+                                                                  temporary_storage,
+                                                                  storage_size,
+                                                                  std::forward<Function>(function));
+    }
+    return invoke_config_candidate_impl<SizeBucketTable>(index - 1,
+                                                         tuned_config<Candidates...>{},
+                                                         size,
+                                                         stream,
+                                                         temporary_storage,
+                                                         storage_size,
+                                                         std::forward<Function>(function));
+}
+
+/// Calls \p function with the config_tag of the candidate at \p index of \p Candidates. The
+/// launches made by \p function report \p index as their kernel_launch_info::config_candidate.
+template<class SizeBucketTable, class Candidates, class Function>
+hipError_t invoke_config_candidate(const unsigned int index,
+                                   Candidates,
+                                   const size_t      size,
+                                   const hipStream_t stream,
+                                   void*             temporary_storage,
+                                   size_t*           storage_size,
+                                   Function&&        function)
+{
+    launch_trace_config_scope config_scope(index);
+    return invoke_config_candidate_impl<SizeBucketTable>(index,
+                                                         Candidates{},
+                                                         size,
+                                                         stream,
+                                                         temporary_storage,
+                                                         storage_size,
+                                                         std::forward<Function>(function));
+}
+
+template<class TunedConfig>
+struct tuned_config_candidates;
+
+template<class... Candidates>
+struct tuned_config_candidates<tuned_config<Candidates...>>
+{
+    using type = tuned_config<default_config, Candidates...>;
+    static constexpr unsigned int size = sizeof...(Candidates) + 1;
+};
+
+/// Runs every candidate on the data of the call and sets \p best to the fastest one.
+/// \p elapsed_ms is set to the device time spent, also when an error is returned. If the time
+/// budget runs out before all candidates are timed, \p complete is set to \p false and
+/// \p best is the fastest of the timed ones.
+template<class SizeBucketTable, class Candidates, class Function>
+hipError_t autotune_config_candidates(autotune_state&         state,
+                                      const autotune_options& options,
+                                      const unsigned int      candidate_count,
+                                      const size_t            size,
+                                      const hipStream_t       stream,
+                                      void*                   temporary_storage,
+                                      size_t*                 storage_size,
+                                      Function&               function,
+                                      unsigned int&           best,
+                                      float&                  elapsed_ms,
+                                      bool&                   complete)
+{
+    const unsigned int repetitions = std::max(options.repetitions, 1u);
+
+    hipEvent_t start;
+    hipEvent_t stop;
+    hipError_t result = hipEventCreate(&start);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    result = hipEventCreate(&stop);
+    if(result != hipSuccess)
+    {
+        (void)hipEventDestroy(start);
+        return result;
+    }
+
+    float best_time = std::numeric_limits<float>::max();
+    for(unsigned int index = 0; index < candidate_count && result == hipSuccess; ++index)
+    {
+        // The default config is always timed, so that there is a fastest candidate.
+        if(index != 0 && !autotune_has_budget(state, elapsed_ms))
+        {
+            complete = false;
+            break;
+        }
+        // An error of earlier work is reported to the user, not taken for a failed candidate.
+        const bool error_pending = hipPeekAtLastError() != hipSuccess;
+        // The warm-up run also loads the kernels of the candidate.
+        result = invoke_config_candidate<SizeBucketTable>(index,
+                                                          Candidates{},
+                                                          size,
+                                                          stream,
+                                                          temporary_storage,
+                                                          storage_size,
+                                                          function);
+        if(result != hipSuccess && index != 0 && !error_pending)
+        {
+            // The candidate cannot run on this device, e.g. it uses too much shared memory.
+            // Any error still pending now was caused by the candidate and must not be returned
+            // by later calls.
+            if(hipPeekAtLastError() != hipSuccess)
+            {
+                (void)hipGetLastError();
+            }
+            result = hipSuccess;
+            continue;
+        }
+        if(result == hipSuccess)
+        {
+            result = hipEventRecord(start, stream);
+        }
+        for(unsigned int i = 0; i < repetitions && result == hipSuccess; ++i)
+        {
+            result = invoke_config_candidate<SizeBucketTable>(index,
+                                                              Candidates{},
+                                                              size,
+                                                              stream,
+                                                              temporary_storage,
+                                                              storage_size,
+                                                              function);
+        }
+        if(result == hipSuccess)
+        {
+            result = hipEventRecord(stop, stream);
+        }
+        if(result == hipSuccess)
+        {
+            result = hipEventSynchronize(stop);
+        }
+        float time = 0.0f;
+        if(result == hipSuccess)
+        {
+            result = hipEventElapsedTime(&time, start, stop);
+        }
+        if(result == hipSuccess)
+        {
+            // Account for the untimed warm-up run too.
+            elapsed_ms += time * (repetitions + 1) / repetitions;
+            if(time < best_time)
+            {
+                best_time = time;
+                best      = index;
+            }
+        }
+    }
+
+    (void)hipEventDestroy(start);
+    (void)hipEventDestroy(stop);
+    return result;
+}
+
+/// Selects the candidate of the call with the autotuner. If the call is tuned, it is also
+/// executed and \p executed is set to \p true. Otherwise \p index is only updated if a
+/// candidate was selected before.
+template<class SizeBucketTable, class Candidates, class Function>
+hipError_t autotune_config_database(const char*        algorithm,
+                                    const std::string& types,
+                                    const unsigned int candidate_count,
+                                    const bool         repeatable,
+                                    const size_t       size,
+                                    const hipStream_t  stream,
+                                    void*              temporary_storage,
+                                    size_t*            storage_size,
+                                    Function&          function,
+                                    unsigned int&      index,
+                                    bool&              executed)
+{
+    autotune_state& state = get_autotune_state();
+
+    int        device_id;
+    hipError_t result = get_device_from_stream(stream, device_id);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    std::string device_name;
+    result = get_autotune_device_name(state, device_id, device_name);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const std::string key = std::string(algorithm) + ' ' + device_name + ' ' + types + ' '
+                            + std::to_string(autotune_size_bucket(size));
+
+    // Tuning runs the candidates repeatedly, and cannot be recorded into a graph.
+    const bool            can_tune  = repeatable && !autotune_is_capturing(stream);
+    unsigned int          candidate = 0;
+    autotune_options      options;
+    const autotune_lookup lookup = begin_autotune(state, key, can_tune, candidate, options);
+    if(lookup == autotune_lookup::selected)
+    {
+        // The cache may come from a build with fewer candidates.
+        index = candidate < candidate_count ? candidate : 0;
+        return hipSuccess;
+    }
+    if(lookup == autotune_lookup::skip)
+    {
+        return hipSuccess;
+    }
+
+    float elapsed_ms = 0.0f;
+    bool  complete   = true;
+    result = autotune_config_candidates<SizeBucketTable, Candidates>(state,
+                                                                     options,
+                                                                     candidate_count,
+                                                                     size,
+                                                                     stream,
+                                                                     temporary_storage,
+                                                                     storage_size,
+                                                                     function,
+                                                                     candidate,
+                                                                     elapsed_ms,
+                                                                     complete);
+    // A selection from only part of the candidates is used for this call, but not stored.
+    finish_autotune(state, key, result == hipSuccess && complete, candidate, elapsed_ms);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    // Produce the result with the selected candidate, the last timed candidate may have failed.
+    executed = true;
+    return invoke_config_candidate<SizeBucketTable>(candidate,
+                                                    Candidates{},
+                                                    size,
+                                                    stream,
+                                                    temporary_storage,
+                                                    storage_size,
+                                                    function);
+}
+
+template<class Config, class SizeBucketTable, class... Types, class Function>
+hipError_t dispatch_config_database_impl(const char*,
+                                         const size_t      size,
+                                         const hipStream_t stream,
+                                         void*             temporary_storage,
+                                         size_t*           storage_size,
+                                         bool,
+                                         Function&&        function,
+                                         std::false_type /*is_tuned_config*/)
+{
+    // Nested calls of other device-level functions must not report the candidate of the caller.
+    launch_trace_config_scope config_scope(0);
+    return config_invoker<Config, SizeBucketTable>::invoke(size,
+                                                           stream,
+                                                           temporary_storage,
+                                                           storage_size,
+                                                           std::forward<Function>(function));
+}
+
+template<class Config, class SizeBucketTable, class... Types, class Function>
+hipError_t dispatch_config_database_impl(const char*       algorithm,
+                                         const size_t      size,
+                                         const hipStream_t stream,
+                                         void*             temporary_storage,
+                                         size_t*           storage_size,
+                                         const bool        repeatable,
+                                         Function&&        function,
+                                         std::true_type /*is_tuned_config*/)
+{
+    using candidates                       = typename tuned_config_candidates<Config>::type;
+    constexpr unsigned int candidate_count = tuned_config_candidates<Config>::size;
+
+    if(temporary_storage == nullptr && storage_size != nullptr)
+    {
+        // Size the temporary storage for every candidate, so that the allocation stays valid
+        // if the database is replaced between the query and the call.
+        size_t max_storage_size = 0;
+        for(unsigned int index = 0; index < candidate_count; ++index)
+        {
+            const hipError_t result = invoke_config_candidate<SizeBucketTable>(index,
+                                                                               candidates{},
+                                                                               size,
+                                                                               stream,
+                                                                               temporary_storage,
+                                                                               storage_size,
+                                                                               function);
+            if(result != hipSuccess)
+            {
+                return result;
+            }
+            max_storage_size = std::max(max_storage_size, *storage_size);
+        }
+        *storage_size = max_storage_size;
+        return hipSuccess;
+    }
+
+    const bool use_database = get_config_database_state().enabled.load(std::memory_order_acquire);
+    const bool use_autotune = get_autotune_state().enabled.load(std::memory_order_acquire);
+    // The key is only built when it is needed.
+    const std::string types
+        = use_database || use_autotune ? config_database_types<Types...>::name() : std::string();
+    unsigned int index    = 0;
+    bool         selected = false;
+    if(use_database)
+    {
+        target_arch      arch;
+        const hipError_t result = host_target_arch(stream, arch);
+        if(result != hipSuccess)
+        {
+            return result;
+        }
+        selected = lookup_config_database(algorithm, arch, types, size, index);
+        if(index >= candidate_count)
+        {
+            index = 0;
+        }
+    }
+    if(!selected && use_autotune)
+    {
+        bool             executed = false;
+        const hipError_t result
+            = autotune_config_database<SizeBucketTable, candidates>(algorithm,
+                                                                    types,
+                                                                    candidate_count,
+                                                                    repeatable,
+                                                                    size,
+                                                                    stream,
+                                                                    temporary_storage,
+                                                                    storage_size,
+                                                                    function,
+                                                                    index,
+                                                                    executed);
+        if(result != hipSuccess || executed)
+        {
+            return result;
+        }
+    }
+    return invoke_config_candidate<SizeBucketTable>(index,
+                                                    candidates{},
+                                                    size,
+                                                    stream,
+                                                    temporary_storage,
+                                                    storage_size,
+                                                    std::forward<Function>(function));
+}
+
+/// Calls \p function with the config_tag of \p Config or, if \p Config is a tuned_config, of
+/// the candidate that the config database selects for \p algorithm with value types \p Types.
+/// The default config is split into the size buckets of \p SizeBucketTable (no_size_buckets
+/// for algorithms without them). Algorithms with temporary storage pass \p temporary_storage
+/// and \p storage_size, the others pass \p nullptr for both. \p repeatable tells whether
+/// \p function gives the same result when called repeatedly (its operation is declared pure
+/// with is_pure_operation and its output cannot overlap its input), which is required for
+/// autotuning.
+template<class Config, class SizeBucketTable, class... Types, class Function>
+hipError_t dispatch_config_database(const char*       algorithm,
+                                    const size_t      size,
+                                    const hipStream_t stream,
+                                    void*             temporary_storage,
+                                    size_t*           storage_size,
+                                    const bool        repeatable,
+                                    Function&&        function)
+{
+    return dispatch_config_database_impl<Config, SizeBucketTable, Types...>(
+        algorithm,
+        size,
+        stream,
+        temporary_storage,
+        storage_size,
+        repeatable,
+        std::forward<Function>(function),
+        is_tuned_config<Config>{});
+}
+
+} // end namespace detail
+
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// \brief Replaces the config database with the entries of the file at \p path.
+///
+/// See tuned_config for the format of the file. The previous database is kept if the file
+/// cannot be read or parsed.
+///
+/// \param [in] path - path of the config database file.
+/// \return \p hipErrorFileNotFound if the file cannot be opened, \p hipErrorInvalidValue if
+/// it contains a malformed entry, \p hipSuccess otherwise.
+inline hipError_t load_config_database(const char* path)
+{
+    return detail::load_config_database(detail::get_config_database_state(), path);
+}
+
+/// \brief Removes all entries from the config database, so that every tuned_config
+/// uses its compiled-in default configuration.
+inline void clear_config_database()
+{
+    detail::set_config_database(detail::get_config_database_state(), detail::config_database{});
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group primitivesmodule_deviceconfigs
+
+#endif // ROCPRIM_DEVICE_CONFIG_DATABASE_HPP_
@@ -363,6 +363,220 @@ inline hipError_t host_target_arch(const hipStream_t stream, target_arch& arch)
     return get_device_arch(device_id, arch);
 }
 
+template<class Config>
+struct config_tag
+{
+    using type = Config;
+};
+
+/// Maximum number of size buckets of a generated config table.
+constexpr unsigned int max_size_buckets = 4;
+
+/// Config used for problem sizes up to and including \p MaxSize.
+template<size_t MaxSize, class Config>
+struct size_bucket
+{
+    static constexpr size_t max_size = MaxSize;
+    using config                     = Config;
+};
+
+struct size_bucket_limits
+{
+    unsigned int count;
+    size_t       max_sizes[max_size_buckets];
+};
+
+/// List of size buckets, ordered by ascending \p max_size. Problem sizes above the last bucket
+/// use the default config of the table.
+template<class... Buckets>
+struct size_buckets
+{
+    static_assert(sizeof...(Buckets) <= max_size_buckets, "Too many size buckets");
+
+    using buckets = size_buckets;
+
+    static constexpr unsigned int       count  = sizeof...(Buckets);
+    static constexpr size_bucket_limits limits = {sizeof...(Buckets), {Buckets::max_size...}};
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<class... Buckets>
+constexpr unsigned int size_buckets<Buckets...>::count;
+
+template<class... Buckets>
+constexpr size_bucket_limits size_buckets<Buckets...>::limits;
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// Selects the config of bucket \p Index of \p SizeBuckets, or \p Default if there is no such
+/// bucket.
+template<unsigned int Index, class SizeBuckets, class Default>
+struct select_size_bucket
+{
+    using type = Default;
+};
+
+template<class Bucket, class... Buckets, class Default>
+struct select_size_bucket<0, size_buckets<Bucket, Buckets...>, Default>
+{
+    using type = typename Bucket::config;
+};
+
+template<unsigned int Index, class Bucket, class... Buckets, class Default>
+struct select_size_bucket<Index, size_buckets<Bucket, Buckets...>, Default>
+    : select_size_bucket<Index - 1, size_buckets<Buckets...>, Default>
+{};
+
+/// Config type that selects bucket \p Index of the size bucket table of the default config,
+/// the wrapped config of each algorithm falls back to the default config if the table of the
+/// target architecture has fewer buckets.
+template<unsigned int Index>
+struct default_size_bucket_config
+{};
+
+/// Wraps a size bucket table <tt>Table<arch, Value, enable></tt> so that its limits can be
+/// selected with dispatch_target_arch.
+template<template<unsigned int, class, class> class Table, class Value>
+struct size_bucket_table
+{
+    template<target_arch Arch>
+    using buckets = typename Table<static_cast<unsigned int>(Arch), Value, void>::buckets;
+
+    template<target_arch Arch>
+    struct architecture_config
+    {
+        static constexpr size_bucket_limits params = buckets<Arch>::limits;
+    };
+
+    // Only this many bucket configs are instantiated.
+    static constexpr unsigned int max_count = std::max({buckets<target_arch::unknown>::count,
+                                                        buckets<target_arch::gfx803>::count,
+                                                        buckets<target_arch::gfx900>::count,
+                                                        buckets<target_arch::gfx906>::count,
+                                                        buckets<target_arch::gfx908>::count,
+                                                        buckets<target_arch::gfx90a>::count,
+                                                        buckets<target_arch::gfx1030>::count,
+                                                        buckets<target_arch::gfx1100>::count,
+                                                        buckets<target_arch::gfx1102>::count});
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<template<unsigned int, class, class> class Table, class Value>
+template<target_arch Arch>
+constexpr size_bucket_limits
+    size_bucket_table<Table, Value>::architecture_config<Arch>::params;
+
+template<template<unsigned int, class, class> class Table, class Value>
+constexpr unsigned int size_bucket_table<Table, Value>::max_count;
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+template<unsigned int, class, class = void>
+struct no_size_buckets_table : size_buckets<>
+{};
+
+/// Size bucket table of algorithms without size buckets.
+using no_size_buckets = size_bucket_table<no_size_buckets_table, void>;
+
+template<unsigned int Index, unsigned int Count, class Function>
+hipError_t invoke_size_bucket(const unsigned int, Function&& function, std::false_type)
+{
+    return function(config_tag<default_config>{});
+}
+
+template<unsigned int Index, unsigned int Count, class Function>
+hipError_t invoke_size_bucket(const unsigned int index, Function&& function, std::true_type)
+{
+    if(index == Index)
+    {
+        return function(config_tag<default_size_bucket_config<Index>>{});
+    }
+    return invoke_size_bucket<Index + 1, Count>(
+        index,
+        std::forward<Function>(function),
+        std::integral_constant<bool, (Index + 1 < Count)>{});
+}
+
+template<class SizeBucketTable, class Function>
+hipError_t dispatch_size_bucket_impl(const size_t,
+                                     const hipStream_t,
+                                     void*,
+                                     size_t*,
+                                     Function&& function,
+                                     std::false_type /*has_size_buckets*/)
+{
+    return function(config_tag<default_config>{});
+}
+
+template<class SizeBucketTable, class Function>
+hipError_t dispatch_size_bucket_impl(const size_t      size,
+                                     const hipStream_t stream,
+                                     void*             temporary_storage,
+                                     size_t*           storage_size,
+                                     Function&&        function,
+                                     std::true_type /*has_size_buckets*/)
+{
+    constexpr unsigned int max_count = SizeBucketTable::max_count;
+
+    if(temporary_storage == nullptr && storage_size != nullptr)
+    {
+        // The bucket is only known for the device of the stream, so size the temporary storage
+        // for the default config and every bucket.
+        size_t max_storage_size = 0;
+        for(unsigned int index = 0; index <= max_count; ++index)
+        {
+            const hipError_t result
+                = invoke_size_bucket<0, max_count>(index, function, std::true_type{});
+            if(result != hipSuccess)
+            {
+                return result;
+            }
+            max_storage_size = std::max(max_storage_size, *storage_size);
+        }
+        *storage_size = max_storage_size;
+        return hipSuccess;
+    }
+
+    target_arch      arch;
+    const hipError_t result = host_target_arch(stream, arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const size_bucket_limits limits = dispatch_target_arch<SizeBucketTable>(arch);
+
+    unsigned int index = limits.count;
+    for(unsigned int bucket = 0; bucket < limits.count; ++bucket)
+    {
+        if(size <= limits.max_sizes[bucket])
+        {
+            index = bucket;
+            break;
+        }
+    }
+    return invoke_size_bucket<0, max_count>(index,
+                                            std::forward<Function>(function),
+                                            std::true_type{});
+}
+
+/// Calls \p function with the config_tag of the default config, or of the bucket of the
+/// default config that \p SizeBucketTable selects for \p size on the device of \p stream.
+/// Algorithms with temporary storage pass \p temporary_storage and \p storage_size, the others
+/// pass \p nullptr for both.
+template<class SizeBucketTable, class Function>
+hipError_t dispatch_size_bucket(const size_t      size,
+                                const hipStream_t stream,
+                                void*             temporary_storage,
+                                size_t*           storage_size,
+                                Function&&        function)
+{
+    return dispatch_size_bucket_impl<SizeBucketTable>(
+        size,
+        stream,
+        temporary_storage,
+        storage_size,
+        std::forward<Function>(function),
+        std::integral_constant<bool, (SizeBucketTable::max_count > 0)>{});
+}
+
 } // end namespace detail
 
 /// \brief Returns a number of threads in a hardware warp for the actual device.
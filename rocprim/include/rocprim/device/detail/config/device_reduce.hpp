@@ -518,6 +518,11 @@ struct default_reduce_config<static_cast<unsigned int>(target_arch::gfx90a),
     : reduce_config<256, 16, ::rocprim::block_reduce_algorithm::using_warp_reduce>
 {};
 
+// Without buckets measured for the architecture and type, all sizes use the default config.
+template<unsigned int arch, class key_type, class enable = void>
+struct default_reduce_size_buckets : size_buckets<>
+{};
+
 } // end namespace detail
 
 END_ROCPRIM_NAMESPACE
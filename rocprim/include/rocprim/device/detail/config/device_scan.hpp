@@ -618,6 +618,11 @@ struct default_scan_config<static_cast<unsigned int>(target_arch::gfx90a),
                   block_scan_algorithm::using_warp_scan>
 {};
 
+// Without buckets measured for the architecture and type, all sizes use the default config.
+template<unsigned int arch, class value_type, class enable = void>
+struct default_scan_size_buckets : size_buckets<>
+{};
+
 } // end namespace detail
 
 END_ROCPRIM_NAMESPACE
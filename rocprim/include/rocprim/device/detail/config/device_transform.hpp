@@ -450,6 +450,11 @@ struct default_transform_config<
                       && (sizeof(value_type) <= 1))>> : transform_config<128, 8>
 {};
 
+// Without buckets measured for the architecture and type, all sizes use the default config.
+template<unsigned int arch, class data_type, class enable = void>
+struct default_transform_size_buckets : size_buckets<>
+{};
+
 } // end namespace detail
 
 END_ROCPRIM_NAMESPACE
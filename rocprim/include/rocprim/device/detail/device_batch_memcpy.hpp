@@ -30,6 +30,7 @@
 #define ROCPRIM_DEVICE_DETAIL_DEVICE_BATCH_MEMCPY_HPP_
 
 #include "rocprim/device/config_types.hpp"
+#include "rocprim/device/device_launch_trace.hpp"
 #include "rocprim/device/detail/device_scan_common.hpp"
 #include "rocprim/device/detail/lookback_scan_state.hpp"
 #include "rocprim/device/device_memcpy_config.hpp"
@@ -1186,6 +1187,12 @@ ROCPRIM_INLINE static hipError_t batch_memcpy_func(void*              temporary_
     }
 
     // Launch init_scan_states_kernel.
+    detail::trace_launch_begin("batch_memcpy",
+                               dim3(init_kernel_grid_size),
+                               dim3(init_kernel_threads),
+                               0,
+                               0,
+                               stream);
     batch_memcpy_impl_type::
         init_tile_state_kernel<<<init_kernel_grid_size, init_kernel_threads, 0, stream>>>(
             scan_state_buffer,
@@ -1196,12 +1203,19 @@ ROCPRIM_INLINE static hipError_t batch_memcpy_func(void*              temporary_
     {
         return error;
     }
+    detail::trace_launch_end("init_tile_state_kernel", num_blocks);
     if(debug_synchronous)
     {
         hipStreamSynchronize(stream);
     }
 
     // Launch batch_memcpy_non_blev_kernel.
+    detail::trace_launch_begin("batch_memcpy",
+                               dim3(batch_memcpy_grid_size),
+                               dim3(non_blev_block_size),
+                               non_blev_buffers_per_thread,
+                               0,
+                               stream);
     batch_memcpy_impl_type::
         non_blev_memcpy_kernel<<<batch_memcpy_grid_size, non_blev_block_size, 0, stream>>>(
             buffers,
@@ -1214,12 +1228,20 @@ ROCPRIM_INLINE static hipError_t batch_memcpy_func(void*              temporary_
     {
         return error;
     }
+    detail::trace_launch_end("blev_memcpy_kernel", num_copies);
+    detail::trace_launch_end("non_blev_memcpy_kernel", num_copies);
     if(debug_synchronous)
     {
         hipStreamSynchronize(stream);
     }
 
     // Launch batch_memcpy_blev_kernel.
+    detail::trace_launch_begin("batch_memcpy",
+                               dim3(batch_memcpy_blev_grid_size),
+                               dim3(blev_block_size),
+                               Config::blev_bytes_per_thread,
+                               0,
+                               stream);
     batch_memcpy_impl_type::
         blev_memcpy_kernel<<<batch_memcpy_blev_grid_size, blev_block_size, 0, stream>>>(
             blev_buffers,
@@ -0,0 +1,364 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_BUCKET_PARTITION_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_BUCKET_PARTITION_HPP_
+
+#include "../../block/block_histogram.hpp"
+#include "../../block/block_load.hpp"
+#include "../../block/block_load_func.hpp"
+#include "../../block/block_radix_sort.hpp"
+#include "../../block/block_scan.hpp"
+
+#include "../../config.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+
+#include "device_config_helper.hpp"
+#include "device_radix_sort.hpp"
+
+#include <hip/hip_runtime.h>
+
+#include <iterator>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+/// The largest number of buckets supported by a single partitioning pass, the per-bucket block
+/// offsets are kept in shared memory.
+constexpr unsigned int bucket_partition_max_buckets = 4096;
+
+constexpr unsigned int bucket_partition_scan_block_size = 256;
+
+/// Computes the bucket of every item of the tile. Out-of-bounds items are put in the last bucket,
+/// so they are ranked after all valid items when the tile is sorted by bucket.
+template<bool IsFull, unsigned int ItemsPerThread, class Value, class BucketOp>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+    bucket_partition_get_buckets(const Value (&values)[ItemsPerThread],
+                                 unsigned int (&buckets)[ItemsPerThread],
+                                 const unsigned int first_index,
+                                 const unsigned int index_stride,
+                                 const unsigned int valid_items,
+                                 const unsigned int num_buckets,
+                                 BucketOp&          bucket_op)
+{
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        if(IsFull || first_index + i * index_stride < valid_items)
+        {
+            buckets[i] = static_cast<unsigned int>(bucket_op(values[i]));
+        }
+        else
+        {
+            buckets[i] = num_buckets - 1;
+        }
+    }
+}
+
+template<bool IsFull,
+         unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class InputIterator,
+         class BucketOp>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+    bucket_partition_histogram_impl(InputIterator      input,
+                                    const size_t       size,
+                                    const unsigned int num_buckets,
+                                    BucketOp           bucket_op,
+                                    size_t*            bucket_counts)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+    using block_histogram_type
+        = block_histogram<unsigned int, BlockSize, ItemsPerThread, bucket_partition_max_buckets>;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        typename block_histogram_type::storage_type histogram;
+        unsigned int                                bins[bucket_partition_max_buckets];
+    } storage;
+
+    const unsigned int flat_id      = ::rocprim::detail::block_thread_id<0>();
+    const size_t       block_offset = static_cast<size_t>(::rocprim::detail::block_id<0>())
+                                * items_per_block;
+    const unsigned int valid_items
+        = static_cast<unsigned int>(::rocprim::min<size_t>(size - block_offset, items_per_block));
+
+    // The order of the items does not matter for the histogram, so they are loaded striped.
+    value_type values[ItemsPerThread];
+    if ROCPRIM_IF_CONSTEXPR(IsFull)
+    {
+        block_load_direct_striped<BlockSize>(flat_id, input + block_offset, values);
+    }
+    else
+    {
+        block_load_direct_striped<BlockSize>(flat_id, input + block_offset, values, valid_items);
+    }
+
+    unsigned int buckets[ItemsPerThread];
+    bucket_partition_get_buckets<IsFull>(values,
+                                         buckets,
+                                         flat_id,
+                                         BlockSize,
+                                         valid_items,
+                                         num_buckets,
+                                         bucket_op);
+
+    for(unsigned int bucket = flat_id; bucket < num_buckets; bucket += BlockSize)
+    {
+        storage.bins[bucket] = 0;
+    }
+    ::rocprim::syncthreads();
+
+    block_histogram_type{}.composite(buckets, storage.bins, storage.histogram);
+
+    for(unsigned int bucket = flat_id; bucket < num_buckets; bucket += BlockSize)
+    {
+        unsigned int count = storage.bins[bucket];
+        if(!IsFull && bucket == num_buckets - 1)
+        {
+            // Remove the out-of-bounds items
+            count -= items_per_block - valid_items;
+        }
+        if(count != 0)
+        {
+            ::rocprim::detail::atomic_add(&bucket_counts[bucket], static_cast<size_t>(count));
+        }
+    }
+}
+
+template<unsigned int BlockSize, class BucketOffsetIterator>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+    bucket_partition_scan_impl(const size_t*        bucket_counts,
+                               size_t*              bucket_starts,
+                               BucketOffsetIterator bucket_offsets,
+                               const unsigned int   num_buckets)
+{
+    using block_scan_type = block_scan<size_t, BlockSize>;
+
+    ROCPRIM_SHARED_MEMORY typename block_scan_type::storage_type storage;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+
+    size_t carry = 0;
+    for(unsigned int chunk = 0; chunk < num_buckets; chunk += BlockSize)
+    {
+        const unsigned int bucket = chunk + flat_id;
+        const size_t       count  = bucket < num_buckets ? bucket_counts[bucket] : 0;
+
+        size_t start;
+        size_t reduction;
+        block_scan_type{}.exclusive_scan(count, start, size_t(0), reduction, storage);
+        if(bucket < num_buckets)
+        {
+            bucket_starts[bucket]  = carry + start;
+            bucket_offsets[bucket] = carry + start;
+        }
+        carry += reduction;
+        ::rocprim::syncthreads();
+    }
+
+    if(flat_id == 0)
+    {
+        bucket_offsets[num_buckets] = carry;
+    }
+}
+
+/// Stable partitioning of one tile, the scatter pass of the partition. The tile is sorted by
+/// bucket in shared memory, and the position of its items within every bucket is found with a
+/// decoupled look-back over the per-bucket counts of the previous tiles. The starts of the buckets
+/// come from the preceding counting pass, so every item is read twice (once per pass) and
+/// written once.
+template<bool IsFull,
+         unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class InputIterator,
+         class OutputIterator,
+         class BucketOp>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+    bucket_partition_scatter_impl(InputIterator            input,
+                                  OutputIterator           output,
+                                  const unsigned int       size,
+                                  const unsigned int       num_buckets,
+                                  const unsigned int       bucket_bits,
+                                  BucketOp                 bucket_op,
+                                  const size_t*            bucket_offsets_in,
+                                  size_t*                  bucket_offsets_out,
+                                  onesweep_lookback_state* lookback_states)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+    using block_load_type
+        = block_load<value_type, BlockSize, ItemsPerThread, block_load_method::block_load_transpose>;
+    using block_histogram_type
+        = block_histogram<unsigned int, BlockSize, ItemsPerThread, bucket_partition_max_buckets>;
+    using block_sort_type = block_radix_sort<unsigned int, BlockSize, ItemsPerThread, value_type>;
+    using block_scan_type = block_scan<unsigned int, BlockSize>;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        // Holds the bucket counts of the tile, and later the offset of each bucket relative to
+        // the start of the bucket in the batch, minus the start of the bucket in the sorted tile.
+        unsigned int bins[bucket_partition_max_buckets];
+        union
+        {
+            typename block_load_type::storage_type      load;
+            typename block_histogram_type::storage_type histogram;
+            typename block_sort_type::storage_type      sort;
+            typename block_scan_type::storage_type      scan;
+        };
+    } storage;
+
+    const unsigned int flat_id      = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int block_id     = ::rocprim::detail::block_id<0>();
+    const unsigned int last_block   = ::rocprim::detail::grid_size<0>() - 1;
+    const unsigned int block_offset = block_id * items_per_block;
+    const unsigned int valid_items  = ::rocprim::min(size - block_offset, items_per_block);
+
+    // The items are loaded blocked, so that the stable block sort keeps their input order.
+    value_type values[ItemsPerThread];
+    if ROCPRIM_IF_CONSTEXPR(IsFull)
+    {
+        block_load_type{}.load(input + block_offset, values, storage.load);
+    }
+    else
+    {
+        block_load_type{}.load(input + block_offset, values, valid_items, storage.load);
+    }
+
+    unsigned int buckets[ItemsPerThread];
+    bucket_partition_get_buckets<IsFull>(values,
+                                         buckets,
+                                         flat_id * ItemsPerThread,
+                                         1,
+                                         valid_items,
+                                         num_buckets,
+                                         bucket_op);
+
+    for(unsigned int bucket = flat_id; bucket < num_buckets; bucket += BlockSize)
+    {
+        storage.bins[bucket] = 0;
+    }
+    ::rocprim::syncthreads();
+
+    block_histogram_type{}.composite(buckets, storage.bins, storage.histogram);
+
+    // Publish the counts of this tile as early as possible, so that the next tiles are not kept
+    // waiting while this one is sorted.
+    for(unsigned int bucket = flat_id; bucket < num_buckets; bucket += BlockSize)
+    {
+        unsigned int count = storage.bins[bucket];
+        if(!IsFull && bucket == num_buckets - 1)
+        {
+            count -= items_per_block - valid_items;
+        }
+        onesweep_lookback_state(onesweep_lookback_state::PARTIAL, count)
+            .store(&lookback_states[block_id * num_buckets + bucket]);
+    }
+
+    block_sort_type{}.sort_to_striped(buckets, values, storage.sort, 0, bucket_bits);
+    ::rocprim::syncthreads();
+
+    for(unsigned int chunk = 0; chunk < num_buckets; chunk += BlockSize)
+    {
+        const unsigned int bucket = chunk + flat_id;
+        unsigned int       count  = 0;
+        if(bucket < num_buckets)
+        {
+            count = storage.bins[bucket];
+            if(!IsFull && bucket == num_buckets - 1)
+            {
+                count -= items_per_block - valid_items;
+            }
+        }
+
+        // The out-of-bounds items are ranked last, so the start of every bucket in the sorted
+        // tile does not depend on them.
+        unsigned int tile_start;
+        block_scan_type{}.exclusive_scan(count, tile_start, 0u, storage.scan);
+
+        if(bucket < num_buckets)
+        {
+            onesweep_lookback_state* block_state
+                = &lookback_states[block_id * num_buckets + bucket];
+
+            unsigned int exclusive_prefix  = 0;
+            unsigned int lookback_block_id = block_id;
+            while(lookback_block_id > 0)
+            {
+                --lookback_block_id;
+                onesweep_lookback_state* lookback_state_ptr
+                    = &lookback_states[lookback_block_id * num_buckets + bucket];
+                onesweep_lookback_state lookback_state
+                    = onesweep_lookback_state::load(lookback_state_ptr);
+                while(lookback_state.status() == onesweep_lookback_state::EMPTY)
+                {
+                    lookback_state = onesweep_lookback_state::load(lookback_state_ptr);
+                }
+
+                exclusive_prefix += lookback_state.value();
+                if(lookback_state.status() == onesweep_lookback_state::COMPLETE)
+                {
+                    break;
+                }
+            }
+
+            const unsigned int inclusive_prefix = exclusive_prefix + count;
+            // Note that this should not deadlock, as HSA guarantees that blocks with a lower block
+            // ID launch before those with a higher block id.
+            onesweep_lookback_state(onesweep_lookback_state::COMPLETE, inclusive_prefix)
+                .store(block_state);
+
+            if(block_id == last_block)
+            {
+                bucket_offsets_out[bucket] = bucket_offsets_in[bucket] + inclusive_prefix;
+            }
+
+            // Wraps around when the bucket starts later in the tile than in the batch, which is
+            // undone when the position in the sorted tile is added.
+            storage.bins[bucket] = exclusive_prefix - tile_start;
+        }
+        ::rocprim::syncthreads();
+    }
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        const unsigned int rank = i * BlockSize + flat_id;
+        if(IsFull || rank < valid_items)
+        {
+            const unsigned int bucket = buckets[i];
+            output[bucket_offsets_in[bucket] + (storage.bins[bucket] + rank)] = values[i];
+        }
+    }
+}
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_BUCKET_PARTITION_HPP_
@@ -26,6 +26,7 @@
 #include "../../config.hpp"
 #include "../../detail/various.hpp"
 
+#include "../../block/block_histogram.hpp"
 #include "../../block/block_load.hpp"
 #include "../../block/block_reduce.hpp"
 #include "../../block/block_scan.hpp"
@@ -124,6 +125,51 @@ struct radix_sort_block_sort_config_base
                   "Sorted items per block should be a power of two.");
 };
 
+/// \brief Thresholds between the algorithms of device-level radix sort, which sorts inputs with
+/// a single block, with merge sort or with onesweep depending on their size.
+struct radix_sort_thresholds_params
+{
+    /// \brief Configuration of the single block sort.
+    kernel_config_params single_sort_config;
+    /// \brief Largest number of items sorted by a single block, at most the items per block of
+    /// \p single_sort_config.
+    size_t single_sort_limit;
+    /// \brief Largest number of items sorted by merge sort, larger inputs are sorted by onesweep.
+    size_t merge_sort_limit;
+};
+
+template<class SingleSortConfig, size_t SingleSortLimit, size_t MergeSortLimit>
+struct radix_sort_thresholds : radix_sort_thresholds_params
+{
+    static_assert(SingleSortLimit
+                      <= SingleSortConfig::block_size * SingleSortConfig::items_per_thread,
+                  "The single sort limit cannot exceed the items per block of the single sort");
+
+    constexpr radix_sort_thresholds()
+        : radix_sort_thresholds_params{SingleSortConfig(), SingleSortLimit, MergeSortLimit}
+    {}
+};
+
+template<class Key, class Value>
+struct default_radix_sort_thresholds_base
+{
+    using block_sort_config = typename radix_sort_block_sort_config_base<Key, Value>::type;
+
+    // Instead of the block sort config of merge sort, use <256u, 4u> (unless smaller is needed to
+    // not exceed shared memory maximum), this improves compute unit utilization as only a single
+    // block is launched.
+    using single_sort_config
+        = kernel_config<rocprim::min(256u, block_sort_config::block_size),
+                        rocprim::min(4u, block_sort_config::items_per_thread)>;
+
+    // For sizeof(Key) <= 2, onesweep is 2x/3x faster (also with values) when the input size
+    // exceeds 100K.
+    using type = radix_sort_thresholds<single_sort_config,
+                                       single_sort_config::block_size
+                                           * single_sort_config::items_per_thread,
+                                       (sizeof(Key) > 2) ? 1024 * 1024 : 100000 - 1>;
+};
+
 /// \brief Default values are provided by \p merge_sort_block_merge_config_base.
 struct merge_sort_block_merge_config_params
 {
@@ -753,6 +799,9 @@ struct histogram_config_params
     unsigned int max_grid_size          = 0;
     unsigned int shared_impl_max_bins   = 0;
     unsigned int shared_impl_histograms = 0;
+
+    ::rocprim::block_histogram_algorithm shared_impl_algorithm
+        = ::rocprim::block_histogram_algorithm::using_atomic;
 };
 
 } // namespace detail
@@ -766,12 +815,21 @@ struct histogram_config_params
 /// when exceeded the global memory implementation is used (samples -> global memory bins).
 /// \tparam SharedImplHistograms - number of histograms in the shared memory to reduce bank conflicts
 /// for atomic operations with narrow sample distributions. Sweetspot for 9xx and 10xx is 3.
+/// \tparam SharedImplAlgorithm - how samples update the shared memory histograms. With
+/// \p block_histogram_algorithm::using_atomic every sample performs its own atomic addition,
+/// with \p block_histogram_algorithm::using_warp_aggregated_atomic samples of a warp falling into
+/// the same bin are combined into a single atomic addition, which is beneficial for heavily
+/// skewed sample distributions. \p block_histogram_algorithm::using_sort is not supported.
 template<class HistogramConfig,
-         unsigned int MaxGridSize          = 1024,
-         unsigned int SharedImplMaxBins    = 2048,
-         unsigned int SharedImplHistograms = 3>
+         unsigned int              MaxGridSize          = 1024,
+         unsigned int              SharedImplMaxBins    = 2048,
+         unsigned int              SharedImplHistograms = 3,
+         block_histogram_algorithm SharedImplAlgorithm  = block_histogram_algorithm::using_atomic>
 struct histogram_config : detail::histogram_config_params
 {
+    static_assert(SharedImplAlgorithm != block_histogram_algorithm::using_sort,
+                  "The shared memory histogram implementation does not support using_sort");
+
     /// \brief Identifies the algorithm associated to the config.
     using tag = detail::histogram_config_tag;
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -781,9 +839,14 @@ struct histogram_config : detail::histogram_config_params
     static constexpr unsigned int shared_impl_max_bins   = SharedImplMaxBins;
     static constexpr unsigned int shared_impl_histograms = SharedImplHistograms;
 
+    static constexpr block_histogram_algorithm shared_impl_algorithm = SharedImplAlgorithm;
+
     constexpr histogram_config()
-        : detail::histogram_config_params{
-            HistogramConfig{}, MaxGridSize, SharedImplMaxBins, SharedImplHistograms} {};
+        : detail::histogram_config_params{HistogramConfig{},
+                                          MaxGridSize,
+                                          SharedImplMaxBins,
+                                          SharedImplHistograms,
+                                          SharedImplAlgorithm} {};
 #endif
 };
 
@@ -1082,6 +1145,57 @@ struct nth_element_config : public detail::nth_element_config_params
 #endif
 };
 
+namespace detail
+{
+
+/// \brief Threshold between the algorithms of device-level partial sort.
+struct partial_sort_thresholds_params
+{
+    /// \brief Largest number of items for which the whole input is sorted, instead of
+    /// selecting the sorted range with nth_element first.
+    size_t sort_limit;
+};
+
+template<size_t SortLimit>
+struct partial_sort_thresholds : partial_sort_thresholds_params
+{
+    constexpr partial_sort_thresholds() : partial_sort_thresholds_params{SortLimit} {}
+};
+
+template<class Key>
+struct default_partial_sort_thresholds_base
+{
+    using type = partial_sort_thresholds<0>;
+};
+
+} // namespace detail
+
+namespace detail
+{
+
+struct bucket_partition_config_params
+{
+    kernel_config_params kernel_config;
+};
+
+} // namespace detail
+
+/// \brief Configuration of device-level bucket partition
+///
+/// \tparam BlockSize number of threads in a block.
+/// \tparam ItemsPerThread number of items processed by each thread.
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+struct bucket_partition_config : public detail::bucket_partition_config_params
+{
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    constexpr bucket_partition_config()
+        : detail::bucket_partition_config_params{
+            {BlockSize, ItemsPerThread, ROCPRIM_GRID_SIZE_LIMIT}
+    }
+    {}
+#endif
+};
+
 END_ROCPRIM_NAMESPACE
 
 /// @}
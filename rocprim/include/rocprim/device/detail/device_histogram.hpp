@@ -32,6 +32,7 @@
 #include "../../type_traits.hpp"
 
 #include "../../block/block_load.hpp"
+#include "../../block/detail/block_histogram_warp_aggregated.hpp"
 
 #include "uint_fast_div.hpp"
 
@@ -322,10 +323,32 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void init_histogram(fixed_array<Counter*, ActiveCh
     }
 }
 
+// Increments the bin of a shared memory histogram for a valid sample. All threads of the
+// block must call it, even for invalid samples.
+template<bool WarpAggregated>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+auto update_shared_histogram(unsigned int* histogram, unsigned int bin, bool valid)
+    -> typename std::enable_if<!WarpAggregated>::type
+{
+    if(valid)
+    {
+        ::rocprim::detail::atomic_add(histogram + bin, 1);
+    }
+}
+
+template<bool WarpAggregated>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+auto update_shared_histogram(unsigned int* histogram, unsigned int bin, bool valid)
+    -> typename std::enable_if<WarpAggregated>::type
+{
+    ::rocprim::detail::warp_aggregated_atomic_add(histogram, bin, valid);
+}
+
 template<unsigned int BlockSize,
          unsigned int ItemsPerThread,
          unsigned int Channels,
          unsigned int ActiveChannels,
+         bool         WarpAggregated,
          class SampleIterator,
          class Counter,
          class SampleToBinOp>
@@ -360,8 +383,11 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void
         total_bins += bins[channel];
     }
 
-    // partial histogram to work with
-    const unsigned int thread_shift = (flat_id % shared_histograms) * total_bins;
+    // partial histogram to work with, warp-aggregated updates need the whole warp to
+    // work with the same one
+    const unsigned int thread_shift
+        = ((WarpAggregated ? ::rocprim::warp_id(flat_id) : flat_id) % shared_histograms)
+          * total_bins;
 
     // fill all histograms with 0
     for(unsigned int i = flat_id; i < total_bins * shared_histograms; i += BlockSize)
@@ -389,13 +415,13 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void
                 {
                     for(unsigned int channel = 0; channel < ActiveChannels; channel++)
                     {
-                        unsigned int bin;
-                        if(sample_to_bin_op[channel](values[i].values[channel], bin))
-                        {
-                            ::rocprim::detail::atomic_add(block_histogram[channel] + bin
-                                                              + thread_shift,
-                                                          1);
-                        }
+                        unsigned int bin = 0;
+                        const bool   valid
+                            = sample_to_bin_op[channel](values[i].values[channel], bin);
+                        update_shared_histogram<WarpAggregated>(block_histogram[channel]
+                                                                    + thread_shift,
+                                                                bin,
+                                                                valid);
                     }
                 }
             }
@@ -409,18 +435,17 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void
 
                 for(unsigned int i = 0; i < ItemsPerThread; i++)
                 {
-                    if(flat_id * ItemsPerThread + i < valid_count)
+                    const bool in_range = flat_id * ItemsPerThread + i < valid_count;
+                    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
                     {
-                        for(unsigned int channel = 0; channel < ActiveChannels; channel++)
-                        {
-                            unsigned int bin;
-                            if(sample_to_bin_op[channel](values[i].values[channel], bin))
-                            {
-                                ::rocprim::detail::atomic_add(block_histogram[channel] + bin
-                                                                  + thread_shift,
-                                                              1);
-                            }
-                        }
+                        unsigned int bin = 0;
+                        const bool   valid
+                            = in_range
+                              && sample_to_bin_op[channel](values[i].values[channel], bin);
+                        update_shared_histogram<WarpAggregated>(block_histogram[channel]
+                                                                    + thread_shift,
+                                                                bin,
+                                                                valid);
                     }
                 }
             }
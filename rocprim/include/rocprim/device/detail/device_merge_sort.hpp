@@ -31,10 +31,12 @@
 #include "../../functional.hpp"
 #include "../../types.hpp"
 
+#include "../../block/block_discontinuity.hpp"
 #include "../../block/block_load.hpp"
 #include "../../block/block_load_func.hpp"
 #include "../../block/block_sort.hpp"
 #include "../../block/block_store.hpp"
+#include "../../block/block_store_func.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -740,6 +742,177 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void block_merge_oddeven_kernel(KeysInputIterator
     }
 }
 
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class OffsetT>
+ROCPRIM_DEVICE ROCPRIM_INLINE void block_copy_kernel_impl(KeysInputIterator    keys_input,
+                                                          KeysOutputIterator   keys_output,
+                                                          ValuesInputIterator  values_input,
+                                                          ValuesOutputIterator values_output,
+                                                          const OffsetT        input_size)
+{
+    using key_type             = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type           = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    const unsigned int     flat_id         = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int     flat_block_id   = ::rocprim::detail::block_id<0>();
+    const OffsetT          block_offset    = static_cast<OffsetT>(flat_block_id) * items_per_block;
+    const unsigned int     valid_items
+        = static_cast<unsigned int>(::rocprim::min<OffsetT>(input_size - block_offset,
+                                                            items_per_block));
+
+    key_type keys[ItemsPerThread];
+    block_load_direct_striped<BlockSize>(flat_id, keys_input + block_offset, keys, valid_items);
+    block_store_direct_striped<BlockSize>(flat_id, keys_output + block_offset, keys, valid_items);
+
+    if ROCPRIM_IF_CONSTEXPR(with_values)
+    {
+        value_type values[ItemsPerThread];
+        block_load_direct_striped<BlockSize>(flat_id,
+                                             values_input + block_offset,
+                                             values,
+                                             valid_items);
+        block_store_direct_striped<BlockSize>(flat_id,
+                                              values_output + block_offset,
+                                              values,
+                                              valid_items);
+    }
+}
+
+template<class Key, class BinaryFunction>
+struct merge_sort_descent_op
+{
+    BinaryFunction compare_function;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    bool operator()(const Key& previous, const Key& current) const
+    {
+        return compare_function(current, previous);
+    }
+};
+
+/// Checks for every tile of the block sort whether its keys are already in order. A tile that is
+/// out of order, or whose first key is ordered before the last key of the previous tile, increments
+/// \p unsorted_count, so the input is sorted if it stays zero.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class KeysInputIterator,
+         class OffsetT,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE void
+    block_find_sorted_tiles_impl(KeysInputIterator   keys_input,
+                                 const OffsetT       input_size,
+                                 BinaryFunction      compare_function,
+                                 unsigned char*      sorted_tiles,
+                                 unsigned long long* unsorted_count)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using block_discontinuity_type = block_discontinuity<key_type, BlockSize>;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    const unsigned int     flat_id         = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int     flat_block_id   = ::rocprim::detail::block_id<0>();
+    const OffsetT          block_offset    = static_cast<OffsetT>(flat_block_id) * items_per_block;
+    const unsigned int     valid_items
+        = static_cast<unsigned int>(::rocprim::min<OffsetT>(input_size - block_offset,
+                                                            items_per_block));
+
+    ROCPRIM_SHARED_MEMORY typename block_discontinuity_type::storage_type storage;
+    ROCPRIM_SHARED_MEMORY bool                                            tile_unsorted;
+
+    // Items past the end repeat the last item, which never forms a descent
+    key_type keys[ItemsPerThread];
+    block_load_direct_blocked(flat_id,
+                              keys_input + block_offset,
+                              keys,
+                              valid_items,
+                              keys_input[block_offset + valid_items - 1]);
+
+    // The first tile has no predecessor, comparing its first key with itself flags nothing
+    const key_type tile_predecessor
+        = flat_block_id == 0 ? keys_input[0] : keys_input[block_offset - 1];
+
+    bool descents[ItemsPerThread];
+    block_discontinuity_type{}.flag_heads(descents,
+                                          tile_predecessor,
+                                          keys,
+                                          merge_sort_descent_op<key_type, BinaryFunction>{
+                                              compare_function},
+                                          storage);
+
+    if(flat_id == 0)
+    {
+        tile_unsorted = false;
+    }
+    ::rocprim::syncthreads();
+
+    bool thread_unsorted = false;
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        // The first flag of the tile compares with the previous tile
+        thread_unsorted |= descents[i] && (flat_id != 0 || i != 0);
+    }
+    if(thread_unsorted)
+    {
+        tile_unsorted = true;
+    }
+    ::rocprim::syncthreads();
+
+    if(flat_id == 0)
+    {
+        sorted_tiles[flat_block_id] = tile_unsorted ? 0 : 1;
+        if(tile_unsorted || descents[0])
+        {
+            ::rocprim::detail::atomic_add(unsorted_count, 1ull);
+        }
+    }
+}
+
+/// Checks for every pair of sorted blocks that is merged in the next round whether the first key
+/// of the second block is ordered before the last key of the first block. Pairs that are already
+/// ordered are flagged in \p ordered_pairs, and the number of items in the other pairs is added to
+/// \p unordered_items. The counter is 64 bits wide as the input may hold more than 2^32 items.
+template<unsigned int BlockSize, class KeysInputIterator, class OffsetT, class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE void find_ordered_pairs_impl(KeysInputIterator   keys_input,
+                                                           const OffsetT       input_size,
+                                                           const OffsetT       sorted_block_size,
+                                                           const unsigned int  num_pairs,
+                                                           BinaryFunction      compare_function,
+                                                           unsigned char*      ordered_pairs,
+                                                           unsigned long long* unordered_items)
+{
+    const unsigned int pair_id
+        = ::rocprim::detail::block_id<0>() * BlockSize + ::rocprim::detail::block_thread_id<0>();
+    if(pair_id >= num_pairs)
+    {
+        return;
+    }
+
+    const OffsetT pair_begin  = static_cast<OffsetT>(pair_id) * 2 * sorted_block_size;
+    const OffsetT second_head = pair_begin + sorted_block_size;
+
+    bool ordered = true;
+    if(second_head < input_size)
+    {
+        ordered = !compare_function(keys_input[second_head], keys_input[second_head - 1]);
+    }
+    ordered_pairs[pair_id] = ordered ? 1 : 0;
+    if(!ordered)
+    {
+        const OffsetT pair_end
+            = ::rocprim::min<OffsetT>(second_head + sorted_block_size, input_size);
+        ::rocprim::detail::atomic_add(unordered_items,
+                                      static_cast<unsigned long long>(pair_end - pair_begin));
+    }
+}
+
 } // end of detail namespace
 
 END_ROCPRIM_NAMESPACE
@@ -31,6 +31,7 @@
 #include "../../intrinsics.hpp"
 #include "../../type_traits.hpp"
 
+#include "../device_launch_trace.hpp"
 #include "../device_transform.hpp"
 
 #include "device_config_helper.hpp"
@@ -55,6 +56,7 @@ namespace detail
         hipError_t _error = hipGetLastError();                                                   \
         if(_error != hipSuccess)                                                                 \
             return _error;                                                                       \
+        ::rocprim::detail::trace_launch_end(name, size);                                         \
         if(debug_synchronous)                                                                    \
         {                                                                                        \
             std::cout << name << "(" << size << ")";                                             \
@@ -698,11 +700,18 @@ ROCPRIM_INLINE hipError_t
                                                                    stream));
 
         start_timer();
+        detail::trace_launch_begin("nth_element", dim3(1), dim3(num_splitters), 0, 0, stream);
         kernel_find_splitters<config>
             <<<1, num_splitters, 0, stream>>>(keys, tree, equality_buckets, size, compare_function);
         ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("kernel_find_splitters", size, start);
 
         start_timer();
+        detail::trace_launch_begin("nth_element",
+                                   dim3(num_blocks),
+                                   dim3(num_threads_per_block),
+                                   num_items_per_thread,
+                                   0,
+                                   stream);
         kernel_count_bucket_sizes<config>
             <<<num_blocks, num_threads_per_block, 0, stream>>>(keys,
                                                                tree,
@@ -713,11 +722,18 @@ ROCPRIM_INLINE hipError_t
         ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("kernel_count_bucket_sizes", size, start);
 
         start_timer();
+        detail::trace_launch_begin("nth_element", dim3(1), dim3(num_buckets), 0, 0, stream);
         kernel_find_nth_element_bucket<config>
             <<<1, num_buckets, 0, stream>>>(buckets, nth_element_data, equality_buckets, rank);
         ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("kernel_find_nth_element_bucket", size, start);
 
         start_timer();
+        detail::trace_launch_begin("nth_element",
+                                   dim3(num_blocks),
+                                   dim3(num_threads_per_block),
+                                   num_items_per_thread,
+                                   0,
+                                   stream);
         kernel_copy_buckets<config, num_partitions>
             <<<num_blocks, num_threads_per_block, 0, stream>>>(keys,
                                                                tree,
@@ -763,6 +779,7 @@ ROCPRIM_INLINE hipError_t
     }
 
     start_timer();
+    detail::trace_launch_begin("nth_element", dim3(1), dim3(stop_recursion_size), 1, 0, stream);
     kernel_block_sort<config><<<1, stop_recursion_size, 0, stream>>>(keys, size, compare_function);
     ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("kernel_block_sort", size, start);
     return hipSuccess;
@@ -37,6 +37,7 @@
 #include "../../block/block_load_func.hpp"
 #include "../../block/block_radix_rank.hpp"
 #include "../../block/block_radix_sort.hpp"
+#include "../../block/block_reduce.hpp"
 #include "../../block/block_scan.hpp"
 #include "../../block/block_store_func.hpp"
 #include "../../thread/radix_key_codec.hpp"
@@ -867,9 +868,11 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void onesweep_histograms(KeysInputIterator
 }
 
 template<unsigned int BlockSize, unsigned int RadixBits, class Offset>
-ROCPRIM_DEVICE void onesweep_scan_histograms(Offset* global_digit_offsets)
+ROCPRIM_DEVICE void onesweep_scan_histograms(Offset*       global_digit_offsets,
+                                             unsigned int* trivial_digits)
 {
-    using block_scan_type = block_scan<Offset, BlockSize>;
+    using block_scan_type   = block_scan<Offset, BlockSize>;
+    using block_reduce_type = block_reduce<unsigned int, BlockSize>;
 
     constexpr unsigned int radix_size       = 1u << RadixBits;
     constexpr unsigned int items_per_thread = ::rocprim::detail::ceiling_div(radix_size, BlockSize);
@@ -878,10 +881,35 @@ ROCPRIM_DEVICE void onesweep_scan_histograms(Offset* global_digit_offsets)
     const unsigned int digit_place  = ::rocprim::detail::block_id<0>();
     const unsigned int block_offset = digit_place * radix_size;
 
+    Offset counts[items_per_thread];
+    block_load_direct_blocked(flat_id,
+                              global_digit_offsets + block_offset,
+                              counts,
+                              radix_size,
+                              Offset(0));
+
     Offset offsets[items_per_thread];
-    block_load_direct_blocked(flat_id, global_digit_offsets + block_offset, offsets, radix_size);
-    block_scan_type{}.exclusive_scan(offsets, offsets, 0);
+    Offset total;
+    block_scan_type{}.exclusive_scan(counts, offsets, 0, total);
     block_store_direct_blocked(flat_id, global_digit_offsets + block_offset, offsets, radix_size);
+
+    // A digit place is trivial if a single digit holds every key. Sorting by such a place
+    // preserves the order of the keys, so the iteration can copy instead of ranking.
+    unsigned int trivial_digit = 0;
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        const unsigned int digit = flat_id * items_per_thread + i;
+        if(digit < radix_size && counts[i] == total)
+        {
+            trivial_digit = digit + 1;
+        }
+    }
+    block_reduce_type{}.reduce(trivial_digit, trivial_digit, ::rocprim::maximum<unsigned int>());
+    if(flat_id == 0)
+    {
+        trivial_digits[digit_place] = trivial_digit;
+    }
 }
 
 struct onesweep_lookback_state
@@ -1224,6 +1252,81 @@ struct onesweep_iteration_helper
             }
         }
     }
+
+    // Iteration for a digit place in which all keys have the same digit. The keys keep their
+    // relative order, so they (and the values) are moved as-is without ranking or lookback.
+    template<bool IsFull,
+             class KeysInputIterator,
+             class KeysOutputIterator,
+             class ValuesInputIterator,
+             class ValuesOutputIterator>
+    ROCPRIM_DEVICE void copy_trivial(KeysInputIterator    keys_input,
+                                     KeysOutputIterator   keys_output,
+                                     ValuesInputIterator  values_input,
+                                     ValuesOutputIterator values_output,
+                                     Offset*              global_digit_offsets_in,
+                                     Offset*              global_digit_offsets_out,
+                                     const unsigned int   trivial_digit,
+                                     const unsigned int   valid_items)
+    {
+        const unsigned int flat_id      = ::rocprim::detail::block_thread_id<0>();
+        const unsigned int block_id     = ::rocprim::detail::block_id<0>();
+        const unsigned int block_offset = block_id * items_per_block;
+        const Offset output_offset = global_digit_offsets_in[trivial_digit] + block_offset;
+
+        Key keys[ItemsPerThread];
+        if ROCPRIM_IF_CONSTEXPR(IsFull)
+        {
+            block_load_direct_striped<BlockSize>(flat_id, keys_input + block_offset, keys);
+            block_store_direct_striped<BlockSize>(flat_id, keys_output + output_offset, keys);
+        }
+        else
+        {
+            block_load_direct_striped<BlockSize>(flat_id,
+                                                 keys_input + block_offset,
+                                                 keys,
+                                                 valid_items);
+            block_store_direct_striped<BlockSize>(flat_id,
+                                                  keys_output + output_offset,
+                                                  keys,
+                                                  valid_items);
+        }
+
+        if(with_values)
+        {
+            Value values[ItemsPerThread];
+            if ROCPRIM_IF_CONSTEXPR(IsFull)
+            {
+                block_load_direct_striped<BlockSize>(flat_id, values_input + block_offset, values);
+                block_store_direct_striped<BlockSize>(flat_id,
+                                                      values_output + output_offset,
+                                                      values);
+            }
+            else
+            {
+                block_load_direct_striped<BlockSize>(flat_id,
+                                                     values_input + block_offset,
+                                                     values,
+                                                     valid_items);
+                block_store_direct_striped<BlockSize>(flat_id,
+                                                      values_output + output_offset,
+                                                      values,
+                                                      valid_items);
+            }
+        }
+
+        // Update the global digit offset if we are batching
+        const bool is_last_block = block_id == rocprim::detail::grid_size<0>() - 1;
+        if(is_last_block)
+        {
+            const unsigned int batch_size = block_offset + valid_items;
+            for(unsigned int digit = flat_id; digit < radix_size; digit += BlockSize)
+            {
+                global_digit_offsets_out[digit]
+                    = global_digit_offsets_in[digit] + (digit == trivial_digit ? batch_size : 0);
+            }
+        }
+    }
 };
 
 template<unsigned int               BlockSize,
@@ -1246,6 +1349,7 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
                        Offset*                  global_digit_offsets_in,
                        Offset*                  global_digit_offsets_out,
                        onesweep_lookback_state* lookback_states,
+                       const unsigned int*      trivial_digit,
                        Decomposer               decomposer,
                        const unsigned int       bit,
                        const unsigned int       current_radix_bits,
@@ -1267,6 +1371,39 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
     constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
     const unsigned int     block_id        = ::rocprim::detail::block_id<0>();
 
+    // The trivial digit (plus one) is computed on the device by onesweep_scan_histograms,
+    // so skipping the ranking does not require a round trip to the host.
+    const unsigned int trivial_digit_plus_one = *trivial_digit;
+    if(trivial_digit_plus_one != 0)
+    {
+        if(block_id < full_blocks)
+        {
+            onesweep_iteration_helper_type{}.template copy_trivial<true>(
+                keys_input,
+                keys_output,
+                values_input,
+                values_output,
+                global_digit_offsets_in,
+                global_digit_offsets_out,
+                trivial_digit_plus_one - 1,
+                items_per_block);
+        }
+        else
+        {
+            const unsigned int valid_in_last_block = size - items_per_block * full_blocks;
+            onesweep_iteration_helper_type{}.template copy_trivial<false>(
+                keys_input,
+                keys_output,
+                values_input,
+                values_output,
+                global_digit_offsets_in,
+                global_digit_offsets_out,
+                trivial_digit_plus_one - 1,
+                valid_in_last_block);
+        }
+        return;
+    }
+
     ROCPRIM_SHARED_MEMORY typename onesweep_iteration_helper_type::storage_type storage;
 
     if(block_id < full_blocks)
@@ -36,6 +36,7 @@
 
 #include "../../block/block_load.hpp"
 #include "../../block/block_reduce.hpp"
+#include "../../block/detail/block_load_store_vectorized.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -88,7 +89,8 @@ void block_reduce_kernel_impl(InputIterator input,
                               const size_t input_size,
                               OutputIterator output,
                               InitValueType initial_value,
-                              BinaryFunction reduce_op)
+                              BinaryFunction reduce_op,
+                              std::false_type /* vectorized */)
 {
     static constexpr reduce_config_params params = device_params<Config>();
 
@@ -163,6 +165,146 @@ void block_reduce_kernel_impl(InputIterator input,
             );
     }
 }
+
+// Vectorized reduction of a pointer. The tiles are shifted to start at addresses that are aligned
+// for vector accesses, so full tiles are always loaded with the full vector width regardless of
+// the alignment of the input. The items before the first aligned address (the head) are reduced
+// by the last block, which is never a full tile when there is a head.
+template<
+    bool WithInitialValue,
+    class Config,
+    class ResultType,
+    class InputIterator,
+    class OutputIterator,
+    class InitValueType,
+    class BinaryFunction
+>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void block_reduce_kernel_impl(InputIterator input,
+                              const size_t input_size,
+                              OutputIterator output,
+                              InitValueType initial_value,
+                              BinaryFunction reduce_op,
+                              std::true_type /* vectorized */)
+{
+    static constexpr reduce_config_params params = device_params<Config>();
+
+    constexpr unsigned int block_size       = params.reduce_config.block_size;
+    constexpr unsigned int items_per_thread = params.reduce_config.items_per_thread;
+
+    using input_type = typename std::remove_cv<
+        typename std::iterator_traits<InputIterator>::value_type>::type;
+    using result_type = ResultType;
+
+    using block_reduce_type
+        = ::rocprim::block_reduce<result_type, block_size, params.block_reduce_method>;
+    constexpr unsigned int items_per_block = block_size * items_per_thread;
+
+    const unsigned int head = vector_alignment_head<input_type, items_per_thread>(input);
+    if(input_size <= head || head >= block_size
+       || !is_vector_aligned<input_type, items_per_thread>(input + head))
+    {
+        block_reduce_kernel_impl<WithInitialValue, Config, ResultType>(
+            input, input_size, output, initial_value, reduce_op, std::false_type{});
+        return;
+    }
+
+    const unsigned int flat_id          = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int flat_block_id    = ::rocprim::detail::block_id<0>();
+    const unsigned int number_of_blocks = ::rocprim::detail::grid_size<0>();
+    const size_t       block_offset     = head + size_t(flat_block_id) * items_per_block;
+
+    result_type values[items_per_thread];
+    result_type output_value;
+    if(block_offset + items_per_block <= input_size)
+    {
+        block_load_vector_striped<block_size>(flat_id, input + block_offset, values);
+
+        block_reduce_type()
+            .reduce(
+                values, // input
+                output_value, // output
+                reduce_op
+            );
+    }
+    else
+    {
+        // The tile of the last block may be empty if the head covers the remainder
+        const unsigned int valid_in_block
+            = block_offset < input_size ? input_size - block_offset : 0;
+        block_load_direct_striped<block_size>(
+            flat_id,
+            input + block_offset,
+            values,
+            valid_in_block
+        );
+
+        output_value = values[0];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 1; i < items_per_thread; i++)
+        {
+            unsigned int offset = i * block_size;
+            if(flat_id + offset < valid_in_block)
+            {
+                output_value = reduce_op(output_value, values[i]);
+            }
+        }
+
+        unsigned int valid_threads = std::min(valid_in_block, block_size);
+        if(flat_block_id == (number_of_blocks - 1) && flat_id < head)
+        {
+            const result_type head_value = input[flat_id];
+            output_value = flat_id < valid_in_block ? reduce_op(head_value, output_value)
+                                                    : head_value;
+        }
+        if(flat_block_id == (number_of_blocks - 1))
+        {
+            valid_threads = std::max(valid_threads, head);
+        }
+
+        block_reduce_type().reduce(output_value, // input
+                                   output_value, // output
+                                   valid_threads,
+                                   reduce_op);
+    }
+
+    // Save value into output
+    if(flat_id == 0)
+    {
+        output[flat_block_id] = reduce_with_initial<WithInitialValue>(
+            output_value,
+            static_cast<result_type>(initial_value),
+            reduce_op
+        );
+    }
+}
+
+template<
+    bool WithInitialValue,
+    class Config,
+    class ResultType,
+    class InputIterator,
+    class OutputIterator,
+    class InitValueType,
+    class BinaryFunction
+>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void block_reduce_kernel_impl(InputIterator input,
+                              const size_t input_size,
+                              OutputIterator output,
+                              InitValueType initial_value,
+                              BinaryFunction reduce_op)
+{
+    static constexpr reduce_config_params params = device_params<Config>();
+
+    using vectorized = std::integral_constant<
+        bool,
+        is_vector_accessible<InputIterator, params.reduce_config.items_per_thread>::value>;
+
+    block_reduce_kernel_impl<WithInitialValue, Config, ResultType>(
+        input, input_size, output, initial_value, reduce_op, vectorized{});
+}
+
 } // end of detail namespace
 
 END_ROCPRIM_NAMESPACE
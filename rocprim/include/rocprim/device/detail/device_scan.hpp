@@ -32,6 +32,7 @@
 #include "../../block/block_load.hpp"
 #include "../../block/block_scan.hpp"
 #include "../../block/block_store.hpp"
+#include "../../block/detail/block_load_store_vectorized.hpp"
 
 #include "../../device/device_scan_config.hpp"
 
@@ -88,6 +89,94 @@ ROCPRIM_DEVICE ROCPRIM_INLINE auto single_scan_block_scan(T (&input)[ItemsPerThr
                                scan_op);
 }
 
+// Loads a full tile of the look-back scan. Transposing loads of pointers use vector loads
+// when the tile is aligned for them, and transpose the items through the same storage.
+template<class BlockLoad,
+         unsigned int BlockSize,
+         class InputIterator,
+         class AccType,
+         unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void lookback_scan_load_tile(InputIterator                     block_input,
+                             AccType (&values)[ItemsPerThread],
+                             typename BlockLoad::storage_type& storage,
+                             std::false_type                   /* vectorized */)
+{
+    BlockLoad().load(block_input, values, storage);
+}
+
+template<class BlockLoad,
+         unsigned int BlockSize,
+         class InputIterator,
+         class AccType,
+         unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void lookback_scan_load_tile(InputIterator                     block_input,
+                             AccType (&values)[ItemsPerThread],
+                             typename BlockLoad::storage_type& storage,
+                             std::true_type                    /* vectorized */)
+{
+    using input_type = typename std::remove_cv<
+        typename std::iterator_traits<InputIterator>::value_type>::type;
+    using block_exchange_type = ::rocprim::block_exchange<AccType, BlockSize, ItemsPerThread>;
+
+    if(is_vector_aligned<input_type, ItemsPerThread>(block_input))
+    {
+        block_load_vector_transpose<block_exchange_type, BlockSize>(
+            ::rocprim::detail::block_thread_id<0>(),
+            block_input,
+            values,
+            storage);
+    }
+    else
+    {
+        BlockLoad().load(block_input, values, storage);
+    }
+}
+
+// Stores a full tile of the look-back scan, see lookback_scan_load_tile.
+template<class BlockStore,
+         unsigned int BlockSize,
+         class OutputIterator,
+         class AccType,
+         unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void lookback_scan_store_tile(OutputIterator                     block_output,
+                              AccType (&values)[ItemsPerThread],
+                              typename BlockStore::storage_type& storage,
+                              std::false_type                    /* vectorized */)
+{
+    BlockStore().store(block_output, values, storage);
+}
+
+template<class BlockStore,
+         unsigned int BlockSize,
+         class OutputIterator,
+         class AccType,
+         unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void lookback_scan_store_tile(OutputIterator                     block_output,
+                              AccType (&values)[ItemsPerThread],
+                              typename BlockStore::storage_type& storage,
+                              std::true_type                     /* vectorized */)
+{
+    using output_type         = typename std::iterator_traits<OutputIterator>::value_type;
+    using block_exchange_type = ::rocprim::block_exchange<AccType, BlockSize, ItemsPerThread>;
+
+    if(is_vector_aligned<output_type, ItemsPerThread>(block_output))
+    {
+        block_store_vector_transpose<block_exchange_type, BlockSize>(
+            ::rocprim::detail::block_thread_id<0>(),
+            block_output,
+            values,
+            storage);
+    }
+    else
+    {
+        BlockStore().store(block_output, values, storage);
+    }
+}
+
 template<lookback_scan_determinism Determinism,
          bool                      Exclusive,
          class Config,
@@ -151,6 +240,16 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto
     using lookback_scan_prefix_op_type
         = lookback_scan_prefix_op<AccType, BinaryFunction, LookbackScanState, Determinism>;
 
+    // Full tiles of pointers are transposed with vector accesses
+    using vectorized_load = std::integral_constant<
+        bool,
+        params.block_load_method == block_load_method::block_load_transpose
+            && is_vector_accessible<InputIterator, items_per_thread>::value>;
+    using vectorized_store = std::integral_constant<
+        bool,
+        params.block_store_method == block_store_method::block_store_transpose
+            && is_vector_accessible<OutputIterator, items_per_thread>::value>;
+
     ROCPRIM_SHARED_MEMORY union
     {
         typename block_load_type::storage_type  load;
@@ -177,7 +276,10 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto
     }
     else
     {
-        block_load_type().load(input + block_offset, values, storage.load);
+        lookback_scan_load_tile<block_load_type, block_size>(input + block_offset,
+                                                             values,
+                                                             storage.load,
+                                                             vectorized_load{});
     }
     ::rocprim::syncthreads(); // sync threads to reuse shared memory
 
@@ -237,7 +339,10 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto
     }
     else
     {
-        block_store_type().store(output + block_offset, values, storage.store);
+        lookback_scan_store_tile<block_store_type, block_size>(output + block_offset,
+                                                               values,
+                                                               storage.store,
+                                                               vectorized_store{});
     }
 }
 
@@ -37,6 +37,7 @@
 #include "../../block/block_scan.hpp"
 
 #include "../../warp/warp_load.hpp"
+#include "../../warp/warp_radix_sort.hpp"
 #include "../../warp/warp_sort.hpp"
 #include "../../warp/warp_store.hpp"
 
@@ -504,11 +505,17 @@ using select_warp_sort_helper_config_t
                          WarpSortHelperConfig<logical_warp_size, items_per_thread, block_size>,
                          DisabledWarpSortHelperConfig>;
 
+// The largest shared memory the warp radix sort storage of all logical warps in a block may take,
+// the helper falls back to the bitonic warp sort otherwise.
+constexpr size_t segmented_warp_radix_sort_max_storage = 32 * 1024;
+
+// Warps is the number of logical warps of a block that sort concurrently with the helper.
 template<
     class Config,
     class Key,
     class Value,
     bool Descending,
+    unsigned int Warps = 1,
     class Enable = void
 >
 struct segmented_warp_sort_helper
@@ -523,12 +530,13 @@ struct segmented_warp_sort_helper
     }
 };
 
-template<class Config, class Key, class Value, bool Descending>
+template<class Config, class Key, class Value, bool Descending, unsigned int Warps>
 class segmented_warp_sort_helper<
     Config,
     Key,
     Value,
     Descending,
+    Warps,
     std::enable_if_t<!std::is_same<DisabledWarpSortHelperConfig, Config>::value>>
 {
     static constexpr unsigned int logical_warp_size = Config::logical_warp_size;
@@ -547,8 +555,21 @@ class segmented_warp_sort_helper<
     using radix_comparator_type = ::rocprim::detail::radix_merge_compare<Descending, UseRadixMask, key_type>;
     using stable_key_type       = ::rocprim::tuple<key_type, unsigned int>;
     using sort_type             = ::rocprim::warp_sort<stable_key_type, logical_warp_size, value_type>;
+    using radix_sort_type
+        = ::rocprim::warp_radix_sort<key_type, logical_warp_size, items_per_thread, value_type>;
 
     static constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+    // Radix sort needs fewer steps than bitonic sort for integer keys once a warp holds
+    // enough items, it also avoids the stable key tuples. Unlike the other primitives, it needs
+    // storage for every logical warp, so it is only used if that fits.
+    using integral_sort_storage_type = typename std::
+        conditional_t<is_integral<Key>::value, radix_sort_type, sort_type>::storage_type;
+    static constexpr bool use_radix_sort
+        = is_integral<Key>::value && items_per_thread * logical_warp_size >= 64
+          && Warps * sizeof(integral_sort_storage_type) <= segmented_warp_radix_sort_max_storage;
+    static constexpr unsigned int radix_sort_warps = use_radix_sort ? Warps : 1;
+    using radix_sort_storage_type =
+        typename std::conditional_t<use_radix_sort, radix_sort_type, sort_type>::storage_type;
 
     template<class ComparatorT>
     ROCPRIM_DEVICE ROCPRIM_INLINE
@@ -572,6 +593,7 @@ public:
         typename keys_store_type::storage_type keys_store;
         typename values_store_type::storage_type values_store;
         typename sort_type::storage_type sort;
+        radix_sort_storage_type radix_sort[radix_sort_warps];
     };
 
 private:
@@ -581,7 +603,7 @@ private:
                                          storage_type& storage,
                                          unsigned int  begin_bit,
                                          unsigned int  end_bit)
-        -> std::enable_if_t<!is_integral<K>::value>
+        -> std::enable_if_t<!is_integral<K>::value && !use_radix_sort>
     {
         (void)begin_bit;
         (void)end_bit;
@@ -597,7 +619,7 @@ private:
                                          storage_type& storage,
                                          unsigned int  begin_bit,
                                          unsigned int  end_bit)
-        -> std::enable_if_t<is_integral<K>::value>
+        -> std::enable_if_t<is_integral<K>::value && !use_radix_sort>
     {
         if(begin_bit == 0 && end_bit == 8 * sizeof(key_type))
         {
@@ -613,6 +635,51 @@ private:
         }
     }
 
+    // The keys are loaded in striped arrangement, and the radix sort keeps the order of equal
+    // keys in that arrangement, so no index is needed to make it stable.
+    template<class K = Key>
+    ROCPRIM_DEVICE auto invoke_warp_sort(stable_key_type (&stable_keys)[items_per_thread],
+                                         value_type (&values)[items_per_thread],
+                                         storage_type& storage,
+                                         unsigned int  begin_bit,
+                                         unsigned int  end_bit)
+        -> std::enable_if_t<use_radix_sort && std::is_same<K, Key>::value>
+    {
+        const unsigned int warp_id
+            = Warps == 1 ? 0 : ::rocprim::detail::logical_warp_id<logical_warp_size>();
+        auto& radix_storage = storage.radix_sort[warp_id];
+
+        key_type keys[items_per_thread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < items_per_thread; i++)
+        {
+            keys[i] = ::rocprim::get<0>(stable_keys[i]);
+        }
+
+        if ROCPRIM_IF_CONSTEXPR(Descending)
+        {
+            radix_sort_type().sort_desc_from_striped(keys,
+                                                     values,
+                                                     radix_storage,
+                                                     begin_bit,
+                                                     end_bit);
+        }
+        else
+        {
+            radix_sort_type().sort_from_striped(keys,
+                                                values,
+                                                radix_storage,
+                                                begin_bit,
+                                                end_bit);
+        }
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < items_per_thread; i++)
+        {
+            ::rocprim::get<0>(stable_keys[i]) = keys[i];
+        }
+    }
+
 public:
     template<
         class KeysInputIterator,
@@ -1003,7 +1070,8 @@ void segmented_sort_small(KeysInputIterator keys_input,
                                          params.warp_sort_config.block_size_small>,
         key_type,
         value_type,
-        Descending>;
+        Descending,
+        warps_per_block>;
 
     ROCPRIM_SHARED_MEMORY typename warp_sort_helper_type::storage_type storage;
 
@@ -1078,7 +1146,8 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void segmented_sort_medium(
                                          params.warp_sort_config.block_size_medium>,
         key_type,
         value_type,
-        Descending>;
+        Descending,
+        warps_per_block>;
 
     ROCPRIM_SHARED_MEMORY typename warp_sort_helper_type::storage_type storage;
 
@@ -0,0 +1,226 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_STRING_SORT_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_STRING_SORT_HPP_
+
+#include "../../block/block_discontinuity.hpp"
+#include "../../block/block_load.hpp"
+#include "../../block/block_store.hpp"
+
+#include "../../config.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+
+#include <hip/hip_runtime.h>
+
+#include <iterator>
+
+#include <cstddef>
+#include <cstdint>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+/// Strings are sorted by comparing fixed-size chunks of this type, packed big-endian so that
+/// unsigned integer order of the chunks matches lexicographic order of the bytes.
+using string_sort_key_type = uint64_t;
+
+/// Number of characters compared per refinement round.
+constexpr unsigned int string_sort_chunk_size = sizeof(string_sort_key_type);
+
+constexpr unsigned int string_sort_flag_heads_block_size       = 256;
+constexpr unsigned int string_sort_flag_heads_items_per_thread = 8;
+
+/// Loads \p string_sort_chunk_size characters of a string starting at \p depth. Characters past
+/// the end of the string are read as zero, so a string orders before all its extensions.
+template<class CharIterator, class OffsetIterator>
+struct string_sort_prefix_op
+{
+    CharIterator   chars;
+    OffsetIterator offsets;
+    size_t         depth;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    string_sort_key_type operator()(const unsigned int string) const
+    {
+        const size_t begin = static_cast<size_t>(offsets[string]) + depth;
+        const size_t end   = static_cast<size_t>(offsets[string + 1]);
+
+        string_sort_key_type key = 0;
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < string_sort_chunk_size; ++i)
+        {
+            const unsigned char c
+                = begin + i < end ? static_cast<unsigned char>(chars[begin + i]) : 0;
+            key = (key << 8) | c;
+        }
+        return key;
+    }
+};
+
+/// Loads the next chunk of the string at sorted position \p position. Positions that already form
+/// a group on their own are not refined any further, so their characters are not read.
+template<class CharIterator, class OffsetIterator>
+struct string_sort_refine_key_op
+{
+    string_sort_prefix_op<CharIterator, OffsetIterator> prefix_op;
+
+    const unsigned int*  permutation;
+    const unsigned char* heads;
+    unsigned int         size;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    string_sort_key_type operator()(const unsigned int position) const
+    {
+        if(heads[position] && (position + 1 == size || heads[position + 1]))
+        {
+            return 0;
+        }
+        return prefix_op(permutation[position]);
+    }
+};
+
+/// Selects the first position of each group of at least two strings that may still differ, i.e.
+/// whose shared chunk has no zero padding.
+struct string_sort_segment_begin_op
+{
+    const string_sort_key_type* keys;
+    const unsigned char*        heads;
+    unsigned int                size;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    bool operator()(const unsigned int position) const
+    {
+        return heads[position] && position + 1 < size && !heads[position + 1]
+               && (keys[position] & 0xFF) != 0;
+    }
+};
+
+/// Selects the past-the-end position of the groups selected by \p string_sort_segment_begin_op.
+struct string_sort_segment_end_op
+{
+    const string_sort_key_type* keys;
+    const unsigned char*        heads;
+    unsigned int                size;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    bool operator()(const unsigned int end) const
+    {
+        const unsigned int last = end - 1;
+        return !heads[last] && (end == size || heads[end]) && (keys[last] & 0xFF) != 0;
+    }
+};
+
+/// Marks every position whose key differs from the key before it as the head of a new group.
+/// Unless \p first_round is set, the existing flags are kept, since a group can only ever be split.
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+ROCPRIM_KERNEL __launch_bounds__(BlockSize) void string_sort_flag_heads_kernel(
+    const string_sort_key_type* keys,
+    unsigned char*              heads,
+    const unsigned int          size,
+    const bool                  first_round)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    using key_type = string_sort_key_type;
+    using block_load_keys_type
+        = block_load<key_type, BlockSize, ItemsPerThread, block_load_method::block_load_transpose>;
+    using block_load_heads_type = block_load<unsigned char,
+                                             BlockSize,
+                                             ItemsPerThread,
+                                             block_load_method::block_load_transpose>;
+    using block_store_heads_type = block_store<unsigned char,
+                                               BlockSize,
+                                               ItemsPerThread,
+                                               block_store_method::block_store_transpose>;
+    using block_discontinuity_type = block_discontinuity<key_type, BlockSize>;
+
+    ROCPRIM_SHARED_MEMORY union
+    {
+        typename block_load_keys_type::storage_type     load_keys;
+        typename block_load_heads_type::storage_type    load_heads;
+        typename block_store_heads_type::storage_type   store_heads;
+        typename block_discontinuity_type::storage_type discontinuity;
+    } storage;
+
+    const unsigned int block_id     = blockIdx.x;
+    const unsigned int block_offset = block_id * items_per_block;
+    const unsigned int valid_items  = ::rocprim::min(size - block_offset, items_per_block);
+
+    key_type keys_thread[ItemsPerThread];
+    block_load_keys_type{}.load(keys + block_offset,
+                                keys_thread,
+                                valid_items,
+                                key_type(0),
+                                storage.load_keys);
+    ::rocprim::syncthreads();
+
+    bool flags[ItemsPerThread];
+    if(block_id == 0)
+    {
+        block_discontinuity_type{}.flag_heads(flags,
+                                              keys_thread,
+                                              ::rocprim::not_equal_to<key_type>(),
+                                              storage.discontinuity);
+    }
+    else
+    {
+        block_discontinuity_type{}.flag_heads(flags,
+                                              keys[block_offset - 1],
+                                              keys_thread,
+                                              ::rocprim::not_equal_to<key_type>(),
+                                              storage.discontinuity);
+    }
+
+    unsigned char heads_thread[ItemsPerThread] = {};
+    if(!first_round)
+    {
+        ::rocprim::syncthreads();
+        block_load_heads_type{}.load(heads + block_offset,
+                                     heads_thread,
+                                     valid_items,
+                                     static_cast<unsigned char>(0),
+                                     storage.load_heads);
+    }
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        if(flags[i])
+        {
+            heads_thread[i] = 1;
+        }
+    }
+
+    ::rocprim::syncthreads();
+    block_store_heads_type{}.store(heads + block_offset,
+                                   heads_thread,
+                                   valid_items,
+                                   storage.store_heads);
+}
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_STRING_SORT_HPP_
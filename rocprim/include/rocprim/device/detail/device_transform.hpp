@@ -33,6 +33,7 @@
 
 #include "../../block/block_load.hpp"
 #include "../../block/block_store.hpp"
+#include "../../block/detail/block_load_store_vectorized.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -79,7 +80,8 @@ ROCPRIM_DEVICE ROCPRIM_INLINE
 void transform_kernel_impl(InputIterator input,
                            const size_t input_size,
                            OutputIterator output,
-                           UnaryFunction transform_op)
+                           UnaryFunction transform_op,
+                           std::false_type /* vectorized */)
 {
     using input_type = typename std::iterator_traits<InputIterator>::value_type;
     using output_type = typename std::iterator_traits<OutputIterator>::value_type;
@@ -146,6 +148,122 @@ void transform_kernel_impl(InputIterator input,
     }
 }
 
+// Vectorized transform of pointers. The tiles are shifted to start at addresses that are aligned
+// for vector accesses, so full tiles are always loaded and stored with the full vector width
+// regardless of the alignment of the ranges. The items before the first aligned address
+// (the head) are transformed by the last block, which is never a full tile when there is a head.
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    class ResultType,
+    class InputIterator,
+    class OutputIterator,
+    class UnaryFunction
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void transform_kernel_impl(InputIterator input,
+                           const size_t input_size,
+                           OutputIterator output,
+                           UnaryFunction transform_op,
+                           std::true_type /* vectorized */)
+{
+    using input_type = typename std::remove_cv<
+        typename std::iterator_traits<InputIterator>::value_type>::type;
+    using output_type = typename std::iterator_traits<OutputIterator>::value_type;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    // Vectorization is only possible if the input and the output are misaligned by the same
+    // number of items
+    const unsigned int head = vector_alignment_head<input_type, ItemsPerThread>(input);
+    if(input_size <= head
+       || !is_vector_aligned<input_type, ItemsPerThread>(input + head)
+       || !is_vector_aligned<output_type, ItemsPerThread>(output + head))
+    {
+        transform_kernel_impl<BlockSize, ItemsPerThread, ResultType>(
+            input, input_size, output, transform_op, std::false_type{});
+        return;
+    }
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
+    const unsigned int number_of_blocks = ::rocprim::detail::grid_size<0>();
+    const size_t block_offset = head + size_t(flat_block_id) * items_per_block;
+
+    input_type input_values[ItemsPerThread];
+    output_type output_values[ItemsPerThread];
+
+    if(block_offset + items_per_block <= input_size)
+    {
+        block_load_vector_striped<BlockSize>(flat_id, input + block_offset, input_values);
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            output_values[i] = transform_op(input_values[i]);
+        }
+
+        block_store_vector_striped<BlockSize>(flat_id, output + block_offset, output_values);
+    }
+    else if(block_offset < input_size)
+    {
+        const unsigned int valid_in_block = input_size - block_offset;
+        block_load_direct_striped<BlockSize>(
+            flat_id,
+            input + block_offset,
+            input_values,
+            valid_in_block
+        );
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            if(BlockSize * i + flat_id < valid_in_block)
+            {
+                output_values[i] = transform_op(input_values[i]);
+            }
+        }
+
+        block_store_direct_striped<BlockSize>(
+            flat_id,
+            output + block_offset,
+            output_values,
+            valid_in_block
+        );
+    }
+
+    if(flat_block_id == (number_of_blocks - 1))
+    {
+        for(unsigned int i = flat_id; i < head; i += BlockSize)
+        {
+            output[i] = transform_op(input[i]);
+        }
+    }
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    class ResultType,
+    class InputIterator,
+    class OutputIterator,
+    class UnaryFunction
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void transform_kernel_impl(InputIterator input,
+                           const size_t input_size,
+                           OutputIterator output,
+                           UnaryFunction transform_op)
+{
+    using vectorized = std::integral_constant<
+        bool,
+        is_vector_accessible<InputIterator, ItemsPerThread>::value
+            && is_vector_accessible<OutputIterator, ItemsPerThread>::value>;
+
+    transform_kernel_impl<BlockSize, ItemsPerThread, ResultType>(
+        input, input_size, output, transform_op, vectorized{});
+}
+
 } // end of detail namespace
 
 END_ROCPRIM_NAMESPACE
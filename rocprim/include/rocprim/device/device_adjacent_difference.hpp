@@ -23,6 +23,7 @@
 
 #include "detail/device_adjacent_difference.hpp"
 
+#include "device_launch_trace.hpp"
 #include "device_adjacent_difference_config.hpp"
 
 #include "config_types.hpp"
@@ -58,6 +59,7 @@ BEGIN_ROCPRIM_NAMESPACE
         auto _error = hipGetLastError();                                                         \
         if(_error != hipSuccess)                                                                 \
             return _error;                                                                       \
+        ::rocprim::detail::trace_launch_end(name, size);                                         \
         if(debug_synchronous)                                                                    \
         {                                                                                        \
             std::cout << name << "(" << size << ")";                                             \
@@ -210,6 +212,12 @@ hipError_t adjacent_difference_impl(void* const          temporary_storage,
 
             start = std::chrono::high_resolution_clock::now();
         }
+        detail::trace_launch_begin("adjacent_difference",
+                                   dim3(current_blocks),
+                                   dim3(block_size),
+                                   items_per_thread,
+                                   0,
+                                   stream);
         hipLaunchKernelGGL(HIP_KERNEL_NAME(adjacent_difference_kernel<config, InPlace, Right>),
                            dim3(current_blocks),
                            dim3(block_size),
@@ -0,0 +1,410 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_AUTOTUNE_HPP_
+#define ROCPRIM_DEVICE_DEVICE_AUTOTUNE_HPP_
+
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include <cstddef>
+
+#include "../config.hpp"
+#include "../functional.hpp"
+#include "config_types.hpp"
+
+/// \addtogroup primitivesmodule_deviceconfigs
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief Options of the online autotuner, see enable_autotune().
+struct autotune_options
+{
+    /// Path of the file that stores the selected candidates. It is read by enable_autotune(),
+    /// and every new selection is appended to it. May be \p nullptr to not persist the
+    /// selections.
+    const char* cache_path = nullptr;
+    /// Number of timed runs of each candidate, after an untimed warm-up run.
+    unsigned int repetitions = 3;
+    /// Total device time in milliseconds that the process may spend on tuning. Once it is
+    /// used up, calls without a selection use the default config.
+    float time_budget_ms = 10000.0f;
+};
+
+/// \brief Declares that \p Operation computes its result only from its arguments and has no
+/// side effects.
+///
+/// The autotuner runs every candidate config of a call, so it invokes the operation of the
+/// call many times. Calls are only tuned when this trait is \p true for their operation (the
+/// transform, reduction or scan operation), so the user has to opt in for their own function
+/// objects:
+/// \code{.cpp}
+/// namespace rocprim
+/// {
+/// template<>
+/// struct is_pure_operation<my_op> : std::true_type
+/// {};
+/// } // namespace rocprim
+/// \endcode
+/// It is \p true for the arithmetic, comparison and identity function objects of rocPRIM.
+template<class Operation>
+struct is_pure_operation : std::false_type
+{};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS // Do not document
+
+template<class T>
+struct is_pure_operation<::rocprim::plus<T>> : std::true_type
+{};
+
+template<class T>
+struct is_pure_operation<::rocprim::minus<T>> : std::true_type
+{};
+
+template<class T>
+struct is_pure_operation<::rocprim::multiplies<T>> : std::true_type
+{};
+
+template<class T>
+struct is_pure_operation<::rocprim::maximum<T>> : std::true_type
+{};
+
+template<class T>
+struct is_pure_operation<::rocprim::minimum<T>> : std::true_type
+{};
+
+template<class T>
+struct is_pure_operation<::rocprim::identity<T>> : std::true_type
+{};
+
+template<class T>
+struct is_pure_operation<::rocprim::less<T>> : std::true_type
+{};
+
+template<class T>
+struct is_pure_operation<::rocprim::less_equal<T>> : std::true_type
+{};
+
+template<class T>
+struct is_pure_operation<::rocprim::greater<T>> : std::true_type
+{};
+
+template<class T>
+struct is_pure_operation<::rocprim::greater_equal<T>> : std::true_type
+{};
+
+template<class T>
+struct is_pure_operation<::rocprim::equal_to<T>> : std::true_type
+{};
+
+template<class T>
+struct is_pure_operation<::rocprim::not_equal_to<T>> : std::true_type
+{};
+
+namespace detail
+{
+
+struct autotune_entry
+{
+    unsigned int candidate;
+    // False while a thread is tuning the entry.
+    bool tuned;
+};
+
+struct autotune_state
+{
+    std::mutex        mutex;
+    std::atomic<bool> enabled{false};
+    autotune_options  options;
+    std::string       cache_path;
+    float             spent_ms = 0.0f;
+    // Keyed on "algorithm device types size_bucket".
+    std::unordered_map<std::string, autotune_entry> entries;
+    std::unordered_map<int, std::string>            device_names;
+};
+
+inline hipError_t parse_autotune_cache(std::istream&                                    input,
+                                       std::unordered_map<std::string, autotune_entry>& entries)
+{
+    std::string line;
+    while(std::getline(input, line))
+    {
+        line = line.substr(0, line.find('#'));
+        std::istringstream fields(line);
+
+        std::string algorithm, device, types, size_bucket, candidate;
+        if(!(fields >> algorithm))
+        {
+            continue;
+        }
+        std::string extra;
+        if(!(fields >> device >> types >> size_bucket >> candidate) || (fields >> extra))
+        {
+            return hipErrorInvalidValue;
+        }
+        char* end = nullptr;
+        const unsigned long value = std::strtoul(candidate.c_str(), &end, 10);
+        if(*end != '\0')
+        {
+            return hipErrorInvalidValue;
+        }
+        // Later lines override earlier ones, so a re-tuned selection can be appended.
+        entries[algorithm + ' ' + device + ' ' + types + ' ' + size_bucket]
+            = autotune_entry{static_cast<unsigned int>(value), true};
+    }
+    return hipSuccess;
+}
+
+inline hipError_t enable_autotune(autotune_state& state, const autotune_options& options)
+{
+    std::unordered_map<std::string, autotune_entry> entries;
+    if(options.cache_path != nullptr)
+    {
+        // A missing cache file is created by the first selection.
+        std::ifstream file(options.cache_path);
+        if(file)
+        {
+            const hipError_t result = parse_autotune_cache(file, entries);
+            if(result != hipSuccess)
+            {
+                return result;
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(state.mutex);
+    // Entries that are being tuned are kept, their threads still finish them.
+    for(const auto& entry : state.entries)
+    {
+        if(!entry.second.tuned)
+        {
+            entries.insert(entry);
+        }
+    }
+    state.options    = options;
+    state.cache_path = options.cache_path != nullptr ? options.cache_path : "";
+    state.entries    = std::move(entries);
+    state.spent_ms   = 0.0f;
+    state.enabled.store(true, std::memory_order_release);
+    return hipSuccess;
+}
+
+inline autotune_state& get_autotune_state()
+{
+    static autotune_state state;
+    // The environment is read once, on first use, and a malformed cache disables tuning.
+    static const bool from_environment = [] {
+        const char* path = std::getenv("ROCPRIM_AUTOTUNE_CACHE");
+        if(path == nullptr)
+        {
+            return false;
+        }
+        autotune_options options;
+        options.cache_path = path;
+        return enable_autotune(state, options) == hipSuccess;
+    }();
+    (void)from_environment;
+    return state;
+}
+
+/// Identifies the device by its architecture and number of compute units, so that devices
+/// with the same architecture but a different size are tuned separately.
+inline hipError_t get_autotune_device_name(autotune_state& state, int device_id, std::string& name)
+{
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        const auto                  it = state.device_names.find(device_id);
+        if(it != state.device_names.end())
+        {
+            name = it->second;
+            return hipSuccess;
+        }
+    }
+
+    hipDeviceProp_t  device_props;
+    const hipError_t result = hipGetDeviceProperties(&device_props, device_id);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const std::string arch_name(device_props.gcnArchName);
+    name = arch_name.substr(0, arch_name.find(':')) + "_cu"
+           + std::to_string(device_props.multiProcessorCount);
+
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.device_names.emplace(device_id, name);
+    return hipSuccess;
+}
+
+/// Returns the size bucket of \p size: bucket \p b holds the sizes from <tt>2^(b-1)</tt> to
+/// <tt>2^b - 1</tt>, and bucket 0 the empty inputs.
+inline unsigned int autotune_size_bucket(size_t size)
+{
+    unsigned int bucket = 0;
+    for(; size != 0; size >>= 1)
+    {
+        ++bucket;
+    }
+    return bucket;
+}
+
+enum class autotune_lookup
+{
+    // The candidate was tuned before.
+    selected,
+    // The caller must tune the candidate and call finish_autotune.
+    tune,
+    // Use the default config: another thread is tuning, or tuning is not possible.
+    skip
+};
+
+inline autotune_lookup begin_autotune(autotune_state&    state,
+                                      const std::string& key,
+                                      const bool         can_tune,
+                                      unsigned int&      candidate,
+                                      autotune_options&  options)
+{
+    std::lock_guard<std::mutex> lock(state.mutex);
+    const auto                  it = state.entries.find(key);
+    if(it != state.entries.end())
+    {
+        candidate = it->second.candidate;
+        return it->second.tuned ? autotune_lookup::selected : autotune_lookup::skip;
+    }
+    if(!can_tune || state.spent_ms >= state.options.time_budget_ms)
+    {
+        return autotune_lookup::skip;
+    }
+    state.entries.emplace(key, autotune_entry{0, false});
+    options = state.options;
+    return autotune_lookup::tune;
+}
+
+/// Returns whether tuning may continue after the calling thread spent \p elapsed_ms on it,
+/// in addition to the time of the finished tunings.
+inline bool autotune_has_budget(autotune_state& state, const float elapsed_ms)
+{
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.spent_ms + elapsed_ms < state.options.time_budget_ms;
+}
+
+/// Stores the selected candidate of \p key. If tuning failed or ran out of time budget
+/// (\p tuned is \p false), the entry is removed so that a later call can tune it again.
+inline void finish_autotune(autotune_state&    state,
+                            const std::string& key,
+                            const bool         tuned,
+                            const unsigned int candidate,
+                            const float        elapsed_ms)
+{
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.spent_ms += elapsed_ms;
+    const auto it = state.entries.find(key);
+    if(it == state.entries.end())
+    {
+        return;
+    }
+    if(!tuned)
+    {
+        state.entries.erase(it);
+        return;
+    }
+    it->second = autotune_entry{candidate, true};
+    if(!state.cache_path.empty())
+    {
+        // Appending a whole line keeps the file valid when several processes tune at once.
+        std::ofstream file(state.cache_path, std::ios::app);
+        file << key + ' ' + std::to_string(candidate) + '\n' << std::flush;
+    }
+}
+
+inline bool autotune_is_capturing(const hipStream_t stream)
+{
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess)
+    {
+        // Do not time a stream of unknown state.
+        return true;
+    }
+    return capture_status != hipStreamCaptureStatusNone;
+}
+
+} // end namespace detail
+
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// \brief Enables the online autotuner for device-level functions called with a
+/// \p tuned_config.
+///
+/// On the first call for an algorithm, value types, size bucket (sizes between consecutive
+/// powers of two) and device without an entry in the config database, every candidate of
+/// the \p tuned_config is run on the real data of the call and timed with events, and the
+/// fastest one is used for all later calls of that kind. The result of the tuned call is the
+/// same as without tuning, but the call blocks until the timings are known.
+///
+/// The selections are appended to the cache file in \p options, and read back by
+/// enable_autotune() in later processes. The autotuner is also enabled on first use, with
+/// default options, if the \p ROCPRIM_AUTOTUNE_CACHE environment variable holds the path of
+/// a cache file.
+///
+/// Calls are not tuned, and use the default config until another call selects a candidate:
+/// * while another thread is tuning the same kind of call,
+/// * when the stream is being captured into a graph,
+/// * when the operation of the call is not declared free of side effects with
+///   is_pure_operation, as the candidates run it many times,
+/// * when the output can overlap the input, as running the candidates repeatedly would
+///   change the result,
+/// * when the time budget in \p options is used up. The budget is also checked between the
+///   candidates; a call that runs out of it uses the fastest candidate timed so far, which is
+///   not stored.
+///
+/// Calls that are not tuned still use a candidate selected before by a tuned call of the same
+/// kind. The iterators of a tuned call are dereferenced repeatedly as well, so they must not
+/// have side effects either.
+///
+/// \param [in] options - options of the autotuner.
+/// \return \p hipErrorInvalidValue if the cache file contains a malformed entry, in which case
+/// the autotuner is not enabled, \p hipSuccess otherwise.
+inline hipError_t enable_autotune(const autotune_options& options = autotune_options())
+{
+    return detail::enable_autotune(detail::get_autotune_state(), options);
+}
+
+/// \brief Disables the online autotuner. Calls with a \p tuned_config use the config database
+/// or the default config again.
+inline void disable_autotune()
+{
+    detail::get_autotune_state().enabled.store(false, std::memory_order_release);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group primitivesmodule_deviceconfigs
+
+#endif // ROCPRIM_DEVICE_DEVICE_AUTOTUNE_HPP_
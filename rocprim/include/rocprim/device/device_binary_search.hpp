@@ -83,6 +83,14 @@ hipError_t binary_search(void * temporary_storage,
     );
 }
 
+// Type of the output used to select the default config. Output iterators with void value_type
+// (for example transform_output_iterator) are assigned the indices returned by the search ops.
+template<class OutputIterator>
+using binary_search_output_type_t = std::conditional_t<
+    std::is_void<typename std::iterator_traits<OutputIterator>::value_type>::value,
+    size_t,
+    typename std::iterator_traits<OutputIterator>::value_type>;
+
 template<class Config, class Tag>
 struct is_default_or_has_tag
 {
@@ -216,7 +224,7 @@ hipError_t lower_bound(void * temporary_storage,
                   "Config must be a specialization of struct template lower_bound_config");
 
     using value_type  = typename std::iterator_traits<NeedlesIterator>::value_type;
-    using output_type = typename std::iterator_traits<OutputIterator>::value_type;
+    using output_type = detail::binary_search_output_type_t<OutputIterator>;
     using config
         = std::conditional_t<std::is_same<default_config, Config>::value,
                              detail::default_config_for_lower_bound<value_type, output_type>,
@@ -352,7 +360,7 @@ hipError_t upper_bound(void * temporary_storage,
     static_assert(detail::is_default_or_has_tag<Config, detail::upper_bound_config_tag>::value,
                   "Config must be a specialization of struct template upper_bound_config");
     using value_type  = typename std::iterator_traits<NeedlesIterator>::value_type;
-    using output_type = typename std::iterator_traits<OutputIterator>::value_type;
+    using output_type = detail::binary_search_output_type_t<OutputIterator>;
     using config
         = std::conditional_t<std::is_same<default_config, Config>::value,
                              detail::default_config_for_upper_bound<value_type, output_type>,
@@ -483,7 +491,7 @@ hipError_t binary_search(void * temporary_storage,
     static_assert(detail::is_default_or_has_tag<Config, detail::binary_search_config_tag>::value,
                   "Config must be a specialization of struct template binary_search_config");
     using value_type  = typename std::iterator_traits<NeedlesIterator>::value_type;
-    using output_type = typename std::iterator_traits<OutputIterator>::value_type;
+    using output_type = detail::binary_search_output_type_t<OutputIterator>;
     using config
         = std::conditional_t<std::is_same<default_config, Config>::value,
                              detail::default_config_for_binary_search<value_type, output_type>,
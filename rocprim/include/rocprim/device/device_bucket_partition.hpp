@@ -0,0 +1,477 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_BUCKET_PARTITION_HPP_
+#define ROCPRIM_DEVICE_DEVICE_BUCKET_PARTITION_HPP_
+
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+
+#include "config_types.hpp"
+#include "detail/device_bucket_partition.hpp"
+#include "device_launch_trace.hpp"
+#include "device_bucket_partition_config.hpp"
+
+#include <hip/hip_runtime.h>
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <utility>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start)                           \
+    do                                                                                           \
+    {                                                                                            \
+        hipError_t _error = hipGetLastError();                                                   \
+        if(_error != hipSuccess)                                                                 \
+            return _error;                                                                       \
+        ::rocprim::detail::trace_launch_end(name, size);                                         \
+        if(debug_synchronous)                                                                    \
+        {                                                                                        \
+            std::cout << name << "(" << size << ")";                                             \
+            hipError_t __error = hipStreamSynchronize(stream);                                   \
+            if(__error != hipSuccess)                                                            \
+                return __error;                                                                  \
+            auto _end = std::chrono::steady_clock::now();                                        \
+            auto _d   = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start); \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n';                              \
+        }                                                                                        \
+    }                                                                                            \
+    while(0)
+
+template<class Config, class InputIterator, class BucketOp>
+ROCPRIM_KERNEL __launch_bounds__(
+    device_params<Config>()
+        .kernel_config
+        .block_size) void bucket_partition_histogram_kernel(InputIterator      input,
+                                                            const size_t       size,
+                                                            const unsigned int num_buckets,
+                                                            BucketOp           bucket_op,
+                                                            size_t*            bucket_counts,
+                                                            const unsigned int full_blocks)
+{
+    static constexpr bucket_partition_config_params params = device_params<Config>();
+    if(::rocprim::detail::block_id<0>() < full_blocks)
+    {
+        bucket_partition_histogram_impl<true,
+                                        params.kernel_config.block_size,
+                                        params.kernel_config.items_per_thread>(input,
+                                                                               size,
+                                                                               num_buckets,
+                                                                               bucket_op,
+                                                                               bucket_counts);
+    }
+    else
+    {
+        bucket_partition_histogram_impl<false,
+                                        params.kernel_config.block_size,
+                                        params.kernel_config.items_per_thread>(input,
+                                                                               size,
+                                                                               num_buckets,
+                                                                               bucket_op,
+                                                                               bucket_counts);
+    }
+}
+
+template<unsigned int BlockSize, class BucketOffsetIterator>
+ROCPRIM_KERNEL __launch_bounds__(BlockSize) void bucket_partition_scan_kernel(
+    const size_t*        bucket_counts,
+    size_t*              bucket_starts,
+    BucketOffsetIterator bucket_offsets,
+    const unsigned int   num_buckets)
+{
+    bucket_partition_scan_impl<BlockSize>(bucket_counts,
+                                          bucket_starts,
+                                          bucket_offsets,
+                                          num_buckets);
+}
+
+template<class Config, class InputIterator, class OutputIterator, class BucketOp>
+ROCPRIM_KERNEL __launch_bounds__(
+    device_params<Config>()
+        .kernel_config
+        .block_size) void bucket_partition_scatter_kernel(InputIterator            input,
+                                                          OutputIterator           output,
+                                                          const unsigned int       size,
+                                                          const unsigned int       num_buckets,
+                                                          const unsigned int       bucket_bits,
+                                                          BucketOp                 bucket_op,
+                                                          const size_t*            bucket_offsets_in,
+                                                          size_t*                  bucket_offsets_out,
+                                                          onesweep_lookback_state* lookback_states,
+                                                          const unsigned int       full_blocks)
+{
+    static constexpr bucket_partition_config_params params = device_params<Config>();
+    if(::rocprim::detail::block_id<0>() < full_blocks)
+    {
+        bucket_partition_scatter_impl<true,
+                                      params.kernel_config.block_size,
+                                      params.kernel_config.items_per_thread>(input,
+                                                                             output,
+                                                                             size,
+                                                                             num_buckets,
+                                                                             bucket_bits,
+                                                                             bucket_op,
+                                                                             bucket_offsets_in,
+                                                                             bucket_offsets_out,
+                                                                             lookback_states);
+    }
+    else
+    {
+        bucket_partition_scatter_impl<false,
+                                      params.kernel_config.block_size,
+                                      params.kernel_config.items_per_thread>(input,
+                                                                             output,
+                                                                             size,
+                                                                             num_buckets,
+                                                                             bucket_bits,
+                                                                             bucket_op,
+                                                                             bucket_offsets_in,
+                                                                             bucket_offsets_out,
+                                                                             lookback_states);
+    }
+}
+
+template<class Config,
+         class InputIterator,
+         class OutputIterator,
+         class BucketOffsetIterator,
+         class BucketOp>
+inline hipError_t bucket_partition_impl(void*                temporary_storage,
+                                        size_t&              storage_size,
+                                        InputIterator        input,
+                                        OutputIterator       output,
+                                        BucketOffsetIterator bucket_offsets,
+                                        const size_t         size,
+                                        const unsigned int   num_buckets,
+                                        BucketOp             bucket_op,
+                                        const hipStream_t    stream,
+                                        const bool           debug_synchronous)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+    using config     = wrapped_bucket_partition_config<Config, value_type>;
+
+    if(num_buckets == 0 || num_buckets > bucket_partition_max_buckets)
+    {
+        return hipErrorInvalidValue;
+    }
+
+    target_arch target_arch;
+    hipError_t  result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const bucket_partition_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size      = params.kernel_config.block_size;
+    const unsigned int items_per_block = block_size * params.kernel_config.items_per_thread;
+
+    // Every block of a batch has a look-back state per bucket. The batches are kept small enough
+    // for these states to fit in a fixed budget, and for the counts to fit in the states.
+    const size_t       max_lookback_states = size_t(1) << 24;
+    const unsigned int max_blocks_per_batch
+        = static_cast<unsigned int>(::rocprim::max<size_t>(1, max_lookback_states / num_buckets));
+    const unsigned int max_items_per_full_batch = (1u << 30) - 1;
+    const unsigned int items_per_full_batch     = ::rocprim::min(
+        max_items_per_full_batch - max_items_per_full_batch % items_per_block,
+        max_blocks_per_batch * items_per_block);
+
+    const unsigned int items_per_batch
+        = static_cast<unsigned int>(::rocprim::min<size_t>(size, items_per_full_batch));
+    const unsigned int blocks_per_batch = ceiling_div(items_per_batch, items_per_block);
+
+    size_t*                  bucket_counts   = nullptr;
+    size_t*                  bucket_starts   = nullptr;
+    size_t*                  bucket_ends     = nullptr;
+    onesweep_lookback_state* lookback_states = nullptr;
+
+    result = temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        temp_storage::make_linear_partition(
+            temp_storage::ptr_aligned_array(&bucket_counts, num_buckets),
+            temp_storage::ptr_aligned_array(&bucket_starts, num_buckets),
+            temp_storage::ptr_aligned_array(&bucket_ends, num_buckets),
+            temp_storage::ptr_aligned_array(&lookback_states,
+                                            static_cast<size_t>(num_buckets) * blocks_per_batch)));
+    if(result != hipSuccess || temporary_storage == nullptr)
+    {
+        return result;
+    }
+
+    unsigned int bucket_bits = 1;
+    while((1u << bucket_bits) < num_buckets)
+    {
+        ++bucket_bits;
+    }
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+    const auto                            start_timer = [&start, debug_synchronous]()
+    {
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+    };
+
+    if(debug_synchronous)
+    {
+        std::cout << "num_buckets " << num_buckets << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+        std::cout << "items_per_full_batch " << items_per_full_batch << '\n';
+        std::cout << "blocks_per_batch " << blocks_per_batch << '\n';
+    }
+
+    result = hipMemsetAsync(bucket_counts, 0, sizeof(*bucket_counts) * num_buckets, stream);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    if(size > 0)
+    {
+        const unsigned int blocks = static_cast<unsigned int>(ceiling_div(size, items_per_block));
+        const unsigned int full_blocks = size % items_per_block == 0 ? blocks : blocks - 1;
+
+        start_timer();
+        detail::trace_launch_begin("bucket_partition",
+                                   dim3(blocks),
+                                   dim3(block_size),
+                                   params.kernel_config.items_per_thread,
+                                   0,
+                                   stream);
+        bucket_partition_histogram_kernel<config>
+            <<<blocks, block_size, 0, stream>>>(input,
+                                                size,
+                                                num_buckets,
+                                                bucket_op,
+                                                bucket_counts,
+                                                full_blocks);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("bucket_partition_histogram_kernel",
+                                                    size,
+                                                    start);
+    }
+
+    start_timer();
+    detail::trace_launch_begin("bucket_partition",
+                               dim3(1),
+                               dim3(bucket_partition_scan_block_size),
+                               0,
+                               0,
+                               stream);
+    bucket_partition_scan_kernel<bucket_partition_scan_block_size>
+        <<<1, bucket_partition_scan_block_size, 0, stream>>>(bucket_counts,
+                                                             bucket_starts,
+                                                             bucket_offsets,
+                                                             num_buckets);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("bucket_partition_scan_kernel", num_buckets, start);
+
+    for(size_t offset = 0; offset < size; offset += items_per_batch)
+    {
+        const unsigned int current_batch_size
+            = static_cast<unsigned int>(::rocprim::min<size_t>(size - offset, items_per_batch));
+        const unsigned int blocks = ceiling_div(current_batch_size, items_per_block);
+        const unsigned int full_blocks
+            = current_batch_size % items_per_block == 0 ? blocks : blocks - 1;
+
+        // Reset lookback scan states to zero, indicating empty prefix.
+        result = hipMemsetAsync(lookback_states,
+                                0,
+                                sizeof(*lookback_states) * num_buckets * blocks,
+                                stream);
+        if(result != hipSuccess)
+        {
+            return result;
+        }
+
+        start_timer();
+        detail::trace_launch_begin("bucket_partition",
+                                   dim3(blocks),
+                                   dim3(block_size),
+                                   params.kernel_config.items_per_thread,
+                                   0,
+                                   stream);
+        bucket_partition_scatter_kernel<config>
+            <<<blocks, block_size, 0, stream>>>(input + offset,
+                                                output,
+                                                current_batch_size,
+                                                num_buckets,
+                                                bucket_bits,
+                                                bucket_op,
+                                                bucket_starts,
+                                                bucket_ends,
+                                                lookback_states,
+                                                full_blocks);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("bucket_partition_scatter_kernel",
+                                                    current_batch_size,
+                                                    start);
+
+        // The end of each bucket in this batch is where the next batch starts
+        std::swap(bucket_starts, bucket_ends);
+    }
+
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // namespace detail
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief Stable partitioning of a range into a number of buckets.
+///
+/// \par Overview
+/// * Every item of the input is copied to the output region of the bucket given by \p bucket_op.
+/// The buckets are stored in order, and the items of every bucket keep their relative order
+/// from the input, so the result equals a stable sort by bucket index.
+/// * The start of every bucket in the output is written to \p bucket_offsets, followed by
+/// \p size, so bucket \p b occupies <tt>[bucket_offsets[b], bucket_offsets[b + 1])</tt>.
+/// * The items are read twice and written once: the first pass only counts the buckets, the
+/// second pass scatters the items to their final position. The counting pass is needed because
+/// the start of a bucket depends on the sizes of all smaller buckets in the whole input, like
+/// the histogram pass of onesweep radix sort. No intermediate copy is made, unlike with a radix
+/// sort over the bucket indices.
+/// * The number of buckets must be in the range <tt>[1, 4096]</tt>, otherwise
+/// \p hipErrorInvalidValue is returned.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * Ranges specified by \p input and \p output must have at least \p size elements, and
+/// \p bucket_offsets must have at least <tt>num_buckets + 1</tt> elements.
+/// * Ranges specified by \p input and \p output must not overlap.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be
+/// \p bucket_partition_config or \p default_config.
+/// \tparam InputIterator [inferred] random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam OutputIterator [inferred] random-access iterator type of the output range. It can be
+/// a simple pointer type.
+/// \tparam BucketOffsetIterator [inferred] random-access iterator type of the bucket offsets
+/// range. It can be a simple pointer type.
+/// \tparam BucketOp [inferred] type of the bucket operation.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the partition operation.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input iterator to the first element in the range to partition.
+/// \param [out] output iterator to the first element in the output range.
+/// \param [out] bucket_offsets iterator to the output range of bucket offsets.
+/// \param [in] size number of element in the input range.
+/// \param [in] num_buckets number of buckets.
+/// \param [in] bucket_op unary function object which returns the bucket of an item. The signature
+/// of the function should be equivalent to the following:
+/// <tt>unsigned int f(const T &a);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the object passed to it. The returned
+/// value must be smaller than \p num_buckets.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful partition; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level bucket partition is performed on an array of unsigned
+/// integers, which are partitioned by their value modulo 3.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// auto bucket_op =
+///     [] __device__ (unsigned int a) -> unsigned int
+///     {
+///         return a % 3;
+///     };
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;            // e.g., 8
+/// unsigned int * input;         // e.g., [1, 2, 3, 4, 5, 6, 7, 8]
+/// unsigned int * output;        // empty array of 8 elements
+/// size_t * bucket_offsets;      // empty array of 4 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::bucket_partition(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, bucket_offsets,
+///     input_size, 3, bucket_op
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform partition
+/// rocprim::bucket_partition(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, bucket_offsets,
+///     input_size, 3, bucket_op
+/// );
+/// // output:         [3, 6, 1, 4, 7, 2, 5, 8]
+/// // bucket_offsets: [0, 2, 5, 8]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class BucketOffsetIterator,
+         class BucketOp>
+inline hipError_t bucket_partition(void*                temporary_storage,
+                                   size_t&              storage_size,
+                                   InputIterator        input,
+                                   OutputIterator       output,
+                                   BucketOffsetIterator bucket_offsets,
+                                   const size_t         size,
+                                   const unsigned int   num_buckets,
+                                   BucketOp             bucket_op,
+                                   const hipStream_t    stream            = 0,
+                                   const bool           debug_synchronous = false)
+{
+    return detail::bucket_partition_impl<Config>(temporary_storage,
+                                                 storage_size,
+                                                 input,
+                                                 output,
+                                                 bucket_offsets,
+                                                 size,
+                                                 num_buckets,
+                                                 bucket_op,
+                                                 stream,
+                                                 debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_BUCKET_PARTITION_HPP_
@@ -31,6 +31,7 @@
 #include "../functional.hpp"
 
 #include "detail/device_histogram.hpp"
+#include "device_launch_trace.hpp"
 #include "device_histogram_config.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
@@ -74,22 +75,25 @@ ROCPRIM_KERNEL __launch_bounds__(
                                                   fixed_array<unsigned int, ActiveChannels> bins)
 {
     static constexpr histogram_config_params params = device_params<Config>();
+    static constexpr bool                    warp_aggregated
+        = params.shared_impl_algorithm == block_histogram_algorithm::using_warp_aggregated_atomic;
 
     HIP_DYNAMIC_SHARED(unsigned int, block_histogram);
 
     histogram_shared<params.histogram_config.block_size,
                      params.histogram_config.items_per_thread,
                      Channels,
-                     ActiveChannels>(samples,
-                                     columns,
-                                     rows,
-                                     row_stride,
-                                     rows_per_block,
-                                     shared_histograms,
-                                     histogram,
-                                     sample_to_bin_op,
-                                     bins,
-                                     block_histogram);
+                     ActiveChannels,
+                     warp_aggregated>(samples,
+                                      columns,
+                                      rows,
+                                      row_stride,
+                                      rows_per_block,
+                                      shared_histograms,
+                                      histogram,
+                                      sample_to_bin_op,
+                                      bins,
+                                      block_histogram);
 }
 
 template<class Config,
@@ -128,6 +132,7 @@ ROCPRIM_KERNEL __launch_bounds__(
         auto _error = hipGetLastError();                                                         \
         if(_error != hipSuccess)                                                                 \
             return _error;                                                                       \
+        ::rocprim::detail::trace_launch_end(name, size);                                         \
         if(debug_synchronous)                                                                    \
         {                                                                                        \
             std::cout << name << "(" << size << ")";                                             \
@@ -223,6 +228,12 @@ inline hipError_t histogram_impl(void*          temporary_storage,
     {
         start = std::chrono::high_resolution_clock::now();
     }
+    detail::trace_launch_begin("histogram",
+                               dim3(::rocprim::detail::ceiling_div(max_bins, block_size)),
+                               dim3(block_size),
+                               0,
+                               0,
+                               stream);
     hipLaunchKernelGGL(HIP_KERNEL_NAME(init_histogram_kernel<config, ActiveChannels>),
                        dim3(::rocprim::detail::ceiling_div(max_bins, block_size)),
                        dim3(block_size),
@@ -296,6 +307,12 @@ inline hipError_t histogram_impl(void*          temporary_storage,
         grid_size.x = std::min(chosen_grid_size, blocks_x);
         grid_size.y = std::min(rows, ::rocprim::detail::ceiling_div(chosen_grid_size, grid_size.x));
         const unsigned int rows_per_block = ::rocprim::detail::ceiling_div(rows, grid_size.y);
+        detail::trace_launch_begin("histogram",
+                                   dim3(grid_size),
+                                   dim3(block_size, 1),
+                                   items_per_thread,
+                                   chosen_shared_histograms * block_histogram_bytes,
+                                   stream);
         hipLaunchKernelGGL(kernel,
                            grid_size,
                            dim3(block_size, 1),
@@ -320,6 +337,12 @@ inline hipError_t histogram_impl(void*          temporary_storage,
         {
             start = std::chrono::high_resolution_clock::now();
         }
+        detail::trace_launch_begin("histogram",
+                                   dim3(blocks_x, rows),
+                                   dim3(block_size, 1),
+                                   items_per_thread,
+                                   0,
+                                   stream);
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(histogram_global_kernel<config, Channels, ActiveChannels>),
             dim3(blocks_x, rows),
@@ -0,0 +1,578 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_LAUNCH_TRACE_HPP_
+#define ROCPRIM_DEVICE_DEVICE_LAUNCH_TRACE_HPP_
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include <cstddef>
+
+#include "../config.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief Description of a single kernel launch made by a device-level algorithm.
+///
+/// All pointers refer to string literals with static storage duration, so they can be
+/// stored by the callbacks without copying.
+struct kernel_launch_info
+{
+    /// Name of the device-level algorithm that launched the kernel (e.g. <tt>"reduce"</tt>).
+    const char* algorithm;
+    /// Name of the launched kernel, as printed when \p debug_synchronous is set.
+    const char* kernel_name;
+    /// Number of blocks in the launch grid.
+    dim3 grid_size;
+    /// Number of threads per block.
+    dim3 block_size;
+    /// Number of items processed by each thread, as set by the config selected for the
+    /// launch. 0 for kernels that do not process a fixed number of items per thread, e.g.
+    /// the initialization kernels of the look-back scans.
+    unsigned int items_per_thread;
+    /// Size of the dynamically allocated shared memory, in bytes.
+    unsigned int dynamic_shared_memory;
+    /// Index of the tuned_config candidate that was selected for the call: 0 for the
+    /// default config, \p i for the <tt>i</tt>-th candidate of the tuned_config. Always 0
+    /// when the config of the call is not a tuned_config.
+    unsigned int config_candidate;
+    /// Problem size processed by the launch (number of items, segments, bins or blocks,
+    /// depending on the kernel).
+    size_t size;
+    /// Stream the kernel was launched on.
+    hipStream_t stream;
+};
+
+/// \brief Callback invoked on the host right after a kernel is launched.
+///
+/// \param [in] info - description of the launch.
+/// \param [in] user_data - pointer passed in launch_tracer::user_data.
+using launch_trace_callback = void (*)(const kernel_launch_info& info, void* user_data);
+
+/// \brief Callback invoked on the host once the execution time of a kernel is known.
+///
+/// \param [in] info - description of the launch.
+/// \param [in] elapsed_ms - time between the start and the end of the kernel on the
+/// device, in milliseconds.
+/// \param [in] user_data - pointer passed in launch_tracer::user_data.
+using launch_timing_callback
+    = void (*)(const kernel_launch_info& info, float elapsed_ms, void* user_data);
+
+/// \brief Set of callbacks that observe the kernels launched by device-level algorithms.
+///
+/// When \p on_timing is set, a pair of events is recorded around every launch. The events
+/// are never waited on by the algorithms: elapsed times are resolved later, when the
+/// events have completed, either opportunistically during subsequent launches or
+/// explicitly by calling flush_launch_timings(). Timing is skipped for launches made
+/// into a stream that is being captured into a graph.
+struct launch_tracer
+{
+    /// Called for every successful kernel launch. May be \p nullptr.
+    launch_trace_callback on_launch = nullptr;
+    /// Called with the device execution time of every launch. May be \p nullptr.
+    launch_timing_callback on_timing = nullptr;
+    /// Opaque pointer forwarded to both callbacks.
+    void* user_data = nullptr;
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS // Do not document
+
+namespace detail
+{
+
+struct launch_trace_pending_timing
+{
+    kernel_launch_info info;
+    launch_tracer      tracer;
+    hipEvent_t         start;
+    hipEvent_t         stop;
+};
+
+struct launch_trace_state
+{
+    // Limits the number of unresolved timings, new launches are not timed above it.
+    static constexpr size_t max_pending_timings = 4096;
+    // Limits the number of idle events kept for reuse.
+    static constexpr size_t max_pooled_events = 64;
+
+    std::mutex                              mutex;
+    std::atomic<bool>                       enabled{false};
+    launch_tracer                           global_tracer;
+    std::vector<hipEvent_t>                 event_pool;
+    std::deque<launch_trace_pending_timing> pending_timings;
+};
+
+struct launch_trace_thread_state
+{
+    const launch_tracer* scoped_tracer = nullptr;
+
+    // Launch started by trace_launch_begin and not yet reported by trace_launch_end.
+    bool          launch_pending = false;
+    launch_tracer tracer;
+    const char*   algorithm;
+    dim3          grid_size;
+    dim3          block_size;
+    unsigned int  items_per_thread;
+    unsigned int  dynamic_shared_memory;
+    hipStream_t   stream;
+    hipEvent_t    start = nullptr;
+
+    // Candidate selected by the innermost active launch_trace_config_scope.
+    unsigned int config_candidate = 0;
+};
+
+inline launch_trace_state& get_launch_trace_state()
+{
+    // Intentionally leaked: the pooled events must not be destroyed after the HIP runtime
+    // has been torn down at program exit.
+    static launch_trace_state* state = new launch_trace_state();
+    return *state;
+}
+
+inline launch_trace_thread_state& get_launch_trace_thread_state()
+{
+    static thread_local launch_trace_thread_state state;
+    return state;
+}
+
+inline hipError_t launch_trace_acquire_event(launch_trace_state& state, hipEvent_t& event)
+{
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if(!state.event_pool.empty())
+        {
+            event = state.event_pool.back();
+            state.event_pool.pop_back();
+            return hipSuccess;
+        }
+    }
+    const hipError_t error = hipEventCreateWithFlags(&event, hipEventDefault);
+    if(error != hipSuccess)
+    {
+        event = nullptr;
+    }
+    return error;
+}
+
+// Must be called with state.mutex held.
+inline void launch_trace_release_event_locked(launch_trace_state& state, const hipEvent_t event)
+{
+    if(event == nullptr)
+    {
+        return;
+    }
+    if(state.event_pool.size() < launch_trace_state::max_pooled_events)
+    {
+        state.event_pool.push_back(event);
+    }
+    else
+    {
+        (void)hipEventDestroy(event);
+    }
+}
+
+inline void launch_trace_release_event(launch_trace_state& state, const hipEvent_t event)
+{
+    std::lock_guard<std::mutex> lock(state.mutex);
+    launch_trace_release_event_locked(state, event);
+}
+
+/// Returns the tracer that applies to the calling thread, or \p false if tracing is off.
+inline bool get_active_launch_tracer(launch_tracer& tracer)
+{
+    const launch_trace_thread_state& thread_state = get_launch_trace_thread_state();
+    if(thread_state.scoped_tracer != nullptr)
+    {
+        tracer = *thread_state.scoped_tracer;
+        return tracer.on_launch != nullptr || tracer.on_timing != nullptr;
+    }
+    launch_trace_state& state = get_launch_trace_state();
+    if(!state.enabled.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(state.mutex);
+    tracer = state.global_tracer;
+    return tracer.on_launch != nullptr || tracer.on_timing != nullptr;
+}
+
+inline hipError_t launch_trace_is_capturing(const hipStream_t stream, bool& capturing)
+{
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    const hipError_t       error          = hipStreamIsCapturing(stream, &capture_status);
+    capturing = capture_status != hipStreamCaptureStatusNone;
+    return error;
+}
+
+/// The tracer must not change the errors reported by the traced algorithms: a failed HIP
+/// call of the tracer would replace the error of earlier work that is still to be reported,
+/// so the tracer only makes HIP calls when no error is pending.
+inline bool launch_trace_error_pending()
+{
+    return hipPeekAtLastError() != hipSuccess;
+}
+
+/// Clears the error left by a failed call of the tracer itself. Only valid when no error
+/// was pending before that call, see launch_trace_error_pending.
+inline void launch_trace_clear_own_error(const bool tracer_failed)
+{
+    if(tracer_failed)
+    {
+        (void)hipGetLastError();
+    }
+}
+
+/// Sets the tuned_config candidate reported for the launches made while it is in scope.
+class launch_trace_config_scope
+{
+public:
+    explicit launch_trace_config_scope(const unsigned int candidate)
+        : previous_(get_launch_trace_thread_state().config_candidate)
+    {
+        get_launch_trace_thread_state().config_candidate = candidate;
+    }
+
+    ~launch_trace_config_scope()
+    {
+        get_launch_trace_thread_state().config_candidate = previous_;
+    }
+
+    launch_trace_config_scope(const launch_trace_config_scope&)            = delete;
+    launch_trace_config_scope& operator=(const launch_trace_config_scope&) = delete;
+
+private:
+    unsigned int previous_;
+};
+
+/// Delivers the timings whose events have completed. When \p wait is \p true, blocks until
+/// all pending timings can be delivered.
+inline hipError_t resolve_launch_timings(const bool wait)
+{
+    launch_trace_state& state = get_launch_trace_state();
+
+    const bool error_pending = launch_trace_error_pending();
+    if(error_pending && !wait)
+    {
+        // Polling reports hipErrorNotReady, deliver the timings at a later point instead.
+        return hipSuccess;
+    }
+
+    std::deque<launch_trace_pending_timing> pending;
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if(state.pending_timings.empty())
+        {
+            return hipSuccess;
+        }
+        pending.swap(state.pending_timings);
+    }
+
+    hipError_t                               result        = hipSuccess;
+    bool                                     tracer_failed = false;
+    std::vector<launch_trace_pending_timing> completed;
+    std::deque<launch_trace_pending_timing>  not_ready;
+    std::vector<float>                       elapsed;
+    for(const launch_trace_pending_timing& timing : pending)
+    {
+        hipError_t error = wait ? hipEventSynchronize(timing.stop) : hipEventQuery(timing.stop);
+        tracer_failed |= error != hipSuccess;
+        if(error == hipErrorNotReady)
+        {
+            not_ready.push_back(timing);
+            continue;
+        }
+        float elapsed_ms = 0.0f;
+        if(error == hipSuccess)
+        {
+            error = hipEventElapsedTime(&elapsed_ms, timing.start, timing.stop);
+            tracer_failed |= error != hipSuccess;
+        }
+        if(error == hipSuccess)
+        {
+            completed.push_back(timing);
+            elapsed.push_back(elapsed_ms);
+        }
+        else
+        {
+            if(result == hipSuccess)
+            {
+                result = error;
+            }
+            launch_trace_release_event(state, timing.start);
+            launch_trace_release_event(state, timing.stop);
+        }
+    }
+    // hipErrorNotReady of polling must not be mistaken for a failure of the next launch.
+    // A pending error of earlier work is left for the user to observe.
+    launch_trace_clear_own_error(tracer_failed && !error_pending);
+
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        // Timings queued by other threads in the meantime are kept after the older ones.
+        for(auto it = not_ready.rbegin(); it != not_ready.rend(); ++it)
+        {
+            state.pending_timings.push_front(*it);
+        }
+        for(const launch_trace_pending_timing& timing : completed)
+        {
+            launch_trace_release_event_locked(state, timing.start);
+            launch_trace_release_event_locked(state, timing.stop);
+        }
+    }
+
+    for(size_t i = 0; i < completed.size(); ++i)
+    {
+        completed[i].tracer.on_timing(completed[i].info, elapsed[i], completed[i].tracer.user_data);
+    }
+    return result;
+}
+
+/// Called right before a kernel is launched. Costs a thread-local read and an atomic load
+/// when no tracer is installed.
+inline void trace_launch_begin(const char*        algorithm,
+                               const dim3         grid_size,
+                               const dim3         block_size,
+                               const unsigned int items_per_thread,
+                               const unsigned int dynamic_shared_memory,
+                               const hipStream_t  stream)
+{
+    launch_trace_thread_state& thread_state = get_launch_trace_thread_state();
+    launch_trace_state&        state        = get_launch_trace_state();
+    if(thread_state.start != nullptr)
+    {
+        // The previous launch failed and was never reported.
+        launch_trace_release_event(state, thread_state.start);
+        thread_state.start = nullptr;
+    }
+    thread_state.launch_pending = false;
+
+    launch_tracer tracer;
+    if(!get_active_launch_tracer(tracer))
+    {
+        return;
+    }
+
+    thread_state.launch_pending        = true;
+    thread_state.tracer                = tracer;
+    thread_state.algorithm             = algorithm;
+    thread_state.grid_size             = grid_size;
+    thread_state.block_size            = block_size;
+    thread_state.items_per_thread      = items_per_thread;
+    thread_state.dynamic_shared_memory = dynamic_shared_memory;
+    thread_state.stream                = stream;
+
+    if(tracer.on_timing == nullptr)
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if(state.pending_timings.size() >= launch_trace_state::max_pending_timings)
+        {
+            return;
+        }
+    }
+    if(launch_trace_error_pending())
+    {
+        // The error of earlier work is reported by the traced launch, timing it could
+        // replace that error.
+        return;
+    }
+    bool       capturing = false;
+    hipError_t error     = launch_trace_is_capturing(stream, capturing);
+    if(error != hipSuccess || capturing)
+    {
+        // Events recorded during capture become graph nodes and cannot be queried.
+        // Errors of the tracer must not be reported as errors of the traced launch.
+        launch_trace_clear_own_error(error != hipSuccess);
+        return;
+    }
+    hipEvent_t start = nullptr;
+    error            = launch_trace_acquire_event(state, start);
+    if(error == hipSuccess)
+    {
+        error = hipEventRecord(start, stream);
+    }
+    if(error == hipSuccess)
+    {
+        thread_state.start = start;
+    }
+    else
+    {
+        launch_trace_release_event(state, start);
+        launch_trace_clear_own_error(true);
+    }
+}
+
+/// Called after the launch started by trace_launch_begin has been checked for errors.
+/// Does nothing if there is no such launch, e.g. when \p debug_synchronous messages are
+/// printed for nested device-level calls.
+inline void trace_launch_end(const char* kernel_name, const size_t size)
+{
+    launch_trace_thread_state& thread_state = get_launch_trace_thread_state();
+    if(!thread_state.launch_pending)
+    {
+        return;
+    }
+    thread_state.launch_pending = false;
+
+    const kernel_launch_info info{thread_state.algorithm,
+                                  kernel_name,
+                                  thread_state.grid_size,
+                                  thread_state.block_size,
+                                  thread_state.items_per_thread,
+                                  thread_state.dynamic_shared_memory,
+                                  thread_state.config_candidate,
+                                  size,
+                                  thread_state.stream};
+    const launch_tracer tracer = thread_state.tracer;
+    const hipEvent_t    start  = thread_state.start;
+    thread_state.start         = nullptr;
+
+    if(start != nullptr)
+    {
+        launch_trace_state& state = get_launch_trace_state();
+        // The timing is dropped rather than replacing a pending error of earlier work.
+        const bool error_pending = launch_trace_error_pending();
+        hipEvent_t stop          = nullptr;
+        hipError_t error         = hipSuccess;
+        if(!error_pending)
+        {
+            error = launch_trace_acquire_event(state, stop);
+            if(error == hipSuccess)
+            {
+                error = hipEventRecord(stop, info.stream);
+            }
+        }
+        if(!error_pending && error == hipSuccess)
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.pending_timings.push_back({info, tracer, start, stop});
+        }
+        else
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            launch_trace_release_event_locked(state, start);
+            launch_trace_release_event_locked(state, stop);
+        }
+        launch_trace_clear_own_error(error != hipSuccess);
+    }
+
+    if(tracer.on_launch != nullptr)
+    {
+        tracer.on_launch(info, tracer.user_data);
+    }
+    (void)resolve_launch_timings(false);
+}
+
+} // end namespace detail
+
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// \brief Installs \p tracer as the process-wide launch tracer.
+///
+/// The tracer observes all kernels launched by device-level algorithms from any host
+/// thread, unless a scoped_launch_tracer is active on that thread. Passing a tracer
+/// without callbacks disables tracing.
+///
+/// \param [in] tracer - callbacks to install.
+inline void set_launch_tracer(const launch_tracer& tracer)
+{
+    detail::launch_trace_state& state = detail::get_launch_trace_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.global_tracer = tracer;
+    state.enabled.store(tracer.on_launch != nullptr || tracer.on_timing != nullptr,
+                        std::memory_order_release);
+}
+
+/// \brief Returns the process-wide launch tracer.
+inline launch_tracer get_launch_tracer()
+{
+    detail::launch_trace_state& state = detail::get_launch_trace_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.global_tracer;
+}
+
+/// \brief Delivers the pending kernel timings to their launch_tracer::on_timing callbacks.
+///
+/// Timings are otherwise only delivered opportunistically, during later launches, so this
+/// should be called before the results are consumed, e.g. at the end of a benchmark.
+///
+/// \param [in] wait - if \p true, blocks until every pending timing is available.
+/// Otherwise only the timings of kernels that have already finished are delivered.
+///
+/// \return \p hipSuccess, or the first error returned while querying the events.
+inline hipError_t flush_launch_timings(const bool wait = true)
+{
+    return detail::resolve_launch_timings(wait);
+}
+
+/// \brief Overrides the launch tracer for the calling thread while it is in scope.
+///
+/// This can be used to trace a single call of a device-level algorithm, independently
+/// of the process-wide tracer:
+///
+/// \code{.cpp}
+/// {
+///     rocprim::scoped_launch_tracer trace({on_launch, on_timing, &log});
+///     rocprim::reduce(temp_storage, storage_size, input, output, size);
+/// }
+/// rocprim::flush_launch_timings();
+/// \endcode
+///
+/// A tracer without callbacks disables tracing on the calling thread. Scopes can be
+/// nested, the innermost one is used.
+class scoped_launch_tracer
+{
+public:
+    /// \brief Installs \p tracer for the calling thread.
+    explicit scoped_launch_tracer(const launch_tracer& tracer)
+        : tracer_(tracer)
+        , previous_(detail::get_launch_trace_thread_state().scoped_tracer)
+    {
+        detail::get_launch_trace_thread_state().scoped_tracer = &tracer_;
+    }
+
+    /// \brief Restores the tracer that was active before construction.
+    ~scoped_launch_tracer()
+    {
+        detail::get_launch_trace_thread_state().scoped_tracer = previous_;
+    }
+
+    scoped_launch_tracer(const scoped_launch_tracer&)            = delete;
+    scoped_launch_tracer& operator=(const scoped_launch_tracer&) = delete;
+
+private:
+    launch_tracer        tracer_;
+    const launch_tracer* previous_;
+};
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_LAUNCH_TRACE_HPP_
@@ -29,6 +29,7 @@
 #include "../detail/temp_storage.hpp"
 #include "../detail/various.hpp"
 
+#include "device_launch_trace.hpp"
 #include "device_merge_config.hpp"
 #include "detail/device_merge.hpp"
 
@@ -98,6 +99,7 @@ void merge_kernel(IndexIterator index,
     { \
         auto _error = hipGetLastError(); \
         if(_error != hipSuccess) return _error; \
+        ::rocprim::detail::trace_launch_end(name, size); \
         if(debug_synchronous) \
         { \
             std::cout << name << "(" << size << ")"; \
@@ -180,6 +182,7 @@ hipError_t merge_impl(void * temporary_storage,
     const unsigned partition_blocks = ((partitions + 1) + half_block - 1) / half_block;
 
     if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    detail::trace_launch_begin("merge", dim3(partition_blocks), dim3(half_block), 0, 0, stream);
     hipLaunchKernelGGL(
         HIP_KERNEL_NAME(detail::partition_kernel),
         dim3(partition_blocks), dim3(half_block), 0, stream,
@@ -189,6 +192,12 @@ hipError_t merge_impl(void * temporary_storage,
     ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("partition_kernel", input1_size, start);
 
     if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    detail::trace_launch_begin("merge",
+                               dim3(number_of_blocks),
+                               dim3(block_size),
+                               items_per_thread,
+                               0,
+                               stream);
     hipLaunchKernelGGL(
         HIP_KERNEL_NAME(detail::merge_kernel<block_size, items_per_thread>),
         dim3(number_of_blocks), dim3(block_size), 0, stream,
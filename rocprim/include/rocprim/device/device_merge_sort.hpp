@@ -32,6 +32,7 @@
 #include "detail/device_merge.hpp"
 #include "detail/device_merge_sort.hpp"
 #include "detail/device_merge_sort_mergepath.hpp"
+#include "device_launch_trace.hpp"
 #include "device_merge_sort_config.hpp"
 #include "device_transform.hpp"
 
@@ -57,9 +58,21 @@ ROCPRIM_KERNEL
         ValuesInputIterator  values_input,
         ValuesOutputIterator values_output,
         const OffsetT        sorted_block_size,
-        BinaryFunction       compare_function)
+        BinaryFunction       compare_function,
+        const unsigned char* sorted_tiles)
 {
     static constexpr merge_sort_block_sort_config_params params = device_params<Config>();
+    if(sorted_tiles != nullptr && sorted_tiles[::rocprim::detail::block_id<0>()])
+    {
+        // The tile is already in order, sorting it would not move anything
+        block_copy_kernel_impl<params.block_sort_config.block_size,
+                               params.block_sort_config.items_per_thread>(keys_input,
+                                                                          keys_output,
+                                                                          values_input,
+                                                                          values_output,
+                                                                          sorted_block_size);
+        return;
+    }
     block_sort_kernel_impl<params.block_sort_config.block_size,
                            params.block_sort_config.items_per_thread>(keys_input,
                                                                       keys_output,
@@ -85,9 +98,18 @@ ROCPRIM_KERNEL __launch_bounds__(
                                                             ValuesOutputIterator values_output,
                                                             const OffsetT        input_size,
                                                             const OffsetT        sorted_block_size,
-                                                            BinaryFunction       compare_function)
+                                                            BinaryFunction       compare_function,
+                                                            const unsigned char* ordered_pairs)
 {
     static constexpr merge_sort_block_merge_config_params params = device_params<Config>();
+    static constexpr unsigned int                         items_per_block
+        = params.merge_oddeven_config.block_size * params.merge_oddeven_config.items_per_thread;
+    if(ordered_pairs != nullptr
+       && ordered_pairs[static_cast<OffsetT>(::rocprim::detail::block_id<0>()) * items_per_block
+                        / (2 * sorted_block_size)])
+    {
+        return;
+    }
     block_merge_oddeven_kernel<params.merge_oddeven_config.block_size,
                                params.merge_oddeven_config.items_per_thread>(keys_input,
                                                                              keys_output,
@@ -115,9 +137,18 @@ ROCPRIM_KERNEL __launch_bounds__(
                                                               const OffsetT        input_size,
                                                               const OffsetT  sorted_block_size,
                                                               BinaryFunction compare_function,
-                                                              const OffsetT* merge_partitions)
+                                                              const OffsetT* merge_partitions,
+                                                              const unsigned char* ordered_pairs)
 {
     static constexpr merge_sort_block_merge_config_params params = device_params<Config>();
+    static constexpr unsigned int                         items_per_block
+        = params.merge_mergepath_config.block_size * params.merge_mergepath_config.items_per_thread;
+    if(ordered_pairs != nullptr
+       && ordered_pairs[static_cast<OffsetT>(::rocprim::detail::block_id<0>()) * items_per_block
+                        / (2 * sorted_block_size)])
+    {
+        return;
+    }
     block_merge_mergepath_kernel<params.merge_mergepath_config.block_size,
                                  params.merge_mergepath_config.items_per_thread>(keys_input,
                                                                                  keys_output,
@@ -144,6 +175,7 @@ ROCPRIM_KERNEL __launch_bounds__(
     { \
         auto _error = hipGetLastError(); \
         if(_error != hipSuccess) return _error; \
+        ::rocprim::detail::trace_launch_end(name, size); \
         if(debug_synchronous) \
         { \
             std::cout << name << "(" << size << ")"; \
@@ -204,6 +236,79 @@ ROCPRIM_KERNEL __launch_bounds__(
     merge_partitions[partition_id] = keys1_beg + partition_diag;
 }
 
+template<class Config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class OffsetT>
+ROCPRIM_KERNEL __launch_bounds__(
+    device_params<Config>()
+        .merge_mergepath_config
+        .block_size) void device_block_copy_unordered_kernel(KeysInputIterator    keys_input,
+                                                             KeysOutputIterator   keys_output,
+                                                             ValuesInputIterator  values_input,
+                                                             ValuesOutputIterator values_output,
+                                                             const OffsetT        input_size,
+                                                             const OffsetT        sorted_block_size,
+                                                             const unsigned char* ordered_pairs)
+{
+    static constexpr merge_sort_block_merge_config_params params = device_params<Config>();
+    static constexpr unsigned int                         items_per_block
+        = params.merge_mergepath_config.block_size * params.merge_mergepath_config.items_per_thread;
+    if(ordered_pairs[static_cast<OffsetT>(::rocprim::detail::block_id<0>()) * items_per_block
+                     / (2 * sorted_block_size)])
+    {
+        return;
+    }
+    block_copy_kernel_impl<params.merge_mergepath_config.block_size,
+                           params.merge_mergepath_config.items_per_thread>(keys_input,
+                                                                           keys_output,
+                                                                           values_input,
+                                                                           values_output,
+                                                                           input_size);
+}
+
+template<class Config, class KeysInputIterator, class OffsetT, class BinaryFunction>
+ROCPRIM_KERNEL __launch_bounds__(
+    device_params<Config>()
+        .block_sort_config
+        .block_size) void device_find_sorted_tiles_kernel(KeysInputIterator   keys_input,
+                                                          const OffsetT       input_size,
+                                                          BinaryFunction      compare_function,
+                                                          unsigned char*      sorted_tiles,
+                                                          unsigned long long* unsorted_count)
+{
+    static constexpr merge_sort_block_sort_config_params params = device_params<Config>();
+    block_find_sorted_tiles_impl<params.block_sort_config.block_size,
+                                 params.block_sort_config.items_per_thread>(keys_input,
+                                                                            input_size,
+                                                                            compare_function,
+                                                                            sorted_tiles,
+                                                                            unsorted_count);
+}
+
+constexpr unsigned int merge_sort_find_ordered_pairs_block_size = 256;
+
+template<unsigned int BlockSize, class KeysInputIterator, class OffsetT, class BinaryFunction>
+ROCPRIM_KERNEL __launch_bounds__(BlockSize) void device_find_ordered_pairs_kernel(
+    KeysInputIterator   keys_input,
+    const OffsetT       input_size,
+    const OffsetT       sorted_block_size,
+    const unsigned int  num_pairs,
+    BinaryFunction      compare_function,
+    unsigned char*      ordered_pairs,
+    unsigned long long* unordered_items)
+{
+    find_ordered_pairs_impl<BlockSize>(keys_input,
+                                       input_size,
+                                       sorted_block_size,
+                                       num_pairs,
+                                       compare_function,
+                                       ordered_pairs,
+                                       unordered_items);
+}
+
 template<class Config,
          class KeysIterator,
          class ValuesIterator,
@@ -220,7 +325,9 @@ inline hipError_t merge_sort_block_merge(
     const hipStream_t                                          stream,
     bool                                                       debug_synchronous,
     typename std::iterator_traits<KeysIterator>::value_type*   keys_double_buffer   = nullptr,
-    typename std::iterator_traits<ValuesIterator>::value_type* values_double_buffer = nullptr)
+    typename std::iterator_traits<ValuesIterator>::value_type* values_double_buffer = nullptr,
+    unsigned char*                                             ordered_pairs        = nullptr,
+    unsigned long long*                                        unordered_items      = nullptr)
 {
     using key_type             = typename std::iterator_traits<KeysIterator>::value_type;
     using value_type           = typename std::iterator_traits<ValuesIterator>::value_type;
@@ -324,10 +431,78 @@ inline hipError_t merge_sort_block_merge(
     // Start point for time measurements
     std::chrono::high_resolution_clock::time_point start;
 
+    // The natural merge sort skips the pairs of sorted blocks which are already in order
+    const bool natural = ordered_pairs != nullptr;
+
     bool temporary_store = true;
     for(OffsetT block = sorted_block_size; block < size; block *= 2)
     {
-        temporary_store = !temporary_store;
+        const unsigned char* skipped_pairs = nullptr;
+        if(natural)
+        {
+            const unsigned int num_pairs = ceiling_div(size, 2 * block);
+
+            hipError_t error = hipMemsetAsync(unordered_items, 0, sizeof(*unordered_items), stream);
+            if(error != hipSuccess) return error;
+
+            const auto find_ordered_pairs = [&](auto keys_input_) -> hipError_t
+            {
+                if(debug_synchronous)
+                    start = std::chrono::high_resolution_clock::now();
+                detail::trace_launch_begin("merge_sort",
+                                           dim3(ceiling_div(num_pairs, merge_sort_find_ordered_pairs_block_size)),
+                                           dim3(merge_sort_find_ordered_pairs_block_size),
+                                           0,
+                                           0,
+                                           stream);
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(
+                        device_find_ordered_pairs_kernel<merge_sort_find_ordered_pairs_block_size>),
+                    dim3(ceiling_div(num_pairs, merge_sort_find_ordered_pairs_block_size)),
+                    dim3(merge_sort_find_ordered_pairs_block_size),
+                    0,
+                    stream,
+                    keys_input_,
+                    size,
+                    block,
+                    num_pairs,
+                    compare_function,
+                    ordered_pairs,
+                    unordered_items);
+                ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("device_find_ordered_pairs_kernel",
+                                                            num_pairs,
+                                                            start);
+                return hipSuccess;
+            };
+            error = temporary_store ? find_ordered_pairs(keys) : find_ordered_pairs(keys_buffer);
+            if(error != hipSuccess) return error;
+
+            unsigned long long round_unordered_items;
+            error = detail::memcpy_and_sync(&round_unordered_items,
+                                            unordered_items,
+                                            sizeof(round_unordered_items),
+                                            hipMemcpyDeviceToHost,
+                                            stream);
+            if(error != hipSuccess) return error;
+
+            if(round_unordered_items == 0)
+            {
+                // Every pair is in order, the round would not move anything
+                continue;
+            }
+            // Merging only the unordered pairs moves their items twice, as they are copied
+            // back afterwards. Unless that is less than moving all items, merge everything.
+            if(2 * round_unordered_items < static_cast<unsigned long long>(size))
+            {
+                skipped_pairs = ordered_pairs;
+            }
+        }
+
+        // When pairs are skipped, the result is copied back, so the data stays where it is
+        if(skipped_pairs == nullptr)
+        {
+            temporary_store = !temporary_store;
+        }
 
         const auto merge_step = [&](auto keys_input_,
                                     auto keys_output_,
@@ -338,6 +513,12 @@ inline hipError_t merge_sort_block_merge(
             {
                 if(debug_synchronous)
                     start = std::chrono::high_resolution_clock::now();
+                detail::trace_launch_begin("merge_sort",
+                                           dim3(merge_partition_number_of_blocks),
+                                           dim3(merge_partition_block_size),
+                                           0,
+                                           0,
+                                           stream);
                 hipLaunchKernelGGL(
                     HIP_KERNEL_NAME(device_block_merge_mergepath_partition_kernel<config>),
                     dim3(merge_partition_number_of_blocks),
@@ -357,6 +538,12 @@ inline hipError_t merge_sort_block_merge(
 
                 if(debug_synchronous)
                     start = std::chrono::high_resolution_clock::now();
+                detail::trace_launch_begin("merge_sort",
+                                           dim3(merge_mergepath_number_of_blocks),
+                                           dim3(merge_mergepath_block_size),
+                                           merge_mergepath_items_per_thread,
+                                           0,
+                                           stream);
                 hipLaunchKernelGGL(HIP_KERNEL_NAME(device_block_merge_mergepath_kernel<config>),
                                    dim3(merge_mergepath_number_of_blocks),
                                    dim3(merge_mergepath_block_size),
@@ -369,7 +556,8 @@ inline hipError_t merge_sort_block_merge(
                                    size,
                                    block,
                                    compare_function,
-                                   d_merge_partitions);
+                                   d_merge_partitions,
+                                   skipped_pairs);
                 ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("device_block_merge_mergepath_kernel",
                                                             size,
                                                             start);
@@ -378,6 +566,12 @@ inline hipError_t merge_sort_block_merge(
             {
                 if(debug_synchronous)
                     start = std::chrono::high_resolution_clock::now();
+                detail::trace_launch_begin("merge_sort",
+                                           dim3(merge_oddeven_number_of_blocks),
+                                           dim3(merge_oddeven_block_size),
+                                           merge_oddeven_items_per_thread,
+                                           0,
+                                           stream);
                 hipLaunchKernelGGL(HIP_KERNEL_NAME(device_block_merge_oddeven_kernel<config>),
                                    dim3(merge_oddeven_number_of_blocks),
                                    dim3(merge_oddeven_block_size),
@@ -389,7 +583,8 @@ inline hipError_t merge_sort_block_merge(
                                    values_output_,
                                    size,
                                    block,
-                                   compare_function);
+                                   compare_function,
+                                   skipped_pairs);
                 ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("device_block_merge_oddeven_kernel",
                                                             size,
                                                             start)
@@ -397,8 +592,54 @@ inline hipError_t merge_sort_block_merge(
             return hipSuccess;
         };
 
+        const auto copy_step = [&](auto keys_input_,
+                                   auto keys_output_,
+                                   auto values_input_,
+                                   auto values_output_) -> hipError_t
+        {
+            if(debug_synchronous)
+                start = std::chrono::high_resolution_clock::now();
+            detail::trace_launch_begin("merge_sort",
+                                       dim3(merge_mergepath_number_of_blocks),
+                                       dim3(merge_mergepath_block_size),
+                                       merge_mergepath_items_per_thread,
+                                       0,
+                                       stream);
+            hipLaunchKernelGGL(HIP_KERNEL_NAME(device_block_copy_unordered_kernel<config>),
+                               dim3(merge_mergepath_number_of_blocks),
+                               dim3(merge_mergepath_block_size),
+                               0,
+                               stream,
+                               keys_input_,
+                               keys_output_,
+                               values_input_,
+                               values_output_,
+                               size,
+                               block,
+                               skipped_pairs);
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("device_block_copy_unordered_kernel",
+                                                        size,
+                                                        start);
+            return hipSuccess;
+        };
+
         hipError_t error;
-        if(temporary_store)
+        if(skipped_pairs != nullptr)
+        {
+            if(temporary_store)
+            {
+                error = merge_step(keys, keys_buffer, values, values_buffer);
+                if(error != hipSuccess) return error;
+                error = copy_step(keys_buffer, keys, values_buffer, values);
+            }
+            else
+            {
+                error = merge_step(keys_buffer, keys, values_buffer, values);
+                if(error != hipSuccess) return error;
+                error = copy_step(keys, keys_buffer, values, values_buffer);
+            }
+        }
+        else if(temporary_store)
         {
             error = merge_step(keys_buffer, keys, values_buffer, values);
         }
@@ -448,7 +689,8 @@ inline hipError_t merge_sort_block_sort(KeysInputIterator    keys_input,
                                         unsigned int&        sort_items_per_block,
                                         BinaryFunction       compare_function,
                                         const hipStream_t    stream,
-                                        bool                 debug_synchronous)
+                                        bool                 debug_synchronous,
+                                        const unsigned char* sorted_tiles = nullptr)
 {
     using key_type   = typename std::iterator_traits<KeysInputIterator>::value_type;
     using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
@@ -482,6 +724,12 @@ inline hipError_t merge_sort_block_sort(KeysInputIterator    keys_input,
     if(debug_synchronous)
         start = std::chrono::high_resolution_clock::now();
 
+    detail::trace_launch_begin("merge_sort",
+                               dim3(sort_number_of_blocks),
+                               dim3(params.block_sort_config.block_size),
+                               params.block_sort_config.items_per_thread,
+                               0,
+                               stream);
     hipLaunchKernelGGL(HIP_KERNEL_NAME(block_sort_kernel<config>),
                        dim3(sort_number_of_blocks),
                        dim3(params.block_sort_config.block_size),
@@ -492,7 +740,8 @@ inline hipError_t merge_sort_block_sort(KeysInputIterator    keys_input,
                        values_input,
                        values_output,
                        size,
-                       compare_function);
+                       compare_function,
+                       sorted_tiles);
     ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("block_sort_kernel", size, start);
 
     return hipSuccess;
@@ -629,6 +878,191 @@ inline hipError_t merge_sort_impl(
     return hipSuccess;
 }
 
+template<class Config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class BinaryFunction>
+inline hipError_t natural_merge_sort_impl(void*                temporary_storage,
+                                          size_t&              storage_size,
+                                          KeysInputIterator    keys_input,
+                                          KeysOutputIterator   keys_output,
+                                          ValuesInputIterator  values_input,
+                                          ValuesOutputIterator values_output,
+                                          const unsigned int   size,
+                                          BinaryFunction       compare_function,
+                                          const hipStream_t    stream,
+                                          bool                 debug_synchronous)
+{
+    using key_type             = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type           = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    static constexpr bool with_custom_config = !std::is_same<Config, default_config>::value;
+
+    using block_sort_config = typename std::
+        conditional<with_custom_config, typename Config::block_sort_config, default_config>::type;
+    using block_merge_config = typename std::
+        conditional<with_custom_config, typename Config::block_merge_config, default_config>::type;
+    using wrapped_bs_config
+        = wrapped_merge_sort_block_sort_config<block_sort_config, key_type, value_type>;
+    using wrapped_bm_config
+        = wrapped_merge_sort_block_merge_config<block_merge_config, key_type, value_type>;
+
+    (void)device_merge_sort_compile_time_verifier<
+        wrapped_bs_config,
+        wrapped_bm_config>; // Some helpful checks during compile-time
+
+    detail::target_arch target_arch;
+    hipError_t          result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const merge_sort_block_sort_config_params params
+        = dispatch_target_arch<wrapped_bs_config>(target_arch);
+
+    unsigned int sort_items_per_block
+        = params.block_sort_config.block_size * params.block_sort_config.items_per_thread;
+    const unsigned int number_of_tiles = ceiling_div(size, sort_items_per_block);
+
+    size_t merge_storage_size = 0;
+    result = merge_sort_block_merge<block_merge_config>(nullptr,
+                                                        merge_storage_size,
+                                                        keys_output,
+                                                        values_output,
+                                                        size,
+                                                        sort_items_per_block,
+                                                        compare_function,
+                                                        stream,
+                                                        debug_synchronous);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    // The flags of the sorted tiles are reused for the ordered pairs of the merge rounds
+    unsigned char*      sorted_tiles   = nullptr;
+    unsigned long long* unsorted_count = nullptr;
+    void*               merge_storage  = nullptr;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&sorted_tiles, number_of_tiles),
+            detail::temp_storage::ptr_aligned_array(&unsorted_count, 1),
+            detail::temp_storage::make_partition(&merge_storage, merge_storage_size)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(size == 0u)
+    {
+        return hipSuccess;
+    }
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+
+    result = hipMemsetAsync(unsorted_count, 0, sizeof(*unsorted_count), stream);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    if(debug_synchronous)
+        start = std::chrono::high_resolution_clock::now();
+    detail::trace_launch_begin("merge_sort",
+                               dim3(number_of_tiles),
+                               dim3(params.block_sort_config.block_size),
+                               params.block_sort_config.items_per_thread,
+                               0,
+                               stream);
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(device_find_sorted_tiles_kernel<wrapped_bs_config>),
+                       dim3(number_of_tiles),
+                       dim3(params.block_sort_config.block_size),
+                       0,
+                       stream,
+                       keys_input,
+                       size,
+                       compare_function,
+                       sorted_tiles,
+                       unsorted_count);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("device_find_sorted_tiles_kernel", size, start);
+
+    unsigned long long unsorted_tiles;
+    result = detail::memcpy_and_sync(&unsorted_tiles,
+                                     unsorted_count,
+                                     sizeof(unsorted_tiles),
+                                     hipMemcpyDeviceToHost,
+                                     stream);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    if(unsorted_tiles == 0)
+    {
+        // The input is already sorted
+        result = ::rocprim::transform(keys_input,
+                                      keys_output,
+                                      size,
+                                      ::rocprim::identity<key_type>(),
+                                      stream,
+                                      debug_synchronous);
+        if(result != hipSuccess)
+        {
+            return result;
+        }
+        if(with_values)
+        {
+            result = ::rocprim::transform(values_input,
+                                          values_output,
+                                          size,
+                                          ::rocprim::identity<value_type>(),
+                                          stream,
+                                          debug_synchronous);
+        }
+        return result;
+    }
+
+    result = merge_sort_block_sort<block_sort_config>(keys_input,
+                                                      keys_output,
+                                                      values_input,
+                                                      values_output,
+                                                      size,
+                                                      sort_items_per_block,
+                                                      compare_function,
+                                                      stream,
+                                                      debug_synchronous,
+                                                      sorted_tiles);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    if(size > sort_items_per_block)
+    {
+        return merge_sort_block_merge<block_merge_config>(merge_storage,
+                                                          merge_storage_size,
+                                                          keys_output,
+                                                          values_output,
+                                                          size,
+                                                          sort_items_per_block,
+                                                          compare_function,
+                                                          stream,
+                                                          debug_synchronous,
+                                                          nullptr,
+                                                          nullptr,
+                                                          sorted_tiles,
+                                                          unsorted_count);
+    }
+    return hipSuccess;
+}
+
 #undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
 #undef ROCPRIM_DETAIL_HIP_SYNC
 
@@ -832,6 +1266,182 @@ hipError_t merge_sort(void * temporary_storage,
     );
 }
 
+/// \brief Parallel natural merge sort primitive for device level.
+///
+/// \p natural_merge_sort function performs a device-wide merge sort of keys, like
+/// \p merge_sort, but it takes advantage of parts of the input that are already in order.
+/// It is intended for nearly-sorted inputs, such as time series where only short windows
+/// arrive out of order.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Accepts custom compare_functions for sorting across the device.
+/// * The sort is stable, and produces the same result as \p merge_sort.
+/// * The input is first checked for runs of sorted keys. If the input is already sorted, it is
+/// copied to the output. Otherwise, the tiles that are already sorted are not block sorted, and
+/// merge rounds only merge the pairs of sorted blocks that are not yet in order.
+/// * The checks synchronize \p stream once, and once more for every merge round. This adds
+/// latency compared to \p merge_sort for inputs that are not nearly sorted.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `merge_sort_config`.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] compare_function - binary operation function object that will be used for comparison.
+/// The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level natural merge sort is performed on a nearly sorted array of
+/// \p int values.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;      // e.g., 8
+/// int * input;            // e.g., [1, 2, 4, 3, 5, 6, 7, 8]
+/// int * output;           // empty array of 8 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::natural_merge_sort(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform sort
+/// rocprim::natural_merge_sort(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size
+/// );
+/// // keys_output: [1, 2, 3, 4, 5, 6, 7, 8]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class BinaryFunction = ::rocprim::less<typename std::iterator_traits<KeysInputIterator>::value_type>
+>
+inline
+hipError_t natural_merge_sort(void * temporary_storage,
+                              size_t& storage_size,
+                              KeysInputIterator keys_input,
+                              KeysOutputIterator keys_output,
+                              const size_t size,
+                              BinaryFunction compare_function = BinaryFunction(),
+                              const hipStream_t stream = 0,
+                              bool debug_synchronous = false)
+{
+    empty_type * values = nullptr;
+    return detail::natural_merge_sort_impl<Config>(
+        temporary_storage, storage_size,
+        keys_input, keys_output, values, values, size,
+        compare_function, stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel natural merge sort-by-key primitive for device level.
+///
+/// \p natural_merge_sort function performs a device-wide merge sort of (key, value) pairs,
+/// like \p merge_sort, but it takes advantage of parts of the input that are already in order.
+/// It is intended for nearly-sorted inputs, such as time series where only short windows
+/// arrive out of order.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Accepts custom compare_functions for sorting across the device.
+/// * The sort is stable, and produces the same result as \p merge_sort.
+/// * The input is first checked for runs of sorted keys. If the input is already sorted, it is
+/// copied to the output. Otherwise, the tiles that are already sorted are not block sorted, and
+/// merge rounds only merge the pairs of sorted blocks that are not yet in order.
+/// * The checks synchronize \p stream once, and once more for every merge round. This adds
+/// latency compared to \p merge_sort for inputs that are not nearly sorted.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `merge_sort_config`.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] values_input - pointer to the first element in the range to sort.
+/// \param [out] values_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] compare_function - binary operation function object that will be used for comparison.
+/// The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class BinaryFunction = ::rocprim::less<typename std::iterator_traits<KeysInputIterator>::value_type>
+>
+inline
+hipError_t natural_merge_sort(void * temporary_storage,
+                              size_t& storage_size,
+                              KeysInputIterator keys_input,
+                              KeysOutputIterator keys_output,
+                              ValuesInputIterator values_input,
+                              ValuesOutputIterator values_output,
+                              const size_t size,
+                              BinaryFunction compare_function = BinaryFunction(),
+                              const hipStream_t stream = 0,
+                              bool debug_synchronous = false)
+{
+    return detail::natural_merge_sort_impl<Config>(
+        temporary_storage, storage_size,
+        keys_input, keys_output, values_input, values_output, size,
+        compare_function, stream, debug_synchronous
+    );
+}
+
 /// @}
 // end of group devicemodule
 
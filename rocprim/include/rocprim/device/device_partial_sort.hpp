@@ -83,12 +83,20 @@ hipError_t partial_sort_impl(void*              temporary_storage,
         return hipErrorInvalidValue;
     }
 
+    detail::target_arch target_arch;
+    RETURN_ON_ERROR(host_target_arch(stream, target_arch));
+    const partial_sort_thresholds_params thresholds
+        = dispatch_target_arch<wrapped_partial_sort_thresholds<Config, key_type>>(target_arch);
+
     size_t storage_size_nth_element{};
     // non-null placeholder so that no buffer is allocated for keys
     key_type* keys_buffer_placeholder = reinterpret_cast<key_type*>(1);
 
+    // Small inputs are sorted completely, which is faster than selecting the sorted range with
+    // nth element first.
     const bool full_sort = middle + 1 == size;
-    if(!full_sort)
+    const bool sort_all  = full_sort || size <= thresholds.sort_limit;
+    if(!sort_all)
     {
         RETURN_ON_ERROR(nth_element_impl<config_nth_element>(nullptr,
                                                              storage_size_nth_element,
@@ -109,7 +117,7 @@ hipError_t partial_sort_impl(void*              temporary_storage,
                                            keys_out,
                                            static_cast<empty_type*>(nullptr), // values_input
                                            static_cast<empty_type*>(nullptr), // values_output
-                                           (!inplace || full_sort) ? middle + 1 : middle,
+                                           sort_all ? size : inplace ? middle : middle + 1,
                                            compare_function,
                                            stream,
                                            debug_synchronous,
@@ -140,7 +148,60 @@ hipError_t partial_sort_impl(void*              temporary_storage,
         return hipSuccess;
     }
 
-    if(!inplace)
+    if(sort_all)
+    {
+        if(inplace)
+        {
+            return merge_sort_impl<config_merge_sort>(
+                temporary_storage_merge_sort,
+                storage_size_merge_sort,
+                keys_in,
+                keys_out,
+                static_cast<empty_type*>(nullptr), // values_input
+                static_cast<empty_type*>(nullptr), // values_output
+                size,
+                compare_function,
+                stream,
+                debug_synchronous,
+                keys_buffer, // keys_buffer
+                static_cast<empty_type*>(nullptr)); // values_buffer
+        }
+
+        // The output only has room for the first middle + 1 keys
+        RETURN_ON_ERROR(merge_sort_impl<config_merge_sort>(
+            temporary_storage_merge_sort,
+            storage_size_merge_sort,
+            keys_in,
+            keys_output_nth_element,
+            static_cast<empty_type*>(nullptr), // values_input
+            static_cast<empty_type*>(nullptr), // values_output
+            size,
+            compare_function,
+            stream,
+            debug_synchronous,
+            keys_buffer, // keys_buffer
+            static_cast<empty_type*>(nullptr))); // values_buffer
+        return transform(keys_output_nth_element,
+                         keys_out,
+                         middle + 1,
+                         rocprim::identity<key_type>(),
+                         stream,
+                         debug_synchronous);
+    }
+
+    if(inplace)
+    {
+        RETURN_ON_ERROR(nth_element_impl<config_nth_element>(temporary_storage_nth_element,
+                                                             storage_size_nth_element,
+                                                             keys_in,
+                                                             middle,
+                                                             size,
+                                                             compare_function,
+                                                             stream,
+                                                             debug_synchronous,
+                                                             keys_buffer));
+    }
+    else
     {
         RETURN_ON_ERROR(transform(keys_in,
                                   keys_output_nth_element,
@@ -148,34 +209,15 @@ hipError_t partial_sort_impl(void*              temporary_storage,
                                   rocprim::identity<key_type>(),
                                   stream,
                                   debug_synchronous));
-    }
-
-    if(!full_sort)
-    {
-        if(inplace)
-        {
-            RETURN_ON_ERROR(nth_element_impl<config_nth_element>(temporary_storage_nth_element,
-                                                                 storage_size_nth_element,
-                                                                 keys_in,
-                                                                 middle,
-                                                                 size,
-                                                                 compare_function,
-                                                                 stream,
-                                                                 debug_synchronous,
-                                                                 keys_buffer));
-        }
-        else
-        {
-            RETURN_ON_ERROR(nth_element_impl<config_nth_element>(temporary_storage_nth_element,
-                                                                 storage_size_nth_element,
-                                                                 keys_output_nth_element,
-                                                                 middle,
-                                                                 size,
-                                                                 compare_function,
-                                                                 stream,
-                                                                 debug_synchronous,
-                                                                 keys_buffer));
-        }
+        RETURN_ON_ERROR(nth_element_impl<config_nth_element>(temporary_storage_nth_element,
+                                                             storage_size_nth_element,
+                                                             keys_output_nth_element,
+                                                             middle,
+                                                             size,
+                                                             compare_function,
+                                                             stream,
+                                                             debug_synchronous,
+                                                             keys_buffer));
     }
 
     if(middle == 0)
@@ -201,7 +243,7 @@ hipError_t partial_sort_impl(void*              temporary_storage,
             keys_out,
             static_cast<empty_type*>(nullptr), // values_input
             static_cast<empty_type*>(nullptr), // values_output
-            full_sort ? middle + 1 : middle,
+            middle,
             compare_function,
             stream,
             debug_synchronous,
@@ -22,6 +22,7 @@
 #define ROCPRIM_DEVICE_DEVICE_PARTIAL_SORT_CONFIG_HPP_
 
 #include "config_types.hpp"
+#include "detail/config/device_partial_sort_thresholds.hpp"
 
 #include "device_nth_element_config.hpp"
 
@@ -36,13 +37,17 @@ BEGIN_ROCPRIM_NAMESPACE
 /// Must be \p nth_element_config or \p default_config.
 /// \tparam MergeSortConfig - configuration of device-level merge sort operation.
 /// Must be \p merge_sort_config or \p default_config.
-template<class NthElementConfig, class MergeSortConfig = default_config>
+/// \tparam SortLimit - the largest number of items for which the whole input is sorted by merge
+/// sort, instead of selecting the sorted range with nth element first.
+template<class NthElementConfig, class MergeSortConfig = default_config, size_t SortLimit = 0>
 struct partial_sort_config
 {
     /// \brief Configuration of device-level nth element operation.
     using nth_element = NthElementConfig;
     /// \brief Configuration of device-level merge sort operation.
     using merge_sort = MergeSortConfig;
+    /// \brief Maximum number of items to sort the whole input.
+    static constexpr size_t sort_limit = SortLimit;
 };
 
 namespace detail
@@ -51,6 +56,40 @@ namespace detail
 template<typename Type>
 using default_partial_sort_config = partial_sort_config<default_config, default_config>;
 
+template<typename PartialSortConfig, typename>
+struct wrapped_partial_sort_thresholds
+{
+    template<target_arch Arch>
+    struct architecture_config
+    {
+        static constexpr partial_sort_thresholds_params params
+            = partial_sort_thresholds<PartialSortConfig::sort_limit>();
+    };
+};
+
+template<typename Key>
+struct wrapped_partial_sort_thresholds<default_config, Key>
+{
+    template<target_arch Arch>
+    struct architecture_config
+    {
+        static constexpr partial_sort_thresholds_params params
+            = default_partial_sort_thresholds<static_cast<unsigned int>(Arch), Key>();
+    };
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<typename PartialSortConfig, typename Key>
+template<target_arch Arch>
+constexpr partial_sort_thresholds_params
+    wrapped_partial_sort_thresholds<PartialSortConfig, Key>::architecture_config<Arch>::params;
+
+template<typename Key>
+template<target_arch Arch>
+constexpr partial_sort_thresholds_params
+    wrapped_partial_sort_thresholds<default_config, Key>::architecture_config<Arch>::params;
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
 } // end namespace detail
 
 END_ROCPRIM_NAMESPACE
@@ -36,6 +36,7 @@
 
 #include "detail/device_partition.hpp"
 #include "detail/device_scan_common.hpp"
+#include "device_launch_trace.hpp"
 #include "device_partition_config.hpp"
 #include "device_transform.hpp"
 
@@ -104,6 +105,7 @@ ROCPRIM_KERNEL
     { \
         auto _error = hipGetLastError(); \
         if(_error != hipSuccess) return _error; \
+        ::rocprim::detail::trace_launch_end(name, size); \
         if(debug_synchronous) \
         { \
             std::cout << name << "(" << size << ")"; \
@@ -305,6 +307,12 @@ inline hipError_t partition_impl(void*                       temporary_storage,
                 const unsigned int block_size = ROCPRIM_DEFAULT_MAX_BLOCK_SIZE;
                 const unsigned int grid_size
                     = ::rocprim::detail::ceiling_div(current_number_of_blocks, block_size);
+                detail::trace_launch_begin("partition",
+                                           dim3(grid_size),
+                                           dim3(block_size),
+                                           0,
+                                           0,
+                                           stream);
                 init_lookback_scan_state_kernel<decltype(scan_state)>
                     <<<dim3(grid_size), dim3(block_size), 0, stream>>>(scan_state,
                                                                        current_number_of_blocks);
@@ -318,6 +326,12 @@ inline hipError_t partition_impl(void*                       temporary_storage,
         with_scan_state(
             [&](const auto scan_state)
             {
+                detail::trace_launch_begin("partition",
+                                           dim3(current_number_of_blocks),
+                                           dim3(block_size),
+                                           items_per_thread,
+                                           0,
+                                           stream);
                 partition_kernel<method, write_only_selected, config>
                     <<<dim3(current_number_of_blocks), dim3(block_size), 0, stream>>>(
                         keys_input + prev_processed,
@@ -23,6 +23,7 @@
 
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <type_traits>
 #include <utility>
 
@@ -34,9 +35,11 @@
 #include "../functional.hpp"
 #include "../types.hpp"
 
+#include "../iterator/counting_iterator.hpp"
 #include "../type_traits.hpp"
 #include "detail/config/device_radix_sort_onesweep.hpp"
 #include "detail/device_radix_sort.hpp"
+#include "device_launch_trace.hpp"
 #include "device_transform.hpp"
 #include "specialization/device_radix_block_sort.hpp"
 #include "specialization/device_radix_merge_sort.hpp"
@@ -55,6 +58,7 @@ namespace detail
     { \
         auto _error = hipGetLastError(); \
         if(_error != hipSuccess) return _error; \
+        ::rocprim::detail::trace_launch_end(name, size); \
         if(debug_synchronous) \
         { \
             std::cout << name << "(" << size << ")"; \
@@ -124,13 +128,13 @@ ROCPRIM_KERNEL
 }
 
 template<class Config, class Offset>
-ROCPRIM_KERNEL __launch_bounds__(
-    device_params<Config>()
-        .histogram.block_size) void onesweep_scan_histograms_kernel(Offset* global_digit_offsets)
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().histogram.block_size) void
+    onesweep_scan_histograms_kernel(Offset* global_digit_offsets, unsigned int* trivial_digits)
 {
     static constexpr radix_sort_onesweep_config_params params = device_params<Config>();
     onesweep_scan_histograms<params.histogram.block_size, params.radix_bits_per_place>(
-        global_digit_offsets);
+        global_digit_offsets,
+        trivial_digits);
 }
 
 template<class Config,
@@ -142,6 +146,7 @@ template<class Config,
 hipError_t radix_sort_onesweep_global_offsets(KeysInputIterator keys_input,
                                               ValuesInputIterator,
                                               Offset*            global_digit_offsets,
+                                              unsigned int*      trivial_digits,
                                               const Offset       size,
                                               const unsigned int digit_places,
                                               Decomposer         decomposer,
@@ -187,6 +192,12 @@ hipError_t radix_sort_onesweep_global_offsets(KeysInputIterator keys_input,
     }
 
     // Compute a histogram for each digit.
+    detail::trace_launch_begin("radix_sort",
+                               dim3(blocks),
+                               dim3(params.histogram.block_size),
+                               params.histogram.items_per_thread,
+                               0,
+                               stream);
     hipLaunchKernelGGL(HIP_KERNEL_NAME(onesweep_histograms_kernel<config, Descending>),
                        dim3(blocks),
                        dim3(params.histogram.block_size),
@@ -207,12 +218,19 @@ hipError_t radix_sort_onesweep_global_offsets(KeysInputIterator keys_input,
         start = std::chrono::high_resolution_clock::now();
     }
 
+    detail::trace_launch_begin("radix_sort",
+                               dim3(digit_places),
+                               dim3(params.histogram.block_size),
+                               0,
+                               0,
+                               stream);
     hipLaunchKernelGGL(HIP_KERNEL_NAME(onesweep_scan_histograms_kernel<config>),
                        dim3(digit_places), // One block for every digit place.
                        dim3(params.histogram.block_size),
                        0,
                        stream,
-                       global_digit_offsets);
+                       global_digit_offsets,
+                       trivial_digits);
 
     ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("scan_global_digit_histograms", bins, start);
     return hipSuccess;
@@ -236,6 +254,7 @@ ROCPRIM_KERNEL
         Offset*                  global_digit_offsets_in,
         Offset*                  global_digit_offsets_out,
         onesweep_lookback_state* lookback_states,
+        const unsigned int*      trivial_digit,
         Decomposer               decomposer,
         const unsigned int       bit,
         const unsigned int       current_radix_bits,
@@ -254,6 +273,7 @@ ROCPRIM_KERNEL
                                                     global_digit_offsets_in,
                                                     global_digit_offsets_out,
                                                     lookback_states,
+                                                    trivial_digit,
                                                     decomposer,
                                                     bit,
                                                     current_radix_bits,
@@ -279,6 +299,7 @@ hipError_t radix_sort_onesweep_iteration(
     Offset*                                                         global_digit_offsets_in,
     Offset*                                                         global_digit_offsets_out,
     onesweep_lookback_state*                                        lookback_states,
+    const unsigned int*                                             trivial_digit,
     const bool                                                      from_input,
     const bool                                                      to_output,
     Decomposer                                                      decomposer,
@@ -350,6 +371,12 @@ hipError_t radix_sort_onesweep_iteration(
             start = std::chrono::high_resolution_clock::now();
         }
 
+        detail::trace_launch_begin("radix_sort",
+                                   dim3(blocks),
+                                   dim3(params.sort.block_size),
+                                   params.sort.items_per_thread,
+                                   0,
+                                   stream);
         if(from_input && to_output)
         {
             hipLaunchKernelGGL(HIP_KERNEL_NAME(onesweep_iteration_kernel<config, Descending>),
@@ -365,6 +392,7 @@ hipError_t radix_sort_onesweep_iteration(
                                global_digit_offsets_in,
                                global_digit_offsets_out,
                                lookback_states,
+                               trivial_digit,
                                decomposer,
                                bit,
                                current_radix_bits,
@@ -385,6 +413,7 @@ hipError_t radix_sort_onesweep_iteration(
                                global_digit_offsets_in,
                                global_digit_offsets_out,
                                lookback_states,
+                               trivial_digit,
                                decomposer,
                                bit,
                                current_radix_bits,
@@ -405,6 +434,7 @@ hipError_t radix_sort_onesweep_iteration(
                                global_digit_offsets_in,
                                global_digit_offsets_out,
                                lookback_states,
+                               trivial_digit,
                                decomposer,
                                bit,
                                current_radix_bits,
@@ -425,6 +455,7 @@ hipError_t radix_sort_onesweep_iteration(
                                global_digit_offsets_in,
                                global_digit_offsets_out,
                                lookback_states,
+                               trivial_digit,
                                decomposer,
                                bit,
                                current_radix_bits,
@@ -496,6 +527,7 @@ hipError_t radix_sort_onesweep_impl(
     offset_type*             global_digit_offsets;
     offset_type*             global_digit_offsets_tmp;
     onesweep_lookback_state* lookback_states;
+    unsigned int*            trivial_digits;
     key_type*                keys_tmp_storage;
     value_type*              values_tmp_storage;
 
@@ -507,6 +539,7 @@ hipError_t radix_sort_onesweep_impl(
             detail::temp_storage::ptr_aligned_array(&global_digit_offsets_tmp,
                                                     radix_size_per_place),
             detail::temp_storage::ptr_aligned_array(&lookback_states, num_lookback_states),
+            detail::temp_storage::ptr_aligned_array(&trivial_digits, places),
             detail::temp_storage::ptr_aligned_array(&keys_tmp_storage,
                                                     !with_double_buffer ? size : 0),
             detail::temp_storage::ptr_aligned_array(&values_tmp_storage,
@@ -538,6 +571,7 @@ hipError_t radix_sort_onesweep_impl(
             = radix_sort_onesweep_global_offsets<Config, Descending>(keys_input,
                                                                      values_input,
                                                                      global_digit_offsets,
+                                                                     trivial_digits,
                                                                      static_cast<offset_type>(size),
                                                                      places,
                                                                      decomposer,
@@ -592,7 +626,8 @@ hipError_t radix_sort_onesweep_impl(
         }
     }
 
-    // Sort each digit place iteratively.
+    // Sort each digit place iteratively. Places in which all keys share the same digit are
+    // detected on the device while scanning the histograms, and are only copied.
     for(unsigned bit = begin_bit, place = 0; bit < end_bit;
         bit += params.radix_bits_per_place, ++place)
     {
@@ -607,6 +642,7 @@ hipError_t radix_sort_onesweep_impl(
             global_digit_offsets + place * radix_size_per_place,
             global_digit_offsets_tmp,
             lookback_states,
+            trivial_digits + place,
             from_input,
             to_output,
             decomposer,
@@ -633,22 +669,22 @@ template<class Config,
          class ValuesOutputIterator,
          class Size,
          class Decomposer>
-hipError_t
-    radix_sort_impl(void*                                                         temporary_storage,
-                    size_t&                                                       storage_size,
-                    KeysInputIterator                                             keys_input,
-                    typename std::iterator_traits<KeysInputIterator>::value_type* keys_tmp,
-                    KeysOutputIterator                                            keys_output,
-                    ValuesInputIterator                                           values_input,
-                    typename std::iterator_traits<ValuesInputIterator>::value_type* values_tmp,
-                    ValuesOutputIterator                                            values_output,
-                    Size                                                            size,
-                    bool&        is_result_in_output,
-                    Decomposer   decomposer,
-                    unsigned int begin_bit,
-                    unsigned int end_bit,
-                    hipStream_t  stream,
-                    bool         debug_synchronous)
+hipError_t radix_sort_direct_impl(
+    void*                                                           temporary_storage,
+    size_t&                                                         storage_size,
+    KeysInputIterator                                               keys_input,
+    typename std::iterator_traits<KeysInputIterator>::value_type*   keys_tmp,
+    KeysOutputIterator                                              keys_output,
+    ValuesInputIterator                                             values_input,
+    typename std::iterator_traits<ValuesInputIterator>::value_type* values_tmp,
+    ValuesOutputIterator                                            values_output,
+    Size                                                            size,
+    bool&                                                           is_result_in_output,
+    Decomposer                                                      decomposer,
+    unsigned int                                                    begin_bit,
+    unsigned int                                                    end_bit,
+    hipStream_t                                                     stream,
+    bool                                                            debug_synchronous)
 {
     using key_type   = typename std::iterator_traits<KeysInputIterator>::value_type;
     using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
@@ -663,37 +699,54 @@ hipError_t
         "ValuesInputIterator and ValuesOutputIterator must have the same value_type");
 
     constexpr bool is_default_config = std::is_same<Config, default_config>::value;
-    // if config is not custom, provide default value for merge sort limit
-    constexpr size_t merge_sort_limit
-        = std::conditional<is_default_config, radix_sort_config<>, Config>::type::merge_sort_limit;
-
-    // Instantiate single sort config to find the threshold that determines which algorithm is used.
 
-    // In the case that the user provides no custom config for the single sort,
-    // instead of using the autotuned merge_sort_block_sort_config, use a hard-coded config that
-    // significantly improves performance in the case that only a single block is launched.
-    // Higher performance is achieved by increasing compute unit utilization.
-    // Use <256u, 4u>, unless smaller is needed to not exceed shared memory maximum.
-    constexpr bool use_default_small_block_sort
+    // In the case that the user provides no custom config for the single sort, use the
+    // thresholds of the target architecture: a single sort config that improves performance when
+    // only a single block is launched, and the largest sizes for which the single sort and merge
+    // sort are faster than the next algorithm.
+    constexpr bool use_default_single_sort
         = is_default_config
           || std::is_same<typename Config::single_sort_config, default_config>::value;
-    using default_radix_sort_block_sort_config =
-        typename radix_sort_block_sort_config_base<key_type, value_type>::type;
-    using default_block_sort_config
-        = kernel_config<rocprim::min(256u, default_radix_sort_block_sort_config::block_size),
-                        rocprim::min(4u, default_radix_sort_block_sort_config::items_per_thread)>;
-    using block_sort_config = typename std::conditional<use_default_small_block_sort,
-                                                        default_block_sort_config,
-                                                        typename Config::single_sort_config>::type;
+    using block_sort_config =
+        typename std::conditional<use_default_single_sort,
+                                  default_radix_sort_single_sort_config,
+                                  typename Config::single_sort_config>::type;
+
+    detail::target_arch target_arch;
+    hipError_t          result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const radix_sort_thresholds_params thresholds
+        = dispatch_target_arch<wrapped_radix_sort_thresholds<key_type, value_type>>(target_arch);
+
+    const kernel_config_params single_sort_params
+        = dispatch_target_arch<wrapped_radix_sort_block_sort_config<block_sort_config,
+                                                                    key_type,
+                                                                    value_type>>(target_arch);
+    const size_t single_sort_limit
+        = use_default_single_sort
+              ? thresholds.single_sort_limit
+              : size_t{single_sort_params.block_size} * single_sort_params.items_per_thread;
+
+    // If config is not custom, the merge sort limit is calibrated for the target architecture.
+    // Otherwise, for sizeof(key_type) <= 2 onesweep is 2x/3x faster (also with values) when
+    // input_size > 100K, so don't use radix_sort_merge_sort then.
+    constexpr size_t custom_merge_sort_limit
+        = std::conditional<is_default_config, radix_sort_config<>, Config>::type::merge_sort_limit;
+    const size_t merge_sort_limit
+        = is_default_config ? thresholds.merge_sort_limit
+          : sizeof(key_type) > 2 ? custom_merge_sort_limit
+                                 : rocprim::min(custom_merge_sort_limit, size_t{100000 - 1});
 
     if(::rocprim::is_floating_point<key_type>::value
        && ((begin_bit != 0) || (end_bit != sizeof(key_type) * 8)))
     {
         return hipErrorInvalidValue;
     }
-    unsigned int single_sort_items_per_block
-        = block_sort_config::block_size * block_sort_config::items_per_thread;
-    if(size <= single_sort_items_per_block)
+    unsigned int single_sort_items_per_block = 0;
+    if(static_cast<size_t>(size) <= single_sort_limit)
     {
         if(temporary_storage == nullptr)
         {
@@ -720,10 +773,7 @@ hipError_t
                                                                     stream,
                                                                     debug_synchronous);
     }
-    // For sizeof(key_type) <= 2, onesweep is 2x/3x faster (also with values) when
-    // input_size > 100K, so don't use radix_sort_merge_sort then.
-    else if(static_cast<size_t>(size) <= merge_sort_limit
-            && (sizeof(key_type) > 2 || size < 100000))
+    else if(static_cast<size_t>(size) <= merge_sort_limit)
     {
         is_result_in_output = true;
         // note: Config::merge_sort_config may be default_config
@@ -765,6 +815,322 @@ hipError_t
     }
 }
 
+template<class ValuesInputIterator>
+struct radix_sort_gather_op
+{
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    ValuesInputIterator values_input;
+
+    template<class Index>
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE value_type operator()(const Index index) const
+    {
+        return values_input[index];
+    }
+};
+
+template<class Config,
+         bool Descending,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class Size,
+         class Decomposer>
+hipError_t radix_sort_indirect_impl(
+    std::false_type /*use_indirect*/,
+    void*                                                           temporary_storage,
+    size_t&                                                         storage_size,
+    KeysInputIterator                                               keys_input,
+    typename std::iterator_traits<KeysInputIterator>::value_type*   keys_tmp,
+    KeysOutputIterator                                              keys_output,
+    ValuesInputIterator                                             values_input,
+    typename std::iterator_traits<ValuesInputIterator>::value_type* values_tmp,
+    ValuesOutputIterator                                            values_output,
+    Size                                                            size,
+    bool&                                                           is_result_in_output,
+    Decomposer                                                      decomposer,
+    unsigned int                                                    begin_bit,
+    unsigned int                                                    end_bit,
+    hipStream_t                                                     stream,
+    bool                                                            debug_synchronous)
+{
+    return radix_sort_direct_impl<Config, Descending>(temporary_storage,
+                                                      storage_size,
+                                                      keys_input,
+                                                      keys_tmp,
+                                                      keys_output,
+                                                      values_input,
+                                                      values_tmp,
+                                                      values_output,
+                                                      size,
+                                                      is_result_in_output,
+                                                      decomposer,
+                                                      begin_bit,
+                                                      end_bit,
+                                                      stream,
+                                                      debug_synchronous);
+}
+
+// Sorts the keys together with the indices of the values, and then gathers the values in a
+// single pass. Every sorting pass then moves 4 bytes per item instead of sizeof(value_type).
+template<class Config,
+         bool Descending,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class Size,
+         class Decomposer>
+hipError_t radix_sort_indirect_impl(
+    std::true_type /*use_indirect*/,
+    void*                                                           temporary_storage,
+    size_t&                                                         storage_size,
+    KeysInputIterator                                               keys_input,
+    typename std::iterator_traits<KeysInputIterator>::value_type*   keys_tmp,
+    KeysOutputIterator                                              keys_output,
+    ValuesInputIterator                                             values_input,
+    typename std::iterator_traits<ValuesInputIterator>::value_type* values_tmp,
+    ValuesOutputIterator                                            values_output,
+    Size                                                            size,
+    bool&                                                           is_result_in_output,
+    Decomposer                                                      decomposer,
+    unsigned int                                                    begin_bit,
+    unsigned int                                                    end_bit,
+    hipStream_t                                                     stream,
+    bool                                                            debug_synchronous)
+{
+    using index_type = unsigned int;
+
+    // The values of double buffers must end up in the same buffer as the keys, and gathering
+    // cannot be done in-place. In these cases the values are moved in every pass.
+    const bool use_indirect
+        = values_tmp == nullptr
+          && static_cast<size_t>(size) <= std::numeric_limits<index_type>::max()
+          && !::rocprim::detail::can_iterators_alias(values_input, values_output, size);
+    if(!use_indirect)
+    {
+        return radix_sort_direct_impl<Config, Descending>(temporary_storage,
+                                                          storage_size,
+                                                          keys_input,
+                                                          keys_tmp,
+                                                          keys_output,
+                                                          values_input,
+                                                          values_tmp,
+                                                          values_output,
+                                                          size,
+                                                          is_result_in_output,
+                                                          decomposer,
+                                                          begin_bit,
+                                                          end_bit,
+                                                          stream,
+                                                          debug_synchronous);
+    }
+
+    const ::rocprim::counting_iterator<index_type> indices_input(0);
+
+    index_type* indices           = nullptr;
+    void*       sort_storage      = nullptr;
+    size_t      sort_storage_size = 0;
+
+    hipError_t error = radix_sort_direct_impl<Config, Descending>(nullptr,
+                                                                  sort_storage_size,
+                                                                  keys_input,
+                                                                  keys_tmp,
+                                                                  keys_output,
+                                                                  indices_input,
+                                                                  static_cast<index_type*>(nullptr),
+                                                                  indices,
+                                                                  size,
+                                                                  is_result_in_output,
+                                                                  decomposer,
+                                                                  begin_bit,
+                                                                  end_bit,
+                                                                  stream,
+                                                                  debug_synchronous);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&indices, size),
+            detail::temp_storage::make_partition(&sort_storage, sort_storage_size)));
+
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(size == 0)
+    {
+        is_result_in_output = true;
+        return hipSuccess;
+    }
+
+    error = radix_sort_direct_impl<Config, Descending>(sort_storage,
+                                                       sort_storage_size,
+                                                       keys_input,
+                                                       keys_tmp,
+                                                       keys_output,
+                                                       indices_input,
+                                                       static_cast<index_type*>(nullptr),
+                                                       indices,
+                                                       size,
+                                                       is_result_in_output,
+                                                       decomposer,
+                                                       begin_bit,
+                                                       end_bit,
+                                                       stream,
+                                                       debug_synchronous);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    // Without double buffers the sorted keys and indices are always in the output.
+    // Each block loads a tile of indices coalesced, and stores the gathered values coalesced.
+    return ::rocprim::transform(indices,
+                                values_output,
+                                size,
+                                radix_sort_gather_op<ValuesInputIterator>{values_input},
+                                stream,
+                                debug_synchronous);
+}
+
+template<class Config,
+         bool Descending,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class Size,
+         class Decomposer>
+hipError_t
+    radix_sort_impl(void*                                                           temporary_storage,
+                    size_t&                                                         storage_size,
+                    KeysInputIterator                                               keys_input,
+                    typename std::iterator_traits<KeysInputIterator>::value_type*   keys_tmp,
+                    KeysOutputIterator                                              keys_output,
+                    ValuesInputIterator                                             values_input,
+                    typename std::iterator_traits<ValuesInputIterator>::value_type* values_tmp,
+                    ValuesOutputIterator                                            values_output,
+                    Size                                                            size,
+                    bool&                                                           is_result_in_output,
+                    Decomposer                                                      decomposer,
+                    unsigned int                                                    begin_bit,
+                    unsigned int                                                    end_bit,
+                    hipStream_t                                                     stream,
+                    bool                                                            debug_synchronous)
+{
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    return radix_sort_indirect_impl<Config, Descending>(
+        radix_sort_use_indirect<Config, value_type>{},
+        temporary_storage,
+        storage_size,
+        keys_input,
+        keys_tmp,
+        keys_output,
+        values_input,
+        values_tmp,
+        values_output,
+        size,
+        is_result_in_output,
+        decomposer,
+        begin_bit,
+        end_bit,
+        stream,
+        debug_synchronous);
+}
+
+template<class Config,
+         bool Descending,
+         class KeysInputIterator,
+         class IndicesOutputIterator,
+         class Size,
+         class Decomposer>
+hipError_t argsort_impl(void*                 temporary_storage,
+                        size_t&               storage_size,
+                        KeysInputIterator     keys_input,
+                        IndicesOutputIterator indices_output,
+                        Size                  size,
+                        Decomposer            decomposer,
+                        unsigned int          begin_bit,
+                        unsigned int          end_bit,
+                        hipStream_t           stream,
+                        bool                  debug_synchronous)
+{
+    using key_type   = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using index_type = typename std::iterator_traits<IndicesOutputIterator>::value_type;
+
+    static_assert(std::is_integral<index_type>::value,
+                  "The value_type of IndicesOutputIterator must be an integral type.");
+
+    const ::rocprim::counting_iterator<index_type> indices_input(0);
+
+    key_type* keys_output       = nullptr;
+    void*     sort_storage      = nullptr;
+    size_t    sort_storage_size = 0;
+    bool      ignored;
+
+    hipError_t error = radix_sort_impl<Config, Descending>(nullptr,
+                                                           sort_storage_size,
+                                                           keys_input,
+                                                           nullptr,
+                                                           keys_output,
+                                                           indices_input,
+                                                           nullptr,
+                                                           indices_output,
+                                                           size,
+                                                           ignored,
+                                                           decomposer,
+                                                           begin_bit,
+                                                           end_bit,
+                                                           stream,
+                                                           debug_synchronous);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&keys_output, size),
+            detail::temp_storage::make_partition(&sort_storage, sort_storage_size)));
+
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(size == 0)
+    {
+        return hipSuccess;
+    }
+
+    return radix_sort_impl<Config, Descending>(sort_storage,
+                                               sort_storage_size,
+                                               keys_input,
+                                               nullptr,
+                                               keys_output,
+                                               indices_input,
+                                               nullptr,
+                                               indices_output,
+                                               size,
+                                               ignored,
+                                               decomposer,
+                                               begin_bit,
+                                               end_bit,
+                                               stream,
+                                               debug_synchronous);
+}
+
 #undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
 
 } // end namespace detail
@@ -3938,6 +4304,181 @@ auto radix_sort_pairs_desc(void*                 temporary_storage,
     return error;
 }
 
+/// \brief Parallel ascending radix argsort primitive for device level.
+///
+/// \p argsort function computes the permutation that sorts the input keys in ascending order,
+/// without writing the sorted keys. The sort is stable: equal keys keep their relative order.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * \p Key type (a \p value_type of \p KeysInputIterator) must be an arithmetic type (that is,
+/// an integral type or a floating-point type).
+/// * The \p value_type of \p IndicesOutputIterator must be an integral type that can represent
+/// \p size - 1.
+/// * Ranges specified by \p keys_input and \p indices_output must have at least \p size elements.
+/// * After the sort, <tt>keys_input[indices_output[i]]</tt> is the <tt>i</tt>-th smallest key.
+/// The permutation can be used to gather any number of value ranges afterwards, which is often
+/// faster than sorting large values with \p radix_sort_pairs.
+///
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam KeysInputIterator random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam IndicesOutputIterator random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam Size integral type that represents the problem size.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input pointer to the first element in the range to sort.
+/// \param [out] indices_output pointer to the first element in the output range of indices.
+/// \param [in] size number of element in the input range.
+/// \param [in] begin_bit [optional] index of the first (least significant) bit used in
+/// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+/// Non-default value not supported for floating-point key-types.
+/// \param [in] end_bit [optional] past-the-end index (most significant) bit used in
+/// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+/// value: \p <tt>8 * sizeof(Key)</tt>. Non-default value not supported for floating-point key-types.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level ascending argsort is performed on an array of
+/// \p float values.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;      // e.g., 8
+/// float * input;          // e.g., [0.6, 0.3, 0.65, 0.4, 0.2, 0.08, 1, 0.7]
+/// unsigned int * indices; // empty array of 8 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::argsort(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, indices, input_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform sort
+/// rocprim::argsort(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, indices, input_size
+/// );
+/// // indices: [5, 4, 1, 3, 0, 2, 7, 6]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator,
+         class IndicesOutputIterator,
+         class Size,
+         class Key = typename std::iterator_traits<KeysInputIterator>::value_type>
+hipError_t argsort(void*                 temporary_storage,
+                   size_t&               storage_size,
+                   KeysInputIterator     keys_input,
+                   IndicesOutputIterator indices_output,
+                   Size                  size,
+                   unsigned int          begin_bit         = 0,
+                   unsigned int          end_bit           = 8 * sizeof(Key),
+                   hipStream_t           stream            = 0,
+                   bool                  debug_synchronous = false)
+{
+    static_assert(std::is_integral<Size>::value, "Size must be an integral type.");
+    return detail::argsort_impl<Config, false>(temporary_storage,
+                                               storage_size,
+                                               keys_input,
+                                               indices_output,
+                                               size,
+                                               identity_decomposer{},
+                                               begin_bit,
+                                               end_bit,
+                                               stream,
+                                               debug_synchronous);
+}
+
+/// \brief Parallel descending radix argsort primitive for device level.
+///
+/// \p argsort_desc function computes the permutation that sorts the input keys in descending
+/// order, without writing the sorted keys. The sort is stable: equal keys keep their relative
+/// order.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * \p Key type (a \p value_type of \p KeysInputIterator) must be an arithmetic type (that is,
+/// an integral type or a floating-point type).
+/// * The \p value_type of \p IndicesOutputIterator must be an integral type that can represent
+/// \p size - 1.
+/// * Ranges specified by \p keys_input and \p indices_output must have at least \p size elements.
+///
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam KeysInputIterator random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam IndicesOutputIterator random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam Size integral type that represents the problem size.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input pointer to the first element in the range to sort.
+/// \param [out] indices_output pointer to the first element in the output range of indices.
+/// \param [in] size number of element in the input range.
+/// \param [in] begin_bit [optional] index of the first (least significant) bit used in
+/// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+/// Non-default value not supported for floating-point key-types.
+/// \param [in] end_bit [optional] past-the-end index (most significant) bit used in
+/// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+/// value: \p <tt>8 * sizeof(Key)</tt>. Non-default value not supported for floating-point key-types.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class IndicesOutputIterator,
+         class Size,
+         class Key = typename std::iterator_traits<KeysInputIterator>::value_type>
+hipError_t argsort_desc(void*                 temporary_storage,
+                        size_t&               storage_size,
+                        KeysInputIterator     keys_input,
+                        IndicesOutputIterator indices_output,
+                        Size                  size,
+                        unsigned int          begin_bit         = 0,
+                        unsigned int          end_bit           = 8 * sizeof(Key),
+                        hipStream_t           stream            = 0,
+                        bool                  debug_synchronous = false)
+{
+    static_assert(std::is_integral<Size>::value, "Size must be an integral type.");
+    return detail::argsort_impl<Config, true>(temporary_storage,
+                                              storage_size,
+                                              keys_input,
+                                              indices_output,
+                                              size,
+                                              identity_decomposer{},
+                                              begin_bit,
+                                              end_bit,
+                                              stream,
+                                              debug_synchronous);
+}
+
 END_ROCPRIM_NAMESPACE
 
 /// @}
@@ -23,6 +23,7 @@
 
 #include "config_types.hpp"
 #include "detail/config/device_radix_sort_block_sort.hpp"
+#include "detail/config/device_radix_sort_thresholds.hpp"
 #include "detail/device_config_helper.hpp"
 
 /// \addtogroup primitivesmodule_deviceconfigs
@@ -30,6 +31,21 @@
 
 BEGIN_ROCPRIM_NAMESPACE
 
+/// \brief Available methods for moving the values in device-level radix sort of (key, value) pairs.
+enum class radix_sort_values_method
+{
+    /// \brief The values are moved together with the keys in every sorting pass.
+    direct,
+    /// \brief The keys are sorted together with 32-bit indices of the values, after which the
+    /// values are gathered into the output once. This reduces the memory traffic for large value
+    /// types, at the cost of a temporary buffer of indices.
+    indirect,
+    /// \brief Uses \p indirect for value types of at least 32 bytes, and \p direct otherwise.
+    automatic,
+    /// \brief The default method.
+    default_method = automatic,
+};
+
 /// \brief Configuration of device-level radix sort operation.
 ///
 /// One of three algorithms is used: single sort (launches only a single block),
@@ -44,10 +60,15 @@ BEGIN_ROCPRIM_NAMESPACE
 ///         must be \p radix_sort_onesweep_config or \p default_config.
 /// \tparam MergeSortLimit - The largest number of items for which the merge sort algorithm will be
 ///         used. Note that below this limit, a different algorithm may be used.
-template<class SingleSortConfig = default_config,
-         class MergeSortConfig  = default_config,
-         class OnesweepConfig   = default_config,
-         size_t MergeSortLimit  = 1024 * 1024>
+/// \tparam ValuesMethod - The method of moving the values when sorting (key, value) pairs,
+///         see \p radix_sort_values_method. The indirect method is only used when the values are
+///         not sorted with double buffers, the input and output ranges of the values do not
+///         overlap, and the number of items fits in 32 bits.
+template<class SingleSortConfig                  = default_config,
+         class MergeSortConfig                   = default_config,
+         class OnesweepConfig                    = default_config,
+         size_t                   MergeSortLimit = 1024 * 1024,
+         radix_sort_values_method ValuesMethod   = radix_sort_values_method::default_method>
 struct radix_sort_config
 {
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -59,12 +80,32 @@ struct radix_sort_config
     using onesweep_config = OnesweepConfig;
     /// \brief Maximum number of items to use merge sort algorithm.
     static constexpr size_t merge_sort_limit = MergeSortLimit;
+    /// \brief Method of moving the values when sorting (key, value) pairs.
+    static constexpr radix_sort_values_method values_method = ValuesMethod;
 #endif
 };
 
 namespace detail
 {
 
+// Smallest value type for which radix_sort_values_method::automatic sorts indices instead of values.
+constexpr size_t radix_sort_indirect_min_value_size = 32;
+
+template<class Config, class Value>
+struct radix_sort_use_indirect
+    : std::integral_constant<
+          bool,
+          !std::is_same<Value, empty_type>::value
+              && (Config::values_method == radix_sort_values_method::indirect
+                  || (Config::values_method == radix_sort_values_method::automatic
+                      && sizeof(Value) >= radix_sort_indirect_min_value_size))>
+{};
+
+template<class Value>
+struct radix_sort_use_indirect<default_config, Value>
+    : radix_sort_use_indirect<radix_sort_config<>, Value>
+{};
+
 // sub-algorithm onesweep:
 template<typename RadixSortOnesweepConfig, typename, typename>
 struct wrapped_radix_sort_onesweep_config
@@ -123,6 +164,23 @@ struct wrapped_radix_sort_block_sort_config<default_config, Key, Value>
     };
 };
 
+// Config of the single block sort when the user provides no custom config, taken from the
+// thresholds of the target architecture.
+struct default_radix_sort_single_sort_config
+{};
+
+template<typename Key, typename Value>
+struct wrapped_radix_sort_block_sort_config<default_radix_sort_single_sort_config, Key, Value>
+{
+    template<target_arch Arch>
+    struct architecture_config
+    {
+        static constexpr kernel_config_params params
+            = default_radix_sort_thresholds<static_cast<unsigned int>(Arch), Key, Value>()
+                  .single_sort_config;
+    };
+};
+
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 template<typename RadixSortBlockSortConfig, typename Key, typename Value>
 template<target_arch Arch>
@@ -134,6 +192,31 @@ template<typename Key, typename Value>
 template<target_arch Arch>
 constexpr kernel_config_params wrapped_radix_sort_block_sort_config<default_config, Key, Value>::
     architecture_config<Arch>::params;
+
+template<typename Key, typename Value>
+template<target_arch Arch>
+constexpr kernel_config_params
+    wrapped_radix_sort_block_sort_config<default_radix_sort_single_sort_config, Key, Value>::
+        architecture_config<Arch>::params;
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+// Thresholds between single sort, merge sort and onesweep for the default config:
+template<typename Key, typename Value>
+struct wrapped_radix_sort_thresholds
+{
+    template<target_arch Arch>
+    struct architecture_config
+    {
+        static constexpr radix_sort_thresholds_params params
+            = default_radix_sort_thresholds<static_cast<unsigned int>(Arch), Key, Value>();
+    };
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<typename Key, typename Value>
+template<target_arch Arch>
+constexpr radix_sort_thresholds_params
+    wrapped_radix_sort_thresholds<Key, Value>::architecture_config<Arch>::params;
 #endif // DOXYGEN_SHOULD_SKIP_THIS
 
 } // namespace detail
@@ -34,6 +34,8 @@
 
 #include "detail/device_config_helper.hpp"
 #include "detail/device_reduce.hpp"
+#include "config_database.hpp"
+#include "device_launch_trace.hpp"
 #include "device_reduce_config.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
@@ -79,6 +81,7 @@ ROCPRIM_KERNEL
     { \
         auto _error = hipGetLastError(); \
         if(_error != hipSuccess) return _error; \
+        ::rocprim::detail::trace_launch_end(name, size); \
         if(debug_synchronous) \
         { \
             std::cout << name << "(" << size << ")"; \
@@ -192,6 +195,12 @@ hipError_t reduce_impl(void * temporary_storage,
             const auto current_blocks = (current_size + items_per_block - 1) / items_per_block;
 
             if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+            detail::trace_launch_begin("reduce",
+                                       dim3(current_blocks),
+                                       dim3(block_size),
+                                       items_per_thread,
+                                       0,
+                                       stream);
             hipLaunchKernelGGL(
                 HIP_KERNEL_NAME(detail::block_reduce_kernel<false, config, result_type>),
                 dim3(current_blocks),
@@ -222,6 +231,12 @@ hipError_t reduce_impl(void * temporary_storage,
     else
     {
         if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        detail::trace_launch_begin("reduce",
+                                   dim3(1),
+                                   dim3(block_size),
+                                   items_per_thread,
+                                   0,
+                                   stream);
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(detail::block_reduce_kernel<WithInitialValue, config, result_type>),
             dim3(1), dim3(block_size), 0, stream,
@@ -254,7 +269,8 @@ hipError_t reduce_impl(void * temporary_storage,
 /// * By default, the input type is used for accumulation. A custom type
 /// can be specified using <tt>rocprim::transform_iterator</tt>, see the example below.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `reduce_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `reduce_config`
+/// or a `tuned_config` of `reduce_config`s.
 /// \tparam InputIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
@@ -378,11 +394,29 @@ hipError_t reduce(void * temporary_storage,
                  const hipStream_t stream = 0,
                  bool debug_synchronous = false)
 {
-    return detail::reduce_impl<true, Config>(
-        temporary_storage, storage_size,
-        input, output, initial_value, size,
-        reduce_op, stream, debug_synchronous
-    );
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    using result_type =
+        typename ::rocprim::invoke_result_binary_op<input_type, BinaryFunction>::type;
+    using size_buckets
+        = detail::size_bucket_table<detail::default_reduce_size_buckets, result_type>;
+
+    return detail::dispatch_config_database<Config, size_buckets, input_type>(
+        "reduce",
+        size,
+        stream,
+        temporary_storage,
+        &storage_size,
+        is_pure_operation<BinaryFunction>::value
+            && !detail::can_iterators_alias(input, output, size),
+        [&](auto config_tag)
+        {
+            using config = typename decltype(config_tag)::type;
+            return detail::reduce_impl<true, config>(
+                temporary_storage, storage_size,
+                input, output, initial_value, size,
+                reduce_op, stream, debug_synchronous
+            );
+        });
 }
 
 /// \brief Parallel reduce primitive for device level.
@@ -401,7 +435,8 @@ hipError_t reduce(void * temporary_storage,
 /// * By default, the input type is used for accumulation. A custom type
 /// can be specified using <tt>rocprim::transform_iterator</tt>, see the example below.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `reduce_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `reduce_config`
+/// or a `tuned_config` of `reduce_config`s.
 /// \tparam InputIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
@@ -507,12 +542,28 @@ hipError_t reduce(void * temporary_storage,
                   bool debug_synchronous = false)
 {
     using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    using result_type =
+        typename ::rocprim::invoke_result_binary_op<input_type, BinaryFunction>::type;
+    using size_buckets
+        = detail::size_bucket_table<detail::default_reduce_size_buckets, result_type>;
 
-    return detail::reduce_impl<false, Config>(
-        temporary_storage, storage_size,
-        input, output, input_type(), size,
-        reduce_op, stream, debug_synchronous
-    );
+    return detail::dispatch_config_database<Config, size_buckets, input_type>(
+        "reduce",
+        size,
+        stream,
+        temporary_storage,
+        &storage_size,
+        is_pure_operation<BinaryFunction>::value
+            && !detail::can_iterators_alias(input, output, size),
+        [&](auto config_tag)
+        {
+            using config = typename decltype(config_tag)::type;
+            return detail::reduce_impl<false, config>(
+                temporary_storage, storage_size,
+                input, output, input_type(), size,
+                reduce_op, stream, debug_synchronous
+            );
+        });
 }
 
 /// @}
@@ -22,6 +22,7 @@
 #define ROCPRIM_DEVICE_DEVICE_REDUCE_BY_KEY_HPP_
 
 #include "config_types.hpp"
+#include "device_launch_trace.hpp"
 #include "device_reduce_by_key_config.hpp"
 #include "device_transform.hpp"
 
@@ -143,6 +144,7 @@ ROCPRIM_KERNEL
         auto _error = hipGetLastError();                                                         \
         if(_error != hipSuccess)                                                                 \
             return _error;                                                                       \
+        ::rocprim::detail::trace_launch_end(name, size);                                         \
         if(debug_synchronous)                                                                    \
         {                                                                                        \
             std::cout << name << "(" << size << ")";                                             \
@@ -336,6 +338,12 @@ hipError_t reduce_by_key_impl(void*                     temporary_storage,
                 const std::size_t  grid_size
                     = detail::ceiling_div(number_of_tiles_launch, block_size);
 
+                detail::trace_launch_begin("reduce_by_key",
+                                           dim3(grid_size),
+                                           dim3(block_size),
+                                           0,
+                                           0,
+                                           stream);
                 reduce_by_key_init_kernel<<<dim3(grid_size), dim3(block_size), 0, stream>>>(
                     scan_state,
                     number_of_tiles_launch,
@@ -352,6 +360,12 @@ hipError_t reduce_by_key_impl(void*                     temporary_storage,
         with_scan_state(
             [&](const auto scan_state)
             {
+                detail::trace_launch_begin("reduce_by_key",
+                                           dim3(number_of_blocks_launch),
+                                           dim3(block_size),
+                                           params.kernel_config.items_per_thread,
+                                           0,
+                                           stream);
                 reduce_by_key_kernel<Determinism, config>
                     <<<dim3(number_of_blocks_launch), dim3(block_size), 0, stream>>>(
                         keys_input + offset,
@@ -57,6 +57,19 @@ struct wrapped_reduce_config<default_config, Value>
     };
 };
 
+template<unsigned int Bucket, typename Value>
+struct wrapped_reduce_config<default_size_bucket_config<Bucket>, Value>
+{
+    template<target_arch Arch>
+    struct architecture_config
+    {
+        static constexpr reduce_config_params params = typename select_size_bucket<
+            Bucket,
+            typename default_reduce_size_buckets<static_cast<unsigned int>(Arch), Value>::buckets,
+            default_reduce_config<static_cast<unsigned int>(Arch), Value>>::type();
+    };
+};
+
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 template<typename ReduceConfig, typename Value>
 template<target_arch Arch>
@@ -67,6 +80,12 @@ template<typename Value>
 template<target_arch Arch>
 constexpr reduce_config_params
     wrapped_reduce_config<default_config, Value>::architecture_config<Arch>::params;
+
+template<unsigned int Bucket, typename Value>
+template<target_arch Arch>
+constexpr reduce_config_params
+    wrapped_reduce_config<default_size_bucket_config<Bucket>, Value>::architecture_config<
+        Arch>::params;
 #endif // DOXYGEN_SHOULD_SKIP_THIS
 
 } // namespace detail
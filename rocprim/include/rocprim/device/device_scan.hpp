@@ -34,6 +34,8 @@
 #include "detail/config/device_scan.hpp"
 #include "detail/device_scan.hpp"
 #include "detail/device_scan_common.hpp"
+#include "config_database.hpp"
+#include "device_launch_trace.hpp"
 #include "device_scan_config.hpp"
 #include "device_transform.hpp"
 
@@ -168,6 +170,7 @@ ROCPRIM_KERNEL
     { \
         auto _error = hipGetLastError(); \
         if(_error != hipSuccess) return _error; \
+        ::rocprim::detail::trace_launch_end(name, size); \
         if(debug_synchronous) \
         { \
             std::cout << name << "(" << size << ")"; \
@@ -179,6 +182,16 @@ ROCPRIM_KERNEL
         } \
     }
 
+// Name of the scan variant in the config database, the autotune cache and launch traces. The
+// variants have different kernels, so their configs are selected separately.
+template<lookback_scan_determinism Determinism, bool Exclusive>
+constexpr const char* scan_algorithm_name()
+{
+    return Determinism == lookback_scan_determinism::deterministic
+               ? (Exclusive ? "deterministic_exclusive_scan" : "deterministic_inclusive_scan")
+               : (Exclusive ? "exclusive_scan" : "inclusive_scan");
+}
+
 template<lookback_scan_determinism Determinism,
          bool                      Exclusive,
          class Config,
@@ -316,6 +329,12 @@ inline auto scan_impl(void*               temporary_storage,
             with_scan_state(
                 [&](const auto scan_state)
                 {
+                    detail::trace_launch_begin(scan_algorithm_name<Determinism, Exclusive>(),
+                                               dim3(grid_size),
+                                               dim3(block_size),
+                                               0,
+                                               0,
+                                               stream);
                     init_lookback_scan_state_kernel<<<dim3(grid_size),
                                                       dim3(block_size),
                                                       0,
@@ -341,6 +360,12 @@ inline auto scan_impl(void*               temporary_storage,
             with_scan_state(
                 [&](const auto scan_state)
                 {
+                    detail::trace_launch_begin(scan_algorithm_name<Determinism, Exclusive>(),
+                                               dim3(grid_size),
+                                               dim3(block_size),
+                                               items_per_thread,
+                                               0,
+                                               stream);
                     lookback_scan_kernel<Determinism,
                                          Exclusive,
                                          config,
@@ -387,6 +412,12 @@ inline auto scan_impl(void*               temporary_storage,
             start = std::chrono::high_resolution_clock::now();
         }
 
+        detail::trace_launch_begin(scan_algorithm_name<Determinism, Exclusive>(),
+                                   dim3(1),
+                                   dim3(block_size),
+                                   items_per_thread,
+                                   0,
+                                   stream);
         single_scan_kernel<Exclusive, // flag for exclusive scan operation
                            config,
                            InputIterator,
@@ -425,7 +456,8 @@ inline auto scan_impl(void*               temporary_storage,
 /// * By default, the input type is used for accumulation. A custom type
 /// can be specified using the \p AccType type parameter, see the example below.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `scan_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `scan_config`
+/// or a `tuned_config` of `scan_config`s.
 /// \tparam InputIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
@@ -534,23 +566,39 @@ inline hipError_t inclusive_scan(void*             temporary_storage,
                                  const hipStream_t stream            = 0,
                                  bool              debug_synchronous = false)
 {
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    using size_buckets = detail::size_bucket_table<detail::default_scan_size_buckets, AccType>;
+
     // input_type() is a dummy initial value (not used)
-    return detail::scan_impl<detail::lookback_scan_determinism::default_determinism,
-                             false,
-                             Config,
-                             InputIterator,
-                             OutputIterator,
-                             AccType,
-                             BinaryFunction,
-                             AccType>(temporary_storage,
-                                      storage_size,
-                                      input,
-                                      output,
-                                      AccType{},
-                                      size,
-                                      scan_op,
-                                      stream,
-                                      debug_synchronous);
+    return detail::dispatch_config_database<Config, size_buckets, input_type>(
+        "inclusive_scan",
+        size,
+        stream,
+        temporary_storage,
+        &storage_size,
+        is_pure_operation<BinaryFunction>::value
+            && !detail::can_iterators_alias(input, output, size),
+        [&](auto config_tag)
+        {
+            using config = typename decltype(config_tag)::type;
+            return detail::scan_impl<detail::lookback_scan_determinism::default_determinism,
+                                     false,
+                                     config,
+                                     InputIterator,
+                                     OutputIterator,
+                                     AccType,
+                                     BinaryFunction,
+                                     AccType>(temporary_storage,
+                                              storage_size,
+                                              input,
+                                              output,
+                                              AccType{},
+                                              size,
+                                              scan_op,
+                                              stream,
+                                              debug_synchronous);
+        });
 }
 
 /// \brief Bitwise-reproducible parallel inclusive scan primitive for device level.
@@ -575,22 +623,38 @@ inline hipError_t deterministic_inclusive_scan(void*             temporary_stora
                                                const hipStream_t stream  = 0,
                                                bool              debug_synchronous = false)
 {
-    return detail::scan_impl<detail::lookback_scan_determinism::deterministic,
-                             false,
-                             Config,
-                             InputIterator,
-                             OutputIterator,
-                             AccType,
-                             BinaryFunction,
-                             AccType>(temporary_storage,
-                                      storage_size,
-                                      input,
-                                      output,
-                                      AccType{},
-                                      size,
-                                      scan_op,
-                                      stream,
-                                      debug_synchronous);
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    using size_buckets = detail::size_bucket_table<detail::default_scan_size_buckets, AccType>;
+
+    return detail::dispatch_config_database<Config, size_buckets, input_type>(
+        "deterministic_inclusive_scan",
+        size,
+        stream,
+        temporary_storage,
+        &storage_size,
+        is_pure_operation<BinaryFunction>::value
+            && !detail::can_iterators_alias(input, output, size),
+        [&](auto config_tag)
+        {
+            using config = typename decltype(config_tag)::type;
+            return detail::scan_impl<detail::lookback_scan_determinism::deterministic,
+                                     false,
+                                     config,
+                                     InputIterator,
+                                     OutputIterator,
+                                     AccType,
+                                     BinaryFunction,
+                                     AccType>(temporary_storage,
+                                              storage_size,
+                                              input,
+                                              output,
+                                              AccType{},
+                                              size,
+                                              scan_op,
+                                              stream,
+                                              debug_synchronous);
+        });
 }
 
 /// \brief Parallel exclusive scan primitive for device level.
@@ -611,7 +675,8 @@ inline hipError_t deterministic_inclusive_scan(void*             temporary_stora
 /// if \p temporary_storage in a null pointer.
 /// * Ranges specified by \p input and \p output must have at least \p size elements.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `scan_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `scan_config`
+/// or a `tuned_config` of `scan_config`s.
 /// \tparam InputIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
@@ -701,22 +766,39 @@ inline hipError_t exclusive_scan(void*               temporary_storage,
                                  const hipStream_t   stream            = 0,
                                  bool                debug_synchronous = false)
 {
-    return detail::scan_impl<detail::lookback_scan_determinism::default_determinism,
-                             true,
-                             Config,
-                             InputIterator,
-                             OutputIterator,
-                             InitValueType,
-                             BinaryFunction,
-                             AccType>(temporary_storage,
-                                      storage_size,
-                                      input,
-                                      output,
-                                      initial_value,
-                                      size,
-                                      scan_op,
-                                      stream,
-                                      debug_synchronous);
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    using size_buckets = detail::size_bucket_table<detail::default_scan_size_buckets, AccType>;
+
+    return detail::dispatch_config_database<Config, size_buckets, input_type>(
+        "exclusive_scan",
+        size,
+        stream,
+        temporary_storage,
+        &storage_size,
+        is_pure_operation<BinaryFunction>::value
+            && !detail::can_iterators_alias(input, output, size)
+            && std::is_same<InitValueType, detail::input_type_t<InitValueType>>::value,
+        [&](auto config_tag)
+        {
+            using config = typename decltype(config_tag)::type;
+            return detail::scan_impl<detail::lookback_scan_determinism::default_determinism,
+                                     true,
+                                     config,
+                                     InputIterator,
+                                     OutputIterator,
+                                     InitValueType,
+                                     BinaryFunction,
+                                     AccType>(temporary_storage,
+                                              storage_size,
+                                              input,
+                                              output,
+                                              initial_value,
+                                              size,
+                                              scan_op,
+                                              stream,
+                                              debug_synchronous);
+        });
 }
 
 /// \brief Bitwise-reproducible parallel exclusive scan primitive for device level.
@@ -743,22 +825,39 @@ inline hipError_t deterministic_exclusive_scan(void*               temporary_sto
                                                const hipStream_t   stream  = 0,
                                                bool                debug_synchronous = false)
 {
-    return detail::scan_impl<detail::lookback_scan_determinism::deterministic,
-                             true,
-                             Config,
-                             InputIterator,
-                             OutputIterator,
-                             InitValueType,
-                             BinaryFunction,
-                             AccType>(temporary_storage,
-                                      storage_size,
-                                      input,
-                                      output,
-                                      initial_value,
-                                      size,
-                                      scan_op,
-                                      stream,
-                                      debug_synchronous);
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    using size_buckets = detail::size_bucket_table<detail::default_scan_size_buckets, AccType>;
+
+    return detail::dispatch_config_database<Config, size_buckets, input_type>(
+        "deterministic_exclusive_scan",
+        size,
+        stream,
+        temporary_storage,
+        &storage_size,
+        is_pure_operation<BinaryFunction>::value
+            && !detail::can_iterators_alias(input, output, size)
+            && std::is_same<InitValueType, detail::input_type_t<InitValueType>>::value,
+        [&](auto config_tag)
+        {
+            using config = typename decltype(config_tag)::type;
+            return detail::scan_impl<detail::lookback_scan_determinism::deterministic,
+                                     true,
+                                     config,
+                                     InputIterator,
+                                     OutputIterator,
+                                     InitValueType,
+                                     BinaryFunction,
+                                     AccType>(temporary_storage,
+                                              storage_size,
+                                              input,
+                                              output,
+                                              initial_value,
+                                              size,
+                                              scan_op,
+                                              stream,
+                                              debug_synchronous);
+        });
 }
 
 /// @}
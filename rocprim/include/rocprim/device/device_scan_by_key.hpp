@@ -32,6 +32,7 @@
 #include "detail/device_config_helper.hpp"
 #include "detail/device_scan_by_key.hpp"
 #include "detail/lookback_scan_state.hpp"
+#include "device_launch_trace.hpp"
 #include "device_scan_by_key_config.hpp"
 
 #include <hip/hip_runtime.h>
@@ -89,6 +90,7 @@ void __global__ __launch_bounds__(device_params<Config>().kernel_config.block_si
         auto _error = hipGetLastError();                                                         \
         if(_error != hipSuccess)                                                                 \
             return _error;                                                                       \
+        ::rocprim::detail::trace_launch_end(name, size);                                         \
         if(debug_synchronous)                                                                    \
         {                                                                                        \
             std::cout << name << "(" << size << ")";                                             \
@@ -101,6 +103,16 @@ void __global__ __launch_bounds__(device_params<Config>().kernel_config.block_si
         }                                                                                        \
     } while(false)
 
+// Name of the scan by key variant in launch traces
+template<lookback_scan_determinism Determinism, bool Exclusive>
+constexpr const char* scan_by_key_algorithm_name()
+{
+    return Determinism == lookback_scan_determinism::deterministic
+               ? (Exclusive ? "deterministic_exclusive_scan_by_key"
+                            : "deterministic_inclusive_scan_by_key")
+               : (Exclusive ? "exclusive_scan_by_key" : "inclusive_scan_by_key");
+}
+
 template<lookback_scan_determinism Determinism,
          bool                      Exclusive,
          typename Config,
@@ -258,6 +270,12 @@ inline hipError_t scan_by_key_impl(void* const           temporary_storage,
         with_scan_state(
             [&](const auto scan_state)
             {
+                detail::trace_launch_begin(scan_by_key_algorithm_name<Determinism, Exclusive>(),
+                                           dim3(init_grid_size),
+                                           dim3(block_size),
+                                           0,
+                                           0,
+                                           stream);
                 hipLaunchKernelGGL(init_lookback_scan_state_kernel,
                                    dim3(init_grid_size),
                                    dim3(block_size),
@@ -279,6 +297,12 @@ inline hipError_t scan_by_key_impl(void* const           temporary_storage,
         with_scan_state(
             [&](auto& scan_state)
             {
+                detail::trace_launch_begin(scan_by_key_algorithm_name<Determinism, Exclusive>(),
+                                           dim3(scan_blocks),
+                                           dim3(block_size),
+                                           items_per_thread,
+                                           0,
+                                           stream);
                 hipLaunchKernelGGL(
                     HIP_KERNEL_NAME(device_scan_by_key_kernel<Determinism, Exclusive, config>),
                     dim3(scan_blocks),
@@ -55,6 +55,19 @@ struct wrapped_scan_config<default_config, Value>
     };
 };
 
+template<unsigned int Bucket, typename Value>
+struct wrapped_scan_config<default_size_bucket_config<Bucket>, Value>
+{
+    template<target_arch Arch>
+    struct architecture_config
+    {
+        static constexpr scan_config_params params = typename select_size_bucket<
+            Bucket,
+            typename default_scan_size_buckets<static_cast<unsigned int>(Arch), Value>::buckets,
+            default_scan_config<static_cast<unsigned int>(Arch), Value>>::type{};
+    };
+};
+
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 template<typename ScanConfig, typename Value>
 template<target_arch Arch>
@@ -65,6 +78,12 @@ template<typename Value>
 template<target_arch Arch>
 constexpr scan_config_params
     wrapped_scan_config<default_config, Value>::architecture_config<Arch>::params;
+
+template<unsigned int Bucket, typename Value>
+template<target_arch Arch>
+constexpr scan_config_params
+    wrapped_scan_config<default_size_bucket_config<Bucket>, Value>::architecture_config<
+        Arch>::params;
 #endif // DOXYGEN_SHOULD_SKIP_THIS
 
 } // namespace detail
@@ -40,6 +40,7 @@
 #include "../iterator/reverse_iterator.hpp"
 #include "../thread/radix_key_codec.hpp"
 #include "detail/device_segmented_radix_sort.hpp"
+#include "device_launch_trace.hpp"
 #include "device_partition.hpp"
 #include "device_segmented_radix_sort_config.hpp"
 
@@ -206,6 +207,7 @@ ROCPRIM_KERNEL __launch_bounds__(
     { \
         auto _error = hipGetLastError(); \
         if(_error != hipSuccess) return _error; \
+        ::rocprim::detail::trace_launch_end(name, size); \
         if(debug_synchronous) \
         { \
             std::cout << name << "(" << size << ")"; \
@@ -508,6 +510,12 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
         {
             std::chrono::high_resolution_clock::time_point start;
             if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+            detail::trace_launch_begin("segmented_radix_sort",
+                                       dim3(large_segment_count),
+                                       dim3(params.kernel_config.block_size),
+                                       params.kernel_config.items_per_thread,
+                                       0,
+                                       stream);
             hipLaunchKernelGGL(HIP_KERNEL_NAME(segmented_sort_large_kernel<config, Descending>),
                                dim3(large_segment_count),
                                dim3(params.kernel_config.block_size),
@@ -538,6 +546,12 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
             std::chrono::high_resolution_clock::time_point start;
             if(debug_synchronous)
                 start = std::chrono::high_resolution_clock::now();
+            detail::trace_launch_begin("segmented_radix_sort",
+                                       dim3(medium_segment_grid_size),
+                                       dim3(params.warp_sort_config.block_size_medium),
+                                       params.warp_sort_config.items_per_thread_medium,
+                                       0,
+                                       stream);
             hipLaunchKernelGGL(HIP_KERNEL_NAME(segmented_sort_medium_kernel<config, Descending>),
                                dim3(medium_segment_grid_size),
                                dim3(params.warp_sort_config.block_size_medium),
@@ -566,6 +580,12 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
                                                                                 small_segments_per_block);
             std::chrono::high_resolution_clock::time_point start;
             if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+            detail::trace_launch_begin("segmented_radix_sort",
+                                       dim3(small_segment_grid_size),
+                                       dim3(params.warp_sort_config.block_size_small),
+                                       params.warp_sort_config.items_per_thread_small,
+                                       0,
+                                       stream);
             hipLaunchKernelGGL(HIP_KERNEL_NAME(segmented_sort_small_kernel<config, Descending>),
                                dim3(small_segment_grid_size),
                                dim3(params.warp_sort_config.block_size_small),
@@ -593,6 +613,12 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
     {
         std::chrono::high_resolution_clock::time_point start;
         if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        detail::trace_launch_begin("segmented_radix_sort",
+                                   dim3(segments),
+                                   dim3(params.kernel_config.block_size),
+                                   params.kernel_config.items_per_thread,
+                                   0,
+                                   stream);
         hipLaunchKernelGGL(HIP_KERNEL_NAME(segmented_sort_kernel<config, Descending>),
                            dim3(segments),
                            dim3(params.kernel_config.block_size),
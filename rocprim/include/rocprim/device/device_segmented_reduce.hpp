@@ -31,6 +31,7 @@
 
 #include "detail/config/device_reduce.hpp"
 #include "detail/device_segmented_reduce.hpp"
+#include "device_launch_trace.hpp"
 #include "rocprim/type_traits.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
@@ -67,6 +68,7 @@ ROCPRIM_KERNEL __launch_bounds__(
     { \
         auto _error = hipGetLastError(); \
         if(_error != hipSuccess) return _error; \
+        ::rocprim::detail::trace_launch_end(name, size); \
         if(debug_synchronous) \
         { \
             std::cout << name << "(" << size << ")"; \
@@ -129,6 +131,12 @@ hipError_t segmented_reduce_impl(void * temporary_storage,
     std::chrono::high_resolution_clock::time_point start;
 
     if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    detail::trace_launch_begin("segmented_reduce",
+                               dim3(segments),
+                               dim3(block_size),
+                               params.reduce_config.items_per_thread,
+                               0,
+                               stream);
     hipLaunchKernelGGL(
         HIP_KERNEL_NAME(segmented_reduce_kernel<config>),
         dim3(segments), dim3(block_size), 0, stream,
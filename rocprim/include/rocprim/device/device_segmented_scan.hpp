@@ -36,6 +36,7 @@
 
 #include "detail/config/device_scan.hpp"
 #include "detail/device_segmented_scan.hpp"
+#include "device_launch_trace.hpp"
 #include "device_scan.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
@@ -75,6 +76,7 @@ void segmented_scan_kernel(InputIterator input,
     { \
         auto _error = hipGetLastError(); \
         if(_error != hipSuccess) return _error; \
+        ::rocprim::detail::trace_launch_end(name, size); \
         if(debug_synchronous) \
         { \
             std::cout << name << "(" << size << ")"; \
@@ -136,6 +138,12 @@ hipError_t segmented_scan_impl(void * temporary_storage,
 
     std::chrono::high_resolution_clock::time_point start;
     if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    detail::trace_launch_begin("segmented_scan",
+                               dim3(segments),
+                               dim3(block_size),
+                               params.kernel_config.items_per_thread,
+                               0,
+                               stream);
     hipLaunchKernelGGL(
         HIP_KERNEL_NAME(segmented_scan_kernel<Exclusive, config, result_type>),
         dim3(segments), dim3(block_size), 0, stream,
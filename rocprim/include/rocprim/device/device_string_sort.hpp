@@ -0,0 +1,549 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_STRING_SORT_HPP_
+#define ROCPRIM_DEVICE_DEVICE_STRING_SORT_HPP_
+
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/discard_iterator.hpp"
+
+#include "detail/device_string_sort.hpp"
+#include "device_launch_trace.hpp"
+#include "device_radix_sort.hpp"
+#include "device_segmented_radix_sort.hpp"
+#include "device_select.hpp"
+#include "device_transform.hpp"
+
+#include <hip/hip_runtime.h>
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start)                           \
+    do                                                                                           \
+    {                                                                                            \
+        hipError_t _error = hipGetLastError();                                                   \
+        if(_error != hipSuccess)                                                                 \
+            return _error;                                                                       \
+        ::rocprim::detail::trace_launch_end(name, size);                                         \
+        if(debug_synchronous)                                                                    \
+        {                                                                                        \
+            std::cout << name << "(" << size << ")";                                             \
+            hipError_t __error = hipStreamSynchronize(stream);                                   \
+            if(__error != hipSuccess)                                                            \
+                return __error;                                                                  \
+            auto _end = std::chrono::steady_clock::now();                                        \
+            auto _d   = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start); \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n';                              \
+        }                                                                                        \
+    }                                                                                            \
+    while(0)
+
+template<class OffsetIterator>
+struct string_sort_gather_offsets_op
+{
+    OffsetIterator offsets;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    typename std::iterator_traits<OffsetIterator>::value_type
+        operator()(const unsigned int string) const
+    {
+        return offsets[string];
+    }
+};
+
+template<class OffsetIterator, class SortedOffsetsOutputIterator>
+inline hipError_t string_sort_gather_offsets(OffsetIterator              offsets,
+                                             const unsigned int*         permutation,
+                                             SortedOffsetsOutputIterator sorted_offsets_output,
+                                             const unsigned int          size,
+                                             const hipStream_t           stream,
+                                             const bool                  debug_synchronous)
+{
+    return ::rocprim::transform(permutation,
+                                sorted_offsets_output,
+                                size,
+                                string_sort_gather_offsets_op<OffsetIterator>{offsets},
+                                stream,
+                                debug_synchronous);
+}
+
+// Sorted offsets are not requested
+template<class OffsetIterator>
+inline hipError_t string_sort_gather_offsets(OffsetIterator,
+                                             const unsigned int*,
+                                             ::rocprim::discard_iterator,
+                                             const unsigned int,
+                                             const hipStream_t,
+                                             const bool)
+{
+    return hipSuccess;
+}
+
+template<class CharIterator,
+         class OffsetIterator,
+         class PermutationOutputIterator,
+         class SortedOffsetsOutputIterator>
+inline hipError_t string_sort_impl(void*                       temporary_storage,
+                                   size_t&                     storage_size,
+                                   CharIterator                chars,
+                                   OffsetIterator              offsets,
+                                   const unsigned int          size,
+                                   PermutationOutputIterator   permutation_output,
+                                   SortedOffsetsOutputIterator sorted_offsets_output,
+                                   const hipStream_t           stream,
+                                   const bool                  debug_synchronous)
+{
+    using char_type  = typename std::iterator_traits<CharIterator>::value_type;
+    using key_type   = string_sort_key_type;
+    using index_type = unsigned int;
+
+    static_assert(sizeof(char_type) == 1, "The value_type of CharIterator must be a byte.");
+
+    using prefix_op_type     = string_sort_prefix_op<CharIterator, OffsetIterator>;
+    using refine_key_op_type = string_sort_refine_key_op<CharIterator, OffsetIterator>;
+
+    constexpr unsigned int flag_heads_block_size       = string_sort_flag_heads_block_size;
+    constexpr unsigned int flag_heads_items_per_thread = string_sort_flag_heads_items_per_thread;
+    constexpr unsigned int flag_heads_items_per_block
+        = flag_heads_block_size * flag_heads_items_per_thread;
+
+    // Only groups of at least two strings are refined
+    const unsigned int max_segments = size / 2;
+
+    key_type*      keys            = nullptr;
+    key_type*      keys_next       = nullptr;
+    index_type*    permutation     = nullptr;
+    index_type*    permutation_tmp = nullptr;
+    unsigned char* heads           = nullptr;
+    index_type*    begin_offsets   = nullptr;
+    index_type*    end_offsets     = nullptr;
+    index_type*    segment_counts  = nullptr;
+
+    void*  sort_storage        = nullptr;
+    size_t sort_storage_size   = 0;
+    void*  refine_storage      = nullptr;
+    size_t refine_storage_size = 0;
+    void*  select_storage      = nullptr;
+    size_t select_storage_size = 0;
+
+    const ::rocprim::counting_iterator<index_type> positions(0);
+
+    hipError_t error = ::rocprim::radix_sort_pairs(nullptr,
+                                                   sort_storage_size,
+                                                   keys_next,
+                                                   keys,
+                                                   positions,
+                                                   permutation,
+                                                   size,
+                                                   0,
+                                                   8 * sizeof(key_type),
+                                                   stream,
+                                                   debug_synchronous);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    error = ::rocprim::segmented_radix_sort_pairs(nullptr,
+                                                  refine_storage_size,
+                                                  keys_next,
+                                                  keys,
+                                                  permutation,
+                                                  permutation_tmp,
+                                                  size,
+                                                  max_segments,
+                                                  begin_offsets,
+                                                  end_offsets,
+                                                  0,
+                                                  8 * sizeof(key_type),
+                                                  stream,
+                                                  debug_synchronous);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    error = ::rocprim::select(nullptr,
+                              select_storage_size,
+                              positions,
+                              begin_offsets,
+                              segment_counts,
+                              size,
+                              string_sort_segment_begin_op{keys, heads, size},
+                              stream,
+                              debug_synchronous);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&keys, size),
+            detail::temp_storage::ptr_aligned_array(&keys_next, size),
+            detail::temp_storage::ptr_aligned_array(&permutation, size),
+            detail::temp_storage::ptr_aligned_array(&permutation_tmp, size),
+            detail::temp_storage::ptr_aligned_array(&heads, size),
+            detail::temp_storage::ptr_aligned_array(&begin_offsets, max_segments),
+            detail::temp_storage::ptr_aligned_array(&end_offsets, max_segments),
+            detail::temp_storage::ptr_aligned_array(&segment_counts, 2),
+            detail::temp_storage::make_union_partition(
+                detail::temp_storage::make_partition(&sort_storage, sort_storage_size),
+                detail::temp_storage::make_partition(&refine_storage, refine_storage_size),
+                detail::temp_storage::make_partition(&select_storage, select_storage_size))));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(size == 0)
+    {
+        return hipSuccess;
+    }
+
+    std::chrono::steady_clock::time_point start;
+    const auto start_timer = [&start, debug_synchronous]()
+    {
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+    };
+
+    const unsigned int flag_heads_blocks = ceiling_div(size, flag_heads_items_per_block);
+
+    // Sort by the first chunk of every string
+    size_t depth = 0;
+
+    start_timer();
+    error = ::rocprim::transform(positions,
+                                 keys_next,
+                                 size,
+                                 prefix_op_type{chars, offsets, depth},
+                                 stream,
+                                 debug_synchronous);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("rocprim::transform", size, start);
+
+    start_timer();
+    error = ::rocprim::radix_sort_pairs(sort_storage,
+                                        sort_storage_size,
+                                        keys_next,
+                                        keys,
+                                        positions,
+                                        permutation,
+                                        size,
+                                        0,
+                                        8 * sizeof(key_type),
+                                        stream,
+                                        debug_synchronous);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("rocprim::radix_sort_pairs", size, start);
+
+    bool first_round = true;
+    while(true)
+    {
+        // Split the groups of equal strings by the chunk that was just sorted
+        start_timer();
+        detail::trace_launch_begin("string_sort",
+                                   dim3(flag_heads_blocks),
+                                   dim3(flag_heads_block_size),
+                                   flag_heads_items_per_thread,
+                                   0,
+                                   stream);
+        string_sort_flag_heads_kernel<flag_heads_block_size, flag_heads_items_per_thread>
+            <<<flag_heads_blocks, flag_heads_block_size, 0, stream>>>(keys,
+                                                                      heads,
+                                                                      size,
+                                                                      first_round);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("string_sort_flag_heads_kernel", size, start);
+        first_round = false;
+
+        // Every remaining group of two or more strings that did not end in the sorted chunk
+        // becomes a segment of the next refinement round
+        start_timer();
+        error = ::rocprim::select(select_storage,
+                                  select_storage_size,
+                                  positions,
+                                  begin_offsets,
+                                  segment_counts,
+                                  size,
+                                  string_sort_segment_begin_op{keys, heads, size},
+                                  stream,
+                                  debug_synchronous);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("rocprim::select", size, start);
+
+        start_timer();
+        error = ::rocprim::select(select_storage,
+                                  select_storage_size,
+                                  positions + 1,
+                                  end_offsets,
+                                  segment_counts + 1,
+                                  size,
+                                  string_sort_segment_end_op{keys, heads, size},
+                                  stream,
+                                  debug_synchronous);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("rocprim::select", size, start);
+
+        index_type segments;
+        error = detail::memcpy_and_sync(&segments,
+                                        segment_counts,
+                                        sizeof(segments),
+                                        hipMemcpyDeviceToHost,
+                                        stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        if(segments == 0)
+        {
+            break;
+        }
+
+        depth += string_sort_chunk_size;
+
+        start_timer();
+        error = ::rocprim::transform(
+            positions,
+            keys_next,
+            size,
+            refine_key_op_type{prefix_op_type{chars, offsets, depth}, permutation, heads, size},
+            stream,
+            debug_synchronous);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("rocprim::transform", size, start);
+
+        // The segmented sort only writes the segments, the rest of the permutation is carried
+        // over. The keys outside of the segments are left as they are, which keeps their groups
+        // intact when the heads are flagged again.
+        error = hipMemcpyAsync(permutation_tmp,
+                               permutation,
+                               size * sizeof(index_type),
+                               hipMemcpyDeviceToDevice,
+                               stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+
+        start_timer();
+        error = ::rocprim::segmented_radix_sort_pairs(refine_storage,
+                                                      refine_storage_size,
+                                                      keys_next,
+                                                      keys,
+                                                      permutation,
+                                                      permutation_tmp,
+                                                      size,
+                                                      segments,
+                                                      begin_offsets,
+                                                      end_offsets,
+                                                      0,
+                                                      8 * sizeof(key_type),
+                                                      stream,
+                                                      debug_synchronous);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("rocprim::segmented_radix_sort_pairs",
+                                                    size,
+                                                    start);
+
+        std::swap(permutation, permutation_tmp);
+    }
+
+    start_timer();
+    error = ::rocprim::transform(permutation,
+                                 permutation_output,
+                                 size,
+                                 ::rocprim::identity<index_type>(),
+                                 stream,
+                                 debug_synchronous);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("rocprim::transform", size, start);
+
+    return string_sort_gather_offsets(offsets,
+                                      permutation,
+                                      sorted_offsets_output,
+                                      size,
+                                      stream,
+                                      debug_synchronous);
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // namespace detail
+
+/// \brief Parallel lexicographic sort of strings for device level.
+///
+/// \p string_sort function computes the permutation that sorts a set of variable-length
+/// strings in ascending lexicographic order. The strings are stored back to back in a
+/// single character buffer, and string \p i consists of the characters in range
+/// <tt>[offsets[i], offsets[i + 1])</tt>.
+///
+/// The strings are first radix sorted by their first 8 characters. Groups of strings
+/// that share these characters are then refined by the next 8 characters with a segmented
+/// radix sort, and so on, until every group is resolved. Strings that share a long prefix
+/// therefore need several refinement rounds, each of which synchronizes with the host once.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * Characters are compared as unsigned bytes. A string that is a prefix of another string
+/// is ordered before it.
+/// * The strings must not contain zero characters, as zero is used to pad strings that end
+/// within a chunk of 8 characters.
+/// * The sort is stable: equal strings keep their relative order.
+/// * Range specified by \p offsets must have at least <tt>size + 1</tt> elements.
+/// * Ranges specified by \p permutation_output and \p sorted_offsets_output must have
+/// at least \p size elements.
+///
+/// \tparam CharIterator - random-access iterator type of the characters. It must be a
+/// random-access iterator whose \p value_type is one byte in size.
+/// \tparam OffsetIterator - random-access iterator type of the offsets of the strings.
+/// It must be a random-access iterator with an integral \p value_type.
+/// \tparam PermutationOutputIterator - random-access iterator type of the output permutation.
+/// It must be a random-access iterator that can accept values of type `unsigned int`.
+/// \tparam SortedOffsetsOutputIterator - random-access iterator type of the sorted offsets.
+/// Pass `rocprim::discard_iterator` to only compute the permutation.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] chars - iterator to the first character of the first string.
+/// \param [in] offsets - iterator to the offsets of the strings. The end of the last
+/// string is given by <tt>offsets[size]</tt>.
+/// \param [in] size - number of strings to sort.
+/// \param [out] permutation_output - iterator to the output permutation. The index of the
+/// string at sorted position \p i is written to <tt>permutation_output[i]</tt>.
+/// \param [out] sorted_offsets_output - iterator to the output offsets. The offset of the
+/// string at sorted position \p i is written to <tt>sorted_offsets_output[i]</tt>.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level string sort is performed on three strings.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int size;          // e.g., 3
+/// char * chars;               // e.g., "pearapplepeach"
+/// unsigned int * offsets;     // e.g., [0, 4, 9, 14]
+/// unsigned int * permutation; // empty array of 3 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::string_sort(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     chars, offsets, size, permutation, rocprim::discard_iterator()
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // sort the strings
+/// rocprim::string_sort(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     chars, offsets, size, permutation, rocprim::discard_iterator()
+/// );
+/// // permutation: [1, 2, 0]
+/// \endcode
+/// \endparblock
+template<class CharIterator,
+         class OffsetIterator,
+         class PermutationOutputIterator,
+         class SortedOffsetsOutputIterator>
+inline hipError_t string_sort(void*                       temporary_storage,
+                              size_t&                     storage_size,
+                              CharIterator                chars,
+                              OffsetIterator              offsets,
+                              unsigned int                size,
+                              PermutationOutputIterator   permutation_output,
+                              SortedOffsetsOutputIterator sorted_offsets_output,
+                              hipStream_t                 stream            = 0,
+                              bool                        debug_synchronous = false)
+{
+    return detail::string_sort_impl(temporary_storage,
+                                    storage_size,
+                                    chars,
+                                    offsets,
+                                    size,
+                                    permutation_output,
+                                    sorted_offsets_output,
+                                    stream,
+                                    debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_STRING_SORT_HPP_
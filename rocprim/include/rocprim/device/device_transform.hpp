@@ -31,6 +31,8 @@
 #include "../iterator/zip_iterator.hpp"
 #include "../types/tuple.hpp"
 
+#include "config_database.hpp"
+#include "device_launch_trace.hpp"
 #include "device_transform_config.hpp"
 #include "detail/device_transform.hpp"
 
@@ -60,6 +62,7 @@ ROCPRIM_KERNEL
     { \
         auto _error = hipGetLastError(); \
         if(_error != hipSuccess) return _error; \
+        ::rocprim::detail::trace_launch_end(name, size); \
         if(debug_synchronous) \
         { \
             std::cout << name << "(" << size << ")"; \
@@ -71,8 +74,90 @@ ROCPRIM_KERNEL
         } \
     }
 
+template<class Config, class InputIterator, class OutputIterator, class UnaryFunction>
+inline hipError_t transform_impl(InputIterator     input,
+                                 OutputIterator    output,
+                                 const size_t      size,
+                                 UnaryFunction     transform_op,
+                                 const hipStream_t stream,
+                                 bool              debug_synchronous)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    using result_type = typename ::rocprim::invoke_result<UnaryFunction, input_type>::type;
+
+    using config = detail::wrapped_transform_config<Config, result_type>;
+
+    detail::target_arch target_arch;
+    hipError_t          result = detail::host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const detail::transform_config_params params
+        = detail::dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size       = params.kernel_config.block_size;
+    const unsigned int items_per_thread = params.kernel_config.items_per_thread;
+    const auto         items_per_block  = block_size * items_per_thread;
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+
+    const auto size_limit             = params.kernel_config.size_limit;
+    const auto number_of_blocks_limit = ::rocprim::max<size_t>(size_limit / items_per_block, 1);
+
+    auto number_of_blocks = (size + items_per_block - 1)/items_per_block;
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "number of blocks limit " << number_of_blocks_limit << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+    }
+
+    const auto aligned_size_limit = number_of_blocks_limit * items_per_block;
+
+    // Launch number_of_blocks_limit blocks while there is still at least as many blocks left as the limit
+    const auto number_of_launch = (size + aligned_size_limit - 1) / aligned_size_limit;
+    for(size_t i = 0, offset = 0; i < number_of_launch; ++i, offset += aligned_size_limit) {
+        const auto current_size = std::min(size - offset, aligned_size_limit);
+        const auto current_blocks = (current_size + items_per_block - 1) / items_per_block;
+
+        if(debug_synchronous)
+            start = std::chrono::high_resolution_clock::now();
+        detail::trace_launch_begin("transform",
+                                   dim3(current_blocks),
+                                   dim3(block_size),
+                                   items_per_thread,
+                                   0,
+                                   stream);
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(detail::transform_kernel<config, result_type>),
+                           dim3(current_blocks),
+                           dim3(block_size),
+                           0,
+                           stream,
+                           input + offset,
+                           current_size,
+                           output + offset,
+                           transform_op);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("transform_kernel", current_size, start);
+    }
+
+    return hipSuccess;
+}
+
 } // end of detail namespace
 
+#ifndef DOXYGEN_SHOULD_SKIP_THIS // Do not document
+
+// The transform of two inputs is tuned when its binary operation is pure.
+template<class T1, class T2, class BinaryFunction>
+struct is_pure_operation<detail::unpack_binary_op<T1, T2, BinaryFunction>>
+    : is_pure_operation<BinaryFunction>
+{};
+
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
 /// \brief Parallel transform primitive for device level.
 ///
 /// transform function performs a device-wide transformation operation
@@ -81,7 +166,8 @@ ROCPRIM_KERNEL
 /// \par Overview
 /// * Ranges specified by \p input and \p output must have at least \p size elements.
 ///
-/// \tparam Config - [optional] configuration of the primitive. It has to be \p transform_config or a class derived from it.
+/// \tparam Config - [optional] configuration of the primitive. It has to be \p transform_config or a class derived from it,
+/// or a \p tuned_config of such configs.
 /// \tparam InputIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
@@ -143,59 +229,27 @@ inline hipError_t transform(InputIterator     input,
     using input_type = typename std::iterator_traits<InputIterator>::value_type;
     using result_type = typename ::rocprim::invoke_result<UnaryFunction, input_type>::type;
 
-    using config = detail::wrapped_transform_config<Config, result_type>;
-
-    detail::target_arch target_arch;
-    hipError_t          result = detail::host_target_arch(stream, target_arch);
-    if(result != hipSuccess)
-    {
-        return result;
-    }
-    const detail::transform_config_params params
-        = detail::dispatch_target_arch<config>(target_arch);
+    using size_buckets
+        = detail::size_bucket_table<detail::default_transform_size_buckets, result_type>;
 
-    const unsigned int block_size       = params.kernel_config.block_size;
-    const unsigned int items_per_thread = params.kernel_config.items_per_thread;
-    const auto         items_per_block  = block_size * items_per_thread;
-
-    // Start point for time measurements
-    std::chrono::high_resolution_clock::time_point start;
-
-    const auto size_limit             = params.kernel_config.size_limit;
-    const auto number_of_blocks_limit = ::rocprim::max<size_t>(size_limit / items_per_block, 1);
-
-    auto number_of_blocks = (size + items_per_block - 1)/items_per_block;
-    if(debug_synchronous)
-    {
-        std::cout << "block_size " << block_size << '\n';
-        std::cout << "number of blocks " << number_of_blocks << '\n';
-        std::cout << "number of blocks limit " << number_of_blocks_limit << '\n';
-        std::cout << "items_per_block " << items_per_block << '\n';
-    }
-
-    const auto aligned_size_limit = number_of_blocks_limit * items_per_block;
-
-    // Launch number_of_blocks_limit blocks while there is still at least as many blocks left as the limit
-    const auto number_of_launch = (size + aligned_size_limit - 1) / aligned_size_limit;
-    for(size_t i = 0, offset = 0; i < number_of_launch; ++i, offset += aligned_size_limit) {
-        const auto current_size = std::min(size - offset, aligned_size_limit);
-        const auto current_blocks = (current_size + items_per_block - 1) / items_per_block;
-
-        if(debug_synchronous)
-            start = std::chrono::high_resolution_clock::now();
-        hipLaunchKernelGGL(HIP_KERNEL_NAME(detail::transform_kernel<config, result_type>),
-                           dim3(current_blocks),
-                           dim3(block_size),
-                           0,
-                           stream,
-                           input + offset,
-                           current_size,
-                           output + offset,
-                           transform_op);
-        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("transform_kernel", current_size, start);
-    }
-
-    return hipSuccess;
+    return detail::dispatch_config_database<Config, size_buckets, input_type, result_type>(
+        "transform",
+        size,
+        stream,
+        nullptr,
+        nullptr,
+        is_pure_operation<UnaryFunction>::value
+            && !detail::can_iterators_alias(input, output, size),
+        [&](auto config_tag)
+        {
+            using config = typename decltype(config_tag)::type;
+            return detail::transform_impl<config>(input,
+                                                  output,
+                                                  size,
+                                                  transform_op,
+                                                  stream,
+                                                  debug_synchronous);
+        });
 }
 
 /// \brief Parallel device-level transform primitive for two inputs.
@@ -206,7 +260,8 @@ inline hipError_t transform(InputIterator     input,
 /// \par Overview
 /// * Ranges specified by \p input1, \p input2, and \p output must have at least \p size elements.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `transform_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `transform_config`
+/// or a `tuned_config` of `transform_config`s.
 /// \tparam InputIterator1 - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam InputIterator2 - random-access iterator type of the input range. Must meet the
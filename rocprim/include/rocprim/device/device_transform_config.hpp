@@ -62,6 +62,19 @@ struct wrapped_transform_config<default_config, Value>
     };
 };
 
+template<unsigned int Bucket, typename Value>
+struct wrapped_transform_config<default_size_bucket_config<Bucket>, Value>
+{
+    template<target_arch Arch>
+    struct architecture_config
+    {
+        static constexpr transform_config_params params = typename select_size_bucket<
+            Bucket,
+            typename default_transform_size_buckets<static_cast<unsigned int>(Arch), Value>::buckets,
+            default_transform_config<static_cast<unsigned int>(Arch), Value>>::type{};
+    };
+};
+
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 template<typename TransformConfig, typename Value>
 template<target_arch Arch>
@@ -72,6 +85,12 @@ template<typename Value>
 template<target_arch Arch>
 constexpr transform_config_params
     wrapped_transform_config<default_config, Value>::architecture_config<Arch>::params;
+
+template<unsigned int Bucket, typename Value>
+template<target_arch Arch>
+constexpr transform_config_params
+    wrapped_transform_config<default_size_bucket_config<Bucket>, Value>::architecture_config<
+        Arch>::params;
 #endif // DOXYGEN_SHOULD_SKIP_THIS
 
 } // end namespace detail
@@ -22,6 +22,7 @@
 #define ROCPRIM_DEVICE_SPECIALIZATION_DEVICE_RADIX_SINGLE_SORT_HPP_
 
 #include "../detail/device_radix_sort.hpp"
+#include "../device_launch_trace.hpp"
 #include "../device_radix_sort_config.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
@@ -34,6 +35,7 @@ namespace detail
         auto _error = hipGetLastError();                                                         \
         if(_error != hipSuccess)                                                                 \
             return _error;                                                                       \
+        ::rocprim::detail::trace_launch_end(name, size);                                         \
         if(debug_synchronous)                                                                    \
         {                                                                                        \
             std::cout << name << "(" << size << ")";                                             \
@@ -129,6 +131,12 @@ inline hipError_t radix_sort_block_sort(KeysInputIterator    keys_input,
         start = std::chrono::high_resolution_clock::now();
     }
 
+    detail::trace_launch_begin("radix_sort",
+                               dim3(sort_number_of_blocks),
+                               dim3(params.block_size),
+                               params.items_per_thread,
+                               0,
+                               stream);
     radix_sort_block_sort_kernel<config, Descending>
         <<<dim3(sort_number_of_blocks), dim3(params.block_size), 0, stream>>>(keys_input,
                                                                               keys_output,
@@ -71,6 +71,24 @@ ROCPRIM_HOST_DEVICE ROCPRIM_INLINE unsigned int ctz(unsigned long long x)
     return __builtin_ctzll(x);
 }
 
+/// \brief Count leading zeroes
+///
+/// Count the number of consecutive 0-bits, starting from the
+/// most significant bit. The result is undefined if \p x is zero.
+ROCPRIM_HOST_DEVICE ROCPRIM_INLINE unsigned int clz(unsigned int x)
+{
+    return __builtin_clz(x);
+}
+
+/// \brief Count leading zeroes
+///
+/// Count the number of consecutive 0-bits, starting from the
+/// most significant bit. The result is undefined if \p x is zero.
+ROCPRIM_HOST_DEVICE ROCPRIM_INLINE unsigned int clz(unsigned long long x)
+{
+    return __builtin_clzll(x);
+}
+
 /// @}
 // end of group intrinsicsmodule
 
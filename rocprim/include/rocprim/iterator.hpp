@@ -25,14 +25,21 @@
 #include "config.hpp"
 
 #include "iterator/arg_index_iterator.hpp"
+#include "iterator/cache_modified_input_iterator.hpp"
+#include "iterator/cache_modified_output_iterator.hpp"
 #include "iterator/constant_iterator.hpp"
 #include "iterator/counting_iterator.hpp"
 #include "iterator/discard_iterator.hpp"
+#include "iterator/permutation_iterator.hpp"
+#include "iterator/pitched_2d_iterator.hpp"
 #include "iterator/predicate_iterator.hpp"
+#include "iterator/strided_iterator.hpp"
+#include "iterator/tabulate_output_iterator.hpp"
 #ifndef __HIP_CPU_RT__
 #include "iterator/texture_cache_iterator.hpp"
 #endif
 #include "iterator/transform_iterator.hpp"
+#include "iterator/transform_output_iterator.hpp"
 #include "iterator/zip_iterator.hpp"
 
 #endif // ROCPRIM_ITERATOR_HPP_
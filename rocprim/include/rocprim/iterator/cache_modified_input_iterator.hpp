@@ -0,0 +1,253 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_CACHE_MODIFIED_INPUT_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_CACHE_MODIFIED_INPUT_ITERATOR_HPP_
+
+#include <iterator>
+#include <cstddef>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../thread/thread_load.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \class cache_modified_input_iterator
+/// \brief A random-access input (read-only) iterator adaptor for dereferencing array values
+/// with a cache modifier.
+///
+/// \par Overview
+/// * A cache_modified_input_iterator wraps a device pointer of type T, where values are
+/// obtained by dereferencing with the load instruction selected by \p Modifier.
+/// * Inputs that are read exactly once can be loaded with \p load_cs (non-temporal), so that
+/// they do not evict data that is reused from the caches.
+/// * Can be exchanged and manipulated within and between host and device functions, but
+/// the modifier only applies when it is dereferenced within device functions.
+/// * \p block_load with \p block_load_method::block_load_vectorize still uses vector loads,
+/// which are issued with the same modifier.
+///
+/// \tparam Modifier - the cache load modifier, one of \p cache_load_modifier.
+/// \tparam T - type of value that can be obtained by dereferencing the iterator.
+/// \tparam Difference - a type used for identify distance between iterators.
+template<
+    cache_load_modifier Modifier,
+    class T,
+    class Difference = std::ptrdiff_t
+>
+class cache_modified_input_iterator
+{
+public:
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    using value_type = typename std::remove_const<T>::type;
+    /// \brief A reference type of the type iterated over (\p value_type).
+    /// Values are returned by value, since they are loaded with the cache modifier.
+    using reference = value_type;
+    /// \brief A pointer type of the type iterated over (\p value_type).
+    using pointer = const value_type*;
+    /// A type used for identify distance between iterators.
+    using difference_type = Difference;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    using self_type = cache_modified_input_iterator;
+#endif
+
+    ROCPRIM_HOST_DEVICE inline
+    ~cache_modified_input_iterator() = default;
+
+    /// \brief Creates a new cache_modified_input_iterator.
+    ///
+    /// \param ptr pointer to the values loaded with the cache modifier.
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator(const value_type* ptr)
+        : ptr_(ptr)
+    {
+    }
+
+    /// \brief Returns the underlying pointer.
+    ROCPRIM_HOST_DEVICE inline
+    pointer base() const
+    {
+        return ptr_;
+    }
+
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator& operator++()
+    {
+        ptr_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator operator++(int)
+    {
+        cache_modified_input_iterator old = *this;
+        ptr_++;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator& operator--()
+    {
+        ptr_--;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator operator--(int)
+    {
+        cache_modified_input_iterator old = *this;
+        ptr_--;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    value_type operator*() const
+    {
+        #ifndef __HIP_DEVICE_COMPILE__
+        return *ptr_;
+        #else
+        return detail::cache_modified_load<Modifier>(ptr_);
+        #endif
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    value_type operator[](difference_type distance) const
+    {
+        cache_modified_input_iterator i = (*this) + distance;
+        return *i;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator operator+(difference_type distance) const
+    {
+        return cache_modified_input_iterator(ptr_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator& operator+=(difference_type distance)
+    {
+        ptr_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator operator-(difference_type distance) const
+    {
+        return cache_modified_input_iterator(ptr_ - distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator& operator-=(difference_type distance)
+    {
+        ptr_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(cache_modified_input_iterator other) const
+    {
+        return ptr_ - other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(cache_modified_input_iterator other) const
+    {
+        return ptr_ == other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(cache_modified_input_iterator other) const
+    {
+        return ptr_ != other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(cache_modified_input_iterator other) const
+    {
+        return ptr_ < other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(cache_modified_input_iterator other) const
+    {
+        return ptr_ <= other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(cache_modified_input_iterator other) const
+    {
+        return ptr_ > other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(cache_modified_input_iterator other) const
+    {
+        return ptr_ >= other.ptr_;
+    }
+    #endif // DOXYGEN_SHOULD_SKIP_THIS
+
+private:
+    const value_type* ptr_;
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<cache_load_modifier Modifier, class T, class Difference>
+ROCPRIM_HOST_DEVICE inline
+cache_modified_input_iterator<Modifier, T, Difference>
+operator+(typename cache_modified_input_iterator<Modifier, T, Difference>::difference_type distance,
+          const cache_modified_input_iterator<Modifier, T, Difference>& iterator)
+{
+    return iterator + distance;
+}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// make_cache_modified_input_iterator creates a cache_modified_input_iterator which loads
+/// the values pointed by \p ptr with the cache modifier \p Modifier.
+///
+/// \tparam Modifier - the cache load modifier.
+/// \tparam T - type of the values.
+///
+/// \param ptr - pointer to the values.
+/// \return A new cache_modified_input_iterator object which loads the values pointed by
+/// \p ptr with the cache modifier \p Modifier.
+template<
+    cache_load_modifier Modifier,
+    class T
+>
+ROCPRIM_HOST_DEVICE inline
+cache_modified_input_iterator<Modifier, T>
+make_cache_modified_input_iterator(const T* ptr)
+{
+    return cache_modified_input_iterator<Modifier, T>(ptr);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group iteratormodule
+
+#endif // ROCPRIM_ITERATOR_CACHE_MODIFIED_INPUT_ITERATOR_HPP_
@@ -0,0 +1,279 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_CACHE_MODIFIED_OUTPUT_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_CACHE_MODIFIED_OUTPUT_ITERATOR_HPP_
+
+#include <iterator>
+#include <cstddef>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../thread/thread_store.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \class cache_modified_output_iterator
+/// \brief A random-access output (write-only) iterator adaptor for storing values
+/// with a cache modifier.
+///
+/// \par Overview
+/// * A cache_modified_output_iterator wraps a device pointer of type T, where values assigned
+/// to it are stored with the store instruction selected by \p Modifier.
+/// * Outputs that are not read again by the kernel can be stored with \p store_cs
+/// (non-temporal), so that they do not evict data that is reused from the caches.
+/// * Can be exchanged and manipulated within and between host and device functions, but
+/// the modifier only applies when it is assigned to within device functions.
+/// * Its \p value_type is \p void, so algorithms which derive the type of intermediate results
+/// from the output iterator use the type of their input instead.
+/// * \p block_store with \p block_store_method::block_store_vectorize still uses vector stores,
+/// which are issued with the same modifier.
+///
+/// \tparam Modifier - the cache store modifier, one of \p cache_store_modifier.
+/// \tparam T - type of the values stored to the underlying pointer.
+/// \tparam Difference - a type used for identify distance between iterators.
+template<
+    cache_store_modifier Modifier,
+    class T,
+    class Difference = std::ptrdiff_t
+>
+class cache_modified_output_iterator
+{
+public:
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS // Skip internal implementation details.
+    class proxy
+    {
+    public:
+        ROCPRIM_HOST_DEVICE inline
+        proxy(T* ptr)
+            : ptr_(ptr)
+        {
+        }
+
+        template<class U>
+        ROCPRIM_HOST_DEVICE inline
+        proxy& operator=(const U& value)
+        {
+            #ifndef __HIP_DEVICE_COMPILE__
+            *ptr_ = value;
+            #else
+            detail::cache_modified_store<Modifier>(ptr_, static_cast<T>(value));
+            #endif
+            return *this;
+        }
+
+    private:
+        T* ptr_;
+    };
+    #endif // DOXYGEN_SHOULD_SKIP_THIS
+
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    /// It's \p void since cache_modified_output_iterator is a write-only iterator.
+    using value_type = void;
+    /// \brief A reference type of the type iterated over. It's a proxy object which
+    /// stores the values assigned to it with the cache modifier.
+    using reference = proxy;
+    /// \brief A pointer type of the type iterated over (\p value_type).
+    using pointer = void;
+    /// A type used for identify distance between iterators.
+    using difference_type = Difference;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    using self_type = cache_modified_output_iterator;
+#endif
+
+    ROCPRIM_HOST_DEVICE inline
+    ~cache_modified_output_iterator() = default;
+
+    /// \brief Creates a new cache_modified_output_iterator.
+    ///
+    /// \param ptr pointer to which the values are stored with the cache modifier.
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_output_iterator(T* ptr)
+        : ptr_(ptr)
+    {
+    }
+
+    /// \brief Returns the underlying pointer.
+    ROCPRIM_HOST_DEVICE inline
+    T* base() const
+    {
+        return ptr_;
+    }
+
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_output_iterator& operator++()
+    {
+        ptr_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_output_iterator operator++(int)
+    {
+        cache_modified_output_iterator old = *this;
+        ptr_++;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_output_iterator& operator--()
+    {
+        ptr_--;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_output_iterator operator--(int)
+    {
+        cache_modified_output_iterator old = *this;
+        ptr_--;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator*() const
+    {
+        return reference(ptr_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator[](difference_type distance) const
+    {
+        cache_modified_output_iterator i = (*this) + distance;
+        return *i;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_output_iterator operator+(difference_type distance) const
+    {
+        return cache_modified_output_iterator(ptr_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_output_iterator& operator+=(difference_type distance)
+    {
+        ptr_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_output_iterator operator-(difference_type distance) const
+    {
+        return cache_modified_output_iterator(ptr_ - distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_output_iterator& operator-=(difference_type distance)
+    {
+        ptr_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(cache_modified_output_iterator other) const
+    {
+        return ptr_ - other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(cache_modified_output_iterator other) const
+    {
+        return ptr_ == other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(cache_modified_output_iterator other) const
+    {
+        return ptr_ != other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(cache_modified_output_iterator other) const
+    {
+        return ptr_ < other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(cache_modified_output_iterator other) const
+    {
+        return ptr_ <= other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(cache_modified_output_iterator other) const
+    {
+        return ptr_ > other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(cache_modified_output_iterator other) const
+    {
+        return ptr_ >= other.ptr_;
+    }
+    #endif // DOXYGEN_SHOULD_SKIP_THIS
+
+private:
+    T* ptr_;
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<cache_store_modifier Modifier, class T, class Difference>
+ROCPRIM_HOST_DEVICE inline
+cache_modified_output_iterator<Modifier, T, Difference>
+operator+(typename cache_modified_output_iterator<Modifier, T, Difference>::difference_type distance,
+          const cache_modified_output_iterator<Modifier, T, Difference>& iterator)
+{
+    return iterator + distance;
+}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// make_cache_modified_output_iterator creates a cache_modified_output_iterator which stores
+/// the values assigned to it to \p ptr with the cache modifier \p Modifier.
+///
+/// \tparam Modifier - the cache store modifier.
+/// \tparam T - type of the values.
+///
+/// \param ptr - pointer to which the values are stored.
+/// \return A new cache_modified_output_iterator object which stores the values assigned to it
+/// to the range pointed by \p ptr with the cache modifier \p Modifier.
+template<
+    cache_store_modifier Modifier,
+    class T
+>
+ROCPRIM_HOST_DEVICE inline
+cache_modified_output_iterator<Modifier, T>
+make_cache_modified_output_iterator(T* ptr)
+{
+    return cache_modified_output_iterator<Modifier, T>(ptr);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group iteratormodule
+
+#endif // ROCPRIM_ITERATOR_CACHE_MODIFIED_OUTPUT_ITERATOR_HPP_
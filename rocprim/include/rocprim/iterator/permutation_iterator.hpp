@@ -0,0 +1,279 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_PERMUTATION_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_PERMUTATION_ITERATOR_HPP_
+
+#include <iterator>
+#include <cstddef>
+#include <type_traits>
+
+#include "../config.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \class permutation_iterator
+/// \brief A random-access iterator adaptor which accesses a range in the order given by
+/// a range of indices.
+///
+/// \par Overview
+/// * Dereferencing a permutation_iterator at position \p i yields
+/// <tt>values[indices[i]]</tt>, so it can be used to gather (or scatter, if \p ValueIterator
+/// is writable) values without materializing the permuted range.
+/// * \p block_load functions recognise permutation_iterator: the indices are loaded first with
+/// the access pattern of the load method, and all gathers of a thread are then issued together.
+/// * If \p SortedIndices is \p true, the indices must be strictly increasing (for example
+/// the positions of selected items). Threads whose indices in a blocked arrangement are
+/// consecutive then load the values as a contiguous range, with vector loads when possible.
+///
+/// \tparam ValueIterator - type of the iterator of the permuted range. Must be
+/// a random-access iterator.
+/// \tparam IndexIterator - type of the iterator of the indices. Must be a random-access
+/// iterator with an integral \p value_type.
+/// \tparam SortedIndices - whether the indices are strictly increasing. Default is \p false.
+template<class ValueIterator, class IndexIterator, bool SortedIndices = false>
+class permutation_iterator
+{
+public:
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    using value_type = typename std::iterator_traits<ValueIterator>::value_type;
+    /// \brief A reference type of the type iterated over (\p value_type).
+    using reference = typename std::iterator_traits<ValueIterator>::reference;
+    /// \brief A pointer type of the type iterated over (\p value_type).
+    using pointer = typename std::iterator_traits<ValueIterator>::pointer;
+    /// A type used for identify distance between iterators.
+    using difference_type = typename std::iterator_traits<IndexIterator>::difference_type;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+    /// The type of the indices.
+    using index_type = typename std::iterator_traits<IndexIterator>::value_type;
+    /// Whether the indices are strictly increasing.
+    static constexpr bool sorted_indices = SortedIndices;
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    using self_type = permutation_iterator;
+#endif
+
+    static_assert(std::is_integral<index_type>::value, "Indices must be of integral type");
+
+    ROCPRIM_HOST_DEVICE inline
+    ~permutation_iterator() = default;
+
+    /// \brief Creates a new permutation_iterator.
+    ///
+    /// \param values iterator of the permuted range.
+    /// \param indices iterator of the indices into \p values.
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator(ValueIterator values, IndexIterator indices)
+        : values_(values), indices_(indices)
+    {
+    }
+
+    /// \brief Returns the iterator of the permuted range.
+    ROCPRIM_HOST_DEVICE inline
+    ValueIterator value_iterator() const
+    {
+        return values_;
+    }
+
+    /// \brief Returns the iterator of the indices at the current position.
+    ROCPRIM_HOST_DEVICE inline
+    IndexIterator index_iterator() const
+    {
+        return indices_;
+    }
+
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator& operator++()
+    {
+        indices_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator operator++(int)
+    {
+        permutation_iterator old = *this;
+        indices_++;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator& operator--()
+    {
+        indices_--;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator operator--(int)
+    {
+        permutation_iterator old = *this;
+        indices_--;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator*() const
+    {
+        return values_[*indices_];
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator[](difference_type distance) const
+    {
+        return values_[indices_[distance]];
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator operator+(difference_type distance) const
+    {
+        return permutation_iterator(values_, indices_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator& operator+=(difference_type distance)
+    {
+        indices_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator operator-(difference_type distance) const
+    {
+        return permutation_iterator(values_, indices_ - distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator& operator-=(difference_type distance)
+    {
+        indices_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(permutation_iterator other) const
+    {
+        return indices_ - other.indices_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(permutation_iterator other) const
+    {
+        return indices_ == other.indices_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(permutation_iterator other) const
+    {
+        return indices_ != other.indices_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(permutation_iterator other) const
+    {
+        return indices_ < other.indices_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(permutation_iterator other) const
+    {
+        return indices_ <= other.indices_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(permutation_iterator other) const
+    {
+        return indices_ > other.indices_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(permutation_iterator other) const
+    {
+        return indices_ >= other.indices_;
+    }
+    #endif // DOXYGEN_SHOULD_SKIP_THIS
+
+private:
+    ValueIterator values_;
+    IndexIterator indices_;
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<class ValueIterator, class IndexIterator, bool SortedIndices>
+ROCPRIM_HOST_DEVICE inline
+permutation_iterator<ValueIterator, IndexIterator, SortedIndices>
+operator+(typename permutation_iterator<ValueIterator, IndexIterator, SortedIndices>::difference_type distance,
+          const permutation_iterator<ValueIterator, IndexIterator, SortedIndices>& iterator)
+{
+    return iterator + distance;
+}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// make_permutation_iterator creates a permutation_iterator which accesses \p values
+/// in the order given by \p indices.
+///
+/// \tparam ValueIterator - type of the iterator of the permuted range.
+/// \tparam IndexIterator - type of the iterator of the indices.
+///
+/// \param values - iterator of the permuted range.
+/// \param indices - iterator of the indices into \p values.
+/// \return A new permutation_iterator object.
+template<
+    class ValueIterator,
+    class IndexIterator
+>
+ROCPRIM_HOST_DEVICE inline
+permutation_iterator<ValueIterator, IndexIterator>
+make_permutation_iterator(ValueIterator values, IndexIterator indices)
+{
+    return permutation_iterator<ValueIterator, IndexIterator>(values, indices);
+}
+
+/// make_sorted_permutation_iterator creates a permutation_iterator which accesses \p values
+/// in the order given by strictly increasing \p indices, see permutation_iterator.
+///
+/// \tparam ValueIterator - type of the iterator of the permuted range.
+/// \tparam IndexIterator - type of the iterator of the indices.
+///
+/// \param values - iterator of the permuted range.
+/// \param indices - iterator of the strictly increasing indices into \p values.
+/// \return A new permutation_iterator object.
+template<
+    class ValueIterator,
+    class IndexIterator
+>
+ROCPRIM_HOST_DEVICE inline
+permutation_iterator<ValueIterator, IndexIterator, true>
+make_sorted_permutation_iterator(ValueIterator values, IndexIterator indices)
+{
+    return permutation_iterator<ValueIterator, IndexIterator, true>(values, indices);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group iteratormodule
+
+#endif // ROCPRIM_ITERATOR_PERMUTATION_ITERATOR_HPP_
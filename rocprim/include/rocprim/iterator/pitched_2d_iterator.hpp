@@ -0,0 +1,272 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_PITCHED_2D_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_PITCHED_2D_ITERATOR_HPP_
+
+#include <iterator>
+#include <cstddef>
+#include <type_traits>
+
+#include "../config.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \class pitched_2d_iterator
+/// \brief A random-access iterator adaptor which visits the elements of a 2D region of
+/// a row-major range with a row pitch in row-major order.
+///
+/// \par Overview
+/// * A pitched_2d_iterator over \p iterator with \p width and \p pitch dereferences to
+/// <tt>iterator[(i / width) * pitch + i % width]</tt> at position \p i, so a sub-matrix or
+/// a padded matrix can be processed by device algorithms like a continuous range.
+/// * \p block_load walks the rows of the region for all items of a thread after a single
+/// division, instead of dividing for every item.
+/// * The pitch is the distance in items between the starts of consecutive rows.
+///
+/// \tparam Iterator - type of the underlying random-access iterator.
+template<class Iterator>
+class pitched_2d_iterator
+{
+public:
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    using value_type = typename std::iterator_traits<Iterator>::value_type;
+    /// \brief A reference type of the type iterated over (\p value_type).
+    using reference = typename std::iterator_traits<Iterator>::reference;
+    /// \brief A pointer type of the type iterated over (\p value_type).
+    using pointer = typename std::iterator_traits<Iterator>::pointer;
+    /// A type used for identify distance between iterators.
+    using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    using self_type = pitched_2d_iterator;
+#endif
+
+    ROCPRIM_HOST_DEVICE inline
+    ~pitched_2d_iterator() = default;
+
+    /// \brief Creates a new pitched_2d_iterator.
+    ///
+    /// \param iterator the underlying iterator, pointing to the first element of the region.
+    /// \param width the number of visited elements of every row.
+    /// \param pitch the distance in items between the starts of consecutive rows.
+    /// \param index the position of the created iterator within the region.
+    ROCPRIM_HOST_DEVICE inline
+    pitched_2d_iterator(Iterator        iterator,
+                        unsigned int    width,
+                        unsigned int    pitch,
+                        difference_type index = 0)
+        : iterator_(iterator), width_(width), pitch_(pitch), index_(index)
+    {
+    }
+
+    /// \brief Returns the underlying iterator, pointing to the first element of the region.
+    ROCPRIM_HOST_DEVICE inline
+    Iterator base() const
+    {
+        return iterator_;
+    }
+
+    /// \brief Returns the number of visited elements of every row.
+    ROCPRIM_HOST_DEVICE inline
+    unsigned int width() const
+    {
+        return width_;
+    }
+
+    /// \brief Returns the distance in items between the starts of consecutive rows.
+    ROCPRIM_HOST_DEVICE inline
+    unsigned int pitch() const
+    {
+        return pitch_;
+    }
+
+    /// \brief Returns the position of the iterator within the region.
+    ROCPRIM_HOST_DEVICE inline
+    difference_type index() const
+    {
+        return index_;
+    }
+
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS
+    ROCPRIM_HOST_DEVICE inline
+    pitched_2d_iterator& operator++()
+    {
+        index_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    pitched_2d_iterator operator++(int)
+    {
+        pitched_2d_iterator old = *this;
+        index_++;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    pitched_2d_iterator& operator--()
+    {
+        index_--;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    pitched_2d_iterator operator--(int)
+    {
+        pitched_2d_iterator old = *this;
+        index_--;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator*() const
+    {
+        return iterator_[offset(index_)];
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator[](difference_type distance) const
+    {
+        return iterator_[offset(index_ + distance)];
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    pitched_2d_iterator operator+(difference_type distance) const
+    {
+        return pitched_2d_iterator(iterator_, width_, pitch_, index_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    pitched_2d_iterator& operator+=(difference_type distance)
+    {
+        index_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    pitched_2d_iterator operator-(difference_type distance) const
+    {
+        return pitched_2d_iterator(iterator_, width_, pitch_, index_ - distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    pitched_2d_iterator& operator-=(difference_type distance)
+    {
+        index_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(pitched_2d_iterator other) const
+    {
+        return index_ - other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(pitched_2d_iterator other) const
+    {
+        return index_ == other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(pitched_2d_iterator other) const
+    {
+        return index_ != other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(pitched_2d_iterator other) const
+    {
+        return index_ < other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(pitched_2d_iterator other) const
+    {
+        return index_ <= other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(pitched_2d_iterator other) const
+    {
+        return index_ > other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(pitched_2d_iterator other) const
+    {
+        return index_ >= other.index_;
+    }
+    #endif // DOXYGEN_SHOULD_SKIP_THIS
+
+private:
+    ROCPRIM_HOST_DEVICE inline
+    difference_type offset(difference_type index) const
+    {
+        return (index / width_) * pitch_ + index % width_;
+    }
+
+    Iterator        iterator_;
+    unsigned int    width_;
+    unsigned int    pitch_;
+    difference_type index_;
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<class Iterator>
+ROCPRIM_HOST_DEVICE inline
+pitched_2d_iterator<Iterator>
+operator+(typename pitched_2d_iterator<Iterator>::difference_type distance,
+          const pitched_2d_iterator<Iterator>& iterator)
+{
+    return iterator + distance;
+}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// make_pitched_2d_iterator creates a pitched_2d_iterator which visits the first \p width
+/// elements of every row of the range pointed by \p iterator, whose rows are \p pitch items
+/// apart.
+///
+/// \tparam Iterator - type of the underlying random-access iterator.
+///
+/// \param iterator - the underlying iterator, pointing to the first element of the region.
+/// \param width - the number of visited elements of every row.
+/// \param pitch - the distance in items between the starts of consecutive rows.
+/// \return A new pitched_2d_iterator object.
+template<class Iterator>
+ROCPRIM_HOST_DEVICE inline
+pitched_2d_iterator<Iterator>
+make_pitched_2d_iterator(Iterator iterator, unsigned int width, unsigned int pitch)
+{
+    return pitched_2d_iterator<Iterator>(iterator, width, pitch);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group iteratormodule
+
+#endif // ROCPRIM_ITERATOR_PITCHED_2D_ITERATOR_HPP_
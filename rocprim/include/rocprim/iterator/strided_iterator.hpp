@@ -0,0 +1,266 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_STRIDED_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_STRIDED_ITERATOR_HPP_
+
+#include <iterator>
+#include <cstddef>
+#include <type_traits>
+
+#include "../config.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \class strided_iterator
+/// \brief A random-access iterator adaptor which visits every stride-th element of
+/// the underlying range.
+///
+/// \par Overview
+/// * A strided_iterator over \p iterator dereferences to <tt>iterator[i * stride]</tt> at
+/// position \p i, for example one column of a row-major matrix, where the stride is the
+/// length of a row, or one channel of an interleaved buffer.
+/// * The stride is either known at compile time (\p Stride is not zero), or given when
+/// the iterator is created (\p Stride is zero).
+/// * When the underlying iterator is a pointer and the stride is known at compile time and
+/// small, loading a blocked arrangement with \p block_load loads the items of a thread
+/// with wide vector loads and selects them in registers.
+/// * The stride must be positive.
+///
+/// \tparam Iterator - type of the underlying random-access iterator.
+/// \tparam Stride - the stride if it is known at compile time, otherwise zero.
+template<class Iterator, unsigned int Stride = 0>
+class strided_iterator
+{
+public:
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    using value_type = typename std::iterator_traits<Iterator>::value_type;
+    /// \brief A reference type of the type iterated over (\p value_type).
+    using reference = typename std::iterator_traits<Iterator>::reference;
+    /// \brief A pointer type of the type iterated over (\p value_type).
+    using pointer = typename std::iterator_traits<Iterator>::pointer;
+    /// A type used for identify distance between iterators.
+    using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    using self_type = strided_iterator;
+#endif
+
+    ROCPRIM_HOST_DEVICE inline
+    ~strided_iterator() = default;
+
+    /// \brief Creates a new strided_iterator.
+    ///
+    /// \param iterator the underlying iterator, pointing to the first visited element.
+    /// \param stride the distance between the visited elements. It is ignored if \p Stride
+    /// is not zero.
+    ROCPRIM_HOST_DEVICE inline
+    strided_iterator(Iterator iterator, difference_type stride = Stride)
+        : iterator_(iterator), stride_(Stride != 0 ? static_cast<difference_type>(Stride) : stride)
+    {
+    }
+
+    /// \brief Returns the underlying iterator at the current position.
+    ROCPRIM_HOST_DEVICE inline
+    Iterator base() const
+    {
+        return iterator_;
+    }
+
+    /// \brief Returns the distance between the visited elements.
+    ROCPRIM_HOST_DEVICE inline
+    difference_type stride() const
+    {
+        return Stride != 0 ? static_cast<difference_type>(Stride) : stride_;
+    }
+
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS
+    ROCPRIM_HOST_DEVICE inline
+    strided_iterator& operator++()
+    {
+        iterator_ += stride();
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    strided_iterator operator++(int)
+    {
+        strided_iterator old = *this;
+        iterator_ += stride();
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    strided_iterator& operator--()
+    {
+        iterator_ -= stride();
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    strided_iterator operator--(int)
+    {
+        strided_iterator old = *this;
+        iterator_ -= stride();
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator*() const
+    {
+        return *iterator_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator[](difference_type distance) const
+    {
+        return iterator_[distance * stride()];
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    strided_iterator operator+(difference_type distance) const
+    {
+        return strided_iterator(iterator_ + distance * stride(), stride());
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    strided_iterator& operator+=(difference_type distance)
+    {
+        iterator_ += distance * stride();
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    strided_iterator operator-(difference_type distance) const
+    {
+        return strided_iterator(iterator_ - distance * stride(), stride());
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    strided_iterator& operator-=(difference_type distance)
+    {
+        iterator_ -= distance * stride();
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(strided_iterator other) const
+    {
+        return (iterator_ - other.iterator_) / stride();
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(strided_iterator other) const
+    {
+        return iterator_ == other.iterator_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(strided_iterator other) const
+    {
+        return iterator_ != other.iterator_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(strided_iterator other) const
+    {
+        return iterator_ < other.iterator_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(strided_iterator other) const
+    {
+        return iterator_ <= other.iterator_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(strided_iterator other) const
+    {
+        return iterator_ > other.iterator_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(strided_iterator other) const
+    {
+        return iterator_ >= other.iterator_;
+    }
+    #endif // DOXYGEN_SHOULD_SKIP_THIS
+
+private:
+    Iterator        iterator_;
+    difference_type stride_;
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<class Iterator, unsigned int Stride>
+ROCPRIM_HOST_DEVICE inline
+strided_iterator<Iterator, Stride>
+operator+(typename strided_iterator<Iterator, Stride>::difference_type distance,
+          const strided_iterator<Iterator, Stride>& iterator)
+{
+    return iterator + distance;
+}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// make_strided_iterator creates a strided_iterator which visits every \p stride-th element
+/// of the range pointed by \p iterator, with a stride given at run time.
+///
+/// \tparam Iterator - type of the underlying random-access iterator.
+///
+/// \param iterator - the underlying iterator.
+/// \param stride - the distance between the visited elements.
+/// \return A new strided_iterator object.
+template<class Iterator>
+ROCPRIM_HOST_DEVICE inline
+strided_iterator<Iterator>
+make_strided_iterator(Iterator iterator,
+                      typename std::iterator_traits<Iterator>::difference_type stride)
+{
+    return strided_iterator<Iterator>(iterator, stride);
+}
+
+/// make_strided_iterator creates a strided_iterator which visits every \p Stride-th element
+/// of the range pointed by \p iterator, with a stride known at compile time.
+///
+/// \tparam Stride - the distance between the visited elements. Must not be zero.
+/// \tparam Iterator - type of the underlying random-access iterator.
+///
+/// \param iterator - the underlying iterator.
+/// \return A new strided_iterator object.
+template<unsigned int Stride, class Iterator>
+ROCPRIM_HOST_DEVICE inline
+strided_iterator<Iterator, Stride>
+make_strided_iterator(Iterator iterator)
+{
+    static_assert(Stride != 0, "Stride must not be zero");
+    return strided_iterator<Iterator, Stride>(iterator);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group iteratormodule
+
+#endif // ROCPRIM_ITERATOR_STRIDED_ITERATOR_HPP_
@@ -0,0 +1,276 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_TABULATE_OUTPUT_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_TABULATE_OUTPUT_ITERATOR_HPP_
+
+#include <iterator>
+#include <cstddef>
+#include <type_traits>
+
+#include "../config.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \class tabulate_output_iterator
+/// \brief A random-access output (write-only) iterator which calls a functor with the index
+/// and the value of every assignment.
+///
+/// \par Overview
+/// * A tabulate_output_iterator does not have any underlying array (memory). When a value is
+/// assigned to the iterator upon dereference, it calls a functor of type BinaryFunction with
+/// the position of the iterator and the assigned value.
+/// * Using it as the output of an algorithm allows scattering the results, or writing them to
+/// a different layout, without an extra pass over the output.
+/// * Its \p value_type is \p void, so algorithms which derive the type of intermediate results
+/// from the output iterator use the type of their input instead.
+///
+/// \tparam BinaryFunction - type of the functor. It is called as <tt>f(index, value)</tt>,
+/// and its result is discarded.
+/// \tparam Index - type of the index passed to the functor. Default type is \p size_t.
+template<class BinaryFunction, class Index = size_t>
+class tabulate_output_iterator
+{
+public:
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS // Skip internal implementation details.
+    class proxy
+    {
+    public:
+        ROCPRIM_HOST_DEVICE inline
+        proxy(BinaryFunction function, Index index)
+            : function_(function), index_(index)
+        {
+        }
+
+        template<class T>
+        ROCPRIM_HOST_DEVICE inline
+        proxy& operator=(const T& value)
+        {
+            function_(index_, value);
+            return *this;
+        }
+
+    private:
+        BinaryFunction function_;
+        Index          index_;
+    };
+    #endif // DOXYGEN_SHOULD_SKIP_THIS
+
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    /// It's \p void since tabulate_output_iterator is a write-only iterator.
+    using value_type = void;
+    /// \brief A reference type of the type iterated over. It's a proxy object which
+    /// calls the functor with the values assigned to it.
+    using reference = proxy;
+    /// \brief A pointer type of the type iterated over (\p value_type).
+    using pointer = void;
+    /// A type used for identify distance between iterators.
+    using difference_type = std::ptrdiff_t;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+    /// The type of the functor called on assignment.
+    using binary_function = BinaryFunction;
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    using self_type = tabulate_output_iterator;
+#endif
+
+    static_assert(std::is_integral<Index>::value, "Index must be integral type");
+
+    ROCPRIM_HOST_DEVICE inline
+    ~tabulate_output_iterator() = default;
+
+    /// \brief Creates a new tabulate_output_iterator.
+    ///
+    /// \param function functor called with the index and the value of every assignment.
+    /// \param index optional index of the iterator (default = 0).
+    ROCPRIM_HOST_DEVICE inline
+    tabulate_output_iterator(BinaryFunction function, Index index = 0)
+        : function_(function), index_(index)
+    {
+    }
+
+    /// \brief Returns the index of the iterator.
+    ROCPRIM_HOST_DEVICE inline
+    Index index() const
+    {
+        return index_;
+    }
+
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS
+    ROCPRIM_HOST_DEVICE inline
+    tabulate_output_iterator& operator++()
+    {
+        index_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    tabulate_output_iterator operator++(int)
+    {
+        tabulate_output_iterator old = *this;
+        index_++;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    tabulate_output_iterator& operator--()
+    {
+        index_--;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    tabulate_output_iterator operator--(int)
+    {
+        tabulate_output_iterator old = *this;
+        index_--;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator*() const
+    {
+        return reference(function_, index_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator[](difference_type distance) const
+    {
+        tabulate_output_iterator i = (*this) + distance;
+        return *i;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    tabulate_output_iterator operator+(difference_type distance) const
+    {
+        return tabulate_output_iterator(
+            function_, static_cast<Index>(static_cast<difference_type>(index_) + distance));
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    tabulate_output_iterator& operator+=(difference_type distance)
+    {
+        index_ = static_cast<Index>(static_cast<difference_type>(index_) + distance);
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    tabulate_output_iterator operator-(difference_type distance) const
+    {
+        return tabulate_output_iterator(
+            function_, static_cast<Index>(static_cast<difference_type>(index_) - distance));
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    tabulate_output_iterator& operator-=(difference_type distance)
+    {
+        index_ = static_cast<Index>(static_cast<difference_type>(index_) - distance);
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(tabulate_output_iterator other) const
+    {
+        return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(tabulate_output_iterator other) const
+    {
+        return index_ == other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(tabulate_output_iterator other) const
+    {
+        return index_ != other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(tabulate_output_iterator other) const
+    {
+        return index_ < other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(tabulate_output_iterator other) const
+    {
+        return index_ <= other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(tabulate_output_iterator other) const
+    {
+        return index_ > other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(tabulate_output_iterator other) const
+    {
+        return index_ >= other.index_;
+    }
+    #endif // DOXYGEN_SHOULD_SKIP_THIS
+
+private:
+    BinaryFunction function_;
+    Index          index_;
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<class BinaryFunction, class Index>
+ROCPRIM_HOST_DEVICE inline
+tabulate_output_iterator<BinaryFunction, Index>
+operator+(typename tabulate_output_iterator<BinaryFunction, Index>::difference_type distance,
+          const tabulate_output_iterator<BinaryFunction, Index>& iterator)
+{
+    return iterator + distance;
+}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// make_tabulate_output_iterator creates a tabulate_output_iterator which calls
+/// \p function with the index and the value of every assignment.
+///
+/// \tparam BinaryFunction - type of the functor.
+/// \tparam Index - type of the index passed to the functor.
+///
+/// \param function - functor called as <tt>function(index, value)</tt> on assignment.
+/// \param index - optional index of the iterator (default = 0).
+/// \return A new tabulate_output_iterator object.
+template<
+    class BinaryFunction,
+    class Index = size_t
+>
+ROCPRIM_HOST_DEVICE inline
+tabulate_output_iterator<BinaryFunction, Index>
+make_tabulate_output_iterator(BinaryFunction function, Index index = 0)
+{
+    return tabulate_output_iterator<BinaryFunction, Index>(function, index);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group iteratormodule
+
+#endif // ROCPRIM_ITERATOR_TABULATE_OUTPUT_ITERATOR_HPP_
@@ -0,0 +1,284 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_TRANSFORM_OUTPUT_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_TRANSFORM_OUTPUT_ITERATOR_HPP_
+
+#include <iterator>
+#include <cstddef>
+#include <type_traits>
+
+#include "../config.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \class transform_output_iterator
+/// \brief A random-access output (write-only) iterator adaptor for transforming values
+/// assigned to it.
+///
+/// \par Overview
+/// * A transform_output_iterator applies a functor of type UnaryFunction to every value
+/// assigned to it upon dereference, and writes the result to the underlying iterator.
+/// * Using it as the output of an algorithm fuses post-processing of the results (for example
+/// casting or scaling) into the algorithm, which saves a full pass over the output.
+/// * Its \p value_type is \p void, so algorithms which derive the type of intermediate results
+/// from the output iterator use the type of their input instead.
+/// * When the underlying iterator is a pointer, \p block_store with
+/// \p block_store_method::block_store_vectorize applies the functor in registers and still uses
+/// vector stores.
+///
+/// \tparam OutputIterator - type of the underlying random-access output iterator. Must be
+/// a random-access iterator.
+/// \tparam UnaryFunction - type of the transform functor. Its result must be assignable to
+/// the dereferenced \p OutputIterator.
+template<class OutputIterator, class UnaryFunction>
+class transform_output_iterator
+{
+public:
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS // Skip internal implementation details.
+    class proxy
+    {
+    public:
+        ROCPRIM_HOST_DEVICE inline
+        proxy(OutputIterator iterator, UnaryFunction transform)
+            : iterator_(iterator), transform_(transform)
+        {
+        }
+
+        template<class T>
+        ROCPRIM_HOST_DEVICE inline
+        proxy& operator=(const T& value)
+        {
+            *iterator_ = transform_(value);
+            return *this;
+        }
+
+    private:
+        OutputIterator iterator_;
+        UnaryFunction  transform_;
+    };
+    #endif // DOXYGEN_SHOULD_SKIP_THIS
+
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    /// It's \p void since transform_output_iterator is a write-only iterator.
+    using value_type = void;
+    /// \brief A reference type of the type iterated over. It's a proxy object which
+    /// transforms the values assigned to it.
+    using reference = proxy;
+    /// \brief A pointer type of the type iterated over (\p value_type).
+    using pointer = void;
+    /// A type used for identify distance between iterators.
+    using difference_type = typename std::iterator_traits<OutputIterator>::difference_type;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+    /// The type of unary function used to transform the assigned values.
+    using unary_function = UnaryFunction;
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    using self_type = transform_output_iterator;
+#endif
+
+    ROCPRIM_HOST_DEVICE inline
+    ~transform_output_iterator() = default;
+
+    /// \brief Creates a new transform_output_iterator.
+    ///
+    /// \param iterator output iterator to which the transformed values are written.
+    /// \param transform unary function used to transform values assigned to
+    /// the created iterator.
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator(OutputIterator iterator, UnaryFunction transform)
+        : iterator_(iterator), transform_(transform)
+    {
+    }
+
+    /// \brief Returns the underlying output iterator.
+    ROCPRIM_HOST_DEVICE inline
+    OutputIterator base() const
+    {
+        return iterator_;
+    }
+
+    /// \brief Returns the functor used to transform the assigned values.
+    ROCPRIM_HOST_DEVICE inline
+    UnaryFunction functor() const
+    {
+        return transform_;
+    }
+
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator& operator++()
+    {
+        iterator_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator operator++(int)
+    {
+        transform_output_iterator old = *this;
+        iterator_++;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator& operator--()
+    {
+        iterator_--;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator operator--(int)
+    {
+        transform_output_iterator old = *this;
+        iterator_--;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator*() const
+    {
+        return reference(iterator_, transform_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator[](difference_type distance) const
+    {
+        transform_output_iterator i = (*this) + distance;
+        return *i;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator operator+(difference_type distance) const
+    {
+        return transform_output_iterator(iterator_ + distance, transform_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator& operator+=(difference_type distance)
+    {
+        iterator_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator operator-(difference_type distance) const
+    {
+        return transform_output_iterator(iterator_ - distance, transform_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator& operator-=(difference_type distance)
+    {
+        iterator_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(transform_output_iterator other) const
+    {
+        return iterator_ - other.iterator_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(transform_output_iterator other) const
+    {
+        return iterator_ == other.iterator_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(transform_output_iterator other) const
+    {
+        return iterator_ != other.iterator_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(transform_output_iterator other) const
+    {
+        return iterator_ < other.iterator_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(transform_output_iterator other) const
+    {
+        return iterator_ <= other.iterator_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(transform_output_iterator other) const
+    {
+        return iterator_ > other.iterator_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(transform_output_iterator other) const
+    {
+        return iterator_ >= other.iterator_;
+    }
+    #endif // DOXYGEN_SHOULD_SKIP_THIS
+
+private:
+    OutputIterator iterator_;
+    UnaryFunction  transform_;
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<class OutputIterator, class UnaryFunction>
+ROCPRIM_HOST_DEVICE inline
+transform_output_iterator<OutputIterator, UnaryFunction>
+operator+(typename transform_output_iterator<OutputIterator, UnaryFunction>::difference_type distance,
+          const transform_output_iterator<OutputIterator, UnaryFunction>& iterator)
+{
+    return iterator + distance;
+}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// make_transform_output_iterator creates a transform_output_iterator using \p iterator as
+/// the underlying iterator and \p transform as the unary function.
+///
+/// \tparam OutputIterator - type of the underlying random-access output iterator.
+/// \tparam UnaryFunction - type of the transform functor.
+///
+/// \param iterator - output iterator.
+/// \param transform - transform functor to use in created transform_output_iterator.
+/// \return A new transform_output_iterator object which writes the values assigned to it,
+/// transformed with \p transform functor, to the range pointed by \p iterator.
+template<
+    class OutputIterator,
+    class UnaryFunction
+>
+ROCPRIM_HOST_DEVICE inline
+transform_output_iterator<OutputIterator, UnaryFunction>
+make_transform_output_iterator(OutputIterator iterator, UnaryFunction transform)
+{
+    return transform_output_iterator<OutputIterator, UnaryFunction>(iterator, transform);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group iteratormodule
+
+#endif // ROCPRIM_ITERATOR_TRANSFORM_OUTPUT_ITERATOR_HPP_
@@ -158,6 +158,13 @@ public:
     {
     }
 
+    /// \brief Returns the tuple of the underlying iterators.
+    ROCPRIM_HOST_DEVICE inline
+    IteratorTuple get_iterator_tuple() const
+    {
+        return iterator_tuple_;
+    }
+
     #ifndef DOXYGEN_SHOULD_SKIP_THIS
     ROCPRIM_HOST_DEVICE inline
     zip_iterator& operator++()
@@ -42,26 +42,41 @@
 #include "thread/thread_reduce.hpp"
 #include "thread/thread_scan.hpp"
 #include "thread/thread_search.hpp"
+#include "thread/thread_sort.hpp"
 #include "thread/thread_store.hpp"
 
+#include "warp/warp_radix_sort.hpp"
 #include "warp/warp_reduce.hpp"
+#include "warp/warp_reduce_by_key.hpp"
 #include "warp/warp_scan.hpp"
+#include "warp/warp_segmented_scan.hpp"
 #include "warp/warp_sort.hpp"
 
 #include "block/block_discontinuity.hpp"
 #include "block/block_exchange.hpp"
 #include "block/block_histogram.hpp"
 #include "block/block_load.hpp"
+#include "block/block_load_2d.hpp"
+#include "block/block_merge.hpp"
+#include "block/block_partition.hpp"
 #include "block/block_radix_sort.hpp"
+#include "block/block_reduce_by_key.hpp"
 #include "block/block_run_length_decode.hpp"
 #include "block/block_scan.hpp"
+#include "block/block_select.hpp"
 #include "block/block_sort.hpp"
 #include "block/block_store.hpp"
+#include "block/block_store_2d.hpp"
+#include "block/block_topk.hpp"
 
+#include "device/config_database.hpp"
 #include "device/device_adjacent_difference.hpp"
+#include "device/device_autotune.hpp"
 #include "device/device_binary_search.hpp"
+#include "device/device_bucket_partition.hpp"
 #include "device/device_copy.hpp"
 #include "device/device_histogram.hpp"
+#include "device/device_launch_trace.hpp"
 #include "device/device_memcpy.hpp"
 #include "device/device_merge.hpp"
 #include "device/device_merge_sort.hpp"
@@ -78,6 +93,7 @@
 #include "device/device_segmented_reduce.hpp"
 #include "device/device_segmented_scan.hpp"
 #include "device/device_select.hpp"
+#include "device/device_string_sort.hpp"
 #include "device/device_transform.hpp"
 
 /// \brief The top level rocPRIM namespace.
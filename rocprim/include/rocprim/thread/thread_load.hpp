@@ -30,6 +30,8 @@
 #ifndef ROCPRIM_THREAD_THREAD_LOAD_HPP_
 #define ROCPRIM_THREAD_THREAD_LOAD_HPP_
 
+#include <type_traits>
+
 #include "../config.hpp"
 #include "../detail/various.hpp"
 
@@ -67,6 +69,10 @@ ROCPRIM_DEVICE __forceinline__ T AsmThreadLoad(void * ptr)
     return retval;
 }
 
+// 128-bit word of the cache-modified loads and stores. The HIP vector types are structs, which
+// cannot be operands of inline assembly.
+typedef unsigned int cache_modified_dwordx4 __attribute__((ext_vector_type(4)));
+
 #if ROCPRIM_THREAD_LOAD_USE_CACHE_MODIFIERS == 1
 
     // Important for syncing. Check section 9.2.2 or 7.3 in the following document
@@ -99,7 +105,8 @@ ROCPRIM_DEVICE __forceinline__ T AsmThreadLoad(void * ptr)
     ROCPRIM_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, uint32_t, uint32_t, flat_load_dword, v, wait_inst, wait_cmd);   \
     ROCPRIM_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, float, uint32_t, flat_load_dword, v, wait_inst, wait_cmd);      \
     ROCPRIM_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, uint64_t, uint64_t, flat_load_dwordx2, v, wait_inst, wait_cmd); \
-    ROCPRIM_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, double, uint64_t, flat_load_dwordx2, v, wait_inst, wait_cmd);
+    ROCPRIM_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, double, uint64_t, flat_load_dwordx2, v, wait_inst, wait_cmd); \
+    ROCPRIM_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, cache_modified_dwordx4, cache_modified_dwordx4, flat_load_dwordx4, v, wait_inst, wait_cmd);
 
 // [HIP-CPU] MSVC: erronous inline assembly specification (Triggers error C2059: syntax error: 'volatile')
 #ifndef __HIP_CPU_RT__
@@ -132,6 +139,84 @@ ROCPRIM_ASM_THREAD_LOAD_GROUP(load_cs, "", "s_waitcnt", "");
 
 #endif
 
+// The widest word that evenly divides T and is not aligned stricter than T. Types without a
+// specialization of AsmThreadLoad are loaded word by word, so that the cache modifier
+// applies to every type.
+template<class T>
+struct cache_modified_word
+{
+    using type = typename std::conditional<
+        sizeof(T) % 16 == 0 && alignof(T) >= 16,
+        cache_modified_dwordx4,
+        typename std::conditional<
+            sizeof(T) % 8 == 0 && alignof(T) >= 8,
+            uint64_t,
+            typename std::conditional<
+                sizeof(T) % 4 == 0 && alignof(T) >= 4,
+                uint32_t,
+                typename std::conditional<sizeof(T) % 2 == 0 && alignof(T) >= 2,
+                                          uint16_t,
+                                          uint8_t>::type>::type>::type>::type;
+
+    static constexpr unsigned int count = sizeof(T) / sizeof(type);
+};
+
+template<cache_load_modifier MODIFIER, typename Word, unsigned int Count>
+ROCPRIM_DEVICE ROCPRIM_INLINE void
+    cache_modified_load_words(const Word* ptr, Word (&words)[Count], std::false_type /*nontemporal*/)
+{
+    // Every load waits for its result in the same inline assembly statement, the compiler does
+    // not track the memory operations of inline assembly.
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < Count; i++)
+    {
+        words[i] = AsmThreadLoad<MODIFIER, Word>(const_cast<Word*>(ptr + i));
+    }
+}
+
+template<cache_load_modifier MODIFIER, typename Word, unsigned int Count>
+ROCPRIM_DEVICE ROCPRIM_INLINE void
+    cache_modified_load_words(const Word* ptr, Word (&words)[Count], std::true_type /*nontemporal*/)
+{
+#if ROCPRIM_THREAD_LOAD_USE_CACHE_MODIFIERS == 1 && !defined(__HIP_CPU_RT__)
+    // The compiler selects the instruction bits of the target and inserts the waits itself, so
+    // the loads can be in flight at the same time.
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < Count; i++)
+    {
+        words[i] = __builtin_nontemporal_load(ptr + i);
+    }
+#else
+    cache_modified_load_words<MODIFIER>(ptr, words, std::false_type{});
+#endif
+}
+
+// Loads Count consecutive words with the cache modifier MODIFIER. Streaming loads are
+// non-temporal.
+template<cache_load_modifier MODIFIER, typename Word, unsigned int Count>
+ROCPRIM_DEVICE ROCPRIM_INLINE void cache_modified_load_words(const Word* ptr, Word (&words)[Count])
+{
+    cache_modified_load_words<MODIFIER>(ptr,
+                                        words,
+                                        std::integral_constant<bool, MODIFIER == load_cs>{});
+}
+
+// Loads a value of any type with the cache modifier MODIFIER
+template<cache_load_modifier MODIFIER, typename T>
+ROCPRIM_DEVICE ROCPRIM_INLINE T cache_modified_load(const T* ptr)
+{
+    if(MODIFIER == load_default)
+    {
+        return *ptr;
+    }
+
+    using word = typename cache_modified_word<T>::type;
+    // The buffer is aligned for T, a word may be aligned less strictly than T
+    alignas(T) word words[cache_modified_word<T>::count];
+    cache_modified_load_words<MODIFIER>(reinterpret_cast<const word*>(ptr), words);
+    return *reinterpret_cast<const T*>(words);
+}
+
 }
 
 /// \addtogroup thread_load
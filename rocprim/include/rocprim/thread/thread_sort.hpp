@@ -0,0 +1,247 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_THREAD_THREAD_SORT_HPP_
+#define ROCPRIM_THREAD_THREAD_SORT_HPP_
+
+#include "../config.hpp"
+#include "../functional.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The comparators of the network are generated with template recursion rather than unrolled
+// loops, so their indices are compile-time constants even if the compiler decides not to unroll,
+// and the sorted items can never be spilled to scratch memory for dynamic indexing.
+
+// Comparator (A, B), dropped if the two items belong to different merges.
+template<unsigned int A, unsigned int B, bool SameMerge>
+struct odd_even_merge_comparator
+{
+    template<class CompareSwap>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE static void run(CompareSwap& compare_swap)
+    {
+        compare_swap(A, B);
+    }
+};
+
+template<unsigned int A, unsigned int B>
+struct odd_even_merge_comparator<A, B, false>
+{
+    template<class CompareSwap>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE static void run(CompareSwap&)
+    {}
+};
+
+// Comparators (I + J, I + J + K) for I = I, ..., K - 1.
+template<unsigned int Size,
+         unsigned int P,
+         unsigned int K,
+         unsigned int J,
+         unsigned int I,
+         bool         Active = (I < K && I + J + K < Size)>
+struct odd_even_merge_network_i
+{
+    template<class CompareSwap>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE static void run(CompareSwap& compare_swap)
+    {
+        // Only compare items that belong to the same merge of size 2 * P
+        odd_even_merge_comparator<I + J,
+                                  I + J + K,
+                                  (I + J) / (2 * P) == (I + J + K) / (2 * P)>::run(compare_swap);
+        odd_even_merge_network_i<Size, P, K, J, I + 1>::run(compare_swap);
+    }
+};
+
+template<unsigned int Size, unsigned int P, unsigned int K, unsigned int J, unsigned int I>
+struct odd_even_merge_network_i<Size, P, K, J, I, false>
+{
+    template<class CompareSwap>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE static void run(CompareSwap&)
+    {}
+};
+
+// Groups of comparators at distance K starting at J, J + 2 * K, ...
+template<unsigned int Size,
+         unsigned int P,
+         unsigned int K,
+         unsigned int J,
+         bool         Active = (J + K < Size)>
+struct odd_even_merge_network_j
+{
+    template<class CompareSwap>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE static void run(CompareSwap& compare_swap)
+    {
+        odd_even_merge_network_i<Size, P, K, J, 0>::run(compare_swap);
+        odd_even_merge_network_j<Size, P, K, J + 2 * K>::run(compare_swap);
+    }
+};
+
+template<unsigned int Size, unsigned int P, unsigned int K, unsigned int J>
+struct odd_even_merge_network_j<Size, P, K, J, false>
+{
+    template<class CompareSwap>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE static void run(CompareSwap&)
+    {}
+};
+
+// Steps of the merges of size 2 * P, with comparator distances K = P, P / 2, ..., 1.
+template<unsigned int Size, unsigned int P, unsigned int K, bool Active = (K > 0)>
+struct odd_even_merge_network_k
+{
+    template<class CompareSwap>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE static void run(CompareSwap& compare_swap)
+    {
+        odd_even_merge_network_j<Size, P, K, K % P>::run(compare_swap);
+        odd_even_merge_network_k<Size, P, K / 2>::run(compare_swap);
+    }
+};
+
+template<unsigned int Size, unsigned int P, unsigned int K>
+struct odd_even_merge_network_k<Size, P, K, false>
+{
+    template<class CompareSwap>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE static void run(CompareSwap&)
+    {}
+};
+
+// Merges of sorted runs of P = 1, 2, 4, ... items.
+template<unsigned int Size, unsigned int P, bool Active = (P < Size)>
+struct odd_even_merge_network_p
+{
+    template<class CompareSwap>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE static void run(CompareSwap& compare_swap)
+    {
+        odd_even_merge_network_k<Size, P, P>::run(compare_swap);
+        odd_even_merge_network_p<Size, 2 * P>::run(compare_swap);
+    }
+};
+
+template<unsigned int Size, unsigned int P>
+struct odd_even_merge_network_p<Size, P, false>
+{
+    template<class CompareSwap>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE static void run(CompareSwap&)
+    {}
+};
+
+/// Applies \p compare_swap to every comparator of Batcher's odd-even merge sorting network
+/// of \p Size inputs, in network order. Both indices passed to \p compare_swap are
+/// compile-time constants.
+///
+/// Comparators of the power-of-two network that touch an index past \p Size are dropped,
+/// which is equivalent to padding the input with elements that compare greater than all
+/// others.
+template<unsigned int Size, class CompareSwap>
+ROCPRIM_DEVICE ROCPRIM_INLINE void odd_even_merge_network(CompareSwap compare_swap)
+{
+    odd_even_merge_network_p<Size, 1>::run(compare_swap);
+}
+
+} // end namespace detail
+
+/// \defgroup thread_sort Thread Sort Functions
+/// \ingroup threadmodule
+
+/// \addtogroup thread_sort
+/// @{
+
+/// \brief Sorts an array of keys held by a single thread.
+///
+/// The keys are sorted with a sorting network (Batcher's odd-even merge sort) that is
+/// generated at compile time for \p ItemsPerThread, so all index patterns are static and
+/// the keys stay in registers. For up to 8 items the network uses the optimal number of
+/// compare-exchange operations.
+///
+/// \par Overview
+/// * The sort is not stable.
+/// * \p ItemsPerThread does not need to be a power of two, but it should stay small
+///   (32 or less) as the number of compare-exchange operations grows as
+///   <tt>O(n log^2 n)</tt>.
+///
+/// \tparam Key <b>[inferred]</b> the key type.
+/// \tparam ItemsPerThread <b>[inferred]</b> the number of keys.
+/// \tparam BinaryFunction type of the comparison function.
+/// \param [in,out] keys array of keys to be sorted.
+/// \param [in] compare_function comparison function object which returns true if the first
+/// argument is ordered before the second. The signature of the function should be equivalent
+/// to: <tt>bool f(const Key& a, const Key& b);</tt>.
+template<class Key, unsigned int ItemsPerThread, class BinaryFunction = ::rocprim::less<Key>>
+ROCPRIM_DEVICE ROCPRIM_INLINE void thread_sort(Key (&keys)[ItemsPerThread],
+                                               BinaryFunction compare_function
+                                               = BinaryFunction())
+{
+    detail::odd_even_merge_network<ItemsPerThread>(
+        [&](const unsigned int i, const unsigned int j)
+        {
+            const bool swap = compare_function(keys[j], keys[i]);
+            const Key  k_i  = keys[i];
+            const Key  k_j  = keys[j];
+            keys[i]         = swap ? k_j : k_i;
+            keys[j]         = swap ? k_i : k_j;
+        });
+}
+
+/// \brief Sorts an array of key-value pairs held by a single thread.
+///
+/// Values are moved together with their keys. See thread_sort() for details about the
+/// sorting network.
+///
+/// \tparam Key <b>[inferred]</b> the key type.
+/// \tparam Value <b>[inferred]</b> the value type.
+/// \tparam ItemsPerThread <b>[inferred]</b> the number of key-value pairs.
+/// \tparam BinaryFunction type of the comparison function.
+/// \param [in,out] keys array of keys to be sorted.
+/// \param [in,out] values array of values, permuted in the same way as \p keys.
+/// \param [in] compare_function comparison function object which returns true if the first
+/// argument is ordered before the second. The signature of the function should be equivalent
+/// to: <tt>bool f(const Key& a, const Key& b);</tt>.
+template<class Key,
+         class Value,
+         unsigned int ItemsPerThread,
+         class BinaryFunction = ::rocprim::less<Key>>
+ROCPRIM_DEVICE ROCPRIM_INLINE void thread_sort_pairs(Key (&keys)[ItemsPerThread],
+                                                     Value (&values)[ItemsPerThread],
+                                                     BinaryFunction compare_function
+                                                     = BinaryFunction())
+{
+    detail::odd_even_merge_network<ItemsPerThread>(
+        [&](const unsigned int i, const unsigned int j)
+        {
+            const bool  swap = compare_function(keys[j], keys[i]);
+            const Key   k_i  = keys[i];
+            const Key   k_j  = keys[j];
+            const Value v_i  = values[i];
+            const Value v_j  = values[j];
+            keys[i]          = swap ? k_j : k_i;
+            keys[j]          = swap ? k_i : k_j;
+            values[i]        = swap ? v_j : v_i;
+            values[j]        = swap ? v_i : v_j;
+        });
+}
+
+/// @}
+// end of group thread_sort
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_THREAD_THREAD_SORT_HPP_
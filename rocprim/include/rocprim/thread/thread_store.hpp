@@ -33,6 +33,7 @@
 
 #include "../config.hpp"
 #include "../detail/various.hpp"
+#include "thread_load.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -101,7 +102,8 @@ ROCPRIM_DEVICE __forceinline__ void AsmThreadStore(void * ptr, T val)
     ROCPRIM_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, uint32_t, uint32_t, flat_store_dword, v, wait_inst, wait_cmd);   \
     ROCPRIM_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, float, uint32_t, flat_store_dword, v, wait_inst, wait_cmd);      \
     ROCPRIM_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, uint64_t, uint64_t, flat_store_dwordx2, v, wait_inst, wait_cmd); \
-    ROCPRIM_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, double, uint64_t, flat_store_dwordx2, v, wait_inst, wait_cmd);
+    ROCPRIM_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, double, uint64_t, flat_store_dwordx2, v, wait_inst, wait_cmd); \
+    ROCPRIM_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, cache_modified_dwordx4, cache_modified_dwordx4, flat_store_dwordx4, v, wait_inst, wait_cmd);
 
 // [HIP-CPU] MSVC: erronous inline assembly specification (Triggers error C2059: syntax error: 'volatile')
 #ifndef __HIP_CPU_RT__
@@ -132,6 +134,61 @@ ROCPRIM_ASM_THREAD_STORE_GROUP(store_cs, "", "s_waitcnt", "");
 
 #endif
 
+template<cache_store_modifier MODIFIER, typename Word, unsigned int Count>
+ROCPRIM_DEVICE ROCPRIM_INLINE void cache_modified_store_words(Word* ptr,
+                                                              const Word (&words)[Count],
+                                                              std::false_type /*nontemporal*/)
+{
+    // Every store waits in the same inline assembly statement, see cache_modified_load_words.
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < Count; i++)
+    {
+        AsmThreadStore<MODIFIER, Word>(ptr + i, words[i]);
+    }
+}
+
+template<cache_store_modifier MODIFIER, typename Word, unsigned int Count>
+ROCPRIM_DEVICE ROCPRIM_INLINE void cache_modified_store_words(Word* ptr,
+                                                              const Word (&words)[Count],
+                                                              std::true_type /*nontemporal*/)
+{
+#if ROCPRIM_THREAD_STORE_USE_CACHE_MODIFIERS == 1 && !defined(__HIP_CPU_RT__)
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < Count; i++)
+    {
+        __builtin_nontemporal_store(words[i], ptr + i);
+    }
+#else
+    cache_modified_store_words<MODIFIER>(ptr, words, std::false_type{});
+#endif
+}
+
+// Stores Count consecutive words with the cache modifier MODIFIER. Streaming stores are
+// non-temporal.
+template<cache_store_modifier MODIFIER, typename Word, unsigned int Count>
+ROCPRIM_DEVICE ROCPRIM_INLINE void cache_modified_store_words(Word* ptr, const Word (&words)[Count])
+{
+    cache_modified_store_words<MODIFIER>(ptr,
+                                         words,
+                                         std::integral_constant<bool, MODIFIER == store_cs>{});
+}
+
+// Stores a value of any type with the cache modifier MODIFIER
+template<cache_store_modifier MODIFIER, typename T>
+ROCPRIM_DEVICE ROCPRIM_INLINE void cache_modified_store(T* ptr, const T& value)
+{
+    if(MODIFIER == store_default)
+    {
+        *ptr = value;
+        return;
+    }
+
+    using word = typename cache_modified_word<T>::type;
+    word words[cache_modified_word<T>::count];
+    __builtin_memcpy(words, &value, sizeof(T));
+    cache_modified_store_words<MODIFIER>(reinterpret_cast<word*>(ptr), words);
+}
+
 }
 
 /// \addtogroup thread_store
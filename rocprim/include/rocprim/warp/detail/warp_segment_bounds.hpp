@@ -72,6 +72,62 @@ ROCPRIM_DEVICE ROCPRIM_INLINE auto last_in_warp_segment(Flag flag) ->
 #endif
 }
 
+// Returns the flags of the threads of the thread's logical warp, bit i is the flag of
+// logical lane i
+template<unsigned int WarpSize>
+ROCPRIM_DEVICE ROCPRIM_INLINE lane_mask_type logical_warp_ballot(const bool flag)
+{
+    lane_mask_type warp_flags = ::rocprim::ballot(flag);
+    warp_flags >>= (::rocprim::lane_id() / WarpSize) * WarpSize;
+    if(WarpSize < sizeof(lane_mask_type) * 8)
+    {
+        warp_flags &= (lane_mask_type(1) << (WarpSize % (sizeof(lane_mask_type) * 8))) - 1U;
+    }
+    return warp_flags;
+}
+
+// Returns logical warp id of the first thread in thread's segment
+template<bool HeadSegmented, unsigned int WarpSize, class Flag>
+ROCPRIM_DEVICE ROCPRIM_INLINE auto first_in_warp_segment(Flag flag) ->
+    typename std::enable_if<(WarpSize <= device_warp_size()), unsigned int>::type
+{
+    lane_mask_type warp_flags = logical_warp_ballot<WarpSize>(flag);
+
+    // In case of tail flags change them to head flags
+    if(!HeadSegmented)
+    {
+        warp_flags <<= 1;
+    }
+    const unsigned int logical_lane_id = ::rocprim::lane_id() % WarpSize;
+    // Zero bits from threads with higher lane id, the shift overflows to all bits for the
+    // last lane of a full hardware warp
+    warp_flags &= (lane_mask_type(2) << logical_lane_id) - 1U;
+    // Make sure first item in logical warp is marked as a head
+    warp_flags |= lane_mask_type(1);
+    return sizeof(lane_mask_type) * 8 - 1 - ::rocprim::clz(warp_flags);
+}
+
+// Returns the position of the set bit of mask which has rank bits set before it. The mask
+// must have more than rank bits set in its first WarpSize bits.
+template<unsigned int WarpSize>
+ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int select_warp_bit(lane_mask_type mask, unsigned int rank)
+{
+    unsigned int position = 0;
+    ROCPRIM_UNROLL
+    for(unsigned int step = WarpSize / 2; step > 0; step /= 2)
+    {
+        const unsigned int count
+            = ::rocprim::bit_count(mask & ((lane_mask_type(1) << step) - 1U));
+        if(count <= rank)
+        {
+            rank -= count;
+            position += step;
+            mask >>= step;
+        }
+    }
+    return position;
+}
+
 } // end namespace detail
 
 END_ROCPRIM_NAMESPACE
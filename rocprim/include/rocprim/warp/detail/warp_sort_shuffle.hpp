@@ -28,6 +28,7 @@
 
 #include "../../functional.hpp"
 #include "../../intrinsics.hpp"
+#include "../../thread/thread_sort.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -191,19 +192,27 @@ private:
         }
     }
 
-    template<unsigned int ItemsPerThread, class BinaryFunction, class... KeyValue>
+    template<unsigned int ItemsPerThread, class BinaryFunction>
     ROCPRIM_DEVICE ROCPRIM_INLINE void
-        thread_sort(bool dir, BinaryFunction compare_function, KeyValue&... kv)
+        thread_sort(bool dir, BinaryFunction compare_function, Key (&k)[ItemsPerThread])
     {
-        ROCPRIM_UNROLL
-        for(unsigned int k = 2; k <= ItemsPerThread; k *= 2)
-        {
-            ROCPRIM_UNROLL
-            for(unsigned int j = k / 2; j > 0; j /= 2)
-            {
-                thread_shuffle<ItemsPerThread>(k, j, dir, compare_function, kv...);
-            }
-        }
+        // Sorting network, descending if dir is true
+        ::rocprim::thread_sort(k,
+                               [&](const Key& a, const Key& b)
+                               { return compare_function(dir ? b : a, dir ? a : b); });
+    }
+
+    template<unsigned int ItemsPerThread, class V, class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void thread_sort(bool           dir,
+                                                   BinaryFunction compare_function,
+                                                   Key (&k)[ItemsPerThread],
+                                                   V (&v)[ItemsPerThread])
+    {
+        // Sorting network, descending if dir is true
+        ::rocprim::thread_sort_pairs(k,
+                                     v,
+                                     [&](const Key& a, const Key& b)
+                                     { return compare_function(dir ? b : a, dir ? a : b); });
     }
 
     template<int warp, unsigned int ItemsPerThread, class BinaryFunction, class... KeyValue>
@@ -0,0 +1,449 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_WARP_WARP_RADIX_SORT_HPP_
+#define ROCPRIM_WARP_WARP_RADIX_SORT_HPP_
+
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/optional_values.hpp"
+#include "../detail/various.hpp"
+
+#include "../functional.hpp"
+#include "../intrinsics.hpp"
+#include "../thread/radix_key_codec.hpp"
+#include "../types.hpp"
+#include "../types/uninitialized_array.hpp"
+
+#include "warp_scan.hpp"
+
+/// \addtogroup warpmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The warp_radix_sort class is a warp level parallel primitive which provides methods
+/// for sorting items (keys or key-value pairs) partitioned across threads in a logical warp
+/// using the radix sort algorithm.
+///
+/// \tparam Key - the key type.
+/// \tparam WarpSize - the size of logical warp size, which must be a power of two equal to
+/// or less than the size of hardware warp (see rocprim::device_warp_size()). Sorts are
+/// performed separately within groups determined by WarpSize.
+/// \tparam ItemsPerThread - the number of items contributed by each thread.
+/// \tparam Value - the value type. Default type empty_type indicates
+/// a keys-only sort.
+/// \tparam RadixBits - the number of bits sorted in every pass.
+///
+/// \par Overview
+/// * The sort is stable and keys are ordered by their radix representation
+///   (see rocprim::radix_key_codec), so \p Key must be an arithmetic type.
+/// * Every pass ranks the keys of the logical warp by the current digit: lanes with the same
+///   digit are grouped with rocprim::match_any(), and the per-warp digit counters in shared
+///   memory are scanned with rocprim::warp_scan. No block synchronization is required.
+/// * The number of passes depends only on the sorted bit range and on \p RadixBits, not on
+///   the number of keys per warp.
+/// * The keys and values are exchanged through shared memory after every pass, so
+///   \p storage_type grows with <tt>WarpSize * ItemsPerThread</tt>.
+/// * All threads from a logical warp must be active and in the same hardware warp.
+///
+/// \par Examples
+/// \parblock
+/// In the examples radix sort is performed on a logical warp of 64 threads, each thread
+/// provides 4 \p unsigned \p int keys.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(...) // blockDim.x = 64
+/// {
+///     using warp_sort_uint = rocprim::warp_radix_sort<unsigned int, 64, 4>;
+///     __shared__ warp_sort_uint::storage_type storage;
+///
+///     unsigned int keys[4];
+///     ...
+///     warp_sort_uint().sort(keys, storage);
+///     ...
+/// }
+/// \endcode
+/// \endparblock
+template<class Key,
+         unsigned int WarpSize,
+         unsigned int ItemsPerThread,
+         class Value            = empty_type,
+         unsigned int RadixBits = 4>
+class warp_radix_sort
+{
+    static_assert(detail::is_power_of_two(WarpSize), "WarpSize must be a power of two.");
+    static_assert(WarpSize <= ROCPRIM_MAX_WARP_SIZE,
+                  "WarpSize can't be greater than hardware warp size.");
+    static_assert(RadixBits > 0 && RadixBits <= 8, "RadixBits must be in range [1, 8].");
+
+    static constexpr bool         with_values    = !std::is_same<Value, empty_type>::value;
+    static constexpr unsigned int items_per_warp = WarpSize * ItemsPerThread;
+    static constexpr unsigned int radix_digits   = 1u << RadixBits;
+    // Every lane owns a contiguous range of digit counters for the scan
+    static constexpr unsigned int digits_per_thread
+        = ::rocprim::detail::ceiling_div(radix_digits, WarpSize);
+
+    using digit_counter_type = unsigned int;
+    using bit_key_type       = typename ::rocprim::radix_key_codec<Key>::bit_key_type;
+    using warp_scan_type     = ::rocprim::warp_scan<digit_counter_type, WarpSize>;
+
+    struct storage_type_
+    {
+        typename warp_scan_type::storage_type scan;
+        digit_counter_type                    counters[digits_per_thread * WarpSize];
+        uninitialized_array<bit_key_type, items_per_warp> keys;
+        uninitialized_array<Value, with_values ? items_per_warp : 1> values;
+    };
+
+public:
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by related parallel primitive.
+    ///
+    /// Depending on the implemention the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords \p __shared__. It can be aliased to
+    /// an externally allocated memory, or be a part of a union with other storage types
+    /// to increase shared memory reusability.
+    using storage_type = storage_type_;
+
+    /// \brief Warp radix sort for keys in blocked arrangement.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread. The
+    /// sorted keys are returned in blocked arrangement.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+    /// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+    /// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+    /// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+    /// value: \p <tt>8 * sizeof(Key)</tt>.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p wave_barrier() or \p syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE void sort(Key (&keys)[ItemsPerThread],
+                                            storage_type& storage,
+                                            unsigned int  begin_bit = 0,
+                                            unsigned int  end_bit   = 8 * sizeof(Key))
+    {
+        empty_type values[ItemsPerThread];
+        sort_impl<false, false>(keys, values, storage, begin_bit, end_bit);
+    }
+
+    /// \overload
+    /// \brief Warp radix sort for keys in blocked arrangement, in descending order.
+    ROCPRIM_DEVICE ROCPRIM_INLINE void sort_desc(Key (&keys)[ItemsPerThread],
+                                                 storage_type& storage,
+                                                 unsigned int  begin_bit = 0,
+                                                 unsigned int  end_bit   = 8 * sizeof(Key))
+    {
+        empty_type values[ItemsPerThread];
+        sort_impl<true, false>(keys, values, storage, begin_bit, end_bit);
+    }
+
+    /// \brief Warp radix sort for key-value pairs in blocked arrangement.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread. The
+    /// sorted keys are returned in blocked arrangement.
+    /// \param [in, out] values - reference to an array of values provided by a thread. The
+    /// values are permuted in the same way as \p keys.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+    /// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+    /// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+    /// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+    /// value: \p <tt>8 * sizeof(Key)</tt>.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p wave_barrier() or \p syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE void sort(Key (&keys)[ItemsPerThread],
+                                            Value (&values)[ItemsPerThread],
+                                            storage_type& storage,
+                                            unsigned int  begin_bit = 0,
+                                            unsigned int  end_bit   = 8 * sizeof(Key))
+    {
+        sort_impl<false, false>(keys, values, storage, begin_bit, end_bit);
+    }
+
+    /// \overload
+    /// \brief Warp radix sort for key-value pairs in blocked arrangement, in descending order.
+    ROCPRIM_DEVICE ROCPRIM_INLINE void sort_desc(Key (&keys)[ItemsPerThread],
+                                                 Value (&values)[ItemsPerThread],
+                                                 storage_type& storage,
+                                                 unsigned int  begin_bit = 0,
+                                                 unsigned int  end_bit   = 8 * sizeof(Key))
+    {
+        sort_impl<true, false>(keys, values, storage, begin_bit, end_bit);
+    }
+
+    /// \brief Warp radix sort for keys in striped arrangement.
+    ///
+    /// The input is read in striped arrangement, which is the order produced by a striped
+    /// warp load, so it saves the initial exchange of sort(). The sorted keys are returned
+    /// in blocked arrangement. Equal keys keep the order of the striped input.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+    /// key comparison. Default value: \p 0.
+    /// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+    /// key comparison. Default value: \p <tt>8 * sizeof(Key)</tt>.
+    ROCPRIM_DEVICE ROCPRIM_INLINE void sort_from_striped(Key (&keys)[ItemsPerThread],
+                                                         storage_type& storage,
+                                                         unsigned int  begin_bit = 0,
+                                                         unsigned int  end_bit = 8 * sizeof(Key))
+    {
+        empty_type values[ItemsPerThread];
+        sort_impl<false, true>(keys, values, storage, begin_bit, end_bit);
+    }
+
+    /// \overload
+    /// \brief Warp radix sort for keys in striped arrangement, in descending order.
+    ROCPRIM_DEVICE ROCPRIM_INLINE void sort_desc_from_striped(Key (&keys)[ItemsPerThread],
+                                                              storage_type& storage,
+                                                              unsigned int  begin_bit = 0,
+                                                              unsigned int  end_bit
+                                                              = 8 * sizeof(Key))
+    {
+        empty_type values[ItemsPerThread];
+        sort_impl<true, true>(keys, values, storage, begin_bit, end_bit);
+    }
+
+    /// \brief Warp radix sort for key-value pairs in striped arrangement.
+    ///
+    /// The input is read in striped arrangement and the sorted pairs are returned in blocked
+    /// arrangement. Equal keys keep the order of the striped input.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in, out] values - reference to an array of values provided by a thread.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+    /// key comparison. Default value: \p 0.
+    /// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+    /// key comparison. Default value: \p <tt>8 * sizeof(Key)</tt>.
+    ROCPRIM_DEVICE ROCPRIM_INLINE void sort_from_striped(Key (&keys)[ItemsPerThread],
+                                                         Value (&values)[ItemsPerThread],
+                                                         storage_type& storage,
+                                                         unsigned int  begin_bit = 0,
+                                                         unsigned int  end_bit = 8 * sizeof(Key))
+    {
+        sort_impl<false, true>(keys, values, storage, begin_bit, end_bit);
+    }
+
+    /// \overload
+    /// \brief Warp radix sort for key-value pairs in striped arrangement, in descending order.
+    ROCPRIM_DEVICE ROCPRIM_INLINE void sort_desc_from_striped(Key (&keys)[ItemsPerThread],
+                                                              Value (&values)[ItemsPerThread],
+                                                              storage_type& storage,
+                                                              unsigned int  begin_bit = 0,
+                                                              unsigned int  end_bit
+                                                              = 8 * sizeof(Key))
+    {
+        sort_impl<true, true>(keys, values, storage, begin_bit, end_bit);
+    }
+
+private:
+    template<class V>
+    using values_tag = detail::moves_values<Value, V>;
+
+    template<class V>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void scatter(const bit_key_type (&bit_keys)[ItemsPerThread],
+                                               const V (&values)[ItemsPerThread],
+                                               const unsigned int (&ranks)[ItemsPerThread],
+                                               storage_type& storage)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            storage.keys.emplace(ranks[i], bit_keys[i]);
+            detail::store_value(storage.values, ranks[i], values[i], values_tag<V>{});
+        }
+    }
+
+    template<bool Blocked, class V>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void gather(bit_key_type (&bit_keys)[ItemsPerThread],
+                                              V (&values)[ItemsPerThread],
+                                              storage_type& storage)
+    {
+        const unsigned int  lane        = detail::logical_lane_id<WarpSize>();
+        const bit_key_type* keys_shared = storage.keys.get_unsafe_array();
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            const unsigned int index = Blocked ? lane * ItemsPerThread + i : i * WarpSize + lane;
+            bit_keys[i]              = keys_shared[index];
+            detail::load_value(storage.values, index, values[i], values_tag<V>{});
+        }
+    }
+
+    // Moves the items from striped to blocked arrangement, or the reverse.
+    template<bool ToBlocked, class V>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void exchange(bit_key_type (&bit_keys)[ItemsPerThread],
+                                                V (&values)[ItemsPerThread],
+                                                storage_type& storage)
+    {
+        const unsigned int lane = detail::logical_lane_id<WarpSize>();
+        unsigned int       ranks[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            ranks[i] = ToBlocked ? i * WarpSize + lane : lane * ItemsPerThread + i;
+        }
+        scatter(bit_keys, values, ranks, storage);
+        ::rocprim::wave_barrier();
+        gather<ToBlocked>(bit_keys, values, storage);
+        ::rocprim::wave_barrier();
+    }
+
+    // Ranks the keys by one digit. Keys are ordered by digit and, within the same digit,
+    // by their position in striped arrangement.
+    template<class KeyCodec>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void rank_keys(const bit_key_type (&bit_keys)[ItemsPerThread],
+                                                 unsigned int (&ranks)[ItemsPerThread],
+                                                 const unsigned int bit,
+                                                 const unsigned int pass_bits,
+                                                 storage_type&      storage)
+    {
+        const unsigned int lane = detail::logical_lane_id<WarpSize>();
+        // Lanes of the hardware warp that belong to the thread's logical warp
+        const lane_mask_type logical_warp_mask
+            = (lane_mask_type(-1) >> (sizeof(lane_mask_type) * 8 - WarpSize))
+              << (::rocprim::lane_id() / WarpSize * WarpSize);
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < digits_per_thread; ++i)
+        {
+            storage.counters[lane * digits_per_thread + i] = 0;
+        }
+        ::rocprim::wave_barrier();
+
+        unsigned int digits[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            digits[i] = KeyCodec::extract_digit(bit_keys[i], bit, pass_bits);
+
+            const digit_counter_type warp_digit_prefix = storage.counters[digits[i]];
+            const lane_mask_type     peer_mask
+                = ::rocprim::match_any<RadixBits>(digits[i]) & logical_warp_mask;
+            ::rocprim::wave_barrier();
+
+            if(::rocprim::group_elect(peer_mask))
+            {
+                storage.counters[digits[i]] = warp_digit_prefix + ::rocprim::bit_count(peer_mask);
+            }
+            ::rocprim::wave_barrier();
+
+            ranks[i] = warp_digit_prefix + ::rocprim::masked_bit_count(peer_mask);
+        }
+
+        // Exclusive scan of the digit counters gives the offset of every digit
+        digit_counter_type counts[digits_per_thread];
+        digit_counter_type thread_count = 0;
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < digits_per_thread; ++i)
+        {
+            counts[i] = storage.counters[lane * digits_per_thread + i];
+            thread_count += counts[i];
+        }
+        digit_counter_type thread_prefix;
+        warp_scan_type().exclusive_scan(thread_count, thread_prefix, 0, storage.scan);
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < digits_per_thread; ++i)
+        {
+            storage.counters[lane * digits_per_thread + i] = thread_prefix;
+            thread_prefix += counts[i];
+        }
+        ::rocprim::wave_barrier();
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            ranks[i] += storage.counters[digits[i]];
+        }
+        ::rocprim::wave_barrier();
+    }
+
+    template<bool Descending, bool StripedInput, class V>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void sort_impl(Key (&keys)[ItemsPerThread],
+                                                 V (&values)[ItemsPerThread],
+                                                 storage_type& storage,
+                                                 const unsigned int begin_bit,
+                                                 const unsigned int end_bit)
+    {
+        using key_codec = ::rocprim::radix_key_codec<Key, Descending>;
+
+        bit_key_type bit_keys[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            bit_keys[i] = key_codec::encode(keys[i]);
+        }
+
+        // Ranking follows the striped order, so blocked input is transposed first to keep
+        // the sort stable
+        if ROCPRIM_IF_CONSTEXPR(!StripedInput)
+        {
+            exchange<false>(bit_keys, values, storage);
+        }
+
+        for(unsigned int bit = begin_bit; bit < end_bit; bit += RadixBits)
+        {
+            const unsigned int pass_bits = ::rocprim::min(RadixBits, end_bit - bit);
+
+            unsigned int ranks[ItemsPerThread];
+            rank_keys<key_codec>(bit_keys, ranks, bit, pass_bits, storage);
+
+            scatter(bit_keys, values, ranks, storage);
+            ::rocprim::wave_barrier();
+            // The last pass returns the sorted items in blocked arrangement
+            if(bit + pass_bits == end_bit)
+            {
+                gather<true>(bit_keys, values, storage);
+            }
+            else
+            {
+                gather<false>(bit_keys, values, storage);
+            }
+            ::rocprim::wave_barrier();
+        }
+
+        // Without any pass the items are still in striped arrangement
+        if(begin_bit >= end_bit)
+        {
+            exchange<true>(bit_keys, values, storage);
+        }
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            keys[i] = key_codec::decode(bit_keys[i]);
+        }
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group warpmodule
+
+#endif // ROCPRIM_WARP_WARP_RADIX_SORT_HPP_
@@ -0,0 +1,180 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_WARP_WARP_REDUCE_BY_KEY_HPP_
+#define ROCPRIM_WARP_WARP_REDUCE_BY_KEY_HPP_
+
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+
+#include "../functional.hpp"
+#include "../intrinsics.hpp"
+#include "../types.hpp"
+
+#include "detail/warp_segment_bounds.hpp"
+#include "warp_segmented_scan.hpp"
+
+/// \addtogroup warpmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The warp_reduce_by_key class is a warp level parallel primitive which provides
+/// methods for reducing runs of equal keys of items partitioned across threads in a hardware
+/// warp.
+///
+/// \tparam Key - the key type.
+/// \tparam Value - the value type.
+/// \tparam WarpSize - the size of logical warp size, which must be a power of two equal to
+/// or less than the size of hardware warp (see rocprim::device_warp_size()). Reductions are
+/// performed separately within groups determined by WarpSize.
+///
+/// \par Overview
+/// * Every thread provides one key and one value. Every run of consecutive threads with equal
+///   keys is a segment.
+/// * The first key and the reduction of the values of the <tt>i</tt>-th segment are returned
+///   to the <tt>i</tt>-th thread of the logical warp, and the number of segments is returned to
+///   all threads.
+/// * The segment bounds are derived from a ballot of the head flags, and the reduction is a
+///   segmented scan with <tt>log2(WarpSize)</tt> warp shuffles. No shared memory is used, so
+///   there is no \p storage_type.
+/// * All threads from a logical warp must be active and in the same hardware warp.
+///
+/// \par Examples
+/// \parblock
+/// In the examples reduce by key operation is performed on groups of 32 threads, each
+/// provides an \p int key and a \p float value.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(...)
+/// {
+///     using warp_rbk = rocprim::warp_reduce_by_key<int, float, 32>;
+///
+///     int key = ...;
+///     float value = ...;
+///     int unique_key;
+///     float aggregate;
+///     const unsigned int segments
+///         = warp_rbk().reduce_by_key(key, value, unique_key, aggregate);
+///     if(rocprim::lane_id() % 32 < segments)
+///     {
+///         // unique_key and aggregate are valid
+///     }
+///     ...
+/// }
+/// \endcode
+/// \endparblock
+template<class Key, class Value, unsigned int WarpSize = device_warp_size()>
+class warp_reduce_by_key
+{
+    static_assert(detail::is_power_of_two(WarpSize), "WarpSize must be a power of two.");
+    static_assert(WarpSize <= ROCPRIM_MAX_WARP_SIZE,
+                  "WarpSize can't be greater than hardware warp size.");
+
+public:
+    /// \brief Reduces runs of equal keys across threads in a logical warp.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for the reduction. Default type
+    /// is rocprim::plus<Value>.
+    /// \tparam KeyEqual - type of binary function used to compare keys for equality. Default
+    /// type is rocprim::equal_to<Key>.
+    ///
+    /// \param [in] key - thread key.
+    /// \param [in] value - thread value.
+    /// \param [out] unique_key - the first key of the segment with the index of the thread's
+    /// logical lane. Undefined for logical lanes past the number of segments.
+    /// \param [out] aggregate - the reduction of the segment with the index of the thread's
+    /// logical lane. Undefined for logical lanes past the number of segments.
+    /// \param [in] reduce_op - binary operation function object that will be used for the
+    /// reduction. The signature of the function should be equivalent to the following:
+    /// <tt>Value f(const Value &a, const Value &b);</tt>.
+    /// \param [in] key_equal - binary function object which returns \p true if the keys are
+    /// equal. The signature of the function should be equivalent to the following:
+    /// <tt>bool f(const Key &a, const Key &b);</tt>.
+    ///
+    /// \returns The number of segments of the logical warp.
+    template<class BinaryFunction = ::rocprim::plus<Value>,
+             class KeyEqual       = ::rocprim::equal_to<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int reduce_by_key(Key            key,
+                                                             Value          value,
+                                                             Key&           unique_key,
+                                                             Value&         aggregate,
+                                                             BinaryFunction reduce_op
+                                                             = BinaryFunction(),
+                                                             KeyEqual key_equal = KeyEqual())
+    {
+        return this->reduce_by_key(key,
+                                   value,
+                                   WarpSize,
+                                   unique_key,
+                                   aggregate,
+                                   reduce_op,
+                                   key_equal);
+    }
+
+    /// \overload
+    /// \brief Reduces runs of equal keys of the first \p valid_items threads in a logical warp.
+    /// \p valid_items must be greater than zero and the same for all threads of the logical warp.
+    template<class BinaryFunction = ::rocprim::plus<Value>,
+             class KeyEqual       = ::rocprim::equal_to<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int reduce_by_key(Key                key,
+                                                             Value              value,
+                                                             const unsigned int valid_items,
+                                                             Key&               unique_key,
+                                                             Value&             aggregate,
+                                                             BinaryFunction     reduce_op
+                                                             = BinaryFunction(),
+                                                             KeyEqual key_equal = KeyEqual())
+    {
+        const unsigned int logical_lane_id = ::rocprim::lane_id() % WarpSize;
+
+        const Key  previous_key = ::rocprim::warp_shuffle_up(key, 1, WarpSize);
+        const bool head         = logical_lane_id < valid_items
+                          && (logical_lane_id == 0 || !key_equal(previous_key, key));
+
+        const lane_mask_type heads = detail::logical_warp_ballot<WarpSize>(head);
+        // The thread before a head and the last valid thread are tails
+        const lane_mask_type tails = (heads >> 1) | (lane_mask_type(1) << (valid_items - 1));
+
+        const unsigned int segment_begin = detail::first_in_warp_segment<true, WarpSize>(head);
+        const Value        inclusive
+            = detail::warp_segmented_inclusive_scan<WarpSize>(value, segment_begin, reduce_op);
+
+        // Gather the head key and the tail reduction of the segment of this logical lane
+        const unsigned int segments = ::rocprim::bit_count(heads);
+        const unsigned int segment  = logical_lane_id < segments ? logical_lane_id : 0;
+        unique_key = ::rocprim::warp_shuffle(key,
+                                             detail::select_warp_bit<WarpSize>(heads, segment),
+                                             WarpSize);
+        aggregate  = ::rocprim::warp_shuffle(inclusive,
+                                            detail::select_warp_bit<WarpSize>(tails, segment),
+                                            WarpSize);
+        return segments;
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group warpmodule
+
+#endif // ROCPRIM_WARP_WARP_REDUCE_BY_KEY_HPP_
@@ -0,0 +1,229 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_WARP_WARP_SEGMENTED_SCAN_HPP_
+#define ROCPRIM_WARP_WARP_SEGMENTED_SCAN_HPP_
+
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+
+#include "../functional.hpp"
+#include "../intrinsics.hpp"
+#include "../types.hpp"
+
+#include "detail/warp_segment_bounds.hpp"
+
+/// \addtogroup warpmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Inclusive scan of the segment starting at logical lane segment_begin, the shuffles never
+// take values from before the beginning of the segment
+template<unsigned int WarpSize, class T, class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE T warp_segmented_inclusive_scan(T                  input,
+                                                              const unsigned int segment_begin,
+                                                              BinaryFunction     scan_op)
+{
+    const unsigned int logical_lane_id = ::rocprim::lane_id() % WarpSize;
+    ROCPRIM_UNROLL
+    for(unsigned int offset = 1; offset < WarpSize; offset *= 2)
+    {
+        const T value = ::rocprim::warp_shuffle_up(input, offset, WarpSize);
+        if(logical_lane_id >= segment_begin + offset)
+        {
+            input = scan_op(value, input);
+        }
+    }
+    return input;
+}
+
+} // end namespace detail
+
+/// \brief The warp_segmented_scan class is a warp level parallel primitive which provides
+/// methods for performing segmented inclusive and exclusive scans of items partitioned across
+/// threads in a hardware warp.
+///
+/// \tparam T - the input/output type.
+/// \tparam WarpSize - the size of logical warp size, which must be a power of two equal to
+/// or less than the size of hardware warp (see rocprim::device_warp_size()). Scan operations
+/// are performed separately within groups determined by WarpSize.
+///
+/// \par Overview
+/// * Segments are given either by head flags, which mark the first thread of every segment,
+///   or by tail flags, which mark the last thread of every segment. The first thread of a
+///   logical warp always starts a segment.
+/// * Every thread finds the first thread of its segment with a single ballot, then the scan
+///   is performed with <tt>log2(WarpSize)</tt> warp shuffles, which never cross the start of
+///   the segment. No shared memory is used, so there is no \p storage_type.
+/// * Supports non-commutative scan operators. However, a scan operator should be
+///   associative.
+/// * All threads from a logical warp must be active and in the same hardware warp.
+///
+/// \par Examples
+/// \parblock
+/// In the examples scan operation is performed on groups of 16 threads, each provides
+/// one \p int value and a head flag.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(...)
+/// {
+///     // specialize warp_segmented_scan for int and logical warp of 16 threads
+///     using warp_scan_int = rocprim::warp_segmented_scan<int, 16>;
+///
+///     int value = ...;
+///     bool head_flag = ...;
+///     // execute inclusive scan in each segment
+///     warp_scan_int().head_segmented_inclusive_scan(value, value, head_flag);
+///     ...
+/// }
+/// \endcode
+/// \endparblock
+template<class T, unsigned int WarpSize = device_warp_size()>
+class warp_segmented_scan
+{
+    static_assert(detail::is_power_of_two(WarpSize), "WarpSize must be a power of two.");
+    static_assert(WarpSize <= ROCPRIM_MAX_WARP_SIZE,
+                  "WarpSize can't be greater than hardware warp size.");
+
+public:
+    /// \brief Performs inclusive scan in every head-flagged segment of a logical warp.
+    ///
+    /// \tparam Flag - type of head flags. Must be contextually convertible to \p bool.
+    /// \tparam BinaryFunction - type of binary function used for scan. Default type
+    /// is rocprim::plus<T>.
+    ///
+    /// \param [in] input - thread input value.
+    /// \param [out] output - reference to a thread output value. May be aliased with \p input.
+    /// \param [in] flag - thread head flag, \p true flags mark beginnings of segments.
+    /// \param [in] scan_op - binary operation function object that will be used for scan.
+    /// The signature of the function should be equivalent to the following:
+    /// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+    /// <tt>const &</tt>, but function object must not modify the objects passed to it.
+    template<class Flag, class BinaryFunction = ::rocprim::plus<T>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void head_segmented_inclusive_scan(
+        T input, T& output, Flag flag, BinaryFunction scan_op = BinaryFunction())
+    {
+        this->segmented_inclusive_scan<true>(input, output, flag, scan_op);
+    }
+
+    /// \brief Performs inclusive scan in every tail-flagged segment of a logical warp.
+    ///
+    /// \tparam Flag - type of tail flags. Must be contextually convertible to \p bool.
+    /// \tparam BinaryFunction - type of binary function used for scan. Default type
+    /// is rocprim::plus<T>.
+    ///
+    /// \param [in] input - thread input value.
+    /// \param [out] output - reference to a thread output value. May be aliased with \p input.
+    /// \param [in] flag - thread tail flag, \p true flags mark ends of segments.
+    /// \param [in] scan_op - binary operation function object that will be used for scan.
+    /// The signature of the function should be equivalent to the following:
+    /// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+    /// <tt>const &</tt>, but function object must not modify the objects passed to it.
+    template<class Flag, class BinaryFunction = ::rocprim::plus<T>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void tail_segmented_inclusive_scan(
+        T input, T& output, Flag flag, BinaryFunction scan_op = BinaryFunction())
+    {
+        this->segmented_inclusive_scan<false>(input, output, flag, scan_op);
+    }
+
+    /// \brief Performs exclusive scan in every head-flagged segment of a logical warp.
+    ///
+    /// Every segment is scanned starting with \p init, the output of the first thread of
+    /// every segment is \p init.
+    ///
+    /// \tparam Flag - type of head flags. Must be contextually convertible to \p bool.
+    /// \tparam BinaryFunction - type of binary function used for scan. Default type
+    /// is rocprim::plus<T>.
+    ///
+    /// \param [in] input - thread input value.
+    /// \param [out] output - reference to a thread output value. May be aliased with \p input.
+    /// \param [in] init - initial value used to start the exclusive scan of every segment.
+    /// \param [in] flag - thread head flag, \p true flags mark beginnings of segments.
+    /// \param [in] scan_op - binary operation function object that will be used for scan.
+    /// The signature of the function should be equivalent to the following:
+    /// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+    /// <tt>const &</tt>, but function object must not modify the objects passed to it.
+    template<class Flag, class BinaryFunction = ::rocprim::plus<T>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void head_segmented_exclusive_scan(
+        T input, T& output, T init, Flag flag, BinaryFunction scan_op = BinaryFunction())
+    {
+        this->segmented_exclusive_scan<true>(input, output, init, flag, scan_op);
+    }
+
+    /// \brief Performs exclusive scan in every tail-flagged segment of a logical warp.
+    ///
+    /// Every segment is scanned starting with \p init, the output of the first thread of
+    /// every segment is \p init.
+    ///
+    /// \tparam Flag - type of tail flags. Must be contextually convertible to \p bool.
+    /// \tparam BinaryFunction - type of binary function used for scan. Default type
+    /// is rocprim::plus<T>.
+    ///
+    /// \param [in] input - thread input value.
+    /// \param [out] output - reference to a thread output value. May be aliased with \p input.
+    /// \param [in] init - initial value used to start the exclusive scan of every segment.
+    /// \param [in] flag - thread tail flag, \p true flags mark ends of segments.
+    /// \param [in] scan_op - binary operation function object that will be used for scan.
+    /// The signature of the function should be equivalent to the following:
+    /// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+    /// <tt>const &</tt>, but function object must not modify the objects passed to it.
+    template<class Flag, class BinaryFunction = ::rocprim::plus<T>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void tail_segmented_exclusive_scan(
+        T input, T& output, T init, Flag flag, BinaryFunction scan_op = BinaryFunction())
+    {
+        this->segmented_exclusive_scan<false>(input, output, init, flag, scan_op);
+    }
+
+private:
+    template<bool HeadSegmented, class Flag, class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void
+        segmented_inclusive_scan(T input, T& output, Flag flag, BinaryFunction scan_op)
+    {
+        const unsigned int segment_begin
+            = detail::first_in_warp_segment<HeadSegmented, WarpSize>(static_cast<bool>(flag));
+        output = detail::warp_segmented_inclusive_scan<WarpSize>(input, segment_begin, scan_op);
+    }
+
+    template<bool HeadSegmented, class Flag, class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void
+        segmented_exclusive_scan(T input, T& output, T init, Flag flag, BinaryFunction scan_op)
+    {
+        const unsigned int segment_begin
+            = detail::first_in_warp_segment<HeadSegmented, WarpSize>(static_cast<bool>(flag));
+        const T inclusive
+            = detail::warp_segmented_inclusive_scan<WarpSize>(input, segment_begin, scan_op);
+
+        const T previous = ::rocprim::warp_shuffle_up(inclusive, 1, WarpSize);
+        output = ::rocprim::lane_id() % WarpSize == segment_begin ? init : scan_op(init, previous);
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group warpmodule
+
+#endif // ROCPRIM_WARP_WARP_SEGMENTED_SCAN_HPP_
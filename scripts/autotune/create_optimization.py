@@ -42,6 +42,8 @@ from typing import Dict, List, Callable, Optional, Tuple
 from jinja2 import Environment, PackageLoader, select_autoescape
 
 TARGET_ARCHITECTURES = ['gfx803', 'gfx900', 'gfx906', 'gfx908', 'gfx90a', 'gfx1030', 'gfx1100', 'gfx1102']
+# Maximum number of size buckets per configuration, must match rocprim::detail::max_size_buckets
+MAX_SIZE_BUCKETS = 4
 # C++ typename used for optional types
 EMPTY_TYPENAME = "empty_type"
 
@@ -142,12 +144,15 @@ class BenchmarksOfArchitecture:
     Stores the benchmark results for a specific architecture and algorithm.
     """
 
-    def __init__(self, arch_name: str, config_selection_params, fallback_entries: List[FallbackCase], config_get_best, algorithm_name):
+    def __init__(self, arch_name: str, config_selection_params, fallback_entries: List[FallbackCase], config_get_best, algorithm_name,
+                 select_across_sizes: bool = False):
         self.config_selection_params = config_selection_params
         self.fallback_entries: List[FallbackCase] = fallback_entries
         self.arch_name: str = arch_name
         self.config_get_best: Callable[[Dict], Dict[str, str]] = config_get_best
         self.algorithm_name: str = algorithm_name
+        # If true, config_get_best receives the benchmarks of all sizes and no size buckets are generated
+        self.select_across_sizes: bool = select_across_sizes
         # Dictionary storing the benchmarks
         # Key is an instantiation of the configuration selection types
         # Value is a list of all benchmark runs corresponding to that instantiation,
@@ -185,12 +190,63 @@ class BenchmarksOfArchitecture:
         Returns the best performing benchmark from a list of benchmarks.
         For now, use the items per second as metric. in case the benchmark with the 
         given configuration is not present None is returned
+
+        If the benchmarks were run with multiple sizes, only the largest size is considered,
+        the smaller sizes are covered by the size buckets.
         """
         if instance_key in self.benchmarks.keys():
-            return self.config_get_best(self.benchmarks[instance_key])
+            if self.select_across_sizes:
+                return self.config_get_best(self.benchmarks[instance_key])
+            benchmarks_by_size = self.__get_benchmarks_by_size(instance_key)
+            return self.config_get_best(benchmarks_by_size[max(benchmarks_by_size)])
         else:
             return None
 
+    def __get_benchmarks_by_size(self, instance_key) -> Dict[int, List[Dict[str, str]]]:
+        """
+        Groups the benchmarks of an instance by the problem size they were run with.
+        Benchmarks without a size are all grouped under size 0.
+        """
+        output = defaultdict(list)
+        for benchmark in self.benchmarks[instance_key]:
+            output[benchmark.get('size', 0)].append(benchmark)
+        return output
+
+    def __get_size_buckets(self, instance_key) -> List[Tuple[int, Dict[str, str]]]:
+        """
+        Returns a list of (inclusive maximum size, best benchmark) pairs, ordered by size,
+        for the sizes whose best configuration differs from the one of the largest size.
+        The boundary between two measured sizes is their geometric mean.
+        Returns an empty list if all benchmarks were run with the same size.
+        """
+        if instance_key not in self.benchmarks.keys() or self.select_across_sizes:
+            return []
+        benchmarks_by_size = self.__get_benchmarks_by_size(instance_key)
+        sizes = sorted(benchmarks_by_size)
+        if len(sizes) < 2:
+            return []
+
+        buckets: List[Tuple[int, Dict[str, str]]] = []
+        for size, next_size in zip(sizes, sizes[1:]):
+            best = self.config_get_best(benchmarks_by_size[size])
+            max_size = int(math.sqrt(size * next_size))
+            if buckets and buckets[-1][1]['cfg'] == best['cfg']:
+                # Same configuration as the previous bucket, extend it
+                buckets[-1] = (max_size, buckets[-1][1])
+            else:
+                buckets.append((max_size, best))
+
+        # Trailing buckets with the configuration of the largest size are covered by it
+        default_best = self.config_get_best(benchmarks_by_size[sizes[-1]])
+        while buckets and buckets[-1][1]['cfg'] == default_best['cfg']:
+            buckets.pop()
+
+        if len(buckets) > MAX_SIZE_BUCKETS:
+            print(f'INFO {self.name}: {self.algorithm_name} has {len(buckets)} size buckets, '
+                  f'only the smallest {MAX_SIZE_BUCKETS} are kept')
+            buckets = buckets[:MAX_SIZE_BUCKETS]
+        return buckets
+
     @property
     def best_config_by_selection_types(self):
         """
@@ -229,13 +285,15 @@ class BenchmarksOfArchitecture:
                 output.append((print_config,
                                translate_settings_to_cpp_metaprogramming(fallback_configuration,
                                                                          const_configuration),
-                               best_benchmark_result))
+                               best_benchmark_result,
+                               self.__get_size_buckets(self.__get_instance_key(search_key))))
 
     @property
     def fallback_types(self):
         """
-        Provides a fallback triplet of (string describing the type used for generating the fallback,
-        C++ enable if statement, benchmark containing the selected parameters for the algorithm).
+        Provides a fallback tuple of (string describing the type used for generating the fallback,
+        C++ enable if statement, benchmark containing the selected parameters for the algorithm,
+        list of (maximum size, benchmark) pairs for the size buckets).
 
         This function only supports algorithms with at most two types.
         """
@@ -342,11 +400,66 @@ def merge_sort_block_merge_config_get_best(input: Dict) -> Dict[str, str]:
     best_mergepath = max(input_mergepath, key=lambda x: x.get('items_per_second', 0.0))
     return best_mergepath
 
+def get_winning_paths(input: Dict) -> List[Tuple[int, Dict[str, str]]]:
+    """
+    Returns a list of (size, best benchmark) pairs ordered by size, where the best benchmark is the
+    fastest among all paths measured with that size. Skipped benchmarks are ignored.
+    """
+    benchmarks_by_size = defaultdict(list)
+    for benchmark in input:
+        if not benchmark.get('error_occurred', False):
+            benchmarks_by_size[benchmark.get('size', 0)].append(benchmark)
+    return [(size, default_config_get_best(benchmarks_by_size[size])) for size in sorted(benchmarks_by_size)]
+
+def get_path_limit(winners: List[Tuple[int, Dict[str, str]]], first: int, path: str) -> Tuple[int, int]:
+    """
+    Starting at index first of the winners, returns the index of the first size not won by path,
+    and the largest size to use path for. The boundary between two measured sizes is their geometric mean.
+    """
+    last = first
+    while last < len(winners) and winners[last][1]['cfg']['path'] == path:
+        last += 1
+    if last == first:
+        limit = int(math.sqrt(winners[first - 1][0] * winners[first][0])) if first > 0 else 0
+    elif last == len(winners):
+        limit = winners[-1][0]
+    else:
+        limit = int(math.sqrt(winners[last - 1][0] * winners[last][0]))
+    return last, limit
+
+# The thresholds are the sizes where the fastest algorithm changes from single sort to merge sort,
+# and from merge sort to onesweep. The single sort config is the fastest at the largest size it wins.
+def radix_sort_thresholds_config_get_best(input: Dict) -> Dict[str, str]:
+    winners = get_winning_paths(input)
+    single_sort = [x for x in input if x['cfg']['path'] == 'single_sort' and not x.get('error_occurred', False)]
+    last_single, single_sort_limit = get_path_limit(winners, 0, 'single_sort')
+    if last_single > 0:
+        single_sort_best = winners[last_single - 1][1]
+    else:
+        single_sort_best = default_config_get_best(single_sort)
+    # The single sort cannot sort more items than fit in a single block
+    single_sort_limit = min(single_sort_limit, int(single_sort_best['cfg']['bs']) * int(single_sort_best['cfg']['ipt']))
+    _, merge_sort_limit = get_path_limit(winners, last_single, 'merge_sort')
+    return {'cfg': {'bs': single_sort_best['cfg']['bs'],
+                    'ipt': single_sort_best['cfg']['ipt'],
+                    'single_sort_limit': single_sort_limit,
+                    'merge_sort_limit': max(merge_sort_limit, single_sort_limit)}}
+
+# The threshold is the size where selecting the sorted range with nth element becomes faster
+# than sorting the whole input.
+def partial_sort_thresholds_config_get_best(input: Dict) -> Dict[str, str]:
+    _, sort_limit = get_path_limit(get_winning_paths(input), 0, 'sort')
+    return {'cfg': {'sort_limit': sort_limit}}
+
 class Algorithm:
     """
     Aggregates the data for an algorithm, including the generation of the configuration file.
     """
 
+    # If true, the configuration is selected from the benchmarks of all problem sizes at once,
+    # instead of generating size buckets.
+    select_across_sizes = False
+
     def __init__(self, fallback_entries: List[FallbackCase], config_get_best = default_config_get_best):
         self.architectures: Dict[str, BenchmarksOfArchitecture] = {}
         self.fallback_entries: List[FallbackCase] = fallback_entries
@@ -359,7 +472,7 @@ class Algorithm:
         if architecture not in self.architectures:
             self.architectures[architecture] = BenchmarksOfArchitecture(architecture, self.config_selection_params,
                                                                         self.fallback_entries, self.config_get_best,
-                                                                        self.algorithm_name)
+                                                                        self.algorithm_name, self.select_across_sizes)
         self.architectures[architecture].add_measurement(single_benchmark_data)
 
     def create_config_file_content(self) -> str:
@@ -453,6 +566,25 @@ class AlgorithmDeviceRadixSortOnesweep(Algorithm):
     def __init__(self, fallback_entries):
         Algorithm.__init__(self, fallback_entries)
 
+class AlgorithmDeviceRadixSortThresholds(Algorithm):
+    algorithm_name = "device_radix_sort_thresholds"
+    cpp_configuration_template_name = "radixsort_thresholds_config_template"
+    config_selection_params = [
+        SelectionType(name="key_type", is_optional=False, select_on_size_only=False),
+        SelectionType(name="value_type", is_optional=True, select_on_size_only=True)]
+    select_across_sizes = True
+    def __init__(self, fallback_entries):
+        Algorithm.__init__(self, fallback_entries, radix_sort_thresholds_config_get_best)
+
+class AlgorithmDevicePartialSortThresholds(Algorithm):
+    algorithm_name = "device_partial_sort_thresholds"
+    cpp_configuration_template_name = "partial_sort_thresholds_config_template"
+    config_selection_params = [
+        SelectionType(name="key_type", is_optional=False, select_on_size_only=False)]
+    select_across_sizes = True
+    def __init__(self, fallback_entries):
+        Algorithm.__init__(self, fallback_entries, partial_sort_thresholds_config_get_best)
+
 class AlgorithmDeviceReduce(Algorithm):
     algorithm_name = "device_reduce"
     config_selection_params = [
@@ -639,6 +771,10 @@ def create_algorithm(algorithm_name: str, fallback_entries: List[FallbackCase]):
         return AlgorithmDeviceRadixSortBlockSort(fallback_entries)
     elif algorithm_name == 'device_radix_sort_onesweep':
         return AlgorithmDeviceRadixSortOnesweep(fallback_entries)
+    elif algorithm_name == 'device_radix_sort_thresholds':
+        return AlgorithmDeviceRadixSortThresholds(fallback_entries)
+    elif algorithm_name == 'device_partial_sort_thresholds':
+        return AlgorithmDevicePartialSortThresholds(fallback_entries)
     elif algorithm_name == 'device_reduce':
         return AlgorithmDeviceReduce(fallback_entries)
     elif algorithm_name == 'device_scan':
@@ -768,8 +904,12 @@ class BenchmarkDataManager:
         try:
             print(f'INFO: Processing "{benchmark_run_file_path}"')
             arch = self.__get_target_architecture_from_context(benchmark_run_data)
+            # The problem size of the run is used to generate size buckets
+            size = benchmark_run_data['context'].get('size')
             for raw_single_benchmark in benchmark_run_data['benchmarks']:
                 single_benchmark = self.__get_single_benchmark(raw_single_benchmark)
+                if size is not None:
+                    single_benchmark.setdefault('size', int(size))
                 self.__add_benchmark_to_algorithm(single_benchmark, arch)
             print(f'INFO: Successfully processed file "{benchmark_run_file_path}"')
         except NotSupportedError as error:
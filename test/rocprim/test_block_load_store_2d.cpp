@@ -0,0 +1,304 @@
+// MIT License
+//
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load_2d.hpp>
+#include <rocprim/block/block_store_2d.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <vector>
+
+template<class T,
+         rocprim::block_load_method  LoadMethod,
+         rocprim::block_store_method StoreMethod,
+         unsigned int                BlockSize,
+         unsigned int                RowsPerTile,
+         unsigned int                ColsPerTile>
+struct params
+{
+    using type                                                 = T;
+    static constexpr rocprim::block_load_method  load_method   = LoadMethod;
+    static constexpr rocprim::block_store_method store_method  = StoreMethod;
+    static constexpr unsigned int                block_size    = BlockSize;
+    static constexpr unsigned int                rows_per_tile = RowsPerTile;
+    static constexpr unsigned int                cols_per_tile = ColsPerTile;
+};
+
+template<class Params>
+class RocprimBlockLoadStore2dTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+using rocprim::block_load_method;
+using rocprim::block_store_method;
+
+typedef ::testing::Types<
+    params<int, block_load_method::block_load_direct, block_store_method::block_store_direct, 256, 16, 64>,
+    params<float, block_load_method::block_load_vectorize, block_store_method::block_store_vectorize, 128, 8, 64>,
+    params<unsigned char, block_load_method::block_load_vectorize, block_store_method::block_store_vectorize, 64, 4, 128>,
+    params<short, block_load_method::block_load_striped, block_store_method::block_store_striped, 96, 3, 64>,
+    params<double, block_load_method::block_load_transpose, block_store_method::block_store_transpose, 128, 32, 12>,
+    params<int, block_load_method::block_load_transpose, block_store_method::block_store_vectorize, 256, 8, 128>,
+    params<long long, block_load_method::block_load_vectorize, block_store_method::block_store_transpose, 64, 16, 12>,
+    params<int, block_load_method::block_load_direct, block_store_method::block_store_striped, 32, 1, 96>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimBlockLoadStore2dTests, Params);
+
+template<class T,
+         block_load_method  LoadMethod,
+         block_store_method StoreMethod,
+         unsigned int       BlockSize,
+         unsigned int       RowsPerTile,
+         unsigned int       ColsPerTile>
+__global__ __launch_bounds__(BlockSize) void load_store_2d_kernel(const T*     input,
+                                                                  T*           output,
+                                                                  unsigned int rows,
+                                                                  unsigned int cols,
+                                                                  unsigned int pitch)
+{
+    using block_load_type
+        = rocprim::block_load_2d<T, BlockSize, RowsPerTile, ColsPerTile, LoadMethod>;
+    using block_store_type
+        = rocprim::block_store_2d<T, BlockSize, RowsPerTile, ColsPerTile, StoreMethod>;
+
+    __shared__ typename block_load_type::storage_type  load_storage;
+    __shared__ typename block_store_type::storage_type store_storage;
+
+    const unsigned int row        = blockIdx.y * RowsPerTile;
+    const unsigned int col        = blockIdx.x * ColsPerTile;
+    const unsigned int valid_rows = rocprim::min(RowsPerTile, rows - row);
+    const unsigned int valid_cols = rocprim::min(ColsPerTile, cols - col);
+    const size_t       offset     = static_cast<size_t>(row) * pitch + col;
+
+    T items[block_load_type::items_per_thread];
+    if(valid_rows == RowsPerTile && valid_cols == ColsPerTile)
+    {
+        block_load_type().load(input + offset, pitch, items, load_storage);
+        block_store_type().store(output + offset, pitch, items, store_storage);
+    }
+    else
+    {
+        block_load_type().load(input + offset, pitch, items, valid_rows, valid_cols, load_storage);
+        block_store_type().store(output + offset,
+                                 pitch,
+                                 items,
+                                 valid_rows,
+                                 valid_cols,
+                                 store_storage);
+    }
+}
+
+template<class T,
+         block_load_method LoadMethod,
+         unsigned int      BlockSize,
+         unsigned int      RowsPerTile,
+         unsigned int      ColsPerTile>
+__global__ __launch_bounds__(BlockSize) void load_2d_kernel(const T*     input,
+                                                            T*           output,
+                                                            unsigned int rows,
+                                                            unsigned int cols,
+                                                            unsigned int pitch,
+                                                            T            out_of_bounds)
+{
+    using block_load_type
+        = rocprim::block_load_2d<T, BlockSize, RowsPerTile, ColsPerTile, LoadMethod>;
+    constexpr unsigned int items_per_thread = block_load_type::items_per_thread;
+    constexpr unsigned int items_per_tile   = RowsPerTile * ColsPerTile;
+    constexpr bool         striped          = LoadMethod == block_load_method::block_load_striped;
+
+    const unsigned int row        = blockIdx.y * RowsPerTile;
+    const unsigned int col        = blockIdx.x * ColsPerTile;
+    const unsigned int valid_rows = rocprim::min(RowsPerTile, rows - row);
+    const unsigned int valid_cols = rocprim::min(ColsPerTile, cols - col);
+    const size_t       offset     = static_cast<size_t>(row) * pitch + col;
+
+    T items[items_per_thread];
+    if(valid_rows == RowsPerTile && valid_cols == ColsPerTile)
+    {
+        block_load_type().load(input + offset, pitch, items);
+    }
+    else
+    {
+        block_load_type().load(input + offset, pitch, items, valid_rows, valid_cols, out_of_bounds);
+    }
+
+    const unsigned int tile_offset = (blockIdx.y * gridDim.x + blockIdx.x) * items_per_tile;
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        const unsigned int position
+            = striped ? i * BlockSize + threadIdx.x : threadIdx.x * items_per_thread + i;
+        output[tile_offset + position] = items[i];
+    }
+}
+
+TYPED_TEST(RocprimBlockLoadStore2dTests, LoadStore)
+{
+    using T                              = typename TestFixture::params::type;
+    constexpr auto         load_method   = TestFixture::params::load_method;
+    constexpr auto         store_method  = TestFixture::params::store_method;
+    constexpr unsigned int block_size    = TestFixture::params::block_size;
+    constexpr unsigned int rows_per_tile = TestFixture::params::rows_per_tile;
+    constexpr unsigned int cols_per_tile = TestFixture::params::cols_per_tile;
+
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    // Partial tiles at the bottom and right edges
+    const unsigned int rows = 2 * rows_per_tile + (rows_per_tile + 1) / 2;
+    const unsigned int cols = 2 * cols_per_tile + cols_per_tile / 3 + 1;
+    const dim3         grid_size(rocprim::detail::ceiling_div(cols, cols_per_tile),
+                                 rocprim::detail::ceiling_div(rows, rows_per_tile));
+    const T            sentinel = T(123);
+
+    // An aligned pitch allows vector accesses, the odd one does not
+    for(unsigned int padding : {0u, 3u})
+    {
+        const unsigned int pitch = rocprim::detail::ceiling_div(cols, 16u) * 16 + padding;
+        const size_t       size  = static_cast<size_t>(rows) * pitch;
+        SCOPED_TRACE(testing::Message() << "with pitch = " << pitch);
+
+        T* d_input;
+        T* d_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+
+        for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+        {
+            unsigned int seed_value
+                = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+            SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+            std::vector<T>       output(size, sentinel);
+
+            // Only the items inside of the 2D range are copied, the padding is left unchanged
+            std::vector<T> expected(size, sentinel);
+            for(unsigned int row = 0; row < rows; ++row)
+            {
+                std::copy(input.begin() + row * pitch,
+                          input.begin() + row * pitch + cols,
+                          expected.begin() + row * pitch);
+            }
+
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+            HIP_CHECK(
+                hipMemcpy(d_output, output.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            load_store_2d_kernel<T,
+                                 load_method,
+                                 store_method,
+                                 block_size,
+                                 rows_per_tile,
+                                 cols_per_tile>
+                <<<grid_size, block_size>>>(d_input, d_output, rows, cols, pitch);
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            HIP_CHECK(
+                hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+        }
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_output));
+    }
+}
+
+TYPED_TEST(RocprimBlockLoadStore2dTests, LoadArrangement)
+{
+    using T                               = typename TestFixture::params::type;
+    constexpr auto         load_method    = TestFixture::params::load_method;
+    constexpr unsigned int block_size     = TestFixture::params::block_size;
+    constexpr unsigned int rows_per_tile  = TestFixture::params::rows_per_tile;
+    constexpr unsigned int cols_per_tile  = TestFixture::params::cols_per_tile;
+    constexpr unsigned int items_per_tile = rows_per_tile * cols_per_tile;
+
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const unsigned int rows  = 2 * rows_per_tile + (rows_per_tile + 1) / 2;
+    const unsigned int cols  = cols_per_tile + cols_per_tile / 2 + 1;
+    const unsigned int pitch = rocprim::detail::ceiling_div(cols, 16u) * 16;
+    const size_t       size  = static_cast<size_t>(rows) * pitch;
+    const dim3         grid_size(rocprim::detail::ceiling_div(cols, cols_per_tile),
+                                 rocprim::detail::ceiling_div(rows, rows_per_tile));
+    const size_t       output_size   = grid_size.x * grid_size.y * items_per_tile;
+    const T            out_of_bounds = T(123);
+
+    T* d_input;
+    T* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, output_size * sizeof(T)));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+
+        // Every tile is expected in row-major order, with the default value outside of the range
+        std::vector<T> expected(output_size);
+        for(unsigned int tile_row = 0; tile_row < grid_size.y; ++tile_row)
+        {
+            for(unsigned int tile_col = 0; tile_col < grid_size.x; ++tile_col)
+            {
+                const size_t tile_offset = (tile_row * grid_size.x + tile_col) * items_per_tile;
+                for(unsigned int index = 0; index < items_per_tile; ++index)
+                {
+                    const unsigned int row = tile_row * rows_per_tile + index / cols_per_tile;
+                    const unsigned int col = tile_col * cols_per_tile + index % cols_per_tile;
+                    expected[tile_offset + index]
+                        = row < rows && col < cols ? input[row * pitch + col] : out_of_bounds;
+                }
+            }
+        }
+
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+        load_2d_kernel<T, load_method, block_size, rows_per_tile, cols_per_tile>
+            <<<grid_size, block_size>>>(d_input, d_output, rows, cols, pitch, out_of_bounds);
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<T> output(output_size);
+        HIP_CHECK(
+            hipMemcpy(output.data(), d_output, output_size * sizeof(T), hipMemcpyDeviceToHost));
+
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+    }
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
@@ -0,0 +1,262 @@
+// MIT License
+//
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load_func.hpp>
+#include <rocprim/block/block_merge.hpp>
+#include <rocprim/block/block_store_func.hpp>
+#include <rocprim/functional.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+template<class Key, class Value, unsigned int BlockSize, unsigned int ItemsPerThread>
+struct params
+{
+    using key_type                                 = Key;
+    using value_type                               = Value;
+    static constexpr unsigned int block_size       = BlockSize;
+    static constexpr unsigned int items_per_thread = ItemsPerThread;
+};
+
+template<class Params>
+class RocprimBlockMergeTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<int, int, 256, 4>,
+                         params<int, int, 64, 1>,
+                         params<unsigned char, int, 128, 7>,
+                         params<float, double, 256, 3>,
+                         params<long long, unsigned char, 192, 2>,
+                         params<test_utils::custom_test_type<int>, int, 64, 5>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimBlockMergeTests, Params);
+
+enum class merge_method
+{
+    keys,
+    pairs,
+    iterators
+};
+
+template<merge_method  Method,
+         class Key,
+         class Value,
+         unsigned int BlockSize,
+         unsigned int ItemsPerThread>
+__global__ __launch_bounds__(BlockSize) void block_merge_kernel(const Key*         keys_input,
+                                                                const Value*       values_input,
+                                                                Key*               keys_output,
+                                                                Value*             values_output,
+                                                                const unsigned int num_keys1,
+                                                                const unsigned int num_keys)
+{
+    using block_merge_type = rocprim::block_merge<Key, BlockSize, ItemsPerThread, Value>;
+    ROCPRIM_SHARED_MEMORY typename block_merge_type::storage_type storage;
+
+    const unsigned int flat_id = threadIdx.x;
+
+    Key   keys[ItemsPerThread];
+    Value values[ItemsPerThread];
+    if(Method == merge_method::iterators)
+    {
+        block_merge_type().merge(keys_input,
+                                 values_input,
+                                 num_keys1,
+                                 keys_input + num_keys1,
+                                 values_input + num_keys1,
+                                 num_keys - num_keys1,
+                                 keys,
+                                 values,
+                                 storage,
+                                 rocprim::less<Key>());
+    }
+    else
+    {
+        rocprim::block_load_direct_blocked(flat_id, keys_input, keys, num_keys);
+        rocprim::block_load_direct_blocked(flat_id, values_input, values, num_keys);
+        if(Method == merge_method::keys)
+        {
+            block_merge_type().merge(keys, num_keys1, num_keys, storage, rocprim::less<Key>());
+        }
+        else
+        {
+            block_merge_type().merge(keys,
+                                     values,
+                                     num_keys1,
+                                     num_keys,
+                                     storage,
+                                     rocprim::less<Key>());
+        }
+    }
+
+    rocprim::block_store_direct_blocked(flat_id, keys_output, keys, num_keys);
+    if(Method != merge_method::keys)
+    {
+        rocprim::block_store_direct_blocked(flat_id, values_output, values, num_keys);
+    }
+}
+
+template<merge_method Method, class Params>
+void test_block_merge()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                          = typename Params::key_type;
+    using value_type                        = typename Params::value_type;
+    constexpr unsigned int block_size       = Params::block_size;
+    constexpr unsigned int items_per_thread = Params::items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    key_type*   d_keys_input;
+    value_type* d_values_input;
+    key_type*   d_keys_output;
+    value_type* d_values_output;
+    HIP_CHECK(
+        test_common_utils::hipMallocHelper(&d_keys_input, items_per_block * sizeof(key_type)));
+    HIP_CHECK(
+        test_common_utils::hipMallocHelper(&d_values_input, items_per_block * sizeof(value_type)));
+    HIP_CHECK(
+        test_common_utils::hipMallocHelper(&d_keys_output, items_per_block * sizeof(key_type)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                 items_per_block * sizeof(value_type)));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        std::default_random_engine                  gen(seed_value);
+        std::uniform_int_distribution<unsigned int> size_dis(1, items_per_block);
+
+        const unsigned int partial_size = size_dis(gen);
+        for(unsigned int num_keys : {items_per_block, partial_size, 1u})
+        {
+            std::uniform_int_distribution<unsigned int> split_dis(0, num_keys);
+            for(unsigned int num_keys1 : {0u, num_keys, split_dis(gen)})
+            {
+                SCOPED_TRACE(testing::Message() << "with num_keys = " << num_keys);
+                SCOPED_TRACE(testing::Message() << "with num_keys1 = " << num_keys1);
+
+                // Few distinct keys, so that the stability of the merge is tested
+                std::vector<key_type> keys_input
+                    = test_utils::get_random_data<key_type>(num_keys, 0, 16, seed_value + num_keys1);
+                std::vector<value_type> values_input(num_keys);
+                for(unsigned int i = 0; i < num_keys; ++i)
+                {
+                    values_input[i] = static_cast<value_type>(i);
+                }
+                std::sort(keys_input.begin(), keys_input.begin() + num_keys1);
+                std::sort(keys_input.begin() + num_keys1, keys_input.end());
+
+                // std::merge is stable, equal keys of the first sequence go first
+                using pair_type = std::pair<key_type, value_type>;
+                std::vector<pair_type> pairs(num_keys);
+                for(unsigned int i = 0; i < num_keys; ++i)
+                {
+                    pairs[i] = pair_type(keys_input[i], values_input[i]);
+                }
+                std::vector<pair_type> expected(num_keys);
+                std::merge(pairs.begin(),
+                           pairs.begin() + num_keys1,
+                           pairs.begin() + num_keys1,
+                           pairs.end(),
+                           expected.begin(),
+                           [](const pair_type& a, const pair_type& b)
+                           { return a.first < b.first; });
+
+                HIP_CHECK(hipMemcpy(d_keys_input,
+                                    keys_input.data(),
+                                    num_keys * sizeof(key_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_values_input,
+                                    values_input.data(),
+                                    num_keys * sizeof(value_type),
+                                    hipMemcpyHostToDevice));
+
+                block_merge_kernel<Method, key_type, value_type, block_size, items_per_thread>
+                    <<<1, block_size>>>(d_keys_input,
+                                        d_values_input,
+                                        d_keys_output,
+                                        d_values_output,
+                                        num_keys1,
+                                        num_keys);
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                std::vector<key_type>   keys_output(num_keys);
+                std::vector<value_type> values_output(num_keys);
+                HIP_CHECK(hipMemcpy(keys_output.data(),
+                                    d_keys_output,
+                                    num_keys * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(values_output.data(),
+                                    d_values_output,
+                                    num_keys * sizeof(value_type),
+                                    hipMemcpyDeviceToHost));
+
+                for(unsigned int i = 0; i < num_keys; ++i)
+                {
+                    ASSERT_EQ(keys_output[i], expected[i].first) << "where index = " << i;
+                    if(Method != merge_method::keys)
+                    {
+                        ASSERT_EQ(values_output[i], expected[i].second) << "where index = " << i;
+                    }
+                }
+            }
+        }
+    }
+
+    HIP_CHECK(hipFree(d_keys_input));
+    HIP_CHECK(hipFree(d_values_input));
+    HIP_CHECK(hipFree(d_keys_output));
+    HIP_CHECK(hipFree(d_values_output));
+}
+
+TYPED_TEST(RocprimBlockMergeTests, MergeKeys)
+{
+    test_block_merge<merge_method::keys, typename TestFixture::params>();
+}
+
+TYPED_TEST(RocprimBlockMergeTests, MergePairs)
+{
+    test_block_merge<merge_method::pairs, typename TestFixture::params>();
+}
+
+TYPED_TEST(RocprimBlockMergeTests, MergeIterators)
+{
+    test_block_merge<merge_method::iterators, typename TestFixture::params>();
+}
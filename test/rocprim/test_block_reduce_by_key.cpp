@@ -0,0 +1,251 @@
+// MIT License
+//
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load_func.hpp>
+#include <rocprim/block/block_reduce_by_key.hpp>
+#include <rocprim/block/block_store_func.hpp>
+#include <rocprim/functional.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+template<class Key, class Value, unsigned int BlockSize, unsigned int ItemsPerThread>
+struct params
+{
+    using key_type                                 = Key;
+    using value_type                               = Value;
+    static constexpr unsigned int block_size       = BlockSize;
+    static constexpr unsigned int items_per_thread = ItemsPerThread;
+};
+
+template<class Params>
+class RocprimBlockReduceByKeyTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<int, int, 256, 4>,
+                         params<int, unsigned int, 64, 1>,
+                         params<unsigned char, long long, 128, 7>,
+                         params<long long, float, 96, 3>,
+                         params<int, double, 65, 2>,
+                         params<test_utils::custom_test_type<int>, int, 192, 5>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimBlockReduceByKeyTests, Params);
+
+// A single block reduces all tiles of the input, passing the carry-out of each tile as carry-in
+// to the next one.
+template<class Key, class Value, unsigned int BlockSize, unsigned int ItemsPerThread>
+__global__ __launch_bounds__(BlockSize) void block_reduce_by_key_kernel(const Key*   keys_input,
+                                                                        const Value* values_input,
+                                                                        Key*         unique_output,
+                                                                        Value* aggregates_output,
+                                                                        unsigned int* unique_count,
+                                                                        const unsigned int size)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    using block_rbk_type = rocprim::block_reduce_by_key<Key, Value, BlockSize, ItemsPerThread>;
+    ROCPRIM_SHARED_MEMORY typename block_rbk_type::storage_type storage;
+
+    const unsigned int flat_id = threadIdx.x;
+
+    Key          carry_key;
+    Value        carry_value;
+    unsigned int output_offset = 0;
+    for(unsigned int tile_offset = 0; tile_offset < size; tile_offset += items_per_block)
+    {
+        const unsigned int valid_items = rocprim::min(size - tile_offset, items_per_block);
+
+        Key   keys[ItemsPerThread];
+        Value values[ItemsPerThread];
+        rocprim::block_load_direct_blocked(flat_id, keys_input + tile_offset, keys, valid_items);
+        rocprim::block_load_direct_blocked(flat_id,
+                                           values_input + tile_offset,
+                                           values,
+                                           valid_items);
+
+        unsigned int closed_segments;
+        if(tile_offset == 0)
+        {
+            closed_segments = block_rbk_type().reduce_by_key(keys,
+                                                             values,
+                                                             valid_items,
+                                                             carry_key,
+                                                             carry_value,
+                                                             storage,
+                                                             rocprim::plus<Value>());
+        }
+        else
+        {
+            closed_segments = block_rbk_type().reduce_by_key_with_carry(keys,
+                                                                        values,
+                                                                        valid_items,
+                                                                        carry_key,
+                                                                        carry_value,
+                                                                        storage,
+                                                                        rocprim::plus<Value>());
+        }
+        rocprim::syncthreads();
+
+        rocprim::block_store_direct_blocked(flat_id,
+                                            unique_output + output_offset,
+                                            keys,
+                                            closed_segments);
+        rocprim::block_store_direct_blocked(flat_id,
+                                            aggregates_output + output_offset,
+                                            values,
+                                            closed_segments);
+        output_offset += closed_segments;
+    }
+
+    if(flat_id == 0)
+    {
+        unique_output[output_offset]     = carry_key;
+        aggregates_output[output_offset] = carry_value;
+        *unique_count                    = output_offset + 1;
+    }
+}
+
+TYPED_TEST(RocprimBlockReduceByKeyTests, ReduceByKey)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                          = typename TestFixture::params::key_type;
+    using value_type                        = typename TestFixture::params::value_type;
+    constexpr unsigned int block_size       = TestFixture::params::block_size;
+    constexpr unsigned int items_per_thread = TestFixture::params::items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        std::default_random_engine                  gen(seed_value);
+        std::uniform_int_distribution<unsigned int> size_dis(1, 4 * items_per_block);
+        std::uniform_int_distribution<unsigned int> run_dis(1, 2 * items_per_thread);
+
+        for(unsigned int size : {1u, items_per_block, 3 * items_per_block, size_dis(gen)})
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Runs of random length, consecutive runs may have the same key
+            std::vector<key_type> keys_input;
+            while(keys_input.size() < size)
+            {
+                const key_type key = static_cast<key_type>(gen() % 4);
+                keys_input.insert(keys_input.end(),
+                                  std::min<size_t>(run_dis(gen), size - keys_input.size()),
+                                  key);
+            }
+            std::vector<value_type> values_input
+                = test_utils::get_random_data<value_type>(size, 0, 100, seed_value);
+
+            std::vector<key_type>   unique_expected;
+            std::vector<value_type> aggregates_expected;
+            for(unsigned int i = 0; i < size; ++i)
+            {
+                if(i == 0 || !(keys_input[i] == keys_input[i - 1]))
+                {
+                    unique_expected.push_back(keys_input[i]);
+                    aggregates_expected.push_back(values_input[i]);
+                }
+                else
+                {
+                    aggregates_expected.back() += values_input[i];
+                }
+            }
+
+            key_type*     d_keys_input;
+            value_type*   d_values_input;
+            key_type*     d_unique_output;
+            value_type*   d_aggregates_output;
+            unsigned int* d_unique_count;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_input, size * sizeof(value_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_unique_output, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_aggregates_output,
+                                                         size * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_unique_count, sizeof(unsigned int)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+
+            block_reduce_by_key_kernel<key_type, value_type, block_size, items_per_thread>
+                <<<1, block_size>>>(d_keys_input,
+                                    d_values_input,
+                                    d_unique_output,
+                                    d_aggregates_output,
+                                    d_unique_count,
+                                    size);
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            unsigned int unique_count;
+            HIP_CHECK(hipMemcpy(&unique_count,
+                                d_unique_count,
+                                sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            ASSERT_EQ(unique_count, unique_expected.size());
+
+            std::vector<key_type>   unique_output(unique_count);
+            std::vector<value_type> aggregates_output(unique_count);
+            HIP_CHECK(hipMemcpy(unique_output.data(),
+                                d_unique_output,
+                                unique_count * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(aggregates_output.data(),
+                                d_aggregates_output,
+                                unique_count * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(unique_output, unique_expected));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(aggregates_output, aggregates_expected));
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_unique_output));
+            HIP_CHECK(hipFree(d_aggregates_output));
+            HIP_CHECK(hipFree(d_unique_count));
+        }
+    }
+}
@@ -0,0 +1,277 @@
+// MIT License
+//
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load_func.hpp>
+#include <rocprim/block/block_partition.hpp>
+#include <rocprim/block/block_select.hpp>
+#include <rocprim/block/block_store_func.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <random>
+#include <vector>
+
+template<class T, unsigned int BlockSize, unsigned int ItemsPerThread>
+struct params
+{
+    using type                                     = T;
+    static constexpr unsigned int block_size       = BlockSize;
+    static constexpr unsigned int items_per_thread = ItemsPerThread;
+};
+
+template<class Params>
+class RocprimBlockSelectTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<int, 256, 4>,
+                         params<int, 64, 1>,
+                         params<unsigned char, 128, 7>,
+                         params<double, 96, 3>,
+                         params<long long, 65, 2>,
+                         params<test_utils::custom_test_type<int>, 192, 5>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimBlockSelectTests, Params);
+
+enum class select_method
+{
+    flagged,
+    predicate,
+    scatter,
+    partition
+};
+
+template<class T>
+struct select_op
+{
+    unsigned int threshold;
+
+    ROCPRIM_HOST_DEVICE
+    bool operator()(const T& value) const
+    {
+        return value < T(threshold);
+    }
+};
+
+template<select_method Method, class T, unsigned int BlockSize, unsigned int ItemsPerThread>
+__global__ __launch_bounds__(BlockSize) void block_select_kernel(const T*             input,
+                                                                 const unsigned char* flags_input,
+                                                                 T*                   selected,
+                                                                 T*                   rejected,
+                                                                 unsigned int* selected_count,
+                                                                 const unsigned int valid_items,
+                                                                 const unsigned int threshold)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    using block_select_type    = rocprim::block_select<T, BlockSize, ItemsPerThread>;
+    using block_partition_type = rocprim::block_partition<T, BlockSize, ItemsPerThread>;
+    ROCPRIM_SHARED_MEMORY union
+    {
+        typename block_select_type::storage_type    select;
+        typename block_partition_type::storage_type partition;
+    } storage;
+    ROCPRIM_SHARED_MEMORY rocprim::uninitialized_array<T, items_per_block> scattered;
+
+    const unsigned int flat_id = threadIdx.x;
+
+    T             items[ItemsPerThread];
+    unsigned char flags[ItemsPerThread];
+    rocprim::block_load_direct_blocked(flat_id, input, items, valid_items);
+    rocprim::block_load_direct_blocked(flat_id, flags_input, flags, valid_items);
+
+    unsigned int count = 0;
+    if(Method == select_method::flagged)
+    {
+        count = block_select_type().select_flagged(items,
+                                                   flags,
+                                                   valid_items,
+                                                   selected,
+                                                   storage.select);
+    }
+    else if(Method == select_method::predicate)
+    {
+        count = block_select_type().select_if(items,
+                                              valid_items,
+                                              selected,
+                                              select_op<T>{threshold},
+                                              storage.select);
+    }
+    else if(Method == select_method::scatter)
+    {
+        count = block_select_type().scatter_flagged(items,
+                                                    flags,
+                                                    valid_items,
+                                                    &scattered.get_unsafe_array()[0],
+                                                    storage.select);
+        rocprim::syncthreads();
+        for(unsigned int index = flat_id; index < count; index += BlockSize)
+        {
+            selected[index] = scattered.get_unsafe_array()[index];
+        }
+    }
+    else
+    {
+        count = block_partition_type().partition_flagged(items,
+                                                         flags,
+                                                         valid_items,
+                                                         selected,
+                                                         rejected,
+                                                         storage.partition);
+    }
+
+    if(flat_id == BlockSize - 1)
+    {
+        *selected_count = count;
+    }
+}
+
+template<select_method Method, class Params>
+void test_block_select()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                                 = typename Params::type;
+    constexpr unsigned int block_size       = Params::block_size;
+    constexpr unsigned int items_per_thread = Params::items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    T*             d_input;
+    unsigned char* d_flags;
+    T*             d_selected;
+    T*             d_rejected;
+    unsigned int*  d_selected_count;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, items_per_block * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_flags, items_per_block));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_selected, items_per_block * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_rejected, items_per_block * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_selected_count, sizeof(unsigned int)));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        std::default_random_engine                  gen(seed_value);
+        std::uniform_int_distribution<unsigned int> size_dis(1, items_per_block);
+        std::uniform_int_distribution<unsigned int> threshold_dis(0, 101);
+
+        for(unsigned int valid_items : {items_per_block, size_dis(gen)})
+        {
+            SCOPED_TRACE(testing::Message() << "with valid_items = " << valid_items);
+
+            const unsigned int threshold = threshold_dis(gen);
+
+            std::vector<T> input
+                = test_utils::get_random_data<T>(valid_items, 0, 100, seed_value);
+            std::vector<unsigned char> flags
+                = test_utils::get_random_data<unsigned char>(valid_items, 0, 1, seed_value + 1);
+
+            std::vector<T> expected_selected;
+            std::vector<T> expected_rejected;
+            for(unsigned int i = 0; i < valid_items; ++i)
+            {
+                const bool is_selected = Method == select_method::predicate
+                                             ? select_op<T>{threshold}(input[i])
+                                             : flags[i] != 0;
+                (is_selected ? expected_selected : expected_rejected).push_back(input[i]);
+            }
+
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                valid_items * sizeof(T),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_flags, flags.data(), valid_items, hipMemcpyHostToDevice));
+
+            block_select_kernel<Method, T, block_size, items_per_thread>
+                <<<1, block_size>>>(d_input,
+                                    d_flags,
+                                    d_selected,
+                                    d_rejected,
+                                    d_selected_count,
+                                    valid_items,
+                                    threshold);
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            unsigned int selected_count;
+            HIP_CHECK(hipMemcpy(&selected_count,
+                                d_selected_count,
+                                sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            ASSERT_EQ(selected_count, expected_selected.size());
+
+            std::vector<T> selected(selected_count);
+            HIP_CHECK(hipMemcpy(selected.data(),
+                                d_selected,
+                                selected_count * sizeof(T),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(selected, expected_selected));
+
+            if(Method == select_method::partition)
+            {
+                std::vector<T> rejected(valid_items - selected_count);
+                HIP_CHECK(hipMemcpy(rejected.data(),
+                                    d_rejected,
+                                    rejected.size() * sizeof(T),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(rejected, expected_rejected));
+            }
+        }
+    }
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_flags));
+    HIP_CHECK(hipFree(d_selected));
+    HIP_CHECK(hipFree(d_rejected));
+    HIP_CHECK(hipFree(d_selected_count));
+}
+
+TYPED_TEST(RocprimBlockSelectTests, SelectFlagged)
+{
+    test_block_select<select_method::flagged, typename TestFixture::params>();
+}
+
+TYPED_TEST(RocprimBlockSelectTests, SelectIf)
+{
+    test_block_select<select_method::predicate, typename TestFixture::params>();
+}
+
+TYPED_TEST(RocprimBlockSelectTests, ScatterFlagged)
+{
+    test_block_select<select_method::scatter, typename TestFixture::params>();
+}
+
+TYPED_TEST(RocprimBlockSelectTests, PartitionFlagged)
+{
+    test_block_select<select_method::partition, typename TestFixture::params>();
+}
@@ -0,0 +1,240 @@
+// MIT License
+//
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_topk.hpp>
+#include <rocprim/thread/radix_key_codec.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+template<class Key, unsigned int BlockSize, unsigned int ItemsPerThread>
+struct params
+{
+    using key_type                                 = Key;
+    static constexpr unsigned int block_size       = BlockSize;
+    static constexpr unsigned int items_per_thread = ItemsPerThread;
+};
+
+template<class Params>
+class RocprimBlockTopkTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<int, 256, 4>,
+                         params<unsigned int, 64, 1>,
+                         params<unsigned char, 128, 3>,
+                         params<short, 96, 5>,
+                         params<float, 128, 4>,
+                         params<double, 65, 2>,
+                         params<unsigned long long, 192, 2>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimBlockTopkTests, Params);
+
+template<bool Min,
+         bool ToStriped,
+         unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class Key>
+__global__ __launch_bounds__(BlockSize) void block_topk_kernel(Key*          keys,
+                                                               unsigned int* values,
+                                                               unsigned int  k,
+                                                               bool          sorted)
+{
+    using block_topk_type = rocprim::block_topk<Key, BlockSize, ItemsPerThread, unsigned int>;
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    __shared__ typename block_topk_type::storage_type storage;
+
+    const unsigned int offset = blockIdx.x * items_per_block;
+
+    Key          thread_keys[ItemsPerThread];
+    unsigned int thread_values[ItemsPerThread];
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        thread_keys[i]   = keys[offset + threadIdx.x * ItemsPerThread + i];
+        thread_values[i] = values[offset + threadIdx.x * ItemsPerThread + i];
+    }
+
+    if(Min && ToStriped)
+    {
+        block_topk_type().select_min_to_striped(thread_keys, thread_values, k, storage, sorted);
+    }
+    else if(ToStriped)
+    {
+        block_topk_type().select_max_to_striped(thread_keys, thread_values, k, storage, sorted);
+    }
+    else if(Min)
+    {
+        block_topk_type().select_min(thread_keys, thread_values, k, storage, sorted);
+    }
+    else
+    {
+        block_topk_type().select_max(thread_keys, thread_values, k, storage, sorted);
+    }
+
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        const unsigned int position
+            = ToStriped ? i * BlockSize + threadIdx.x : threadIdx.x * ItemsPerThread + i;
+        keys[offset + position]   = thread_keys[i];
+        values[offset + position] = thread_values[i];
+    }
+}
+
+template<bool Min, bool ToStriped, class Params>
+void test_block_topk()
+{
+    using key_type                          = typename Params::key_type;
+    constexpr unsigned int block_size       = Params::block_size;
+    constexpr unsigned int items_per_thread = Params::items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+    constexpr unsigned int grid_size        = 8;
+    constexpr size_t       size             = grid_size * items_per_block;
+    // The smallest keys are the largest ones of the descending radix representation
+    using key_codec = rocprim::radix_key_codec<key_type, Min>;
+
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    key_type*     d_keys;
+    unsigned int* d_values;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, size * sizeof(key_type)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, size * sizeof(unsigned int)));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // A narrow range, so that there are equal keys at the selection boundary
+        const std::vector<key_type> keys
+            = test_utils::get_random_data<key_type>(size, 0, 100, seed_value);
+        std::vector<unsigned int> values(size);
+        std::iota(values.begin(), values.end(), 0u);
+
+        for(unsigned int k : {0u,
+                              1u,
+                              7u,
+                              items_per_block / 3,
+                              items_per_block - 1,
+                              items_per_block,
+                              items_per_block + 5})
+        {
+            for(bool sorted : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with k = " << k);
+                SCOPED_TRACE(testing::Message() << "with sorted = " << sorted);
+
+                // The best keys first, equal keys in the order of the tile
+                std::vector<unsigned int> expected(values);
+                std::vector<unsigned int> selected_counts(grid_size);
+                for(size_t offset = 0; offset < size; offset += items_per_block)
+                {
+                    const auto begin = expected.begin() + offset;
+                    std::stable_sort(begin,
+                                     begin + items_per_block,
+                                     [&](const unsigned int a, const unsigned int b)
+                                     {
+                                         return key_codec::encode(keys[a])
+                                                > key_codec::encode(keys[b]);
+                                     });
+                    const unsigned int count = std::min(k, items_per_block);
+                    if(!sorted)
+                    {
+                        std::sort(begin, begin + count);
+                    }
+                }
+
+                HIP_CHECK(hipMemcpy(d_keys,
+                                    keys.data(),
+                                    size * sizeof(key_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_values,
+                                    values.data(),
+                                    size * sizeof(unsigned int),
+                                    hipMemcpyHostToDevice));
+
+                block_topk_kernel<Min, ToStriped, block_size, items_per_thread>
+                    <<<grid_size, block_size>>>(d_keys, d_values, k, sorted);
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                std::vector<key_type> output_keys(size);
+                HIP_CHECK(hipMemcpy(output_keys.data(),
+                                    d_keys,
+                                    size * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+                std::vector<unsigned int> output_values(size);
+                HIP_CHECK(hipMemcpy(output_values.data(),
+                                    d_values,
+                                    size * sizeof(unsigned int),
+                                    hipMemcpyDeviceToHost));
+
+                for(size_t offset = 0; offset < size; offset += items_per_block)
+                {
+                    for(unsigned int i = 0; i < std::min(k, items_per_block); ++i)
+                    {
+                        ASSERT_EQ(output_values[offset + i], expected[offset + i]);
+                        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(
+                            output_keys[offset + i],
+                            keys[expected[offset + i]]));
+                    }
+                }
+            }
+        }
+    }
+
+    HIP_CHECK(hipFree(d_keys));
+    HIP_CHECK(hipFree(d_values));
+}
+
+TYPED_TEST(RocprimBlockTopkTests, SelectMax)
+{
+    test_block_topk<false, false, typename TestFixture::params>();
+}
+
+TYPED_TEST(RocprimBlockTopkTests, SelectMin)
+{
+    test_block_topk<true, false, typename TestFixture::params>();
+}
+
+TYPED_TEST(RocprimBlockTopkTests, SelectMaxToStriped)
+{
+    test_block_topk<false, true, typename TestFixture::params>();
+}
+
+TYPED_TEST(RocprimBlockTopkTests, SelectMinToStriped)
+{
+    test_block_topk<true, true, typename TestFixture::params>();
+}
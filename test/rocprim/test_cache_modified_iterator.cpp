@@ -0,0 +1,297 @@
+// MIT License
+//
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load.hpp>
+#include <rocprim/block/block_store.hpp>
+#include <rocprim/device/device_transform.hpp>
+#include <rocprim/iterator/cache_modified_input_iterator.hpp>
+#include <rocprim/iterator/cache_modified_output_iterator.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+// Params for tests
+template<class InputType,
+         rocprim::cache_load_modifier  LoadModifier,
+         rocprim::cache_store_modifier StoreModifier>
+struct RocprimCacheModifiedIteratorParams
+{
+    using input_type = InputType;
+
+    static constexpr rocprim::cache_load_modifier  load_modifier  = LoadModifier;
+    static constexpr rocprim::cache_store_modifier store_modifier = StoreModifier;
+};
+
+template<class Params>
+class RocprimCacheModifiedIteratorTests : public ::testing::Test
+{
+public:
+    using input_type = typename Params::input_type;
+
+    static constexpr rocprim::cache_load_modifier  load_modifier  = Params::load_modifier;
+    static constexpr rocprim::cache_store_modifier store_modifier = Params::store_modifier;
+
+    const bool debug_synchronous = false;
+};
+
+typedef ::testing::Types<
+    RocprimCacheModifiedIteratorParams<int, rocprim::load_default, rocprim::store_default>,
+    RocprimCacheModifiedIteratorParams<int, rocprim::load_cs, rocprim::store_cs>,
+    RocprimCacheModifiedIteratorParams<int, rocprim::load_cg, rocprim::store_cg>,
+    RocprimCacheModifiedIteratorParams<unsigned char, rocprim::load_cs, rocprim::store_cs>,
+    RocprimCacheModifiedIteratorParams<unsigned short, rocprim::load_ca, rocprim::store_wb>,
+    RocprimCacheModifiedIteratorParams<float, rocprim::load_cv, rocprim::store_wt>,
+    RocprimCacheModifiedIteratorParams<double, rocprim::load_cs, rocprim::store_cs>,
+    RocprimCacheModifiedIteratorParams<unsigned long long,
+                                       rocprim::load_volatile,
+                                       rocprim::store_volatile>,
+    RocprimCacheModifiedIteratorParams<test_utils::custom_test_type<int>,
+                                       rocprim::load_cs,
+                                       rocprim::store_cs>,
+    RocprimCacheModifiedIteratorParams<test_utils::custom_test_type<double>,
+                                       rocprim::load_cg,
+                                       rocprim::store_cg>>
+    RocprimCacheModifiedIteratorTestsParams;
+
+TYPED_TEST_SUITE(RocprimCacheModifiedIteratorTests, RocprimCacheModifiedIteratorTestsParams);
+
+template<class T>
+struct transform
+{
+    __device__ __host__
+    constexpr T operator()(const T& a) const
+    {
+        return a + T(5);
+    }
+};
+
+TYPED_TEST(RocprimCacheModifiedIteratorTests, Arithmetic)
+{
+    using T = typename TestFixture::input_type;
+    using InputIterator
+        = rocprim::cache_modified_input_iterator<TestFixture::load_modifier, T>;
+    using OutputIterator
+        = rocprim::cache_modified_output_iterator<TestFixture::store_modifier, T>;
+
+    std::vector<T> data(8);
+
+    InputIterator x(data.data());
+    InputIterator y = x + 5;
+    ASSERT_EQ(y - x, 5);
+    ASSERT_EQ(y.base(), data.data() + 5);
+    ASSERT_LT(x, y);
+    y -= 5;
+    ASSERT_EQ(x, y);
+
+    OutputIterator o(data.data());
+    OutputIterator p = 3 + o;
+    ASSERT_EQ(p - o, 3);
+    ASSERT_EQ(p.base(), data.data() + 3);
+    p--;
+    ASSERT_NE(o, p);
+    ASSERT_GT(p, o);
+}
+
+TYPED_TEST(RocprimCacheModifiedIteratorTests, Transform)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::input_type;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 1, 100, seed_value);
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            // Calculate expected results on host
+            std::vector<T> expected(size);
+            std::transform(input.begin(), input.end(), expected.begin(), transform<T>());
+
+            // Run
+            HIP_CHECK(rocprim::transform(
+                rocprim::make_cache_modified_input_iterator<TestFixture::load_modifier>(d_input),
+                rocprim::make_cache_modified_output_iterator<TestFixture::store_modifier>(
+                    d_output),
+                size,
+                transform<T>(),
+                stream,
+                debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Copy output to host
+            std::vector<T> output(size);
+            HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+template<class T,
+         unsigned int                  BlockSize,
+         unsigned int                  ItemsPerThread,
+         rocprim::block_load_method    LoadMethod,
+         rocprim::block_store_method   StoreMethod,
+         rocprim::cache_load_modifier  LoadModifier,
+         rocprim::cache_store_modifier StoreModifier>
+__global__
+__launch_bounds__(BlockSize)
+void block_load_store_cache_modified_kernel(T* device_input, T* device_output)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    const unsigned int     offset          = blockIdx.x * items_per_block;
+
+    T items[ItemsPerThread];
+    using block_load_type  = rocprim::block_load<T, BlockSize, ItemsPerThread, LoadMethod>;
+    using block_store_type = rocprim::block_store<T, BlockSize, ItemsPerThread, StoreMethod>;
+    ROCPRIM_SHARED_MEMORY union
+    {
+        typename block_load_type::storage_type  load;
+        typename block_store_type::storage_type store;
+    } storage;
+
+    block_load_type().load(
+        rocprim::make_cache_modified_input_iterator<LoadModifier>(device_input + offset),
+        items,
+        storage.load);
+    rocprim::syncthreads();
+    block_store_type().store(
+        rocprim::make_cache_modified_output_iterator<StoreModifier>(device_output + offset),
+        items,
+        storage.store);
+}
+
+template<class T,
+         rocprim::block_load_method    LoadMethod,
+         rocprim::block_store_method   StoreMethod,
+         rocprim::cache_load_modifier  LoadModifier,
+         rocprim::cache_store_modifier StoreModifier>
+void test_block_load_store_cache_modified()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    constexpr unsigned int block_size       = 256;
+    constexpr unsigned int items_per_thread = 4;
+    constexpr unsigned int grid_size        = 37;
+    constexpr size_t       size             = block_size * items_per_thread * grid_size;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+
+        T* d_input;
+        T* d_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+        block_load_store_cache_modified_kernel<T,
+                                               block_size,
+                                               items_per_thread,
+                                               LoadMethod,
+                                               StoreMethod,
+                                               LoadModifier,
+                                               StoreModifier>
+            <<<grid_size, block_size>>>(d_input, d_output);
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<T> output(size);
+        HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, input));
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_output));
+    }
+}
+
+TEST(RocprimCacheModifiedIteratorTests, BlockLoadStoreVectorize)
+{
+    test_block_load_store_cache_modified<int,
+                                         rocprim::block_load_method::block_load_vectorize,
+                                         rocprim::block_store_method::block_store_vectorize,
+                                         rocprim::load_cs,
+                                         rocprim::store_cs>();
+    test_block_load_store_cache_modified<short,
+                                         rocprim::block_load_method::block_load_vectorize,
+                                         rocprim::block_store_method::block_store_vectorize,
+                                         rocprim::load_cg,
+                                         rocprim::store_cg>();
+    test_block_load_store_cache_modified<double,
+                                         rocprim::block_load_method::block_load_vectorize,
+                                         rocprim::block_store_method::block_store_vectorize,
+                                         rocprim::load_volatile,
+                                         rocprim::store_volatile>();
+    // Not vectorizable
+    test_block_load_store_cache_modified<test_utils::custom_test_type<int>,
+                                         rocprim::block_load_method::block_load_vectorize,
+                                         rocprim::block_store_method::block_store_vectorize,
+                                         rocprim::load_cs,
+                                         rocprim::store_cs>();
+}
+
+TEST(RocprimCacheModifiedIteratorTests, BlockLoadStoreTranspose)
+{
+    test_block_load_store_cache_modified<int,
+                                         rocprim::block_load_method::block_load_transpose,
+                                         rocprim::block_store_method::block_store_transpose,
+                                         rocprim::load_cs,
+                                         rocprim::store_cs>();
+    test_block_load_store_cache_modified<test_utils::custom_test_type<double>,
+                                         rocprim::block_load_method::block_load_transpose,
+                                         rocprim::block_store_method::block_store_transpose,
+                                         rocprim::load_cg,
+                                         rocprim::store_cg>();
+}
@@ -1,9 +1,27 @@
 #include "../common_test_header.hpp"
 
+#include <rocprim/device/config_database.hpp>
 #include <rocprim/device/config_types.hpp>
+#include <rocprim/device/device_autotune.hpp>
+#include <rocprim/device/device_launch_trace.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/device_transform.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include <hip/hip_runtime.h>
 
+#include "test_utils_types.hpp"
+
 using rocprim::detail::target_arch;
 
 __global__ void write_target_arch(target_arch* dest_arch)
@@ -108,3 +126,490 @@ TEST(RocprimConfigDispatchTests, DeviceIdFromStream)
     ASSERT_EQ(result, device_id);
 }
 #endif
+
+TEST(RocprimConfigDispatchTests, ParseConfigDatabase)
+{
+    using rocprim::detail::config_database;
+    using rocprim::detail::parse_config_database;
+
+    std::istringstream input("# algorithm arch types max_size candidate\n"
+                             "\n"
+                             "reduce    gfx90a  float        1024  1 # small inputs\n"
+                             "reduce    gfx90a  float        *     2\n"
+                             "transform *       int32,float  *     3\n");
+    config_database    database;
+    HIP_CHECK(parse_config_database(input, database));
+    ASSERT_EQ(database.size(), 3u);
+    ASSERT_EQ(database[0].algorithm, "reduce");
+    ASSERT_EQ(database[0].arch, "gfx90a");
+    ASSERT_EQ(database[0].types, "float");
+    ASSERT_EQ(database[0].max_size, 1024u);
+    ASSERT_EQ(database[0].candidate, 1u);
+    ASSERT_EQ(database[1].max_size, std::numeric_limits<size_t>::max());
+    ASSERT_TRUE(database[2].arch.empty());
+
+    std::istringstream missing_field("reduce gfx90a float 1024\n");
+    ASSERT_EQ(parse_config_database(missing_field, database), hipErrorInvalidValue);
+    std::istringstream bad_size("reduce gfx90a float 1k 1\n");
+    ASSERT_EQ(parse_config_database(bad_size, database), hipErrorInvalidValue);
+
+    ASSERT_EQ(rocprim::load_config_database("this/file/does/not/exist"), hipErrorFileNotFound);
+}
+
+TEST(RocprimConfigDispatchTests, ConfigDatabaseTypeNames)
+{
+    using rocprim::detail::config_database_types;
+
+    ASSERT_EQ(config_database_types<int>::name(), "int32");
+    ASSERT_EQ(config_database_types<unsigned char>::name(), "uint8");
+    ASSERT_EQ(config_database_types<const long long>::name(), "int64");
+    ASSERT_EQ(config_database_types<float>::name(), "float");
+    ASSERT_EQ(config_database_types<rocprim::half>::name(), "half");
+    ASSERT_EQ((config_database_types<short, double>::name()), "int16,double");
+
+    struct custom_type
+    {
+        int values[3];
+    };
+    ASSERT_EQ(config_database_types<custom_type>::name(), "size12");
+}
+
+namespace
+{
+
+void write_config_database(const char* path, const char* contents)
+{
+    std::ofstream file(path);
+    file << contents;
+}
+
+void record_launch(const rocprim::kernel_launch_info& info, void* user_data)
+{
+    static_cast<std::vector<rocprim::kernel_launch_info>*>(user_data)->push_back(info);
+}
+
+// A file in the temporary directory with a name that concurrent test processes do not share.
+// It is removed at the end of the test, also when an assertion fails.
+struct temporary_file
+{
+    std::string path;
+
+    explicit temporary_file(const std::string& name)
+    {
+        std::random_device random;
+        path = ::testing::TempDir() + name + "_" + std::to_string(random()) + "_"
+               + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count())
+               + ".txt";
+    }
+
+    ~temporary_file()
+    {
+        std::remove(path.c_str());
+    }
+};
+
+struct add_two
+{
+    __device__ __host__ inline int operator()(const int value) const
+    {
+        return value + 2;
+    }
+};
+
+// Not declared pure, so calls with it are not tuned.
+struct add_three
+{
+    __device__ __host__ inline int operator()(const int value) const
+    {
+        return value + 3;
+    }
+};
+
+} // namespace
+
+namespace rocprim
+{
+
+template<>
+struct is_pure_operation<add_two> : std::true_type
+{};
+
+} // namespace rocprim
+
+TEST(RocprimConfigDispatchTests, TunedConfigSelectsCandidate)
+{
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using config = rocprim::tuned_config<rocprim::transform_config<64, 1>,
+                                         rocprim::transform_config<256, 2>>;
+
+    const hipStream_t    stream = 0;
+    const size_t         size   = 1 << 16;
+    const temporary_file database("rocprim_test_config_database");
+    const char*          path = database.path.c_str();
+
+    std::vector<int> input(size);
+    std::iota(input.begin(), input.end(), 0);
+
+    int* d_input;
+    int* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(int)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(int), hipMemcpyHostToDevice));
+
+    std::vector<rocprim::kernel_launch_info> launches;
+    rocprim::launch_tracer                   tracer;
+    tracer.on_launch = &record_launch;
+    tracer.user_data = &launches;
+    rocprim::scoped_launch_tracer trace(tracer);
+
+    // Candidate 0 is the default config, its geometry depends on the architecture.
+    const auto run = [&](const unsigned int expected_candidate,
+                         const unsigned int expected_block_size,
+                         const unsigned int expected_items_per_thread)
+    {
+        launches.clear();
+        HIP_CHECK(rocprim::transform<config>(d_input, d_output, size, add_two(), stream));
+        ASSERT_FALSE(launches.empty());
+        ASSERT_EQ(launches.front().config_candidate, expected_candidate);
+        ASSERT_GT(launches.front().items_per_thread, 0u);
+        if(expected_candidate != 0)
+        {
+            ASSERT_EQ(launches.front().block_size.x, expected_block_size);
+            ASSERT_EQ(launches.front().items_per_thread, expected_items_per_thread);
+        }
+
+        std::vector<int> output(size);
+        HIP_CHECK(
+            hipMemcpy(output.data(), d_output, size * sizeof(int), hipMemcpyDeviceToHost));
+        for(size_t i = 0; i < size; ++i)
+        {
+            ASSERT_EQ(output[i], input[i] + 2) << "where index = " << i;
+        }
+    };
+
+    // The type key of transform is the input type followed by the output type.
+    write_config_database(path,
+                          "transform * int32,int32 1024 1\n"
+                          "transform * int32,int32 *    2\n");
+    HIP_CHECK(rocprim::load_config_database(path));
+    ASSERT_NO_FATAL_FAILURE(run(2, 256, 2));
+
+    write_config_database(path, "transform * int32,int32 * 1\n");
+    HIP_CHECK(rocprim::load_config_database(path));
+    ASSERT_NO_FATAL_FAILURE(run(1, 64, 1));
+
+    // Entries for other algorithms, types or too small sizes and out of range candidates
+    // fall back to the compiled-in default config.
+    write_config_database(path,
+                          "reduce    * int32,int32 *    1\n"
+                          "transform * float,float *    1\n"
+                          "transform * int32,int32 1024 2\n"
+                          "transform * int32,int32 *    3\n");
+    HIP_CHECK(rocprim::load_config_database(path));
+    ASSERT_NO_FATAL_FAILURE(run(0, 0, 0));
+
+    rocprim::clear_config_database();
+    ASSERT_NO_FATAL_FAILURE(run(0, 0, 0));
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
+
+TEST(RocprimConfigDispatchTests, TunedConfigStorageSize)
+{
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using small_config
+        = rocprim::reduce_config<64, 1, rocprim::block_reduce_algorithm::default_algorithm>;
+    using large_config
+        = rocprim::reduce_config<256, 16, rocprim::block_reduce_algorithm::default_algorithm>;
+    using config       = rocprim::tuned_config<small_config, large_config>;
+
+    const hipStream_t    stream = 0;
+    const size_t         size   = 1 << 20;
+    const temporary_file database("rocprim_test_config_database");
+    const char*          path = database.path.c_str();
+
+    std::vector<int> input = test_utils::get_random_data<int>(size, 0, 100, 0);
+
+    int* d_input;
+    int* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(int)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(int), hipMemcpyHostToDevice));
+
+    // The storage size of a tuned config covers every candidate.
+    size_t small_storage_size = 0;
+    HIP_CHECK(rocprim::reduce<small_config>(nullptr, small_storage_size, d_input, d_output, size));
+    size_t large_storage_size = 0;
+    HIP_CHECK(rocprim::reduce<large_config>(nullptr, large_storage_size, d_input, d_output, size));
+    size_t storage_size = 0;
+    HIP_CHECK(rocprim::reduce<config>(nullptr, storage_size, d_input, d_output, size));
+    ASSERT_GE(storage_size, small_storage_size);
+    ASSERT_GE(storage_size, large_storage_size);
+
+    void* d_temp_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, storage_size));
+
+    for(const char* contents : {"reduce * int32 * 1\n", "reduce * int32 * 2\n"})
+    {
+        write_config_database(path, contents);
+        HIP_CHECK(rocprim::load_config_database(path));
+
+        HIP_CHECK(rocprim::reduce<config>(d_temp_storage,
+                                          storage_size,
+                                          d_input,
+                                          d_output,
+                                          size,
+                                          rocprim::plus<int>(),
+                                          stream));
+        int output;
+        HIP_CHECK(hipMemcpy(&output, d_output, sizeof(int), hipMemcpyDeviceToHost));
+        ASSERT_EQ(output, std::accumulate(input.begin(), input.end(), 0));
+    }
+
+    rocprim::clear_config_database();
+    HIP_CHECK(hipFree(d_temp_storage));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
+
+template<unsigned int Arch, class Value, class Enable = void>
+struct test_size_buckets
+    : rocprim::detail::size_buckets<
+          rocprim::detail::size_bucket<1000, rocprim::transform_config<64, 1>>,
+          rocprim::detail::size_bucket<100000, rocprim::transform_config<128, 2>>>
+{};
+
+template<unsigned int Index>
+unsigned int size_bucket_index(
+    rocprim::detail::config_tag<rocprim::detail::default_size_bucket_config<Index>>)
+{
+    return Index;
+}
+
+unsigned int size_bucket_index(rocprim::detail::config_tag<rocprim::default_config>)
+{
+    return 10;
+}
+
+TEST(RocprimConfigDispatchTests, SizeBucketSelection)
+{
+    using rocprim::default_config;
+    using rocprim::detail::select_size_bucket;
+    using rocprim::detail::size_bucket_table;
+    using rocprim::detail::default_size_bucket_config;
+
+    using buckets = test_size_buckets<0, int>::buckets;
+    static_assert(std::is_same<select_size_bucket<0, buckets, default_config>::type,
+                               rocprim::transform_config<64, 1>>::value,
+                  "");
+    static_assert(std::is_same<select_size_bucket<1, buckets, default_config>::type,
+                               rocprim::transform_config<128, 2>>::value,
+                  "");
+    static_assert(
+        std::is_same<select_size_bucket<2, buckets, default_config>::type, default_config>::value,
+        "");
+    static_assert(size_bucket_table<test_size_buckets, int>::max_count == 2, "");
+    static_assert(rocprim::detail::no_size_buckets::max_count == 0, "");
+
+    // Buckets that are not in the table of the architecture use the default config.
+    using bucket_config  = rocprim::detail::wrapped_transform_config<default_size_bucket_config<3>,
+                                                                    int>::architecture_config<
+        target_arch::unknown>;
+    using default_params = rocprim::detail::wrapped_transform_config<default_config, int>::
+        architecture_config<target_arch::unknown>;
+    static_assert(bucket_config::params.kernel_config.block_size
+                      == default_params::params.kernel_config.block_size,
+                  "");
+    static_assert(bucket_config::params.kernel_config.items_per_thread
+                      == default_params::params.kernel_config.items_per_thread,
+                  "");
+}
+
+TEST(RocprimConfigDispatchTests, SizeBucketDispatch)
+{
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using table = rocprim::detail::size_bucket_table<test_size_buckets, int>;
+
+    const hipStream_t stream = 0;
+
+    const auto selected_bucket = [&](const size_t size)
+    {
+        unsigned int index = 0;
+        HIP_CHECK(rocprim::detail::dispatch_size_bucket<table>(size,
+                                                               stream,
+                                                               nullptr,
+                                                               nullptr,
+                                                               [&](auto config_tag)
+                                                               {
+                                                                   index = size_bucket_index(
+                                                                       config_tag);
+                                                                   return hipSuccess;
+                                                               }));
+        return index;
+    };
+
+    // Bucket limits are inclusive, larger sizes use the default config.
+    ASSERT_EQ(selected_bucket(0), 0);
+    ASSERT_EQ(selected_bucket(1000), 0);
+    ASSERT_EQ(selected_bucket(1001), 1);
+    ASSERT_EQ(selected_bucket(100000), 1);
+    ASSERT_EQ(selected_bucket(100001), 10);
+
+    // A storage size query covers every bucket.
+    int    dummy_storage;
+    size_t storage_size = 0;
+    HIP_CHECK(rocprim::detail::dispatch_size_bucket<table>(
+        10,
+        stream,
+        nullptr,
+        &storage_size,
+        [&](auto config_tag)
+        {
+            storage_size = size_bucket_index(config_tag) + 1;
+            return hipSuccess;
+        }));
+    ASSERT_EQ(storage_size, 11);
+
+    HIP_CHECK(rocprim::detail::dispatch_size_bucket<table>(
+        10,
+        stream,
+        &dummy_storage,
+        &storage_size,
+        [&](auto config_tag)
+        {
+            storage_size = size_bucket_index(config_tag) + 1;
+            return hipSuccess;
+        }));
+    ASSERT_EQ(storage_size, 1);
+}
+
+TEST(RocprimConfigDispatchTests, ParseAutotuneCache)
+{
+    using rocprim::detail::autotune_entry;
+    using rocprim::detail::parse_autotune_cache;
+
+    std::istringstream input("# algorithm device types size_bucket candidate\n"
+                             "\n"
+                             "reduce    gfx90a_cu104 float       11 1 # first selection\n"
+                             "transform gfx90a_cu104 int32,int32 17 2\n"
+                             "reduce    gfx90a_cu104 float       11 3\n");
+    std::unordered_map<std::string, autotune_entry> entries;
+    HIP_CHECK(parse_autotune_cache(input, entries));
+    ASSERT_EQ(entries.size(), 2u);
+    ASSERT_EQ(entries["reduce gfx90a_cu104 float 11"].candidate, 3u);
+    ASSERT_EQ(entries["transform gfx90a_cu104 int32,int32 17"].candidate, 2u);
+    ASSERT_TRUE(entries["transform gfx90a_cu104 int32,int32 17"].tuned);
+
+    std::istringstream missing_field("reduce gfx90a_cu104 float 11\n");
+    ASSERT_EQ(parse_autotune_cache(missing_field, entries), hipErrorInvalidValue);
+    std::istringstream bad_candidate("reduce gfx90a_cu104 float 11 x\n");
+    ASSERT_EQ(parse_autotune_cache(bad_candidate, entries), hipErrorInvalidValue);
+}
+
+TEST(RocprimConfigDispatchTests, AutotuneSizeBucket)
+{
+    using rocprim::detail::autotune_size_bucket;
+
+    ASSERT_EQ(autotune_size_bucket(0), 0u);
+    ASSERT_EQ(autotune_size_bucket(1), 1u);
+    ASSERT_EQ(autotune_size_bucket(1023), 10u);
+    ASSERT_EQ(autotune_size_bucket(1024), 11u);
+    ASSERT_EQ(autotune_size_bucket(size_t(1) << 40), 41u);
+}
+
+TEST(RocprimConfigDispatchTests, AutotuneTunedConfig)
+{
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using config = rocprim::tuned_config<rocprim::transform_config<64, 1>,
+                                         rocprim::transform_config<256, 2>>;
+
+    const hipStream_t    stream = 0;
+    const size_t         size   = 1 << 16;
+    const temporary_file cache("rocprim_test_autotune_cache");
+
+    std::vector<int> input(size);
+    std::iota(input.begin(), input.end(), 0);
+
+    int* d_input;
+    int* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(int)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(int), hipMemcpyHostToDevice));
+
+    const auto run = [&](auto transform_op, const int added)
+    {
+        HIP_CHECK(hipMemset(d_output, 0, size * sizeof(int)));
+        HIP_CHECK(rocprim::transform<config>(d_input, d_output, size, transform_op, stream));
+
+        std::vector<int> output(size);
+        HIP_CHECK(
+            hipMemcpy(output.data(), d_output, size * sizeof(int), hipMemcpyDeviceToHost));
+        for(size_t i = 0; i < size; ++i)
+        {
+            ASSERT_EQ(output[i], input[i] + added) << "where index = " << i;
+        }
+    };
+    const auto read_lines = [](const std::string& path)
+    {
+        std::vector<std::string> lines;
+        std::ifstream            file(path);
+        std::string              line;
+        while(std::getline(file, line))
+        {
+            lines.push_back(line);
+        }
+        return lines;
+    };
+
+    rocprim::clear_config_database();
+    rocprim::autotune_options options;
+    options.cache_path = cache.path.c_str();
+    HIP_CHECK(rocprim::enable_autotune(options));
+
+    // Operations that are not declared pure are not tuned.
+    ASSERT_NO_FATAL_FAILURE(run(add_three(), 3));
+    ASSERT_TRUE(read_lines(cache.path).empty());
+
+    // The first call tunes and appends the selection to the cache, later calls reuse it.
+    ASSERT_NO_FATAL_FAILURE(run(add_two(), 2));
+    ASSERT_NO_FATAL_FAILURE(run(add_two(), 2));
+    rocprim::disable_autotune();
+
+    const std::vector<std::string> lines = read_lines(cache.path);
+    ASSERT_EQ(lines.size(), 1u);
+    ASSERT_EQ(lines[0].find("transform "), 0u);
+    ASSERT_NE(lines[0].find(" int32,int32 17 "), std::string::npos);
+
+    // A new autotuner state loads the selection instead of tuning again.
+    rocprim::detail::autotune_state state;
+    HIP_CHECK(rocprim::detail::enable_autotune(state, options));
+    ASSERT_EQ(state.entries.size(), 1u);
+    ASSERT_TRUE(state.entries.begin()->second.tuned);
+    ASSERT_LT(state.entries.begin()->second.candidate, 3u);
+
+    // Running out of the time budget after the default config stops tuning, and the partial
+    // selection is not stored.
+    const temporary_file budget_cache("rocprim_test_autotune_budget_cache");
+    options.cache_path     = budget_cache.path.c_str();
+    options.time_budget_ms = 1e-6f;
+    HIP_CHECK(rocprim::enable_autotune(options));
+    ASSERT_NO_FATAL_FAILURE(run(add_two(), 2));
+    rocprim::disable_autotune();
+    ASSERT_TRUE(read_lines(budget_cache.path).empty());
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
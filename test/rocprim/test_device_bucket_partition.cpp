@@ -0,0 +1,207 @@
+// MIT License
+//
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_bucket_partition.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+template<class T, unsigned int NumBuckets, class Config = rocprim::default_config>
+struct params
+{
+    using value_type                          = T;
+    static constexpr unsigned int num_buckets = NumBuckets;
+    using config                              = Config;
+};
+
+template<class Params>
+class RocprimDeviceBucketPartition : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<int, 1>,
+                         params<int, 3>,
+                         params<unsigned int, 256>,
+                         params<uint8_t, 7>,
+                         params<double, 100>,
+                         params<unsigned long long, 1000>,
+                         params<int, 4096>,
+                         params<short, 17, rocprim::bucket_partition_config<128, 3>>,
+                         params<unsigned int, 4096, rocprim::bucket_partition_config<512, 1>>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceBucketPartition, Params);
+
+template<class T>
+struct bucket_partition_test_op
+{
+    unsigned int num_buckets;
+
+    ROCPRIM_HOST_DEVICE
+    unsigned int operator()(const T& value) const
+    {
+        // Spread consecutive values over the buckets
+        return (static_cast<unsigned int>(value) * 2654435761u >> 8) % num_buckets;
+    }
+};
+
+TYPED_TEST(RocprimDeviceBucketPartition, Partition)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = typename TestFixture::params::value_type;
+    using config = typename TestFixture::params::config;
+
+    constexpr unsigned int num_buckets = TestFixture::params::num_buckets;
+
+    const bool debug_synchronous = false;
+
+    const bucket_partition_test_op<T> bucket_op{num_buckets};
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            hipStream_t stream = 0; // default
+
+            // Generate data
+            const T max_value = static_cast<T>(
+                std::min<double>(static_cast<double>(std::numeric_limits<T>::max()), 1 << 20));
+            std::vector<T> input = test_utils::get_random_data<T>(size, 0, max_value, seed_value);
+
+            // Calculate expected results on host
+            std::vector<T> expected(input);
+            std::stable_sort(expected.begin(),
+                             expected.end(),
+                             [bucket_op](const T& a, const T& b)
+                             { return bucket_op(a) < bucket_op(b); });
+
+            std::vector<size_t> offsets_expected(num_buckets + 1, 0);
+            for(const T& value : input)
+            {
+                ++offsets_expected[bucket_op(value) + 1];
+            }
+            std::partial_sum(offsets_expected.begin(),
+                             offsets_expected.end(),
+                             offsets_expected.begin());
+
+            T*      d_input;
+            T*      d_output;
+            size_t* d_offsets;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_offsets, (num_buckets + 1) * sizeof(size_t)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(rocprim::bucket_partition<config>(nullptr,
+                                                        temporary_storage_bytes,
+                                                        d_input,
+                                                        d_output,
+                                                        d_offsets,
+                                                        size,
+                                                        num_buckets,
+                                                        bucket_op,
+                                                        stream,
+                                                        debug_synchronous));
+
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(rocprim::bucket_partition<config>(d_temporary_storage,
+                                                        temporary_storage_bytes,
+                                                        d_input,
+                                                        d_output,
+                                                        d_offsets,
+                                                        size,
+                                                        num_buckets,
+                                                        bucket_op,
+                                                        stream,
+                                                        debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<T>      output(size);
+            std::vector<size_t> offsets(num_buckets + 1);
+            HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(offsets.data(),
+                                d_offsets,
+                                (num_buckets + 1) * sizeof(size_t),
+                                hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(offsets, offsets_expected));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_offsets));
+            HIP_CHECK(hipFree(d_temporary_storage));
+        }
+    }
+}
+
+TEST(RocprimDeviceBucketPartitionInvalid, NumBuckets)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    int*    d_data    = nullptr;
+    size_t* d_offsets = nullptr;
+
+    size_t temporary_storage_bytes = 0;
+    for(unsigned int num_buckets : {0u, rocprim::detail::bucket_partition_max_buckets + 1})
+    {
+        SCOPED_TRACE(testing::Message() << "with num_buckets = " << num_buckets);
+        ASSERT_EQ(rocprim::bucket_partition(nullptr,
+                                            temporary_storage_bytes,
+                                            d_data,
+                                            d_data,
+                                            d_offsets,
+                                            0,
+                                            num_buckets,
+                                            bucket_partition_test_op<int>{1}),
+                  hipErrorInvalidValue);
+    }
+}
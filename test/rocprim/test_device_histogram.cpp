@@ -127,6 +127,12 @@ public:
 };
 
 using custom_config1 = rocprim::histogram_config<rocprim::kernel_config<128, 5>>;
+using custom_config1_warp_aggregated
+    = rocprim::histogram_config<rocprim::kernel_config<128, 5>,
+                                1024,
+                                2048,
+                                3,
+                                rocprim::block_histogram_algorithm::using_warp_aggregated_atomic>;
 
 typedef ::testing::Types<params1<int, 10, 0, 10>,
                          params1<float, 10, 0, 10>,
@@ -142,6 +148,14 @@ typedef ::testing::Types<params1<int, 10, 0, 10>,
                          params1<double, 10, 0, 1000, double, int>,
                          params1<int, 123, 100, 5635, int>,
                          params1<double, 55, -123, +123, double, unsigned int, custom_config1>,
+                         params1<int, 10, 0, 10, int, int, custom_config1_warp_aggregated>,
+                         params1<unsigned char,
+                                 256,
+                                 0,
+                                 256,
+                                 short,
+                                 int,
+                                 custom_config1_warp_aggregated>,
                          params1<int, 10, 0, 10, int, int, rocprim::default_config, true>>
     Params1;
 
@@ -404,6 +418,12 @@ public:
 };
 
 using custom_config2 = rocprim::histogram_config<rocprim::kernel_config<256, 2>>;
+using custom_config2_warp_aggregated
+    = rocprim::histogram_config<rocprim::kernel_config<256, 2>,
+                                1024,
+                                2048,
+                                3,
+                                rocprim::block_histogram_algorithm::using_warp_aggregated_atomic>;
 
 typedef ::testing::Types<
     params2<int, 10, 0, 1, 10>,
@@ -411,6 +431,7 @@ typedef ::testing::Types<
     params2<unsigned int, 10000, 0, 1, 100, unsigned int, unsigned long long, custom_config2>,
     params2<unsigned short, 65536, 0, 1, 1, int>,
     params2<unsigned char, 256, 0, 1, 1, unsigned short, int, custom_config2>,
+    params2<float, 456, -100, 1, 123, float, int, custom_config2_warp_aggregated>,
 
     params2<float, 456, -100, 1, 123>,
     params2<double, 3, 10000, 1000, 1000, double, unsigned int>,
@@ -0,0 +1,285 @@
+// MIT License
+//
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_launch_trace.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/device_transform.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct launch_recorder
+{
+    std::vector<rocprim::kernel_launch_info> launches;
+    std::vector<rocprim::kernel_launch_info> timed_launches;
+    std::vector<float>                       timings;
+
+    static void on_launch(const rocprim::kernel_launch_info& info, void* user_data)
+    {
+        static_cast<launch_recorder*>(user_data)->launches.push_back(info);
+    }
+
+    static void
+        on_timing(const rocprim::kernel_launch_info& info, float elapsed_ms, void* user_data)
+    {
+        auto* recorder = static_cast<launch_recorder*>(user_data);
+        recorder->timed_launches.push_back(info);
+        recorder->timings.push_back(elapsed_ms);
+    }
+
+    rocprim::launch_tracer tracer()
+    {
+        rocprim::launch_tracer tracer;
+        tracer.on_launch = &launch_recorder::on_launch;
+        tracer.on_timing = &launch_recorder::on_timing;
+        tracer.user_data = this;
+        return tracer;
+    }
+};
+
+template<class T>
+struct plus_one
+{
+    __device__ __host__ inline T operator()(const T& value) const
+    {
+        return value + T(1);
+    }
+};
+
+template<class T>
+hipError_t run_transform(T* d_input, T* d_output, const size_t size, const hipStream_t stream)
+{
+    return rocprim::transform(d_input, d_output, size, plus_one<T>(), stream);
+}
+
+template<class T>
+hipError_t run_reduce(T* d_input, T* d_output, const size_t size, const hipStream_t stream)
+{
+    size_t temp_storage_size = 0;
+    HIP_CHECK(rocprim::reduce(nullptr, temp_storage_size, d_input, d_output, size));
+
+    void* d_temp_storage = nullptr;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size));
+    const hipError_t error = rocprim::reduce(d_temp_storage,
+                                             temp_storage_size,
+                                             d_input,
+                                             d_output,
+                                             size,
+                                             rocprim::plus<T>(),
+                                             stream);
+    HIP_CHECK(hipStreamSynchronize(stream));
+    HIP_CHECK(hipFree(d_temp_storage));
+    return error;
+}
+
+} // namespace
+
+TEST(RocprimDeviceLaunchTraceTests, ScopedTracerTransform)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+    hipStream_t stream = 0;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            if(size == 0)
+            {
+                continue;
+            }
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            launch_recorder recorder;
+            {
+                rocprim::scoped_launch_tracer trace(recorder.tracer());
+                HIP_CHECK(run_transform(d_input, d_output, size, stream));
+            }
+            HIP_CHECK(rocprim::flush_launch_timings());
+
+            ASSERT_FALSE(recorder.launches.empty());
+            size_t traced_size = 0;
+            for(const rocprim::kernel_launch_info& info : recorder.launches)
+            {
+                ASSERT_EQ(std::string(info.algorithm), "transform");
+                ASSERT_EQ(std::string(info.kernel_name), "transform_kernel");
+                ASSERT_GT(info.grid_size.x, 0u);
+                ASSERT_GT(info.block_size.x, 0u);
+                ASSERT_GT(info.items_per_thread, 0u);
+                ASSERT_EQ(info.dynamic_shared_memory, 0u);
+                ASSERT_EQ(info.config_candidate, 0u);
+                ASSERT_EQ(info.stream, stream);
+                traced_size += info.size;
+            }
+            ASSERT_EQ(traced_size, size);
+
+            ASSERT_EQ(recorder.timings.size(), recorder.launches.size());
+            for(float elapsed_ms : recorder.timings)
+            {
+                ASSERT_GE(elapsed_ms, 0.0f);
+            }
+
+            // The tracer is no longer active outside of its scope.
+            HIP_CHECK(run_transform(d_input, d_output, size, stream));
+            HIP_CHECK(rocprim::flush_launch_timings());
+            ASSERT_EQ(recorder.timings.size(), recorder.launches.size());
+
+            std::vector<T> output(size);
+            HIP_CHECK(
+                hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+            std::vector<T> expected(size);
+            std::transform(input.begin(), input.end(), expected.begin(), plus_one<T>());
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+TEST(RocprimDeviceLaunchTraceTests, GlobalTracerReduce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T            = int;
+    hipStream_t  stream = 0;
+    const size_t size   = 1 << 20;
+
+    std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, 0);
+
+    T* d_input;
+    T* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+    launch_recorder recorder;
+    rocprim::set_launch_tracer(recorder.tracer());
+    ASSERT_EQ(rocprim::get_launch_tracer().user_data, &recorder);
+    HIP_CHECK(run_reduce(d_input, d_output, size, stream));
+
+    // A scoped tracer without callbacks disables tracing on the calling thread.
+    {
+        rocprim::scoped_launch_tracer disable(rocprim::launch_tracer{});
+        HIP_CHECK(run_reduce(d_input, d_output, size, stream));
+    }
+    rocprim::set_launch_tracer(rocprim::launch_tracer{});
+    HIP_CHECK(rocprim::flush_launch_timings());
+
+    // Large reductions launch the block reduction followed by the nested one.
+    ASSERT_GE(recorder.launches.size(), 2u);
+    for(const rocprim::kernel_launch_info& info : recorder.launches)
+    {
+        ASSERT_EQ(std::string(info.algorithm), "reduce");
+        ASSERT_EQ(std::string(info.kernel_name), "block_reduce_kernel");
+    }
+    ASSERT_EQ(recorder.launches.front().size, size);
+    ASSERT_EQ(recorder.launches.back().grid_size.x, 1u);
+    ASSERT_EQ(recorder.timings.size(), recorder.launches.size());
+
+    const size_t launches = recorder.launches.size();
+    HIP_CHECK(run_reduce(d_input, d_output, size, stream));
+    HIP_CHECK(rocprim::flush_launch_timings());
+    ASSERT_EQ(recorder.launches.size(), launches);
+
+    T output;
+    HIP_CHECK(hipMemcpy(&output, d_output, sizeof(T), hipMemcpyDeviceToHost));
+    ASSERT_EQ(output, std::accumulate(input.begin(), input.end(), T(0)));
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
+
+TEST(RocprimDeviceLaunchTraceTests, GraphCaptureSkipsTiming)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T           = int;
+    const size_t size = 1 << 16;
+
+    // Default stream does not support hipGraph stream capture, so create one
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, 0);
+
+    T* d_input;
+    T* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+    launch_recorder recorder;
+    hipGraph_t      graph = test_utils::createGraphHelper(stream);
+    {
+        rocprim::scoped_launch_tracer trace(recorder.tracer());
+        HIP_CHECK(run_transform(d_input, d_output, size, stream));
+    }
+    hipGraphExec_t graph_instance
+        = test_utils::endCaptureGraphHelper(graph, stream, true, true);
+    HIP_CHECK(rocprim::flush_launch_timings());
+
+    ASSERT_FALSE(recorder.launches.empty());
+    ASSERT_TRUE(recorder.timings.empty());
+
+    std::vector<T> output(size);
+    HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+    std::vector<T> expected(size);
+    std::transform(input.begin(), input.end(), expected.begin(), plus_one<T>());
+    ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+    test_utils::cleanupGraphHelper(graph, graph_instance);
+    HIP_CHECK(hipStreamDestroy(stream));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
@@ -406,3 +406,168 @@ TYPED_TEST(RocprimDeviceSortTests, SortKeyValue)
         }
     }
 }
+
+TYPED_TEST(RocprimDeviceSortTests, NaturalSortKeyValue)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type = typename TestFixture::key_type;
+    using value_type = typename TestFixture::value_type;
+    using compare_function = typename TestFixture::compare_function;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    if(TestFixture::use_graphs)
+    {
+        GTEST_SKIP() << "natural_merge_sort synchronizes the stream, it cannot be captured in a graph";
+    }
+
+    // Fraction of the input that is shuffled after sorting: none, short windows, or everything
+    const std::vector<double> disorders = {0.0, 0.01, 1.0};
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            for(double disorder : disorders)
+            {
+                SCOPED_TRACE(testing::Message() << "with disorder = " << disorder);
+
+                hipStream_t stream = 0; // default
+
+                // compare function
+                compare_function compare_op;
+
+                // Generate nearly sorted data by shuffling windows of sorted keys
+                std::vector<key_type> keys_input = test_utils::get_random_data<key_type>(size, -100, 100, seed_value); // float16 can't exceed 65504
+                std::stable_sort(keys_input.begin(), keys_input.end(), compare_op);
+
+                std::default_random_engine gen(seed_value);
+                const size_t window_size = disorder < 1.0 ? 64 : size;
+                const size_t windows = static_cast<size_t>(disorder * size / window_size);
+                for(size_t i = 0; i < windows && size > 0; i++)
+                {
+                    const size_t begin = std::uniform_int_distribution<size_t>(0, size - 1)(gen);
+                    const size_t end = std::min(size, begin + window_size);
+                    std::shuffle(keys_input.begin() + begin, keys_input.begin() + end, gen);
+                }
+
+                std::vector<value_type> values_input(size);
+                test_utils::iota(values_input.begin(), values_input.end(), 0);
+
+                std::vector<key_type> keys_output(size);
+                std::vector<value_type> values_output(size);
+
+                key_type * d_keys_input;
+                key_type * d_keys_output;
+                value_type * d_values_input;
+                value_type * d_values_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input, size * sizeof(value_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output, size * sizeof(value_type)));
+                HIP_CHECK(
+                    hipMemcpy(
+                        d_keys_input, keys_input.data(),
+                        size * sizeof(key_type),
+                        hipMemcpyHostToDevice
+                    )
+                );
+                HIP_CHECK(
+                    hipMemcpy(
+                        d_values_input, values_input.data(),
+                        size * sizeof(value_type),
+                        hipMemcpyHostToDevice
+                    )
+                );
+
+                // Calculate expected results on host
+                using key_value = std::pair<key_type, value_type>;
+                std::vector<key_value> expected(size);
+                for(size_t i = 0; i < size; i++)
+                {
+                    expected[i] = key_value(keys_input[i], values_input[i]);
+                }
+                std::stable_sort(expected.begin(),
+                                 expected.end(),
+                                 [compare_op](const key_value& a, const key_value& b)
+                                 { return compare_op(a.first, b.first); });
+
+                // temp storage
+                size_t temp_storage_size_bytes;
+                void * d_temp_storage = nullptr;
+                // Get size of d_temp_storage
+                HIP_CHECK(rocprim::natural_merge_sort(d_temp_storage,
+                                                      temp_storage_size_bytes,
+                                                      d_keys_input,
+                                                      d_keys_output,
+                                                      d_values_input,
+                                                      d_values_output,
+                                                      size,
+                                                      compare_op,
+                                                      stream,
+                                                      debug_synchronous));
+
+                // temp_storage_size_bytes must be >0
+                ASSERT_GT(temp_storage_size_bytes, 0);
+
+                // allocate temporary storage
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+                // Run
+                HIP_CHECK(rocprim::natural_merge_sort(d_temp_storage,
+                                                      temp_storage_size_bytes,
+                                                      d_keys_input,
+                                                      d_keys_output,
+                                                      d_values_input,
+                                                      d_values_output,
+                                                      size,
+                                                      compare_op,
+                                                      stream,
+                                                      debug_synchronous));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                // Copy output to host
+                HIP_CHECK(
+                    hipMemcpy(
+                        keys_output.data(), d_keys_output,
+                        size * sizeof(key_type),
+                        hipMemcpyDeviceToHost
+                    )
+                );
+                HIP_CHECK(
+                    hipMemcpy(
+                        values_output.data(), d_values_output,
+                        size * sizeof(value_type),
+                        hipMemcpyDeviceToHost
+                    )
+                );
+
+                // Check if output values are as expected
+                std::vector<key_type> expected_key(size);
+                std::vector<value_type> expected_value(size);
+                for(size_t i = 0; i < size; i++)
+                {
+                    expected_key[i] = expected[i].first;
+                    expected_value[i] = expected[i].second;
+                }
+
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected_key));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, expected_value));
+
+                hipFree(d_keys_input);
+                hipFree(d_keys_output);
+                hipFree(d_values_input);
+                hipFree(d_values_output);
+                hipFree(d_temp_storage);
+            }
+        }
+    }
+}
@@ -519,3 +519,113 @@ TYPED_TEST(RocprimDevicePartialSortTests, PartialSortCopy)
         }
     }
 }
+
+// With a SortLimit, inputs up to the limit are sorted completely instead of running nth element
+// first. The default configs keep a limit of 0, so the typed tests above do not cover this path.
+TEST(RocprimDevicePartialSortSortLimitTests, PartialSortSortLimit)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type = int;
+    using config
+        = rocprim::partial_sort_config<rocprim::default_config, rocprim::default_config, 1 << 20>;
+    const hipStream_t             stream = 0;
+    const rocprim::less<key_type> compare_op;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; ++seed_index)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            if(size == 0 || size > config::sort_limit)
+            {
+                continue;
+            }
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const size_t middle = test_utils::get_random_value<size_t>(0, size - 1, seed_value);
+            SCOPED_TRACE(testing::Message() << "with middle = " << middle);
+
+            const std::vector<key_type> input
+                = test_utils::get_random_data<key_type>(size, -1000, 1000, seed_value);
+            const std::vector<key_type> output_original
+                = test_utils::get_random_data<key_type>(size, -1000, 1000, seed_value + 1);
+
+            key_type* d_keys;
+            key_type* d_input;
+            key_type* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(key_type)));
+            HIP_CHECK(
+                hipMemcpy(d_keys, input.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_output,
+                                output_original.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+
+            size_t sort_storage_size{};
+            size_t copy_storage_size{};
+            HIP_CHECK(rocprim::partial_sort<config>(nullptr,
+                                                    sort_storage_size,
+                                                    d_keys,
+                                                    middle,
+                                                    size,
+                                                    compare_op,
+                                                    stream));
+            HIP_CHECK(rocprim::partial_sort_copy<config>(nullptr,
+                                                         copy_storage_size,
+                                                         d_input,
+                                                         d_output,
+                                                         middle,
+                                                         size,
+                                                         compare_op,
+                                                         stream));
+            void* d_temp_storage{};
+            HIP_CHECK(test_common_utils::hipMallocHelper(
+                &d_temp_storage,
+                std::max(sort_storage_size, copy_storage_size)));
+
+            HIP_CHECK(rocprim::partial_sort<config>(d_temp_storage,
+                                                    sort_storage_size,
+                                                    d_keys,
+                                                    middle,
+                                                    size,
+                                                    compare_op,
+                                                    stream));
+            HIP_CHECK(rocprim::partial_sort_copy<config>(d_temp_storage,
+                                                         copy_storage_size,
+                                                         d_input,
+                                                         d_output,
+                                                         middle,
+                                                         size,
+                                                         compare_op,
+                                                         stream));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<key_type> keys(size);
+            std::vector<key_type> output(size);
+            HIP_CHECK(
+                hipMemcpy(keys.data(), d_keys, size * sizeof(key_type), hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+
+            compare_partial_sort(input, keys, middle, compare_op);
+            compare_partial_sort_copy(input, output, output_original, middle, compare_op);
+
+            HIP_CHECK(hipFree(d_keys));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
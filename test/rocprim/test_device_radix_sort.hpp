@@ -44,7 +44,9 @@ template<class Key,
          unsigned int StartBit        = 0,
          unsigned int EndBit          = sizeof(Key) * 8,
          bool         CheckLargeSizes = false,
-         bool         UseGraphs       = false>
+         bool         UseGraphs       = false,
+         rocprim::radix_sort_values_method ValuesMethod
+         = rocprim::radix_sort_values_method::default_method>
 struct params
 {
     using key_type                                  = Key;
@@ -54,6 +56,7 @@ struct params
     static constexpr unsigned int end_bit           = EndBit;
     static constexpr bool         check_large_sizes = CheckLargeSizes;
     static constexpr bool         use_graphs        = UseGraphs;
+    static constexpr rocprim::radix_sort_values_method values_method = ValuesMethod;
 };
 
 template<class Params>
@@ -630,7 +633,8 @@ void sort_pairs()
                 rocprim::radix_sort_onesweep_config<rocprim::kernel_config<128, 1>,
                                                     rocprim::kernel_config<128, 1>,
                                                     4>,
-                1024 * 512>;
+                1024 * 512,
+                TestFixture::params::values_method>;
 
             hipGraph_t graph;
             hipGraphExec_t graph_instance;
@@ -1391,4 +1395,221 @@ void sort_keys_over_4g()
     }
 }
 
+// Keys with constant high bits (for example 64-bit ids or timestamps in a narrow range) produce
+// digit places in which all keys have the same digit. Onesweep copies those places instead of
+// sorting them, which must keep the result stable.
+void sort_pairs_constant_digits()
+{
+    using key_type                         = unsigned long long;
+    using value_type                       = unsigned int;
+    constexpr bool debug_synchronous       = false;
+    constexpr key_type base                = 0x0123456700000000ull;
+    hipStream_t    stream                  = 0;
+
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : {size_t{1} << 20, (size_t{1} << 22) + 17})
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Only the lowest 20 bits vary, every other digit place is trivial.
+            std::vector<key_type> keys_input
+                = test_utils::get_random_data<key_type>(size, 0, (1ull << 20) - 1, seed_value);
+            for(key_type& key : keys_input)
+            {
+                key += base;
+            }
+            std::vector<value_type> values_input(size);
+            std::iota(values_input.begin(), values_input.end(), 0u);
+
+            std::vector<std::pair<key_type, value_type>> expected(size);
+            for(size_t i = 0; i < size; ++i)
+            {
+                expected[i] = std::make_pair(keys_input[i], values_input[i]);
+            }
+            std::stable_sort(expected.begin(),
+                             expected.end(),
+                             [](const auto& a, const auto& b) { return a.first < b.first; });
+
+            key_type*   d_keys_input;
+            key_type*   d_keys_output;
+            value_type* d_values_input;
+            value_type* d_values_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_input, size * sizeof(value_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_output, size * sizeof(value_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(rocprim::radix_sort_pairs(nullptr,
+                                                temporary_storage_bytes,
+                                                d_keys_input,
+                                                d_keys_output,
+                                                d_values_input,
+                                                d_values_output,
+                                                size,
+                                                0,
+                                                8 * sizeof(key_type),
+                                                stream,
+                                                debug_synchronous));
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(rocprim::radix_sort_pairs(d_temporary_storage,
+                                                temporary_storage_bytes,
+                                                d_keys_input,
+                                                d_keys_output,
+                                                d_values_input,
+                                                d_values_output,
+                                                size,
+                                                0,
+                                                8 * sizeof(key_type),
+                                                stream,
+                                                debug_synchronous));
+
+            std::vector<key_type>   keys_output(size);
+            std::vector<value_type> values_output(size);
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(values_output.data(),
+                                d_values_output,
+                                size * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_values_output));
+
+            for(size_t i = 0; i < size; ++i)
+            {
+                ASSERT_EQ(keys_output[i], expected[i].first) << "where index = " << i;
+                ASSERT_EQ(values_output[i], expected[i].second) << "where index = " << i;
+            }
+        }
+    }
+}
+
+template<bool Descending>
+void argsort()
+{
+    using key_type                   = int;
+    using index_type                 = unsigned int;
+    constexpr bool debug_synchronous = false;
+    hipStream_t    stream            = 0;
+
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        auto sizes = test_utils::get_sizes(seed_value);
+        sizes.push_back(1 << 21);
+
+        for(size_t size : sizes)
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // A narrow range of keys to get many ties, which must keep their input order.
+            std::vector<key_type> keys_input
+                = test_utils::get_random_data<key_type>(size, -1000, 1000, seed_value);
+
+            std::vector<index_type> expected(size);
+            std::iota(expected.begin(), expected.end(), 0u);
+            std::stable_sort(expected.begin(),
+                             expected.end(),
+                             [&](const index_type a, const index_type b)
+                             {
+                                 return Descending ? keys_input[a] > keys_input[b]
+                                                   : keys_input[a] < keys_input[b];
+                             });
+
+            key_type*   d_keys_input;
+            index_type* d_indices_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_indices_output, size * sizeof(index_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+
+            auto invoke_argsort = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+            {
+                if(Descending)
+                {
+                    return rocprim::argsort_desc(d_temporary_storage,
+                                                 temporary_storage_bytes,
+                                                 d_keys_input,
+                                                 d_indices_output,
+                                                 size,
+                                                 0,
+                                                 8 * sizeof(key_type),
+                                                 stream,
+                                                 debug_synchronous);
+                }
+                return rocprim::argsort(d_temporary_storage,
+                                        temporary_storage_bytes,
+                                        d_keys_input,
+                                        d_indices_output,
+                                        size,
+                                        0,
+                                        8 * sizeof(key_type),
+                                        stream,
+                                        debug_synchronous);
+            };
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(invoke_argsort(nullptr, temporary_storage_bytes));
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(invoke_argsort(d_temporary_storage, temporary_storage_bytes));
+
+            std::vector<index_type> indices_output(size);
+            HIP_CHECK(hipMemcpy(indices_output.data(),
+                                d_indices_output,
+                                size * sizeof(index_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_indices_output));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(indices_output, expected));
+        }
+    }
+}
+
 #endif // TEST_DEVICE_RADIX_SORT_HPP_
@@ -367,6 +367,118 @@ TYPED_TEST(RocprimDeviceReduceTests, ReduceSum)
     }
 }
 
+TYPED_TEST(RocprimDeviceReduceTests, ReduceSumMisaligned)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::input_type;
+    using U = typename TestFixture::output_type;
+
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+    using Config = size_limit_config_t<TestFixture::size_limit>;
+
+    hipStream_t stream = 0; // default
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            if(test_utils::precision<U> * size > 0.5)
+            {
+                std::cout << "Test is skipped from size " << size
+                          << " on, potential error of summation is more than 0.5 of the result "
+                             "with current or larger size"
+                          << std::endl;
+                break;
+            }
+
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Offsets (in items) of the input from an aligned allocation
+            for(size_t offset : {1, 2, 3})
+            {
+                SCOPED_TRACE(testing::Message() << "with offset = " << offset);
+
+                // Generate data
+                std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+                std::vector<U> output(1, U(0));
+
+                T * d_input;
+                U * d_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (input.size() + offset) * sizeof(T)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, output.size() * sizeof(U)));
+                HIP_CHECK(
+                    hipMemcpy(
+                        d_input + offset, input.data(),
+                        input.size() * sizeof(T),
+                        hipMemcpyHostToDevice
+                    )
+                );
+                HIP_CHECK(hipDeviceSynchronize());
+
+                // Calculate expected results on host
+                U expected = test_utils::host_reduce(input.begin(), input.end(), rocprim::plus<U>());
+                // fix for custom_test_type case with size == 0
+                if(size == 0)
+                    expected = U();
+
+                // temp storage
+                size_t temp_storage_size_bytes;
+                void * d_temp_storage = nullptr;
+                // Get size of d_temp_storage
+                HIP_CHECK(rocprim::reduce<Config>(
+                    d_temp_storage,
+                    temp_storage_size_bytes,
+                    d_input + offset,
+                    d_output,
+                    input.size(),
+                    rocprim::plus<U>(),
+                    stream,
+                    debug_synchronous));
+
+                // allocate temporary storage
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(hipDeviceSynchronize());
+
+                // Run
+                HIP_CHECK(
+                    rocprim::reduce<Config>(
+                        d_temp_storage, temp_storage_size_bytes,
+                        d_input + offset,
+                        d_output,
+                        input.size(), rocprim::plus<U>(), stream, debug_synchronous
+                    )
+                );
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                // Copy output to host
+                HIP_CHECK(
+                    hipMemcpy(
+                        output.data(), d_output,
+                        output.size() * sizeof(U),
+                        hipMemcpyDeviceToHost
+                    )
+                );
+                HIP_CHECK(hipDeviceSynchronize());
+
+                // Check if output values are as expected
+                ASSERT_NO_FATAL_FAILURE(
+                    test_utils::assert_near(output[0], expected, test_utils::precision<U> * size));
+
+                hipFree(d_input);
+                hipFree(d_output);
+                hipFree(d_temp_storage);
+            }
+        }
+    }
+}
+
 template<
     class Key,
     class Value
@@ -1336,6 +1336,124 @@ TEST(RocprimDeviceScanTests, LargeIndicesExclusiveScanWithGraphs)
     testLargeIndicesExclusiveScan<true>();
 }
 
+template<class T, bool Exclusive>
+void testMisalignedScan()
+{
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const bool  debug_synchronous = false;
+    hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Offsets (in items) of the input and the output from aligned allocations
+            for(size_t offset : {1, 2, 3})
+            {
+                SCOPED_TRACE(testing::Message() << "with offset = " << offset);
+
+                std::vector<T> input = test_utils::get_random_data<T>(size, 0, 2, seed_value);
+                std::vector<T> output(input.size());
+
+                T* d_input;
+                T* d_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                             (input.size() + offset) * sizeof(T)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                             (output.size() + offset) * sizeof(T)));
+                HIP_CHECK(hipMemcpy(d_input + offset,
+                                    input.data(),
+                                    input.size() * sizeof(T),
+                                    hipMemcpyHostToDevice));
+
+                // Calculate expected results on host
+                std::vector<T> expected(input.size());
+                if(Exclusive)
+                {
+                    test_utils::host_exclusive_scan(input.begin(),
+                                                    input.end(),
+                                                    T(1),
+                                                    expected.begin(),
+                                                    rocprim::plus<T>());
+                }
+                else
+                {
+                    test_utils::host_inclusive_scan(input.begin(),
+                                                    input.end(),
+                                                    expected.begin(),
+                                                    rocprim::plus<T>());
+                }
+
+                const auto run_scan = [&](void* d_temp_storage, size_t& temp_storage_size_bytes)
+                {
+                    if(Exclusive)
+                    {
+                        return rocprim::exclusive_scan(d_temp_storage,
+                                                       temp_storage_size_bytes,
+                                                       d_input + offset,
+                                                       d_output + offset,
+                                                       T(1),
+                                                       input.size(),
+                                                       rocprim::plus<T>(),
+                                                       stream,
+                                                       debug_synchronous);
+                    }
+                    return rocprim::inclusive_scan(d_temp_storage,
+                                                   temp_storage_size_bytes,
+                                                   d_input + offset,
+                                                   d_output + offset,
+                                                   input.size(),
+                                                   rocprim::plus<T>(),
+                                                   stream,
+                                                   debug_synchronous);
+                };
+
+                size_t temp_storage_size_bytes;
+                void*  d_temp_storage = nullptr;
+                HIP_CHECK(run_scan(d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+                HIP_CHECK(run_scan(d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                HIP_CHECK(hipMemcpy(output.data(),
+                                    d_output + offset,
+                                    output.size() * sizeof(T),
+                                    hipMemcpyDeviceToHost));
+
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+                HIP_CHECK(hipFree(d_input));
+                HIP_CHECK(hipFree(d_output));
+                HIP_CHECK(hipFree(d_temp_storage));
+            }
+        }
+    }
+}
+
+TEST(RocprimDeviceScanTests, MisalignedInclusiveScan)
+{
+    testMisalignedScan<int, false>();
+    testMisalignedScan<unsigned short, false>();
+}
+
+TEST(RocprimDeviceScanTests, MisalignedExclusiveScan)
+{
+    testMisalignedScan<int, true>();
+    testMisalignedScan<unsigned short, true>();
+}
+
 /// \brief This iterator keeps track of the current index. Upon dereference, a \p CheckValue object
 /// is created and besides the current index, the provided \p rocprim::tuple<Args...> is passed
 /// to its constructor.
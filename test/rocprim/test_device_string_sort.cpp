@@ -0,0 +1,226 @@
+// MIT License
+//
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_string_sort.hpp>
+#include <rocprim/iterator/discard_iterator.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+template<class Offset,
+         unsigned int MinLength,
+         unsigned int MaxLength,
+         unsigned int Alphabet,
+         unsigned int CommonPrefixLength = 0>
+struct params
+{
+    using offset_type                                  = Offset;
+    static constexpr unsigned int min_length           = MinLength;
+    static constexpr unsigned int max_length           = MaxLength;
+    static constexpr unsigned int alphabet             = Alphabet;
+    static constexpr unsigned int common_prefix_length = CommonPrefixLength;
+};
+
+template<class Params>
+class RocprimDeviceStringSort : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<unsigned int, 0, 16, 26>,
+                         params<unsigned int, 1, 8, 2>,
+                         params<unsigned int, 0, 40, 3>,
+                         params<size_t, 4, 24, 255>,
+                         params<size_t, 20, 100, 4, 33>,
+                         params<unsigned int, 64, 64, 1>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceStringSort, Params);
+
+TYPED_TEST(RocprimDeviceStringSort, Sort)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using offset_type = typename TestFixture::params::offset_type;
+
+    constexpr unsigned int min_length           = TestFixture::params::min_length;
+    constexpr unsigned int max_length           = TestFixture::params::max_length;
+    constexpr unsigned int alphabet             = TestFixture::params::alphabet;
+    constexpr unsigned int common_prefix_length = TestFixture::params::common_prefix_length;
+
+    const bool debug_synchronous = false;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            hipStream_t stream = 0; // default
+
+            // Generate data
+            std::default_random_engine                  gen(seed_value);
+            std::uniform_int_distribution<unsigned int> length_dis(min_length, max_length);
+            // Zero characters are not allowed
+            std::uniform_int_distribution<unsigned int> char_dis(1, alphabet);
+
+            std::string common_prefix;
+            for(unsigned int i = 0; i < common_prefix_length; ++i)
+            {
+                common_prefix.push_back(static_cast<char>(char_dis(gen)));
+            }
+
+            std::vector<std::string> strings(size);
+            std::vector<offset_type> offsets(size + 1);
+            std::vector<char>        chars;
+            for(size_t i = 0; i < size; ++i)
+            {
+                strings[i] = common_prefix;
+                const unsigned int length = length_dis(gen);
+                for(unsigned int j = 0; j < length; ++j)
+                {
+                    strings[i].push_back(static_cast<char>(char_dis(gen)));
+                }
+                offsets[i] = static_cast<offset_type>(chars.size());
+                chars.insert(chars.end(), strings[i].begin(), strings[i].end());
+            }
+            offsets[size] = static_cast<offset_type>(chars.size());
+
+            // Calculate expected results on host, std::string compares characters as unsigned
+            std::vector<unsigned int> expected(size);
+            std::iota(expected.begin(), expected.end(), 0u);
+            std::stable_sort(expected.begin(),
+                             expected.end(),
+                             [&strings](const unsigned int a, const unsigned int b)
+                             { return strings[a] < strings[b]; });
+
+            std::vector<offset_type> offsets_expected(size);
+            for(size_t i = 0; i < size; ++i)
+            {
+                offsets_expected[i] = offsets[expected[i]];
+            }
+
+            char*         d_chars;
+            offset_type*  d_offsets;
+            unsigned int* d_permutation;
+            offset_type*  d_sorted_offsets;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_chars, chars.size() + 1));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_offsets, (size + 1) * sizeof(offset_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_permutation, size * sizeof(unsigned int)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_sorted_offsets, size * sizeof(offset_type)));
+            HIP_CHECK(hipMemcpy(d_chars, chars.data(), chars.size(), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_offsets,
+                                offsets.data(),
+                                (size + 1) * sizeof(offset_type),
+                                hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(rocprim::string_sort(nullptr,
+                                           temporary_storage_bytes,
+                                           d_chars,
+                                           d_offsets,
+                                           static_cast<unsigned int>(size),
+                                           d_permutation,
+                                           d_sorted_offsets,
+                                           stream,
+                                           debug_synchronous));
+
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(rocprim::string_sort(d_temporary_storage,
+                                           temporary_storage_bytes,
+                                           d_chars,
+                                           d_offsets,
+                                           static_cast<unsigned int>(size),
+                                           d_permutation,
+                                           d_sorted_offsets,
+                                           stream,
+                                           debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<unsigned int> permutation(size);
+            std::vector<offset_type>  sorted_offsets(size);
+            HIP_CHECK(hipMemcpy(permutation.data(),
+                                d_permutation,
+                                size * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(sorted_offsets.data(),
+                                d_sorted_offsets,
+                                size * sizeof(offset_type),
+                                hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(permutation, expected));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(sorted_offsets, offsets_expected));
+
+            // Only the permutation
+            HIP_CHECK(hipMemset(d_permutation, 0, size * sizeof(unsigned int)));
+            HIP_CHECK(rocprim::string_sort(d_temporary_storage,
+                                           temporary_storage_bytes,
+                                           d_chars,
+                                           d_offsets,
+                                           static_cast<unsigned int>(size),
+                                           d_permutation,
+                                           rocprim::discard_iterator(),
+                                           stream,
+                                           debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            HIP_CHECK(hipMemcpy(permutation.data(),
+                                d_permutation,
+                                size * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(permutation, expected));
+
+            HIP_CHECK(hipFree(d_chars));
+            HIP_CHECK(hipFree(d_offsets));
+            HIP_CHECK(hipFree(d_permutation));
+            HIP_CHECK(hipFree(d_sorted_offsets));
+            HIP_CHECK(hipFree(d_temporary_storage));
+        }
+    }
+}
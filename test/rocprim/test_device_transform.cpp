@@ -208,6 +208,89 @@ TYPED_TEST(RocprimDeviceTransformTests, Transform)
     }
 }
 
+TYPED_TEST(RocprimDeviceTransformTests, TransformMisaligned)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::input_type;
+    using U = typename TestFixture::output_type;
+    using Config = size_limit_config_t<TestFixture::size_limit>;
+
+    // Offsets (in items) of the input and the output from aligned allocations, covering
+    // ranges misaligned by the same and by different amounts
+    const std::vector<std::pair<size_t, size_t>> offsets = {{1, 1}, {3, 3}, {1, 2}, {0, 3}};
+
+    hipStream_t stream = 0; // default
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            for(const auto& offset : offsets)
+            {
+                SCOPED_TRACE(testing::Message() << "with input offset = " << offset.first
+                                                << ", output offset = " << offset.second);
+
+                // Generate data
+                std::vector<T> input = test_utils::get_random_data<T>(size, 1, 100, seed_value);
+                std::vector<U> output(input.size(), (U)0);
+
+                T * d_input;
+                U * d_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (input.size() + offset.first) * sizeof(T)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, (output.size() + offset.second) * sizeof(U)));
+                HIP_CHECK(
+                    hipMemcpy(
+                        d_input + offset.first, input.data(),
+                        input.size() * sizeof(T),
+                        hipMemcpyHostToDevice
+                    )
+                );
+                HIP_CHECK(hipDeviceSynchronize());
+
+                // Calculate expected results on host
+                std::vector<U> expected(input.size());
+                std::transform(input.begin(), input.end(), expected.begin(), transform<U>());
+
+                // Run
+                HIP_CHECK(
+                    rocprim::transform<Config>(
+                        d_input + offset.first,
+                        d_output + offset.second,
+                        input.size(), transform<U>(), stream, TestFixture::debug_synchronous
+                    )
+                );
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                // Copy output to host
+                HIP_CHECK(
+                    hipMemcpy(
+                        output.data(), d_output + offset.second,
+                        output.size() * sizeof(U),
+                        hipMemcpyDeviceToHost
+                    )
+                );
+                HIP_CHECK(hipDeviceSynchronize());
+
+                // Check if output values are as expected
+                ASSERT_NO_FATAL_FAILURE(
+                    test_utils::assert_near(output, expected, test_utils::precision<U>));
+
+                hipFree(d_input);
+                hipFree(d_output);
+            }
+        }
+    }
+}
+
 template<class T1, class T2, class U>
 struct binary_transform
 {
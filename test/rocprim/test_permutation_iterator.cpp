@@ -0,0 +1,372 @@
+// MIT License
+//
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load.hpp>
+#include <rocprim/block/block_store.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/device_transform.hpp>
+#include <rocprim/functional.hpp>
+#include <rocprim/iterator/permutation_iterator.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <numeric>
+
+// Strictly increasing indices into a range of `range_size` items, with runs of consecutive
+// indices separated by random gaps
+inline std::vector<unsigned int>
+    get_sorted_indices(size_t size, size_t& range_size, unsigned int seed_value)
+{
+    const std::vector<unsigned int> gaps
+        = test_utils::get_random_data<unsigned int>(size, 0, 3, seed_value);
+
+    std::vector<unsigned int> indices(size);
+    unsigned int              index = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        // Most indices are consecutive
+        index += gaps[i] == 3 ? 5 : 1;
+        indices[i] = index;
+    }
+    range_size = size == 0 ? 0 : index + 1;
+    return indices;
+}
+
+TEST(RocprimPermutationIteratorTests, Arithmetic)
+{
+    const std::vector<int>          values  = {10, 11, 12, 13, 14, 15, 16, 17};
+    const std::vector<unsigned int> indices = {7, 0, 3, 3, 5, 1};
+
+    auto x = rocprim::make_permutation_iterator(values.data(), indices.data());
+    auto y = x;
+    ASSERT_EQ(x, y);
+    ASSERT_EQ(*x, 17);
+
+    x += 4;
+    for(size_t i = 0; i < 4; i++)
+    {
+        y++;
+    }
+    ASSERT_EQ(x, y);
+    ASSERT_EQ(*x, 15);
+    ASSERT_EQ(x[-2], 13);
+    ASSERT_EQ(x - rocprim::make_permutation_iterator(values.data(), indices.data()), 4);
+
+    y--;
+    ASSERT_NE(x, y);
+    ASSERT_LT(y, x);
+    ASSERT_EQ(*y, 13);
+}
+
+template<class IndexType>
+void test_permutation_transform()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+
+    const bool  debug_synchronous = false;
+    hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const size_t         values_size = std::max<size_t>(size / 2, 1);
+            const std::vector<T> values
+                = test_utils::get_random_data<T>(values_size, -1000, 1000, seed_value);
+            const std::vector<IndexType> indices
+                = test_utils::get_random_data<IndexType>(size, 0, values_size - 1, seed_value + 1);
+
+            std::vector<T> expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected[i] = values[indices[i]] + 1;
+            }
+
+            T*         d_values;
+            IndexType* d_indices;
+            T*         d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, values_size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_indices, size * sizeof(IndexType)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_values,
+                                values.data(),
+                                values_size * sizeof(T),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_indices,
+                                indices.data(),
+                                size * sizeof(IndexType),
+                                hipMemcpyHostToDevice));
+
+            HIP_CHECK(rocprim::transform(rocprim::make_permutation_iterator(d_values, d_indices),
+                                         d_output,
+                                         size,
+                                         [] __device__(T value) { return value + 1; },
+                                         stream,
+                                         debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<T> output(size);
+            HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_values));
+            HIP_CHECK(hipFree(d_indices));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+TEST(RocprimPermutationIteratorTests, Transform)
+{
+    test_permutation_transform<unsigned int>();
+    test_permutation_transform<size_t>();
+}
+
+TEST(RocprimPermutationIteratorTests, SortedReduce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = unsigned int;
+
+    const bool  debug_synchronous = false;
+    hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            size_t                          values_size;
+            const std::vector<unsigned int> indices
+                = get_sorted_indices(size, values_size, seed_value);
+            const std::vector<T> values
+                = test_utils::get_random_data<T>(values_size, 0, 100, seed_value + 1);
+
+            T expected = 0;
+            for(size_t i = 0; i < size; i++)
+            {
+                expected += values[indices[i]];
+            }
+
+            T*            d_values;
+            unsigned int* d_indices;
+            T*            d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, values_size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_indices, size * sizeof(unsigned int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_values,
+                                values.data(),
+                                values_size * sizeof(T),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_indices,
+                                indices.data(),
+                                size * sizeof(unsigned int),
+                                hipMemcpyHostToDevice));
+
+            const auto input = rocprim::make_sorted_permutation_iterator(d_values, d_indices);
+
+            size_t temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            HIP_CHECK(rocprim::reduce(d_temp_storage,
+                                      temp_storage_size_bytes,
+                                      input,
+                                      d_output,
+                                      size,
+                                      rocprim::plus<T>(),
+                                      stream,
+                                      debug_synchronous));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(rocprim::reduce(d_temp_storage,
+                                      temp_storage_size_bytes,
+                                      input,
+                                      d_output,
+                                      size,
+                                      rocprim::plus<T>(),
+                                      stream,
+                                      debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            T output;
+            HIP_CHECK(hipMemcpy(&output, d_output, sizeof(T), hipMemcpyDeviceToHost));
+
+            ASSERT_EQ(output, expected);
+
+            HIP_CHECK(hipFree(d_values));
+            HIP_CHECK(hipFree(d_indices));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
+
+template<class T,
+         unsigned int                BlockSize,
+         unsigned int                ItemsPerThread,
+         rocprim::block_load_method  Method,
+         class InputIterator>
+__global__
+__launch_bounds__(BlockSize)
+void block_load_permutation_kernel(InputIterator input, T* device_output, unsigned int valid)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    const unsigned int     offset          = blockIdx.x * items_per_block;
+
+    T items[ItemsPerThread];
+    using block_load_type = rocprim::block_load<T, BlockSize, ItemsPerThread, Method>;
+    ROCPRIM_SHARED_MEMORY typename block_load_type::storage_type storage;
+    if(offset + items_per_block <= valid)
+    {
+        block_load_type().load(input + offset, items, storage);
+        rocprim::block_store_direct_blocked(threadIdx.x, device_output + offset, items);
+    }
+    else
+    {
+        block_load_type().load(input + offset, items, valid - offset, storage);
+        rocprim::block_store_direct_blocked(threadIdx.x,
+                                            device_output + offset,
+                                            items,
+                                            valid - offset);
+    }
+}
+
+template<rocprim::block_load_method Method, bool Sorted>
+void test_block_load_permutation()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+
+    constexpr unsigned int block_size       = 128;
+    constexpr unsigned int items_per_thread = 4;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+    constexpr unsigned int grid_size        = 19;
+    // The last block is partial
+    constexpr size_t size = items_per_block * grid_size - 77;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        size_t                    values_size = size;
+        std::vector<unsigned int> indices;
+        if(Sorted)
+        {
+            indices = get_sorted_indices(size, values_size, seed_value);
+        }
+        else
+        {
+            indices = test_utils::get_random_data<unsigned int>(size, 0, size - 1, seed_value);
+        }
+        const std::vector<T> values
+            = test_utils::get_random_data<T>(values_size, -1000, 1000, seed_value + 1);
+
+        std::vector<T> expected(size);
+        for(size_t i = 0; i < size; i++)
+        {
+            expected[i] = values[indices[i]];
+        }
+
+        T*            d_values;
+        unsigned int* d_indices;
+        T*            d_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, values_size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_indices, size * sizeof(unsigned int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+        HIP_CHECK(
+            hipMemcpy(d_values, values.data(), values_size * sizeof(T), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_indices,
+                            indices.data(),
+                            size * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+
+        const auto input
+            = rocprim::permutation_iterator<T*, unsigned int*, Sorted>(d_values, d_indices);
+        block_load_permutation_kernel<T, block_size, items_per_thread, Method>
+            <<<grid_size, block_size>>>(input, d_output, size);
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<T> output(size);
+        HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+        HIP_CHECK(hipFree(d_values));
+        HIP_CHECK(hipFree(d_indices));
+        HIP_CHECK(hipFree(d_output));
+    }
+}
+
+TEST(RocprimPermutationIteratorTests, BlockLoadDirect)
+{
+    test_block_load_permutation<rocprim::block_load_method::block_load_direct, false>();
+    test_block_load_permutation<rocprim::block_load_method::block_load_direct, true>();
+}
+
+TEST(RocprimPermutationIteratorTests, BlockLoadVectorize)
+{
+    test_block_load_permutation<rocprim::block_load_method::block_load_vectorize, false>();
+    test_block_load_permutation<rocprim::block_load_method::block_load_vectorize, true>();
+}
+
+TEST(RocprimPermutationIteratorTests, BlockLoadStriped)
+{
+    test_block_load_permutation<rocprim::block_load_method::block_load_striped, false>();
+    test_block_load_permutation<rocprim::block_load_method::block_load_striped, true>();
+}
+
+TEST(RocprimPermutationIteratorTests, BlockLoadTranspose)
+{
+    test_block_load_permutation<rocprim::block_load_method::block_load_transpose, false>();
+    test_block_load_permutation<rocprim::block_load_method::block_load_transpose, true>();
+}
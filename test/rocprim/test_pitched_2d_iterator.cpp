@@ -0,0 +1,241 @@
+// MIT License
+//
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load.hpp>
+#include <rocprim/block/block_store.hpp>
+#include <rocprim/device/device_transform.hpp>
+#include <rocprim/iterator/pitched_2d_iterator.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+TEST(RocprimPitched2dIteratorTests, Arithmetic)
+{
+    // 4 rows of 10 items, of which the first 3 are visited
+    std::vector<int> data(40);
+    std::iota(data.begin(), data.end(), 0);
+
+    auto x = rocprim::make_pitched_2d_iterator(data.data(), 3, 10);
+    ASSERT_EQ(*x, 0);
+    ASSERT_EQ(x[2], 2);
+    ASSERT_EQ(x[3], 10);
+    ASSERT_EQ(x[7], 21);
+
+    auto y = x + 5;
+    ASSERT_EQ(*y, 12);
+    ASSERT_EQ(y - x, 5);
+    ASSERT_EQ(y.index(), 5);
+    ASSERT_LT(x, y);
+    y--;
+    ASSERT_EQ(*y, 11);
+    y -= 4;
+    ASSERT_EQ(x, y);
+    ASSERT_EQ(x.width(), 3u);
+    ASSERT_EQ(x.pitch(), 10u);
+}
+
+template<class T>
+struct transform
+{
+    __device__ __host__
+    constexpr T operator()(const T& a) const
+    {
+        return a * 2;
+    }
+};
+
+TEST(RocprimPitched2dIteratorTests, Transform)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+
+    const bool  debug_synchronous = false;
+    hipStream_t stream            = 0; // default
+
+    const unsigned int pitch = 1000;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const unsigned int width : {1u, 37u, 256u, 999u})
+        {
+            SCOPED_TRACE(testing::Message() << "with width = " << width);
+
+            const size_t         rows = 1 + seed_value % 300;
+            const size_t         size = rows * width;
+            const std::vector<T> matrix
+                = test_utils::get_random_data<T>(rows * pitch, -1000, 1000, seed_value);
+
+            std::vector<T> expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected[i] = transform<T>()(matrix[(i / width) * pitch + i % width]);
+            }
+
+            T* d_matrix;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_matrix, matrix.size() * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_matrix,
+                                matrix.data(),
+                                matrix.size() * sizeof(T),
+                                hipMemcpyHostToDevice));
+
+            HIP_CHECK(rocprim::transform(rocprim::make_pitched_2d_iterator(d_matrix, width, pitch),
+                                         d_output,
+                                         size,
+                                         transform<T>(),
+                                         stream,
+                                         debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<T> output(size);
+            HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_matrix));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+template<class T,
+         unsigned int               BlockSize,
+         unsigned int               ItemsPerThread,
+         rocprim::block_load_method Method,
+         class InputIterator>
+__global__
+__launch_bounds__(BlockSize)
+void block_load_pitched_2d_kernel(InputIterator input, T* device_output, unsigned int valid)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    const unsigned int     offset          = blockIdx.x * items_per_block;
+
+    T items[ItemsPerThread];
+    using block_load_type = rocprim::block_load<T, BlockSize, ItemsPerThread, Method>;
+    ROCPRIM_SHARED_MEMORY typename block_load_type::storage_type storage;
+    if(offset + items_per_block <= valid)
+    {
+        block_load_type().load(input + offset, items, storage);
+        rocprim::block_store_direct_blocked(threadIdx.x, device_output + offset, items);
+    }
+    else
+    {
+        block_load_type().load(input + offset, items, valid - offset, storage);
+        rocprim::block_store_direct_blocked(threadIdx.x,
+                                            device_output + offset,
+                                            items,
+                                            valid - offset);
+    }
+}
+
+template<rocprim::block_load_method Method>
+void test_block_load_pitched_2d()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+
+    constexpr unsigned int block_size       = 128;
+    constexpr unsigned int items_per_thread = 4;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Widths smaller than, equal to and larger than the block size
+        for(const unsigned int width : {1u, 5u, 128u, 300u})
+        {
+            SCOPED_TRACE(testing::Message() << "with width = " << width);
+
+            const unsigned int   pitch     = width + 3;
+            const size_t         rows      = 100;
+            const size_t         size      = rows * width;
+            const unsigned int   grid_size = (size + items_per_block - 1) / items_per_block;
+            const std::vector<T> matrix
+                = test_utils::get_random_data<T>(rows * pitch, -1000, 1000, seed_value);
+
+            std::vector<T> expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected[i] = matrix[(i / width) * pitch + i % width];
+            }
+
+            T* d_matrix;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_matrix, matrix.size() * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_matrix,
+                                matrix.data(),
+                                matrix.size() * sizeof(T),
+                                hipMemcpyHostToDevice));
+
+            block_load_pitched_2d_kernel<T, block_size, items_per_thread, Method>
+                <<<grid_size, block_size>>>(
+                    rocprim::make_pitched_2d_iterator(d_matrix, width, pitch),
+                    d_output,
+                    size);
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<T> output(size);
+            HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_matrix));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+TEST(RocprimPitched2dIteratorTests, BlockLoadDirect)
+{
+    test_block_load_pitched_2d<rocprim::block_load_method::block_load_direct>();
+}
+
+TEST(RocprimPitched2dIteratorTests, BlockLoadStriped)
+{
+    test_block_load_pitched_2d<rocprim::block_load_method::block_load_striped>();
+}
+
+TEST(RocprimPitched2dIteratorTests, BlockLoadTranspose)
+{
+    test_block_load_pitched_2d<rocprim::block_load_method::block_load_transpose>();
+}
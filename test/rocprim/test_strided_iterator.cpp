@@ -0,0 +1,325 @@
+// MIT License
+//
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load.hpp>
+#include <rocprim/block/block_store.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/device_transform.hpp>
+#include <rocprim/functional.hpp>
+#include <rocprim/iterator/strided_iterator.hpp>
+#include <rocprim/iterator/zip_iterator.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+TEST(RocprimStridedIteratorTests, Arithmetic)
+{
+    std::vector<int> data(64);
+    std::iota(data.begin(), data.end(), 0);
+
+    auto x = rocprim::make_strided_iterator(data.data() + 1, 5);
+    auto y = x + 3;
+    ASSERT_EQ(*x, 1);
+    ASSERT_EQ(*y, 16);
+    ASSERT_EQ(x[7], 36);
+    ASSERT_EQ(y - x, 3);
+    ASSERT_LT(x, y);
+    y -= 3;
+    ASSERT_EQ(x, y);
+    ASSERT_EQ(x.stride(), 5);
+
+    auto z = rocprim::make_strided_iterator<4>(data.data());
+    ASSERT_EQ(z.stride(), 4);
+    ASSERT_EQ(*(2 + z), 8);
+    z++;
+    ASSERT_EQ(*z, 4);
+    ASSERT_EQ(z.base(), data.data() + 4);
+}
+
+TEST(RocprimStridedIteratorTests, ReduceColumn)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+
+    const bool  debug_synchronous = false;
+    hipStream_t stream            = 0; // default
+
+    const size_t columns = 7;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto rows : test_utils::get_sizes(seed_value))
+        {
+            if(rows == 0)
+            {
+                continue;
+            }
+            SCOPED_TRACE(testing::Message() << "with rows = " << rows);
+
+            const std::vector<T> matrix
+                = test_utils::get_random_data<T>(rows * columns, -100, 100, seed_value);
+            const size_t column = seed_value % columns;
+
+            T expected = 0;
+            for(size_t row = 0; row < rows; row++)
+            {
+                expected += matrix[row * columns + column];
+            }
+
+            T* d_matrix;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_matrix, matrix.size() * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_matrix,
+                                matrix.data(),
+                                matrix.size() * sizeof(T),
+                                hipMemcpyHostToDevice));
+
+            const auto input = rocprim::make_strided_iterator(d_matrix + column, columns);
+
+            size_t temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            HIP_CHECK(rocprim::reduce(d_temp_storage,
+                                      temp_storage_size_bytes,
+                                      input,
+                                      d_output,
+                                      rows,
+                                      rocprim::plus<T>(),
+                                      stream,
+                                      debug_synchronous));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(rocprim::reduce(d_temp_storage,
+                                      temp_storage_size_bytes,
+                                      input,
+                                      d_output,
+                                      rows,
+                                      rocprim::plus<T>(),
+                                      stream,
+                                      debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            T output;
+            HIP_CHECK(hipMemcpy(&output, d_output, sizeof(T), hipMemcpyDeviceToHost));
+            ASSERT_EQ(output, expected);
+
+            HIP_CHECK(hipFree(d_matrix));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
+
+template<class T>
+struct interleaved_sum
+{
+    __device__ __host__
+    T operator()(const rocprim::tuple<T, T>& value) const
+    {
+        return rocprim::get<0>(value) + rocprim::get<1>(value);
+    }
+};
+
+TEST(RocprimStridedIteratorTests, ZipTransform)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = float;
+
+    const bool  debug_synchronous = false;
+    hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Pairs of interleaved values
+            const std::vector<T> input
+                = test_utils::get_random_data<T>(2 * size, -100, 100, seed_value);
+
+            std::vector<T> expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected[i] = input[2 * i] + input[2 * i + 1];
+            }
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                input.size() * sizeof(T),
+                                hipMemcpyHostToDevice));
+
+            HIP_CHECK(rocprim::transform(
+                rocprim::make_zip_iterator(
+                    rocprim::make_tuple(rocprim::make_strided_iterator<2>(d_input),
+                                        rocprim::make_strided_iterator<2>(d_input + 1))),
+                d_output,
+                size,
+                interleaved_sum<T>(),
+                stream,
+                debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<T> output(size);
+            HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_near(output, expected, 0.0f));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+template<class T,
+         unsigned int               BlockSize,
+         unsigned int               ItemsPerThread,
+         rocprim::block_load_method Method,
+         class InputIterator>
+__global__
+__launch_bounds__(BlockSize)
+void block_load_strided_kernel(InputIterator input, T* device_output, unsigned int valid)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    const unsigned int     offset          = blockIdx.x * items_per_block;
+
+    T items[ItemsPerThread];
+    using block_load_type = rocprim::block_load<T, BlockSize, ItemsPerThread, Method>;
+    ROCPRIM_SHARED_MEMORY typename block_load_type::storage_type storage;
+    if(offset + items_per_block <= valid)
+    {
+        block_load_type().load(input + offset, items, storage);
+        rocprim::block_store_direct_blocked(threadIdx.x, device_output + offset, items);
+    }
+    else
+    {
+        block_load_type().load(input + offset, items, valid - offset, storage);
+        rocprim::block_store_direct_blocked(threadIdx.x,
+                                            device_output + offset,
+                                            items,
+                                            valid - offset);
+    }
+}
+
+template<class T, unsigned int Stride, rocprim::block_load_method Method>
+void test_block_load_strided(const unsigned int stride)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    SCOPED_TRACE(testing::Message() << "with stride = " << stride);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    constexpr unsigned int block_size       = 128;
+    constexpr unsigned int items_per_thread = 8;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+    constexpr unsigned int grid_size        = 13;
+    // The last block is partial
+    constexpr size_t size = items_per_block * grid_size - 45;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // The range ends with the last visited element
+        const size_t         input_size = (size - 1) * stride + 1;
+        const std::vector<T> input = test_utils::get_random_data<T>(input_size, 0, 100, seed_value);
+
+        std::vector<T> expected(size);
+        for(size_t i = 0; i < size; i++)
+        {
+            expected[i] = input[i * stride];
+        }
+
+        T* d_input;
+        T* d_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input_size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+        HIP_CHECK(hipMemcpy(d_input, input.data(), input_size * sizeof(T), hipMemcpyHostToDevice));
+
+        block_load_strided_kernel<T, block_size, items_per_thread, Method>
+            <<<grid_size, block_size>>>(rocprim::strided_iterator<T*, Stride>(d_input, stride),
+                                        d_output,
+                                        size);
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<T> output(size);
+        HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_output));
+    }
+}
+
+TEST(RocprimStridedIteratorTests, BlockLoadDirect)
+{
+    constexpr auto method = rocprim::block_load_method::block_load_direct;
+    test_block_load_strided<int, 2, method>(2);
+    test_block_load_strided<short, 3, method>(3);
+    test_block_load_strided<unsigned char, 4, method>(4);
+    test_block_load_strided<double, 2, method>(2);
+    test_block_load_strided<int, 0, method>(5);
+}
+
+TEST(RocprimStridedIteratorTests, BlockLoadVectorize)
+{
+    constexpr auto method = rocprim::block_load_method::block_load_vectorize;
+    test_block_load_strided<int, 2, method>(2);
+    test_block_load_strided<unsigned short, 2, method>(2);
+    test_block_load_strided<int, 0, method>(3);
+}
+
+TEST(RocprimStridedIteratorTests, BlockLoadTranspose)
+{
+    constexpr auto method = rocprim::block_load_method::block_load_transpose;
+    test_block_load_strided<int, 2, method>(2);
+    test_block_load_strided<float, 0, method>(7);
+}
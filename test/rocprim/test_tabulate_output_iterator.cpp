@@ -0,0 +1,254 @@
+// MIT License
+//
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_binary_search.hpp>
+#include <rocprim/device/device_scan.hpp>
+#include <rocprim/functional.hpp>
+#include <rocprim/iterator/tabulate_output_iterator.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+// Writes every value to the mirrored position of the output
+template<class T>
+struct reverse_scatter
+{
+    T*     output;
+    size_t size;
+
+    template<class Index>
+    ROCPRIM_HOST_DEVICE
+    void operator()(Index index, const T& value) const
+    {
+        output[size - 1 - index] = value;
+    }
+};
+
+TEST(RocprimTabulateOutputIteratorTests, Arithmetic)
+{
+    std::vector<int> data(16, 0);
+    const auto       write_index = [&](size_t index, int value) { data[index] = value; };
+
+    using Iterator = rocprim::tabulate_output_iterator<decltype(write_index)>;
+
+    Iterator x(write_index, 3);
+    Iterator y = x;
+    ASSERT_EQ(x, y);
+    ASSERT_EQ(x.index(), size_t(3));
+
+    x += 10;
+    for(size_t i = 0; i < 10; i++)
+    {
+        y++;
+    }
+    ASSERT_EQ(x, y);
+    ASSERT_EQ(x - Iterator(write_index), 13);
+
+    y--;
+    ASSERT_NE(x, y);
+    ASSERT_LT(y, x);
+
+    x[2] = 7;
+    *y   = 5;
+    ASSERT_EQ(data[15], 7);
+    ASSERT_EQ(data[12], 5);
+}
+
+TEST(RocprimTabulateOutputIteratorTests, ExclusiveScanScatter)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+
+    const bool  debug_synchronous = false;
+    hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<T> input = test_utils::get_random_data<T>(size, 0, 10, seed_value);
+            std::vector<T> output(input.size());
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, output.size() * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                input.size() * sizeof(T),
+                                hipMemcpyHostToDevice));
+
+            // Calculate expected results on host
+            std::vector<T> expected(input.size());
+            test_utils::host_exclusive_scan(input.begin(),
+                                            input.end(),
+                                            T(3),
+                                            expected.rbegin(),
+                                            rocprim::plus<T>());
+
+            auto output_iterator
+                = rocprim::make_tabulate_output_iterator(reverse_scatter<T>{d_output, size});
+
+            size_t temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            HIP_CHECK(rocprim::exclusive_scan(d_temp_storage,
+                                              temp_storage_size_bytes,
+                                              d_input,
+                                              output_iterator,
+                                              T(3),
+                                              input.size(),
+                                              rocprim::plus<T>(),
+                                              stream,
+                                              debug_synchronous));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(rocprim::exclusive_scan(d_temp_storage,
+                                              temp_storage_size_bytes,
+                                              d_input,
+                                              output_iterator,
+                                              T(3),
+                                              input.size(),
+                                              rocprim::plus<T>(),
+                                              stream,
+                                              debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                output.size() * sizeof(T),
+                                hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
+
+TEST(RocprimTabulateOutputIteratorTests, LowerBoundScatter)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+
+    const bool  debug_synchronous = false;
+    hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        const size_t haystack_size = 1024;
+        const size_t needles_size  = 4096;
+
+        std::vector<T> haystack = test_utils::get_random_data<T>(haystack_size, 0, 1000, seed_value);
+        std::sort(haystack.begin(), haystack.end());
+        std::vector<T> needles = test_utils::get_random_data<T>(needles_size, 0, 1000, seed_value + 1);
+
+        std::vector<size_t> expected(needles_size);
+        for(size_t i = 0; i < needles_size; i++)
+        {
+            expected[needles_size - 1 - i]
+                = std::lower_bound(haystack.begin(), haystack.end(), needles[i])
+                  - haystack.begin();
+        }
+
+        T*      d_haystack;
+        T*      d_needles;
+        size_t* d_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_haystack, haystack_size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_needles, needles_size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, needles_size * sizeof(size_t)));
+        HIP_CHECK(hipMemcpy(d_haystack,
+                            haystack.data(),
+                            haystack_size * sizeof(T),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_needles,
+                            needles.data(),
+                            needles_size * sizeof(T),
+                            hipMemcpyHostToDevice));
+
+        auto output_iterator
+            = rocprim::make_tabulate_output_iterator(reverse_scatter<size_t>{d_output, needles_size});
+
+        size_t temp_storage_size_bytes;
+        void*  d_temp_storage = nullptr;
+        HIP_CHECK(rocprim::lower_bound(d_temp_storage,
+                                       temp_storage_size_bytes,
+                                       d_haystack,
+                                       d_needles,
+                                       output_iterator,
+                                       haystack_size,
+                                       needles_size,
+                                       rocprim::less<T>(),
+                                       stream,
+                                       debug_synchronous));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+        HIP_CHECK(rocprim::lower_bound(d_temp_storage,
+                                       temp_storage_size_bytes,
+                                       d_haystack,
+                                       d_needles,
+                                       output_iterator,
+                                       haystack_size,
+                                       needles_size,
+                                       rocprim::less<T>(),
+                                       stream,
+                                       debug_synchronous));
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<size_t> output(needles_size);
+        HIP_CHECK(hipMemcpy(output.data(),
+                            d_output,
+                            needles_size * sizeof(size_t),
+                            hipMemcpyDeviceToHost));
+
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+        HIP_CHECK(hipFree(d_haystack));
+        HIP_CHECK(hipFree(d_needles));
+        HIP_CHECK(hipFree(d_output));
+        HIP_CHECK(hipFree(d_temp_storage));
+    }
+}
@@ -32,6 +32,7 @@
 #include "rocprim/thread/thread_reduce.hpp"
 #include "rocprim/thread/thread_scan.hpp"
 #include "rocprim/thread/thread_search.hpp"
+#include "rocprim/thread/thread_sort.hpp"
 
 #include "../common_test_header.hpp"
 #include "test_utils.hpp"
@@ -524,3 +525,132 @@ TYPED_TEST(RocprimThreadOperationTests, Search)
     merge_path_search_test<T, OffsetT, rocprim::less<T>>();
     merge_path_search_test<T, OffsetT, rocprim::greater<T>>();
 }
+
+template<class Type, class BinaryFunction, uint32_t Length>
+__global__
+void thread_sort_kernel(Type* device_keys, unsigned int* device_values, BinaryFunction bin_op)
+{
+    const size_t offset = (blockIdx.x * blockDim.x + threadIdx.x) * Length;
+
+    Type         keys[Length];
+    unsigned int values[Length];
+    for(uint32_t i = 0; i < Length; i++)
+    {
+        keys[i]   = device_keys[offset + i];
+        values[i] = i;
+    }
+
+    if(device_values == nullptr)
+    {
+        rocprim::thread_sort(keys, bin_op);
+    }
+    else
+    {
+        rocprim::thread_sort_pairs(keys, values, bin_op);
+    }
+
+    for(uint32_t i = 0; i < Length; i++)
+    {
+        device_keys[offset + i] = keys[i];
+        if(device_values != nullptr)
+        {
+            device_values[offset + i] = values[i];
+        }
+    }
+}
+
+template<class T, class BinaryFunction, uint32_t Length>
+void thread_sort_test()
+{
+    SCOPED_TRACE(testing::Message() << "with length = " << Length);
+
+    static constexpr uint32_t block_size = 64;
+    static constexpr uint32_t grid_size  = 32;
+    static constexpr uint32_t size       = block_size * grid_size * Length;
+    BinaryFunction            bin_op;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Generate data, a narrow range produces many equal keys
+        std::vector<T> input = test_utils::get_random_data<T>(size, 0, 16, seed_value);
+
+        // Calculate expected results on host
+        std::vector<T> expected(input);
+        for(size_t offset = 0; offset < size; offset += Length)
+        {
+            std::sort(expected.begin() + offset, expected.begin() + offset + Length, bin_op);
+        }
+
+        // Preparing device
+        T* device_keys;
+        HIP_CHECK(test_common_utils::hipMallocHelper(reinterpret_cast<void**>(&device_keys),
+                                                     size * sizeof(T)));
+        unsigned int* device_values;
+        HIP_CHECK(test_common_utils::hipMallocHelper(reinterpret_cast<void**>(&device_values),
+                                                     size * sizeof(unsigned int)));
+
+        for(bool with_values : {false, true})
+        {
+            SCOPED_TRACE(testing::Message() << "with values = " << with_values);
+
+            HIP_CHECK(
+                hipMemcpy(device_keys, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            thread_sort_kernel<T, BinaryFunction, Length>
+                <<<grid_size, block_size>>>(device_keys,
+                                            with_values ? device_values : nullptr,
+                                            bin_op);
+            HIP_CHECK(hipGetLastError());
+
+            // Reading results back
+            std::vector<T> output(size);
+            HIP_CHECK(
+                hipMemcpy(output.data(), device_keys, size * sizeof(T), hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            if(with_values)
+            {
+                std::vector<unsigned int> values(size);
+                HIP_CHECK(hipMemcpy(values.data(),
+                                    device_values,
+                                    size * sizeof(unsigned int),
+                                    hipMemcpyDeviceToHost));
+
+                // The sort is not stable, so check that values are a permutation that
+                // follows the keys
+                for(size_t offset = 0; offset < size; offset += Length)
+                {
+                    std::vector<bool> seen(Length, false);
+                    for(uint32_t i = 0; i < Length; i++)
+                    {
+                        const unsigned int value = values[offset + i];
+                        ASSERT_LT(value, Length);
+                        ASSERT_FALSE(seen[value]);
+                        seen[value] = true;
+                        ASSERT_NO_FATAL_FAILURE(
+                            test_utils::assert_eq(input[offset + value], output[offset + i]));
+                    }
+                }
+            }
+        }
+
+        HIP_CHECK(hipFree(device_keys));
+        HIP_CHECK(hipFree(device_values));
+    }
+}
+
+TYPED_TEST(RocprimThreadOperationTests, Sort)
+{
+    using T = typename TestFixture::type;
+    thread_sort_test<T, rocprim::less<T>, 1>();
+    thread_sort_test<T, rocprim::less<T>, 2>();
+    thread_sort_test<T, rocprim::less<T>, 7>();
+    thread_sort_test<T, rocprim::less<T>, 8>();
+    thread_sort_test<T, rocprim::greater<T>, 13>();
+    thread_sort_test<T, rocprim::less<T>, 32>();
+}
@@ -0,0 +1,315 @@
+// MIT License
+//
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_store.hpp>
+#include <rocprim/device/device_scan.hpp>
+#include <rocprim/device/device_transform.hpp>
+#include <rocprim/functional.hpp>
+#include <rocprim/iterator/transform_output_iterator.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+template<class T>
+struct times_two
+{
+    ROCPRIM_HOST_DEVICE
+    T operator()(const T& value) const
+    {
+        return 2 * value;
+    }
+};
+
+template<class T>
+struct half_of
+{
+    template<class U>
+    ROCPRIM_HOST_DEVICE
+    T operator()(const U& value) const
+    {
+        return static_cast<T>(value) / 2;
+    }
+};
+
+TEST(RocprimTransformOutputIteratorTests, Arithmetic)
+{
+    using Iterator = rocprim::transform_output_iterator<int*, times_two<int>>;
+
+    int      data[16] = {};
+    Iterator x(data, times_two<int>());
+    Iterator y = x;
+    ASSERT_EQ(x, y);
+
+    x += 10;
+    for(size_t i = 0; i < 10; i++)
+    {
+        y++;
+    }
+    ASSERT_EQ(x, y);
+    ASSERT_EQ(x - Iterator(data, times_two<int>()), 10);
+    ASSERT_EQ(x.base(), data + 10);
+
+    y--;
+    ASSERT_NE(x, y);
+    ASSERT_LT(y, x);
+
+    x[3] = 7;
+    *y   = 5;
+    ASSERT_EQ(data[13], 14);
+    ASSERT_EQ(data[9], 10);
+}
+
+TEST(RocprimTransformOutputIteratorTests, Transform)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+    using U = float;
+
+    const bool  debug_synchronous = false;
+    hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<T> input = test_utils::get_random_data<T>(size, 1, 100, seed_value);
+            std::vector<U> output(input.size());
+
+            T* d_input;
+            U* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, output.size() * sizeof(U)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                input.size() * sizeof(T),
+                                hipMemcpyHostToDevice));
+
+            // Calculate expected results on host
+            std::vector<U> expected(input.size());
+            for(size_t i = 0; i < input.size(); i++)
+            {
+                expected[i] = half_of<U>()(times_two<T>()(input[i]));
+            }
+
+            // The transform is applied by the algorithm, halving by the output iterator
+            HIP_CHECK(rocprim::transform(d_input,
+                                         rocprim::make_transform_output_iterator(d_output,
+                                                                                 half_of<U>()),
+                                         input.size(),
+                                         times_two<T>(),
+                                         stream,
+                                         debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                output.size() * sizeof(U),
+                                hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+TEST(RocprimTransformOutputIteratorTests, InclusiveScan)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+    using U = double;
+
+    const bool  debug_synchronous = false;
+    hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<T> input = test_utils::get_random_data<T>(size, 0, 10, seed_value);
+            std::vector<U> output(input.size());
+
+            T* d_input;
+            U* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, output.size() * sizeof(U)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                input.size() * sizeof(T),
+                                hipMemcpyHostToDevice));
+
+            // Calculate expected results on host
+            std::vector<T> scanned(input.size());
+            test_utils::host_inclusive_scan(input.begin(),
+                                            input.end(),
+                                            scanned.begin(),
+                                            rocprim::plus<T>());
+            std::vector<U> expected(input.size());
+            for(size_t i = 0; i < input.size(); i++)
+            {
+                expected[i] = half_of<U>()(scanned[i]);
+            }
+
+            auto output_iterator = rocprim::make_transform_output_iterator(d_output, half_of<U>());
+
+            size_t temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            HIP_CHECK(rocprim::inclusive_scan(d_temp_storage,
+                                              temp_storage_size_bytes,
+                                              d_input,
+                                              output_iterator,
+                                              input.size(),
+                                              rocprim::plus<T>(),
+                                              stream,
+                                              debug_synchronous));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(rocprim::inclusive_scan(d_temp_storage,
+                                              temp_storage_size_bytes,
+                                              d_input,
+                                              output_iterator,
+                                              input.size(),
+                                              rocprim::plus<T>(),
+                                              stream,
+                                              debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                output.size() * sizeof(U),
+                                hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
+
+template<class T,
+         class U,
+         unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         rocprim::block_store_method Method>
+__global__
+__launch_bounds__(BlockSize)
+void block_store_transform_kernel(const T* device_input, U* device_output)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    const unsigned int     offset          = blockIdx.x * items_per_block;
+
+    T items[ItemsPerThread];
+    rocprim::block_load_direct_blocked(threadIdx.x, device_input + offset, items);
+
+    using block_store_type = rocprim::block_store<T, BlockSize, ItemsPerThread, Method>;
+    ROCPRIM_SHARED_MEMORY typename block_store_type::storage_type storage;
+    block_store_type().store(
+        rocprim::make_transform_output_iterator(device_output + offset, times_two<U>()),
+        items,
+        storage);
+}
+
+template<rocprim::block_store_method Method>
+void test_block_store_transform()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+    using U = int;
+
+    constexpr unsigned int block_size       = 256;
+    constexpr unsigned int items_per_thread = 4;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+    constexpr unsigned int grid_size        = 37;
+    constexpr size_t       size             = items_per_block * grid_size;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        std::vector<T> input = test_utils::get_random_data<T>(size, -1000, 1000, seed_value);
+        std::vector<U> output(size);
+
+        std::vector<U> expected(size);
+        std::transform(input.begin(), input.end(), expected.begin(), times_two<U>());
+
+        T* d_input;
+        U* d_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(U)));
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+        block_store_transform_kernel<T, U, block_size, items_per_thread, Method>
+            <<<grid_size, block_size>>>(d_input, d_output);
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(U), hipMemcpyDeviceToHost));
+
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_output));
+    }
+}
+
+TEST(RocprimTransformOutputIteratorTests, BlockStoreVectorize)
+{
+    test_block_store_transform<rocprim::block_store_method::block_store_vectorize>();
+}
+
+TEST(RocprimTransformOutputIteratorTests, BlockStoreTranspose)
+{
+    test_block_store_transform<rocprim::block_store_method::block_store_transpose>();
+}
@@ -0,0 +1,291 @@
+// MIT License
+//
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/thread/radix_key_codec.hpp>
+#include <rocprim/warp/warp_radix_sort.hpp>
+
+// required test headers
+#include "test_utils.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+template<class Key, unsigned int WarpSize, unsigned int ItemsPerThread>
+struct params
+{
+    using key_type                                 = Key;
+    static constexpr unsigned int warp_size        = WarpSize;
+    static constexpr unsigned int items_per_thread = ItemsPerThread;
+};
+
+template<class Params>
+class RocprimWarpRadixSortTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<unsigned int, 64, 4>,
+                         params<unsigned int, 32, 2>,
+                         params<int, 16, 8>,
+                         params<int, 8, 1>,
+                         params<unsigned char, 32, 4>,
+                         params<short, 64, 1>,
+                         params<unsigned long long, 32, 3>,
+                         params<float, 64, 2>,
+                         params<double, 16, 4>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimWarpRadixSortTests, Params);
+
+constexpr unsigned int block_size = 256;
+
+template<bool Descending,
+         bool StripedInput,
+         unsigned int WarpSize,
+         unsigned int ItemsPerThread,
+         class Key>
+__device__ auto warp_radix_sort_test(Key*          keys,
+                                     unsigned int* values,
+                                     unsigned int  begin_bit,
+                                     unsigned int  end_bit)
+    -> std::enable_if_t<test_utils::device_test_enabled_for_warp_size_v<WarpSize>>
+{
+    using warp_sort_type = rocprim::warp_radix_sort<Key, WarpSize, ItemsPerThread, unsigned int>;
+    constexpr unsigned int warps_per_block = block_size / WarpSize;
+    constexpr unsigned int items_per_warp  = WarpSize * ItemsPerThread;
+
+    __shared__ typename warp_sort_type::storage_type storage[warps_per_block];
+
+    const unsigned int lane    = threadIdx.x % WarpSize;
+    const unsigned int warp_id = threadIdx.x / WarpSize;
+    const unsigned int offset  = (blockIdx.x * warps_per_block + warp_id) * items_per_warp;
+
+    Key          thread_keys[ItemsPerThread];
+    unsigned int thread_values[ItemsPerThread];
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        const unsigned int index
+            = offset + (StripedInput ? i * WarpSize + lane : lane * ItemsPerThread + i);
+        thread_keys[i]   = keys[index];
+        thread_values[i] = values[index];
+    }
+
+    if(Descending && StripedInput)
+    {
+        warp_sort_type().sort_desc_from_striped(thread_keys,
+                                                thread_values,
+                                                storage[warp_id],
+                                                begin_bit,
+                                                end_bit);
+    }
+    else if(StripedInput)
+    {
+        warp_sort_type().sort_from_striped(thread_keys,
+                                           thread_values,
+                                           storage[warp_id],
+                                           begin_bit,
+                                           end_bit);
+    }
+    else if(Descending)
+    {
+        warp_sort_type().sort_desc(thread_keys,
+                                   thread_values,
+                                   storage[warp_id],
+                                   begin_bit,
+                                   end_bit);
+    }
+    else
+    {
+        warp_sort_type().sort(thread_keys, thread_values, storage[warp_id], begin_bit, end_bit);
+    }
+
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        const unsigned int index = offset + lane * ItemsPerThread + i;
+        keys[index]              = thread_keys[i];
+        values[index]            = thread_values[i];
+    }
+}
+
+template<bool Descending,
+         bool StripedInput,
+         unsigned int WarpSize,
+         unsigned int ItemsPerThread,
+         class Key>
+__device__ auto warp_radix_sort_test(Key*, unsigned int*, unsigned int, unsigned int)
+    -> std::enable_if_t<!test_utils::device_test_enabled_for_warp_size_v<WarpSize>>
+{}
+
+template<bool Descending,
+         bool StripedInput,
+         unsigned int WarpSize,
+         unsigned int ItemsPerThread,
+         class Key>
+__global__ __launch_bounds__(block_size) void warp_radix_sort_kernel(Key*          keys,
+                                                                     unsigned int* values,
+                                                                     unsigned int  begin_bit,
+                                                                     unsigned int  end_bit)
+{
+    warp_radix_sort_test<Descending, StripedInput, WarpSize, ItemsPerThread>(keys,
+                                                                            values,
+                                                                            begin_bit,
+                                                                            end_bit);
+}
+
+template<bool Descending, bool StripedInput, class Params>
+void test_warp_radix_sort(unsigned int begin_bit = 0,
+                          unsigned int end_bit   = 8 * sizeof(typename Params::key_type))
+{
+    using key_type                          = typename Params::key_type;
+    constexpr unsigned int warp_size        = Params::warp_size;
+    constexpr unsigned int items_per_thread = Params::items_per_thread;
+    constexpr unsigned int items_per_warp   = warp_size * items_per_thread;
+    using key_codec                         = rocprim::radix_key_codec<key_type, Descending>;
+
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+    SKIP_IF_UNSUPPORTED_WARP_SIZE(warp_size, device_id);
+
+    SCOPED_TRACE(testing::Message() << "with begin_bit = " << begin_bit);
+    SCOPED_TRACE(testing::Message() << "with end_bit = " << end_bit);
+
+    constexpr unsigned int grid_size = 4;
+    constexpr size_t       size      = grid_size * block_size * items_per_thread;
+
+    key_type*     d_keys;
+    unsigned int* d_values;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, size * sizeof(key_type)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, size * sizeof(unsigned int)));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Many equal keys, so the values check that the sort is stable
+        const key_type min_key = std::is_integral<key_type>::value
+                                     ? test_utils::numeric_limits<key_type>::lowest()
+                                     : key_type(-1000);
+        const key_type max_key = std::is_integral<key_type>::value
+                                     ? test_utils::numeric_limits<key_type>::max()
+                                     : key_type(1000);
+        std::vector<key_type> keys
+            = test_utils::get_random_data<key_type>(size, min_key, max_key, seed_value);
+        for(size_t i = 0; i < size; i += 3)
+        {
+            keys[i] = keys[i / items_per_warp * items_per_warp];
+        }
+        std::vector<unsigned int> values(size);
+        std::iota(values.begin(), values.end(), 0u);
+
+        // Equal keys keep the order of the input in memory
+        std::vector<unsigned int> expected_values(values);
+        for(size_t offset = 0; offset < size; offset += items_per_warp)
+        {
+            std::stable_sort(expected_values.begin() + offset,
+                             expected_values.begin() + offset + items_per_warp,
+                             [&](const unsigned int a, const unsigned int b)
+                             {
+                                 const auto digit_a
+                                     = key_codec::extract_digit(key_codec::encode(keys[a]),
+                                                                begin_bit,
+                                                                end_bit - begin_bit);
+                                 const auto digit_b
+                                     = key_codec::extract_digit(key_codec::encode(keys[b]),
+                                                                begin_bit,
+                                                                end_bit - begin_bit);
+                                 return digit_a < digit_b;
+                             });
+        }
+        std::vector<key_type> expected_keys(size);
+        for(size_t i = 0; i < size; ++i)
+        {
+            expected_keys[i] = keys[expected_values[i]];
+        }
+
+        HIP_CHECK(
+            hipMemcpy(d_keys, keys.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_values,
+                            values.data(),
+                            size * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+
+        warp_radix_sort_kernel<Descending, StripedInput, warp_size, items_per_thread>
+            <<<grid_size, block_size>>>(d_keys, d_values, begin_bit, end_bit);
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<key_type> output_keys(size);
+        HIP_CHECK(hipMemcpy(output_keys.data(),
+                            d_keys,
+                            size * sizeof(key_type),
+                            hipMemcpyDeviceToHost));
+        std::vector<unsigned int> output_values(size);
+        HIP_CHECK(hipMemcpy(output_values.data(),
+                            d_values,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_bit_eq(output_keys, expected_keys));
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output_values, expected_values));
+    }
+
+    HIP_CHECK(hipFree(d_keys));
+    HIP_CHECK(hipFree(d_values));
+}
+
+TYPED_TEST(RocprimWarpRadixSortTests, Sort)
+{
+    test_warp_radix_sort<false, false, typename TestFixture::params>();
+}
+
+TYPED_TEST(RocprimWarpRadixSortTests, SortDesc)
+{
+    test_warp_radix_sort<true, false, typename TestFixture::params>();
+}
+
+TYPED_TEST(RocprimWarpRadixSortTests, SortFromStriped)
+{
+    test_warp_radix_sort<false, true, typename TestFixture::params>();
+}
+
+TYPED_TEST(RocprimWarpRadixSortTests, SortDescFromStriped)
+{
+    test_warp_radix_sort<true, true, typename TestFixture::params>();
+}
+
+TYPED_TEST(RocprimWarpRadixSortTests, SortBitRange)
+{
+    using key_type              = typename TestFixture::params::key_type;
+    constexpr unsigned int bits = 8 * sizeof(key_type);
+    test_warp_radix_sort<false, false, typename TestFixture::params>(bits / 4, bits - bits / 4);
+    test_warp_radix_sort<true, true, typename TestFixture::params>(1, bits / 2 + 1);
+    test_warp_radix_sort<false, true, typename TestFixture::params>(3, 3);
+}
@@ -0,0 +1,379 @@
+// MIT License
+//
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/functional.hpp>
+#include <rocprim/warp/warp_reduce_by_key.hpp>
+#include <rocprim/warp/warp_segmented_scan.hpp>
+
+// required test headers
+#include "test_utils.hpp"
+
+#include <random>
+#include <type_traits>
+#include <vector>
+
+template<class T, unsigned int WarpSize>
+struct params
+{
+    using type                              = T;
+    static constexpr unsigned int warp_size = WarpSize;
+};
+
+template<class Params>
+class RocprimWarpSegmentedTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<int, 2>,
+                         params<int, 4>,
+                         params<int, 16>,
+                         params<int, 32>,
+                         params<int, 64>,
+                         params<unsigned long long, 8>,
+                         params<double, 32>,
+                         params<test_utils::custom_test_type<int>, 16>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimWarpSegmentedTests, Params);
+
+enum class scan_method
+{
+    head_inclusive,
+    tail_inclusive,
+    head_exclusive,
+    tail_exclusive
+};
+
+constexpr unsigned int block_size = 256;
+
+template<scan_method Method, unsigned int WarpSize, class T>
+__device__ auto warp_segmented_scan_test(const T* input, const unsigned char* flags, T* output)
+    -> std::enable_if_t<test_utils::device_test_enabled_for_warp_size_v<WarpSize>>
+{
+    using warp_scan_type = rocprim::warp_segmented_scan<T, WarpSize>;
+
+    const unsigned int index = blockIdx.x * block_size + threadIdx.x;
+    const T            value = input[index];
+    const bool         flag  = flags[index] != 0;
+    const T            init  = T(10);
+
+    T result;
+    switch(Method)
+    {
+        case scan_method::head_inclusive:
+            warp_scan_type().head_segmented_inclusive_scan(value, result, flag);
+            break;
+        case scan_method::tail_inclusive:
+            warp_scan_type().tail_segmented_inclusive_scan(value, result, flag);
+            break;
+        case scan_method::head_exclusive:
+            warp_scan_type().head_segmented_exclusive_scan(value, result, init, flag);
+            break;
+        case scan_method::tail_exclusive:
+            warp_scan_type().tail_segmented_exclusive_scan(value, result, init, flag);
+            break;
+    }
+    output[index] = result;
+}
+
+template<scan_method Method, unsigned int WarpSize, class T>
+__device__ auto warp_segmented_scan_test(const T*, const unsigned char*, T*)
+    -> std::enable_if_t<!test_utils::device_test_enabled_for_warp_size_v<WarpSize>>
+{}
+
+template<scan_method Method, unsigned int WarpSize, class T>
+__global__ __launch_bounds__(block_size) void warp_segmented_scan_kernel(
+    const T* input, const unsigned char* flags, T* output)
+{
+    warp_segmented_scan_test<Method, WarpSize>(input, flags, output);
+}
+
+template<scan_method Method, class Params>
+void test_warp_segmented_scan()
+{
+    using T                          = typename Params::type;
+    constexpr unsigned int warp_size = Params::warp_size;
+    constexpr bool         is_head
+        = Method == scan_method::head_inclusive || Method == scan_method::head_exclusive;
+    constexpr bool is_inclusive
+        = Method == scan_method::head_inclusive || Method == scan_method::tail_inclusive;
+
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+    SKIP_IF_UNSUPPORTED_WARP_SIZE(warp_size, device_id);
+
+    constexpr size_t size = block_size * 8;
+
+    T*             d_input;
+    unsigned char* d_flags;
+    T*             d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_flags, size));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+        // Short segments of 1 to 8 items on average
+        std::default_random_engine                  gen(seed_value);
+        std::uniform_int_distribution<unsigned int> segment_dis(1, 8);
+        std::vector<unsigned char>                  flags(size);
+        for(size_t i = 0; i < size; ++i)
+        {
+            flags[i] = gen() % segment_dis(gen) == 0;
+        }
+
+        std::vector<T> expected(size);
+        for(size_t warp_begin = 0; warp_begin < size; warp_begin += warp_size)
+        {
+            T accumulator = T(0);
+            for(size_t i = warp_begin; i < warp_begin + warp_size; ++i)
+            {
+                const bool segment_begin
+                    = i == warp_begin || (is_head ? flags[i] : flags[i - 1]);
+                if(is_inclusive)
+                {
+                    accumulator = segment_begin ? input[i] : T(accumulator + input[i]);
+                    expected[i] = accumulator;
+                }
+                else
+                {
+                    accumulator = segment_begin ? T(10) : accumulator;
+                    expected[i] = accumulator;
+                    accumulator = accumulator + input[i];
+                }
+            }
+        }
+
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_flags, flags.data(), size, hipMemcpyHostToDevice));
+
+        warp_segmented_scan_kernel<Method, warp_size>
+            <<<size / block_size, block_size>>>(d_input, d_flags, d_output);
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<T> output(size);
+        HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+    }
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_flags));
+    HIP_CHECK(hipFree(d_output));
+}
+
+TYPED_TEST(RocprimWarpSegmentedTests, HeadSegmentedInclusiveScan)
+{
+    test_warp_segmented_scan<scan_method::head_inclusive, typename TestFixture::params>();
+}
+
+TYPED_TEST(RocprimWarpSegmentedTests, TailSegmentedInclusiveScan)
+{
+    test_warp_segmented_scan<scan_method::tail_inclusive, typename TestFixture::params>();
+}
+
+TYPED_TEST(RocprimWarpSegmentedTests, HeadSegmentedExclusiveScan)
+{
+    test_warp_segmented_scan<scan_method::head_exclusive, typename TestFixture::params>();
+}
+
+TYPED_TEST(RocprimWarpSegmentedTests, TailSegmentedExclusiveScan)
+{
+    test_warp_segmented_scan<scan_method::tail_exclusive, typename TestFixture::params>();
+}
+
+template<unsigned int WarpSize, class T>
+__device__ auto warp_reduce_by_key_test(const int*          keys,
+                                        const T*            values,
+                                        const unsigned int* valid_items,
+                                        int*                unique_keys,
+                                        T*                  aggregates,
+                                        unsigned int*       segments)
+    -> std::enable_if_t<test_utils::device_test_enabled_for_warp_size_v<WarpSize>>
+{
+    using warp_rbk_type = rocprim::warp_reduce_by_key<int, T, WarpSize>;
+
+    const unsigned int index   = blockIdx.x * block_size + threadIdx.x;
+    const unsigned int warp_id = index / WarpSize;
+
+    int                unique_key;
+    T                  aggregate;
+    const unsigned int count = warp_rbk_type().reduce_by_key(keys[index],
+                                                             values[index],
+                                                             valid_items[warp_id],
+                                                             unique_key,
+                                                             aggregate);
+    if(threadIdx.x % WarpSize < count)
+    {
+        unique_keys[index] = unique_key;
+        aggregates[index]  = aggregate;
+    }
+    if(threadIdx.x % WarpSize == 0)
+    {
+        segments[warp_id] = count;
+    }
+}
+
+template<unsigned int WarpSize, class T>
+__device__ auto warp_reduce_by_key_test(
+    const int*, const T*, const unsigned int*, int*, T*, unsigned int*)
+    -> std::enable_if_t<!test_utils::device_test_enabled_for_warp_size_v<WarpSize>>
+{}
+
+template<unsigned int WarpSize, class T>
+__global__ __launch_bounds__(block_size) void warp_reduce_by_key_kernel(
+    const int*          keys,
+    const T*            values,
+    const unsigned int* valid_items,
+    int*                unique_keys,
+    T*                  aggregates,
+    unsigned int*       segments)
+{
+    warp_reduce_by_key_test<WarpSize>(keys, values, valid_items, unique_keys, aggregates, segments);
+}
+
+TYPED_TEST(RocprimWarpSegmentedTests, ReduceByKey)
+{
+    using T                          = typename TestFixture::params::type;
+    constexpr unsigned int warp_size = TestFixture::params::warp_size;
+
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+    SKIP_IF_UNSUPPORTED_WARP_SIZE(warp_size, device_id);
+
+    constexpr size_t size  = block_size * 8;
+    constexpr size_t warps = size / warp_size;
+
+    int*          d_keys;
+    T*            d_values;
+    unsigned int* d_valid_items;
+    int*          d_unique_keys;
+    T*            d_aggregates;
+    unsigned int* d_segments;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, size * sizeof(int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_valid_items, warps * sizeof(unsigned int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_unique_keys, size * sizeof(int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_aggregates, size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_segments, warps * sizeof(unsigned int)));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        std::vector<T> values = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+
+        // Runs of random length, consecutive runs may have the same key
+        std::default_random_engine                  gen(seed_value);
+        std::uniform_int_distribution<unsigned int> run_dis(1, 6);
+        std::uniform_int_distribution<unsigned int> valid_dis(1, warp_size);
+        std::vector<int>                            keys;
+        while(keys.size() < size)
+        {
+            keys.insert(keys.end(), run_dis(gen), static_cast<int>(gen() % 3));
+        }
+        keys.resize(size);
+        std::vector<unsigned int> valid_items(warps);
+        for(size_t w = 0; w < warps; ++w)
+        {
+            valid_items[w] = w % 2 == 0 ? warp_size : valid_dis(gen);
+        }
+
+        HIP_CHECK(hipMemcpy(d_keys, keys.data(), size * sizeof(int), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_values, values.data(), size * sizeof(T), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_valid_items,
+                            valid_items.data(),
+                            warps * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+
+        warp_reduce_by_key_kernel<warp_size><<<size / block_size, block_size>>>(d_keys,
+                                                                                d_values,
+                                                                                d_valid_items,
+                                                                                d_unique_keys,
+                                                                                d_aggregates,
+                                                                                d_segments);
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<int>          unique_keys(size);
+        std::vector<T>            aggregates(size);
+        std::vector<unsigned int> segments(warps);
+        HIP_CHECK(
+            hipMemcpy(unique_keys.data(), d_unique_keys, size * sizeof(int), hipMemcpyDeviceToHost));
+        HIP_CHECK(
+            hipMemcpy(aggregates.data(), d_aggregates, size * sizeof(T), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(segments.data(),
+                            d_segments,
+                            warps * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+
+        for(size_t w = 0; w < warps; ++w)
+        {
+            SCOPED_TRACE(testing::Message() << "with warp = " << w);
+
+            const size_t     warp_begin = w * warp_size;
+            std::vector<int> expected_keys;
+            std::vector<T>   expected_aggregates;
+            for(size_t i = warp_begin; i < warp_begin + valid_items[w]; ++i)
+            {
+                if(i == warp_begin || keys[i] != keys[i - 1])
+                {
+                    expected_keys.push_back(keys[i]);
+                    expected_aggregates.push_back(values[i]);
+                }
+                else
+                {
+                    expected_aggregates.back() = expected_aggregates.back() + values[i];
+                }
+            }
+
+            ASSERT_EQ(segments[w], expected_keys.size());
+            for(size_t j = 0; j < expected_keys.size(); ++j)
+            {
+                ASSERT_EQ(unique_keys[warp_begin + j], expected_keys[j]);
+                ASSERT_EQ(aggregates[warp_begin + j], expected_aggregates[j]);
+            }
+        }
+    }
+
+    HIP_CHECK(hipFree(d_keys));
+    HIP_CHECK(hipFree(d_values));
+    HIP_CHECK(hipFree(d_valid_items));
+    HIP_CHECK(hipFree(d_unique_keys));
+    HIP_CHECK(hipFree(d_aggregates));
+    HIP_CHECK(hipFree(d_segments));
+}
@@ -23,6 +23,8 @@
 #include "../common_test_header.hpp"
 
 // required rocprim headers
+#include <rocprim/block/block_load.hpp>
+#include <rocprim/block/block_store.hpp>
 #include <rocprim/device/device_reduce.hpp>
 #include <rocprim/device/device_transform.hpp>
 #include <rocprim/iterator/counting_iterator.hpp>
@@ -450,3 +452,151 @@ TEST(RocprimZipIteratorTests, TransformReduce)
     }
 
 }
+
+template<class T1,
+         class T2,
+         class T3,
+         unsigned int                BlockSize,
+         unsigned int                ItemsPerThread,
+         rocprim::block_load_method  LoadMethod,
+         rocprim::block_store_method StoreMethod>
+__global__
+__launch_bounds__(BlockSize)
+void zip_block_load_store_kernel(
+    T1* input1, T2* input2, T3* input3, T1* output1, T2* output2, T3* output3)
+{
+    using T = rocprim::tuple<T1, T2, T3>;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    const unsigned int     offset          = blockIdx.x * items_per_block;
+
+    T items[ItemsPerThread];
+    using block_load_type  = rocprim::block_load<T, BlockSize, ItemsPerThread, LoadMethod>;
+    using block_store_type = rocprim::block_store<T, BlockSize, ItemsPerThread, StoreMethod>;
+    ROCPRIM_SHARED_MEMORY union
+    {
+        typename block_load_type::storage_type  load;
+        typename block_store_type::storage_type store;
+    } storage;
+
+    block_load_type().load(
+        rocprim::make_zip_iterator(rocprim::make_tuple(input1, input2, input3)) + offset,
+        items,
+        storage.load);
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        rocprim::get<0>(items[i]) += T1(1);
+    }
+    rocprim::syncthreads();
+    block_store_type().store(
+        rocprim::make_zip_iterator(rocprim::make_tuple(output1, output2, output3)) + offset,
+        items,
+        storage.store);
+}
+
+template<class T1,
+         class T2,
+         class T3,
+         rocprim::block_load_method  LoadMethod,
+         rocprim::block_store_method StoreMethod>
+void test_zip_block_load_store()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    constexpr unsigned int block_size       = 256;
+    constexpr unsigned int items_per_thread = 4;
+    constexpr unsigned int grid_size        = 29;
+    constexpr size_t       size             = block_size * items_per_thread * grid_size;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        std::vector<T1> input1 = test_utils::get_random_data<T1>(size, 1, 100, seed_value);
+        std::vector<T2> input2 = test_utils::get_random_data<T2>(size, 1, 50, seed_value + 1);
+        std::vector<T3> input3 = test_utils::get_random_data<T3>(size, 1, 10, seed_value + 2);
+
+        T1* d_input1;
+        T2* d_input2;
+        T3* d_input3;
+        T1* d_output1;
+        T2* d_output2;
+        T3* d_output3;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input1, size * sizeof(T1)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input2, size * sizeof(T2)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input3, size * sizeof(T3)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output1, size * sizeof(T1)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output2, size * sizeof(T2)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output3, size * sizeof(T3)));
+        HIP_CHECK(hipMemcpy(d_input1, input1.data(), size * sizeof(T1), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_input2, input2.data(), size * sizeof(T2), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_input3, input3.data(), size * sizeof(T3), hipMemcpyHostToDevice));
+
+        zip_block_load_store_kernel<T1,
+                                    T2,
+                                    T3,
+                                    block_size,
+                                    items_per_thread,
+                                    LoadMethod,
+                                    StoreMethod>
+            <<<grid_size, block_size>>>(d_input1,
+                                        d_input2,
+                                        d_input3,
+                                        d_output1,
+                                        d_output2,
+                                        d_output3);
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<T1> output1(size);
+        std::vector<T2> output2(size);
+        std::vector<T3> output3(size);
+        HIP_CHECK(hipMemcpy(output1.data(), d_output1, size * sizeof(T1), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(output2.data(), d_output2, size * sizeof(T2), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(output3.data(), d_output3, size * sizeof(T3), hipMemcpyDeviceToHost));
+
+        for(auto& value : input1)
+        {
+            value += T1(1);
+        }
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output1, input1));
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output2, input2));
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output3, input3));
+
+        HIP_CHECK(hipFree(d_input1));
+        HIP_CHECK(hipFree(d_input2));
+        HIP_CHECK(hipFree(d_input3));
+        HIP_CHECK(hipFree(d_output1));
+        HIP_CHECK(hipFree(d_output2));
+        HIP_CHECK(hipFree(d_output3));
+    }
+}
+
+TEST(RocprimZipIteratorTests, BlockLoadStoreVectorize)
+{
+    test_zip_block_load_store<int,
+                              double,
+                              unsigned char,
+                              rocprim::block_load_method::block_load_vectorize,
+                              rocprim::block_store_method::block_store_vectorize>();
+    // Columns of a custom type
+    test_zip_block_load_store<short,
+                              float,
+                              test_utils::custom_test_type<int>,
+                              rocprim::block_load_method::block_load_vectorize,
+                              rocprim::block_store_method::block_store_vectorize>();
+}
+
+TEST(RocprimZipIteratorTests, BlockLoadStoreTranspose)
+{
+    test_zip_block_load_store<int,
+                              double,
+                              unsigned char,
+                              rocprim::block_load_method::block_load_transpose,
+                              rocprim::block_store_method::block_store_transpose>();
+}